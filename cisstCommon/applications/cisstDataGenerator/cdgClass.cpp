@@ -62,6 +62,12 @@ cdgClass::cdgClass(size_t lineNumber):
     field->AddPossibleValue("declaration-only");
     field->AddPossibleValue("false");
 
+    field = this->AddField("binary-buffer", "false", false,
+                           "generate the code to serialize/de-serialize in binary format using a user provided buffer, all base classes and members must support cmnData buffer functions");
+    CMN_ASSERT(field);
+    field->AddPossibleValue("true");
+    field->AddPossibleValue("false");
+
     this->AddKnownScope(*this);
 
     cdgBaseClass newBaseClass(0);
@@ -287,8 +293,13 @@ void cdgClass::GenerateDataMethodsHeader(std::ostream & outputStream) const
                  << "#if CISST_HAS_JSON" << std::endl
                  << "    void SerializeTextJSON(Json::Value & jsonValue) const" << overrides << ";" << std::endl
                  << "    void DeSerializeTextJSON(const Json::Value & jsonValue) CISST_THROW(std::runtime_error)" << overrides << ";" << std::endl
-                 << "#endif // CISST_HAS_JSON" << std::endl
-                 << std::endl;
+                 << "#endif // CISST_HAS_JSON" << std::endl;
+    if (this->GetFieldValue("binary-buffer") == "true") {
+        outputStream << "    size_t SerializeBinaryByteSize(void) const" << overrides << ";" << std::endl
+                     << "    size_t SerializeBinaryBuffer(char * buffer, size_t bufferSize) const" << overrides << ";" << std::endl
+                     << "    size_t DeSerializeBinaryBuffer(const char * buffer, size_t bufferSize, const cmnDataFormat & localFormat, const cmnDataFormat & remoteFormat)" << overrides << ";" << std::endl;
+    }
+    outputStream << std::endl;
 }
 
 
@@ -537,8 +548,19 @@ void cdgClass::GenerateDataFunctionsHeader(std::ostream & outputStream) const
                  << "    }" << std::endl
                  << "    static void DeSerializeBinary(DataType & data, std::istream & inputStream, const cmnDataFormat & localFormat, const cmnDataFormat & remoteFormat) CISST_THROW(std::runtime_error) {" << std::endl
                  << "        data.DeSerializeBinary(inputStream, localFormat, remoteFormat);" << std::endl
-                 << "    }" << std::endl
-                 << "    static void SerializeText(const DataType & data, std::ostream & outputStream, const char delimiter = ',') CISST_THROW(std::runtime_error) {" << std::endl
+                 << "    }" << std::endl;
+    if (this->GetFieldValue("binary-buffer") == "true") {
+        outputStream << "    static size_t SerializeBinaryByteSize(const DataType & data) {" << std::endl
+                     << "        return data.SerializeBinaryByteSize();" << std::endl
+                     << "    }" << std::endl
+                     << "    static size_t SerializeBinary(const DataType & data, char * buffer, size_t bufferSize) {" << std::endl
+                     << "        return data.SerializeBinaryBuffer(buffer, bufferSize);" << std::endl
+                     << "    }" << std::endl
+                     << "    static size_t DeSerializeBinary(DataType & data, const char * buffer, size_t bufferSize, const cmnDataFormat & localFormat, const cmnDataFormat & remoteFormat) {" << std::endl
+                     << "        return data.DeSerializeBinaryBuffer(buffer, bufferSize, localFormat, remoteFormat);" << std::endl
+                     << "    }" << std::endl;
+    }
+    outputStream << "    static void SerializeText(const DataType & data, std::ostream & outputStream, const char delimiter = ',') CISST_THROW(std::runtime_error) {" << std::endl
                  << "        data.SerializeText(outputStream, delimiter);" << std::endl
                  << "    }" << std::endl
                  << "    static void DeSerializeText(DataType & data, std::istream & inputStream, const char delimiter = ',') CISST_THROW(std::runtime_error) {" << std::endl
@@ -654,6 +676,91 @@ void cdgClass::GenerateDataFunctionsCode(std::ostream & outputStream) const
 
 
 
+    if (this->GetFieldValue("binary-buffer") == "true") {
+        outputStream << "size_t " << className << "::SerializeBinaryByteSize(void) const {" << std::endl
+                     << "    size_t size__cdg = 0;" << std::endl;
+        for (index = 0; index < BaseClasses.size(); index++) {
+            if (BaseClasses[index]->GetFieldValue("is-data") == "true") {
+                type = BaseClasses[index]->GetFieldValue("type");
+                outputStream << "    size__cdg += cmnData<" << type << " >::SerializeBinaryByteSize(*this);" << std::endl;
+            }
+        }
+        for (index = 0; index < Members.size(); index++) {
+            if (Members[index]->GetFieldValue("is-data") == "true") {
+                type = Members[index]->GetFieldValue("type");
+                name = Members[index]->MemberName;
+                outputStream << "    size__cdg += cmnData<" << type << " >::SerializeBinaryByteSize(this->" << name << ");" << std::endl;
+            }
+        }
+        outputStream << "    return size__cdg;" << std::endl
+                     << "}" << std::endl;
+
+        // each element returns the number of bytes used, 0 if the buffer is too small
+        outputStream << "size_t " << className << "::SerializeBinaryBuffer(char * " << CMN_UNUSED_wrapped("buffer__cdg")
+                     << ", size_t " << CMN_UNUSED_wrapped("bufferSize__cdg") << ") const {" << std::endl
+                     << SkipIfEmpty("    size_t bytes__cdg;\n")
+                     << "    size_t total__cdg = 0;" << std::endl;
+        for (index = 0; index < BaseClasses.size(); index++) {
+            if (BaseClasses[index]->GetFieldValue("is-data") == "true") {
+                type = BaseClasses[index]->GetFieldValue("type");
+                outputStream << "    bytes__cdg = cmnData<" << type << " >::SerializeBinary(*this, buffer__cdg + total__cdg, bufferSize__cdg - total__cdg);" << std::endl
+                             << "    if (bytes__cdg == 0) {" << std::endl
+                             << "        return 0;" << std::endl
+                             << "    }" << std::endl
+                             << "    total__cdg += bytes__cdg;" << std::endl;
+            }
+        }
+        for (index = 0; index < Members.size(); index++) {
+            if (Members[index]->GetFieldValue("is-data") == "true") {
+                type = Members[index]->GetFieldValue("type");
+                name = Members[index]->MemberName;
+                outputStream << "    bytes__cdg = cmnData<" << type << " >::SerializeBinary(this->" << name << ", buffer__cdg + total__cdg, bufferSize__cdg - total__cdg);" << std::endl
+                             << "    if (bytes__cdg == 0) {" << std::endl
+                             << "        return 0;" << std::endl
+                             << "    }" << std::endl
+                             << "    total__cdg += bytes__cdg;" << std::endl;
+            }
+        }
+        outputStream << "    return total__cdg;" << std::endl
+                     << "}" << std::endl;
+
+        outputStream << "size_t " << className << "::DeSerializeBinaryBuffer(const char * " << CMN_UNUSED_wrapped("buffer__cdg")
+                     << ", size_t " << CMN_UNUSED_wrapped("bufferSize__cdg") << "," << std::endl
+                     << "                                            const cmnDataFormat & " << CMN_UNUSED_wrapped("localFormat") << "," << std::endl
+                     << "                                            const cmnDataFormat & " << CMN_UNUSED_wrapped("remoteFormat") << ") {" << std::endl
+                     << SkipIfEmpty("    size_t bytes__cdg;\n")
+                     << "    size_t total__cdg = 0;" << std::endl;
+        for (index = 0; index < BaseClasses.size(); index++) {
+            if (BaseClasses[index]->GetFieldValue("is-data") == "true") {
+                type = BaseClasses[index]->GetFieldValue("type");
+                outputStream << "    bytes__cdg = cmnData<" << type << " >::DeSerializeBinary(*this, buffer__cdg + total__cdg, bufferSize__cdg - total__cdg, localFormat, remoteFormat);" << std::endl
+                             << "    if (bytes__cdg == 0) {" << std::endl
+                             << "        return 0;" << std::endl
+                             << "    }" << std::endl
+                             << "    total__cdg += bytes__cdg;" << std::endl;
+            }
+        }
+        for (index = 0; index < Members.size(); index++) {
+            if (Members[index]->GetFieldValue("is-data") == "true") {
+                type = Members[index]->GetFieldValue("type");
+                name = Members[index]->MemberName;
+                if (Members[index]->GetFieldValue("is-size_t") == "true") {
+                    outputStream << "    bytes__cdg = cmnDataDeSerializeBinary_size_t(this->" << name << ", buffer__cdg + total__cdg, bufferSize__cdg - total__cdg, localFormat, remoteFormat);" << std::endl;
+                } else {
+                    outputStream << "    bytes__cdg = cmnData<" << type << " >::DeSerializeBinary(this->" << name << ", buffer__cdg + total__cdg, bufferSize__cdg - total__cdg, localFormat, remoteFormat);" << std::endl;
+                }
+                outputStream << "    if (bytes__cdg == 0) {" << std::endl
+                             << "        return 0;" << std::endl
+                             << "    }" << std::endl
+                             << "    total__cdg += bytes__cdg;" << std::endl;
+            }
+        }
+        outputStream << "    return total__cdg;" << std::endl
+                     << "}" << std::endl;
+    }
+
+
+
     outputStream << "void " << className << "::SerializeText(std::ostream & " << CMN_UNUSED_wrapped("outputStream__cdg")
                  << ", const char " << CMN_UNUSED_wrapped("delimiter__cdg") << ") const CISST_THROW(std::runtime_error) {" << std::endl;
     outputStream << SkipIfEmpty("    bool someData__cdg = false;\n");
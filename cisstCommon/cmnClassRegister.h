@@ -37,7 +37,9 @@ http://www.cisst.org/cisst/license.txt.
 #include <sstream>
 #include <string>
 #include <map>
+#include <typeindex>
 #include <typeinfo>
+#include <unordered_map>
 #include <fstream>
 
 #include <cisstCommon/cmnExport.h>
@@ -114,6 +116,21 @@ class CISST_EXPORT cmnClassRegister {
     /*! List of class services registered. */
     ServicesContainerType ServicesContainer;
 
+ public:
+    /*! Type used for the hash of class names, see NameHash. */
+    typedef unsigned long long NameHashType;
+
+ private:
+    /*! Indices of the class services by name hash and by
+      std::type_info.  Classes whose name hash collides with an
+      already registered class are not indexed by hash. */
+    //@{
+    typedef std::unordered_map<NameHashType, cmnClassServicesBase *> HashContainerType;
+    HashContainerType HashContainer;
+    typedef std::unordered_map<std::type_index, cmnClassServicesBase *> TypeInfoContainerType;
+    TypeInfoContainerType TypeInfoContainer;
+    //@}
+
  public:
     /*!
       Instance specific implementation of FindClassServices.
@@ -129,6 +146,12 @@ class CISST_EXPORT cmnClassRegister {
     */
     cmnClassServicesBase * FindClassServicesInstance(const std::type_info & typeInfo);
 
+    /*!
+      Instance specific implementation of FindClassServices.
+      \sa FindClassServices
+    */
+    cmnClassServicesBase * FindClassServicesInstance(const NameHashType nameHash) const;
+
     /*! Instance specific implementation of Register.
       \sa Register */
     const std::string *
@@ -293,6 +316,24 @@ protected:
         return Instance()->FindClassServicesInstance(typeInfo);
     }
 
+    /*! Get the class services by hash of the class name, see
+      NameHash and cmnClassServicesBase::GetNameHash.  This doesn't
+      require any string comparison.  Returns null if no class with
+      this name hash is registered.
+
+      \param nameHash The hash to look up.
+      \return The pointer to the cmnClassServicesBase object
+      corresponding to the hash, or null if not registered.
+    */
+    static inline cmnClassServicesBase * FindClassServices(const NameHashType nameHash) {
+        return Instance()->FindClassServicesInstance(nameHash);
+    }
+
+    /*! Hash of a class name (64 bits FNV-1a).  The hash only depends
+      on the name so it is the same for all processes and can be used
+      to identify a class between processes. */
+    static NameHashType NameHash(const std::string & className);
+
 
     /*! Dynamic creation of objects using the default constructor.
 
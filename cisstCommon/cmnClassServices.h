@@ -35,6 +35,15 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstCommon/cmnLogger.h>
 #include <cisstCommon/cmnClassRegisterMacros.h>
 
+/*! Memory for a new object of type _class, allocated from the pool
+  of the class services if any (see cmnClassServicesBase::SetPool),
+  otherwise from the heap.  Used by the factories with the placement
+  new, objects are released by cmnGenericObject::operator delete. */
+template <class _class>
+inline void * cmnClassServicesAllocate(void) {
+    return _class::ClassServices()->Allocate(sizeof(_class));
+}
+
 /*! These classes are helpers for cmnClassServices.  Their goal is to
   specialize the various Create methods based on the first template parameter
   to either create a new object of type _class or do nothing and return 0 (null pointer).
@@ -76,11 +85,11 @@ class cmnConditionalObjectFactoryDefault<true, _class>
 public:
 
     /*! Specialization of create when dynamic creation is
-      enabled.  Call new for the given class.  This method
-      requires a default constructor for the aforementioned
-      class. */
+      enabled.  Call new for the given class, using the class pool
+      if any.  This method requires a default constructor for the
+      aforementioned class. */
     inline static cmnGenericObject * Create(void) {
-        return new value_type;
+        return new(cmnClassServicesAllocate<value_type>()) value_type;
     }
 
     /*! Specialization of create when dynamic creation is
@@ -136,12 +145,13 @@ public:
     typedef _class * pointer;
 
     /*! Specialization of create(other) when dynamic creation is
-      enabled.  Call new for the given class.  This method
-      requires a copy constructor for the aforementioned class. */
+      enabled.  Call new for the given class, using the class pool
+      if any.  This method requires a copy constructor for the
+      aforementioned class. */
     inline static cmnGenericObject * Create(const cmnGenericObject & other) {
         const value_type * otherPointer = dynamic_cast<const value_type *>(&other);
         if (otherPointer)
-            return new value_type(*otherPointer);
+            return new(cmnClassServicesAllocate<value_type>()) value_type(*otherPointer);
         else
             return 0;
     }
@@ -229,7 +239,7 @@ public:
     inline static _class * Create(const cmnGenericObject & arg) {
         const _argType *argTyped = dynamic_cast<const _argType *>(&arg);
         if (argTyped)
-            return new value_type(*argTyped);
+            return new(cmnClassServicesAllocate<value_type>()) value_type(*argTyped);
         else {
             CMN_LOG_INIT_WARNING << "cmnConditionalObjectFactoryOneArg: failed to dynamic cast from "
                                  << arg.Services()->GetName() << " to "
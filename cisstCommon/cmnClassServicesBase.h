@@ -32,6 +32,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstCommon/cmnForwardDeclarations.h>
 #include <cisstCommon/cmnLogLoD.h>
 
+#include <atomic>
 #include <string>
 #include <typeinfo>
 
@@ -63,8 +64,9 @@ class CISST_EXPORT cmnClassServicesBase
                          cmnLogMask mask = CMN_LOG_ALLOW_DEFAULT);
 
 
-    /*! Virtual destructor.  Does nothing. */
-    virtual ~cmnClassServicesBase() {}
+    /*! Virtual destructor.  Deletes the pool created by CreatePool,
+      if any. */
+    virtual ~cmnClassServicesBase();
 
 
     /*! Create a new empty object of the same type as represented by
@@ -147,6 +149,14 @@ class CISST_EXPORT cmnClassServicesBase
     */
     const std::string & GetName(void) const;
 
+    /*! Get the hash of the class name, computed once when the class
+      is registered.  The hash is the same for all processes, see
+      cmnClassRegister::NameHash and
+      cmnClassRegister::FindClassServices. */
+    inline unsigned long long GetNameHash(void) const {
+        return NameHashMember;
+    }
+
     /*!
       Get the type_info corresponding to the registered class.
 
@@ -190,6 +200,42 @@ class CISST_EXPORT cmnClassServicesBase
     /*! Get the name of library likely to contain the symbol. */
     const std::string & GetLibraryName(void) const;
 
+    /*! Memory pool used by Create, CreateWithArg and Create(other)
+      to allocate new objects.  When a pool is set, objects are
+      allocated from the pool until it is exhausted and then from the
+      heap.  Objects can be deleted with the operator delete whether
+      they come from the pool or from the heap.  Arrays are always
+      allocated from the heap.
+
+      CreatePool creates a pool with numberOfBlocks blocks of the size
+      of the class (see GetSize) and the pool is owned by the class
+      services.  SetPool uses an existing pool, which must not be
+      deleted before the objects created from it.  SetPool(0)
+      removes a pool set by SetPool.  A pool must be set before
+      objects are created concurrently, i.e. during the
+      initialization.  Returns false if a pool is already set. */
+    //@{
+    bool CreatePool(const size_t numberOfBlocks);
+    bool SetPool(cmnObjectPool * pool);
+    inline cmnObjectPool * GetPool(void) const {
+        return Pool;
+    }
+    //@}
+
+    /*! Allocate memory for a new object, from the pool if possible.
+      This is used by the factories of cmnClassServices, the memory
+      is released by cmnGenericObject::operator delete.  If the
+      calling thread enabled cmnObjectPool::SetHeapAllocationCheck,
+      heap allocations are counted and the first one is logged. */
+    void * Allocate(const size_t size) const;
+
+    /*! Number of objects allocated from the heap while the heap
+      allocation check was enabled, see
+      cmnObjectPool::SetHeapAllocationCheck. */
+    inline unsigned long long GetNumberOfCheckedHeapAllocations(void) const {
+        return CheckedHeapAllocations.load();
+    }
+
 private:
     /*! The name of the class. */
     const std::string * NameMember;
@@ -206,6 +252,16 @@ private:
 
     /*! The log Level of Detail. */
     cmnLogMask LogMask;
+
+    /*! Hash of the class name. */
+    unsigned long long NameHashMember;
+
+    /*! Pool used to allocate objects, see CreatePool and SetPool. */
+    cmnObjectPool * Pool;
+    bool OwnPool;
+
+    /*! Heap allocations while the check was enabled. */
+    mutable std::atomic<unsigned long long> CheckedHeapAllocations;
 };
 
 
@@ -49,6 +49,24 @@ public:                                                                 \
      cmnData<_promotedType>::DeSerializeBinary(dataPromoted, inputStream, localFormat, remoteFormat); \
      data = static_cast<DataType>(dataPromoted);                        \
  }                                                                      \
+ static size_t SerializeBinaryByteSize(const DataType & CMN_UNUSED(data)) { \
+     return sizeof(_promotedType);                                      \
+ }                                                                      \
+ static size_t SerializeBinary(const DataType & data,                   \
+                               char * buffer, size_t bufferSize) {      \
+     const _promotedType dataPromoted = static_cast<_promotedType>(data); \
+     return cmnData<_promotedType>::SerializeBinary(dataPromoted, buffer, bufferSize); \
+ }                                                                      \
+ static size_t DeSerializeBinary(DataType & data, const char * buffer, size_t bufferSize, \
+                                 const cmnDataFormat & localFormat,     \
+                                 const cmnDataFormat & remoteFormat) {  \
+     _promotedType dataPromoted;                                        \
+     const size_t bytes = cmnData<_promotedType>::DeSerializeBinary(dataPromoted, buffer, bufferSize, localFormat, remoteFormat); \
+     if (bytes != 0) {                                                  \
+         data = static_cast<DataType>(dataPromoted);                    \
+     }                                                                  \
+     return bytes;                                                      \
+ }                                                                      \
  static void SerializeText(const DataType & data, std::ostream & outputStream, \
                            const char CMN_UNUSED(delimiter) = ',') CISST_THROW(std::runtime_error) { \
      CMN_ASSERT(sizeof(_promotedType) >= sizeof(DataType));             \
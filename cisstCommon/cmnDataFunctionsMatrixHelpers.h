@@ -231,6 +231,91 @@ void cmnDataMatrixDeSerializeBinaryCheckSize(_matrixType & data,
     cmnDataMatrixDeSerializeBinary(data, inputStream, localFormat, remoteFormat);
 }
 
+template <class _matrixType>
+size_t cmnDataMatrixSerializeBinaryByteSize(const _matrixType & data)
+{
+    size_t byteSize = 0;
+    typedef typename _matrixType::const_iterator const_iterator;
+    const const_iterator end = data.end();
+    const_iterator iter = data.begin();
+    for (; iter != end; ++iter) {
+        byteSize += cmnData<typename _matrixType::value_type>::SerializeBinaryByteSize(*iter);
+    }
+    return byteSize;
+}
+
+template <class _matrixType>
+size_t cmnDataMatrixSerializeBinary(const _matrixType & data,
+                                    char * buffer, size_t bufferSize)
+{
+    size_t total = 0;
+    size_t bytes;
+    typedef typename _matrixType::const_iterator const_iterator;
+    const const_iterator end = data.end();
+    const_iterator iter = data.begin();
+    for (; iter != end; ++iter) {
+        bytes = cmnData<typename _matrixType::value_type>::SerializeBinary(*iter, buffer + total, bufferSize - total);
+        if (bytes == 0) {
+            return 0;
+        }
+        total += bytes;
+    }
+    return total;
+}
+
+template <class _matrixType>
+size_t cmnDataMatrixDeSerializeBinary(_matrixType & data,
+                                      const char * buffer, size_t bufferSize,
+                                      const cmnDataFormat & localFormat,
+                                      const cmnDataFormat & remoteFormat)
+{
+    size_t total = 0;
+    size_t bytes;
+    typedef typename _matrixType::iterator iterator;
+    const iterator end = data.end();
+    iterator iter = data.begin();
+    for (; iter != end; ++iter) {
+        bytes = cmnData<typename _matrixType::value_type>::DeSerializeBinary(*iter, buffer + total, bufferSize - total,
+                                                                             localFormat, remoteFormat);
+        if (bytes == 0) {
+            return 0;
+        }
+        total += bytes;
+    }
+    return total;
+}
+
+template <class _matrixType>
+size_t cmnDataMatrixDeSerializeBinaryResize(_matrixType & data,
+                                            const char * buffer, size_t bufferSize,
+                                            const cmnDataFormat & localFormat,
+                                            const cmnDataFormat & remoteFormat)
+{
+    // deserialize size and resize, make sure the buffer is large
+    // enough before resizing
+    size_t rows, cols;
+    size_t sizeBytes = cmnDataDeSerializeBinary_size_t(rows, buffer, bufferSize, localFormat, remoteFormat);
+    if (sizeBytes == 0) {
+        return 0;
+    }
+    const size_t colsBytes = cmnDataDeSerializeBinary_size_t(cols, buffer + sizeBytes, bufferSize - sizeBytes,
+                                                             localFormat, remoteFormat);
+    if (colsBytes == 0) {
+        return 0;
+    }
+    sizeBytes += colsBytes;
+    if ((cols != 0) && (rows > ((bufferSize - sizeBytes) / cols))) {
+        return 0;
+    }
+    data.resize(rows, cols);
+    const size_t dataBytes = cmnDataMatrixDeSerializeBinary(data, buffer + sizeBytes, bufferSize - sizeBytes,
+                                                            localFormat, remoteFormat);
+    if ((dataBytes == 0) && (data.size() != 0)) {
+        return 0;
+    }
+    return sizeBytes + dataBytes;
+}
+
 template <class _matrixType>
 size_t cmnDataMatrixScalarNumber(const _matrixType & data, const bool includeSize)
 {
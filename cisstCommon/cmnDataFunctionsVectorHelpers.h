@@ -214,6 +214,86 @@ void cmnDataVectorDeSerializeBinaryCheckSize(_vectorType & data,
     cmnDataVectorDeSerializeBinary(data, inputStream, localFormat, remoteFormat);
 }
 
+template <class _vectorType>
+size_t cmnDataVectorSerializeBinaryByteSize(const _vectorType & data)
+{
+    size_t byteSize = 0;
+    typedef typename _vectorType::const_iterator const_iterator;
+    const const_iterator end = data.end();
+    const_iterator iter = data.begin();
+    for (; iter != end; ++iter) {
+        byteSize += cmnData<typename _vectorType::value_type>::SerializeBinaryByteSize(*iter);
+    }
+    return byteSize;
+}
+
+/*! Serialize all elements in the user provided buffer, returns the
+  number of bytes used or 0 if the buffer is too small. */
+template <class _vectorType>
+size_t cmnDataVectorSerializeBinary(const _vectorType & data,
+                                    char * buffer, size_t bufferSize)
+{
+    size_t total = 0;
+    size_t bytes;
+    typedef typename _vectorType::const_iterator const_iterator;
+    const const_iterator end = data.end();
+    const_iterator iter = data.begin();
+    for (; iter != end; ++iter) {
+        bytes = cmnData<typename _vectorType::value_type>::SerializeBinary(*iter, buffer + total, bufferSize - total);
+        if (bytes == 0) {
+            return 0;
+        }
+        total += bytes;
+    }
+    return total;
+}
+
+template <class _vectorType>
+size_t cmnDataVectorDeSerializeBinary(_vectorType & data,
+                                      const char * buffer, size_t bufferSize,
+                                      const cmnDataFormat & localFormat,
+                                      const cmnDataFormat & remoteFormat)
+{
+    size_t total = 0;
+    size_t bytes;
+    typedef typename _vectorType::iterator iterator;
+    const iterator end = data.end();
+    iterator iter = data.begin();
+    for (; iter != end; ++iter) {
+        bytes = cmnData<typename _vectorType::value_type>::DeSerializeBinary(*iter, buffer + total, bufferSize - total,
+                                                                             localFormat, remoteFormat);
+        if (bytes == 0) {
+            return 0;
+        }
+        total += bytes;
+    }
+    return total;
+}
+
+/*! Deserialize the size, resize the vector and then deserialize all
+  elements from the buffer.  The vector is only resized if the
+  buffer is large enough to contain the announced number of
+  elements so a corrupted size can't trigger a large allocation. */
+template <class _vectorType>
+size_t cmnDataVectorDeSerializeBinaryResize(_vectorType & data,
+                                            const char * buffer, size_t bufferSize,
+                                            const cmnDataFormat & localFormat,
+                                            const cmnDataFormat & remoteFormat)
+{
+    size_t size;
+    const size_t sizeBytes = cmnDataDeSerializeBinary_size_t(size, buffer, bufferSize, localFormat, remoteFormat);
+    if ((sizeBytes == 0) || (size > (bufferSize - sizeBytes))) {
+        return 0;
+    }
+    data.resize(size);
+    const size_t dataBytes = cmnDataVectorDeSerializeBinary(data, buffer + sizeBytes, bufferSize - sizeBytes,
+                                                            localFormat, remoteFormat);
+    if ((dataBytes == 0) && (size != 0)) {
+        return 0;
+    }
+    return sizeBytes + dataBytes;
+}
+
 template <class _vectorType>
 size_t cmnDataVectorScalarNumber(const _vectorType & data)
 {
@@ -38,6 +38,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <string>
 #include <fstream>
 #include <map>
+#include <unordered_map>
 #include <cstddef>
 
 #include <cisstCommon/cmnExport.h>
@@ -267,7 +268,7 @@ public:
         identifier from the input stream.
 
         It will then try to locate the local type identifier based on
-        the class name by doing an STL string comparaison.  If the
+        the class name using cmnClassRegister::FindClassServices.  If the
         class doesn't exist on the de-serialization side, an exception
         is thrown (<code>std::runtime_error</code>).
 
@@ -280,7 +281,7 @@ public:
 
     std::istream & InputStream;
 
-    typedef std::map<TypeId, cmnClassServicesBase *> ServicesContainerType;
+    typedef std::unordered_map<TypeId, cmnClassServicesBase *> ServicesContainerType;
     typedef ServicesContainerType::value_type EntryType;
 
     typedef ServicesContainerType::const_iterator const_iterator;
@@ -41,6 +41,8 @@ class cmnMultiplexerStreambufProxy;
 
 class cmnLODOutputMultiplexer;
 
+class cmnObjectPool;
+
 class cmnObjectRegister;
 
 class cmnPath;
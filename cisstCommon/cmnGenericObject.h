@@ -43,6 +43,8 @@ http://www.cisst.org/cisst/license.txt.
 // Always include last
 #include <cisstCommon/cmnExport.h>
 
+class cmnDataFormat;
+
 /*!
   \brief Base class for high level objects.
 
@@ -56,6 +58,26 @@ public:
     /*! Destructor.  Does nothing specific. */
     virtual ~cmnGenericObject(void) {};
 
+    /*! Allocate and release the memory used by an object.  Objects
+      created by their class services can come from a pool (see
+      cmnClassServicesBase::SetPool), the owner of the memory is
+      stored in front of the object so the operator delete releases
+      it to the pool or to the heap without any lookup. */
+    //@{
+    static void * operator new(size_t size);
+    static void operator delete(void * pointer);
+    //@}
+
+    /*! Placement new and matching delete, used by the factories of
+      cmnClassServices. */
+    //@{
+    inline static void * operator new(size_t CMN_UNUSED(size), void * place) {
+        return place;
+    }
+    inline static void operator delete(void * CMN_UNUSED(pointer), void * CMN_UNUSED(place)) {
+    }
+    //@}
+
     /*! Pure virtual method to access the class services.  The derived
       classes should always declare and implement this method using
       the macros #CMN_DECLARE_SERVICES,
@@ -114,6 +136,30 @@ public:
       information, i.e. no class type nor format version. */
     virtual void DeSerializeRaw(std::istream & inputStream);
 
+    /*! Number of bytes required by SerializeBinaryBuffer.  Returns 0
+      if the derived class doesn't support serialization in a user
+      provided buffer (see cisstDataGenerator "binary-buffer"). */
+    virtual size_t SerializeBinaryByteSize(void) const {
+        return 0;
+    }
+
+    /*! Serialize the content of the object in binary format, without
+      class type, in a user provided buffer.  Returns the number of
+      bytes used or 0 if the buffer is too small or the derived class
+      doesn't support this feature. */
+    virtual size_t SerializeBinaryBuffer(char * CMN_UNUSED(buffer), size_t CMN_UNUSED(bufferSize)) const {
+        return 0;
+    }
+
+    /*! De-serialize the content of the object from a buffer created
+      by SerializeBinaryBuffer.  Returns the number of bytes read or
+      0 on failure. */
+    virtual size_t DeSerializeBinaryBuffer(const char * CMN_UNUSED(buffer), size_t CMN_UNUSED(bufferSize),
+                                           const cmnDataFormat & CMN_UNUSED(localFormat),
+                                           const cmnDataFormat & CMN_UNUSED(remoteFormat)) {
+        return 0;
+    }
+
     /*! Get the multiplexer to use for logging.  This is used by the
       macro CMN_LOG_CLASS to determine the log destination.  By
       default, it uses cmnLogger.  This method can be overloaded to
@@ -0,0 +1,177 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*! \file
+  \brief Asynchronous multiplexer used by cmnLogger
+*/
+#pragma once
+
+#ifndef _cmnLogAsyncStreambuf_h
+#define _cmnLogAsyncStreambuf_h
+
+#include <cisstCommon/cmnPortability.h>
+#include <cisstCommon/cmnLODMultiplexerStreambuf.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Always include last
+#include <cisstCommon/cmnExport.h>
+
+class cmnLogAsyncRing;
+
+/*!
+  \brief Multiplexer streambuf writing to its outputs from a
+  background thread.
+
+  \ingroup cisstCommon
+
+  cmnLogAsyncStreambuf can be used anywhere a
+  cmnLODMultiplexerStreambuf is used.  Messages are formatted by the
+  caller (i.e. by the std::ostream operators) but, instead of being
+  written to all the channels and multiplexers, they are copied in a
+  ring buffer owned by the calling thread.  A background thread
+  periodically moves the messages from all the ring buffers to the
+  channels and multiplexers, i.e. the outputs only see a single
+  writer.
+
+  Writing a message never blocks.  The ring buffers are single
+  producer, single consumer queues and the caller never waits for the
+  background thread.  If a ring buffer is full, the message is
+  dropped and counted.  The number of dropped messages is reported in
+  the outputs as a warning when the background thread catches up and
+  can be queried with GetNumberOfDroppedMessages.  The first message
+  from a thread allocates the thread's ring buffer, real-time threads
+  can call PrepareThread beforehand to avoid this allocation.
+
+  Messages are stored in records of RECORD_SIZE characters, longer
+  messages use consecutive records.  A message ends with a new line,
+  a call to sync (e.g. std::endl or std::flush) or a change of log
+  level.  Messages from different threads are not interleaved unless
+  they span multiple records.
+
+  cmnLogger uses this class when cmnLogger::SetAsynchronous is
+  called.  Channels of the cmnLogger multiplexer can be added or
+  removed while the background thread is running using
+  cmnLogger::AddChannel and cmnLogger::RemoveChannel.  Other users
+  should call LockOutputs and UnlockOutputs around changes to the
+  channels or multiplexers.
+
+  \sa cmnLogger cmnLODMultiplexerStreambuf
+*/
+class CISST_EXPORT cmnLogAsyncStreambuf: public cmnLODMultiplexerStreambuf<char>
+{
+public:
+    typedef cmnLODMultiplexerStreambuf<char> BaseType;
+
+    enum {RECORD_SIZE = 240, DEFAULT_NUMBER_OF_RECORDS = 256};
+
+    /*! Constructor, starts the background thread.  The number of
+      records is used for each thread's ring buffer.  The period, in
+      seconds, defines how often the background thread writes to the
+      outputs. */
+    cmnLogAsyncStreambuf(const size_t numberOfRecords = DEFAULT_NUMBER_OF_RECORDS,
+                         const double period = 0.01);
+
+    /*! Destructor, writes all pending messages, stops the background
+      thread and releases the ring buffers. */
+    ~cmnLogAsyncStreambuf();
+
+    /*! Allocate the ring buffer for the calling thread.  Returns false
+      if the buffer couldn't be registered. */
+    bool PrepareThread(void);
+
+    /*! Write all pending messages to the outputs and sync them.  This
+      is called by the background thread and can be called by any
+      thread that can afford to block. */
+    void Flush(void);
+
+    /*! Total number of messages dropped because a ring buffer was
+      full or couldn't be allocated. */
+    unsigned long long GetNumberOfDroppedMessages(void) const;
+
+    /*! Prevent the background thread from writing to the outputs,
+      e.g. while channels are added or removed. */
+    //@{
+    inline void LockOutputs(void) {
+        OutputMutex.lock();
+    }
+    inline void UnlockOutputs(void) {
+        OutputMutex.unlock();
+    }
+    //@}
+
+protected:
+    /*! Overloaded basic_streambuf methods, these copy the message in
+      the caller's ring buffer. */
+    //@{
+    std::streamsize xsputn(const char * s, std::streamsize n, cmnLogLevel level) override;
+    int sync(void) override;
+    int_type overflow(int_type c, cmnLogLevel level) override;
+    std::streamsize xsputn(const char * s, std::streamsize n) override;
+    int_type overflow(int_type c = traits_type::eof()) override;
+    //@}
+
+private:
+    cmnLogAsyncStreambuf(const cmnLogAsyncStreambuf & other);
+    cmnLogAsyncStreambuf & operator = (const cmnLogAsyncStreambuf & other);
+
+    /*! Ring buffer for the calling thread, allocated if needed.
+      Returns 0 if it can't be allocated. */
+    cmnLogAsyncRing * CurrentRing(void);
+
+    /*! Copy part of a message in the caller's ring buffer.  A level
+      of 0 is used for messages sent to all channels. */
+    void Write(const char * s, std::streamsize n, const cmnLogLevel level);
+
+    /*! Main loop of the background thread. */
+    void Run(void);
+
+    /*! Write all committed records to the outputs, OutputMutex must be
+      locked. */
+    void Drain(void);
+
+    size_t NumberOfRecords;
+    double Period;
+
+    /*! Protects Rings, producers only use try_lock. */
+    std::mutex RingsMutex;
+    std::vector<cmnLogAsyncRing *> Rings;
+
+    /*! Serializes the consumers and protects the outputs. */
+    std::mutex OutputMutex;
+
+    /*! Used to wake up the background thread when stopping. */
+    std::mutex ConditionMutex;
+    std::condition_variable Condition;
+    bool Stopping;
+
+    /*! Messages dropped without a ring buffer to count them or
+      counted by ring buffers already deleted. */
+    std::atomic<unsigned long long> DroppedWithoutRing;
+    unsigned long long DroppedWithoutRingReported;
+
+    std::thread Thread;
+};
+
+#endif // _cmnLogAsyncStreambuf_h
@@ -34,12 +34,15 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstCommon/cmnMultiplexerStreambuf.h>
 #include <cisstCommon/cmnLODMultiplexerStreambuf.h>
 
+#include <atomic>
 #include <string>
 #include <vector>
 #include <fstream>
 
 #include <cisstCommon/cmnExport.h>
 
+class cmnLogAsyncStreambuf;
+
 // MJ: some thirdparty drivers on QNX make CMN_LOG macro throw exceptions
 // (e.g., std::bad_cast) and the following preprocessor can be used to bypass
 // this issue by replacing CMN_LOG with std::cout.
@@ -276,6 +279,15 @@ class CISST_EXPORT cmnLogger {
     /*! Single multiplexer used to stream the log out */
     StreamBufType LoDMultiplexerStreambuf;
 
+    /*! Asynchronous multiplexer forwarding to LoDMultiplexerStreambuf,
+      created the first time SetAsynchronous is used and kept until
+      the logger is destroyed. */
+    cmnLogAsyncStreambuf * AsyncStreambuf;
+
+    /*! Multiplexer used by the log macros, either
+      LoDMultiplexerStreambuf or AsyncStreambuf. */
+    std::atomic<StreamBufType *> CurrentMultiplexer;
+
     /*! Default filename (possibly including path) for default log.
         Normally, cisstLog.txt in current directory. */
     static std::string DefaultLogFileName;
@@ -321,11 +333,34 @@ class CISST_EXPORT cmnLogger {
     /*! Instance specific implementation of Kill */
     void KillInstance(void);
 
+    /*! Instance specific implementation of SetAsynchronous */
+    void SetAsynchronousInstance(const bool asynchronous, const size_t numberOfRecords);
+
+    /*! Instance specific implementation of IsAsynchronous */
+    bool IsAsynchronousInstance(void) const;
+
+    /*! Instance specific implementation of Flush */
+    void FlushInstance(void);
+
+    /*! Instance specific implementation of GetNumberOfDroppedMessages */
+    unsigned long long GetNumberOfDroppedMessagesInstance(void) const;
+
+    /*! Prevent the asynchronous multiplexer from writing while the
+      channels are modified. */
+    //@{
+    void LockOutputs(void);
+    void UnlockOutputs(void);
+    //@}
+
  protected:
     /*! Constructor.  The only constructor must be private in order to
       ensure that the class register is a singleton. */
     cmnLogger(const std::string & defaultLogFileName = DefaultLogFileName);
 
+    /*! Destructor, writes pending messages if the logger is
+      asynchronous. */
+    ~cmnLogger();
+
  public:
     /*! The log is instantiated as a singleton.  To access the unique
       instantiation, one needs to use this static method.  The
@@ -492,6 +527,37 @@ class CISST_EXPORT cmnLogger {
 
     /*! Returns true if cmnLogger instance has been created (i.e., constructor called). */
     static bool IsCreated() { return InstanceCreated; }
+
+    /*! Use a background thread to write the messages to all the
+      output streams (see cmnLogAsyncStreambuf).  When asynchronous,
+      the log macros copy each message in a ring buffer owned by the
+      calling thread and never block, e.g. on a mutex protecting an
+      output stream.  Messages are dropped (and counted) if a thread
+      logs faster than the background thread can write.  The number
+      of records per thread is only used the first time asynchronous
+      logging is enabled.  This should be called from the main
+      thread, e.g. at the beginning of main(). */
+    static inline void SetAsynchronous(const bool asynchronous = true,
+                                       const size_t numberOfRecords = 256) {
+        Instance()->SetAsynchronousInstance(asynchronous, numberOfRecords);
+    }
+
+    /*! Check if messages are written by a background thread. */
+    static inline bool IsAsynchronous(void) {
+        return Instance()->IsAsynchronousInstance();
+    }
+
+    /*! Write all pending messages when the logger is asynchronous.
+      This blocks the caller until all messages have been written. */
+    static inline void Flush(void) {
+        Instance()->FlushInstance();
+    }
+
+    /*! Number of messages dropped because a thread's buffer was full.
+      Always 0 if the logger has never been asynchronous. */
+    static inline unsigned long long GetNumberOfDroppedMessages(void) {
+        return Instance()->GetNumberOfDroppedMessagesInstance();
+    }
 };
 
 
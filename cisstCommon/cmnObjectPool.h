@@ -0,0 +1,146 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*! \file
+  \brief Fixed size memory pool for dynamically created objects
+*/
+#pragma once
+
+#ifndef _cmnObjectPool_h
+#define _cmnObjectPool_h
+
+#include <cisstCommon/cmnPortability.h>
+
+#include <atomic>
+#include <cstddef>
+
+// Always include last
+#include <cisstCommon/cmnExport.h>
+
+/*!
+  \brief Lock free pool of fixed size memory blocks
+
+  \ingroup cisstCommon
+
+  A pool preallocates a given number of blocks of the same size.
+  Allocate and Release never block and never call the system
+  allocator, they can be called concurrently from any thread.
+
+  Pools are used by cmnClassServicesBase to create objects derived
+  from cmnGenericObject without heap allocation, see
+  cmnClassServicesBase::SetPool.  Objects created from a pool can be
+  deleted with the operator delete, cmnGenericObject::operator delete
+  returns the memory to the pool it comes from.  A pool must not be
+  deleted while some of its blocks are still in use.
+
+  cmnObjectPool also provides a per thread flag used to report heap
+  allocations performed by cmnClassServicesBase in time critical
+  threads, see SetHeapAllocationCheck.
+
+  \sa cmnClassServicesBase cmnGenericObject
+*/
+class CISST_EXPORT cmnObjectPool
+{
+public:
+    /*! Constructor, allocates numberOfBlocks blocks of at least
+      blockSize bytes.  Blocks are aligned for any standard type and
+      preceded by a small header used by ReleaseToOwner. */
+    cmnObjectPool(const size_t blockSize, const size_t numberOfBlocks);
+
+    /*! Destructor, releases all blocks. */
+    ~cmnObjectPool();
+
+    /*! Get a block of at least size bytes.  Returns 0 if size is
+      larger than the block size or if all blocks are in use. */
+    void * Allocate(const size_t size);
+
+    /*! Return a block to the pool.  The block must come from this
+      pool. */
+    void Release(void * block);
+
+    /*! Check if a pointer belongs to this pool. */
+    inline bool Owns(const void * pointer) const {
+        return (static_cast<const char *>(pointer) >= Memory)
+            && (static_cast<const char *>(pointer) < End);
+    }
+
+    /*! Size of blocks and number of blocks. */
+    //@{
+    inline size_t GetBlockSize(void) const {
+        return BlockSize;
+    }
+    inline size_t GetNumberOfBlocks(void) const {
+        return NumberOfBlocks;
+    }
+    //@}
+
+    /*! Number of blocks currently allocated. */
+    size_t GetNumberOfBlocksUsed(void) const;
+
+    /*! Number of allocations that failed because all blocks were in
+      use. */
+    unsigned long long GetNumberOfFailures(void) const;
+
+    /*! Get a block of size bytes from the heap.  The block has the
+      same layout as the blocks of a pool so it can be released with
+      ReleaseToOwner.  This is used by cmnGenericObject::operator
+      new. */
+    static void * AllocateFromHeap(const size_t size);
+
+    /*! Release a block to the pool it belongs to, or to the heap if
+      it was allocated by AllocateFromHeap.  The owner is stored in
+      front of each block, there is no lookup.  This is used by
+      cmnGenericObject::operator delete. */
+    static void ReleaseToOwner(void * block);
+
+    /*! Enable or disable the heap allocation check for the calling
+      thread.  When enabled, objects created by
+      cmnClassServicesBase using the heap (class without a pool or
+      pool exhausted) are reported as warnings and counted.  This is
+      used by real-time tasks after their startup. */
+    static void SetHeapAllocationCheck(const bool enable);
+
+    /*! Check if the heap allocation check is enabled for the calling
+      thread. */
+    static bool GetHeapAllocationCheck(void);
+
+private:
+    cmnObjectPool(const cmnObjectPool & other);
+    cmnObjectPool & operator = (const cmnObjectPool & other);
+
+    size_t BlockSize;
+    size_t NumberOfBlocks;
+    char * Memory;
+    char * End;
+
+    /*! Free list, Next[i] is the index plus one of the block after
+      block i, 0 for the end of the list. */
+    std::atomic<unsigned int> * Next;
+
+    /*! Head of the free list, lower 32 bits are the index plus one
+      of the first free block and upper 32 bits a tag incremented on
+      each change to avoid ABA issues. */
+    std::atomic<unsigned long long> Head;
+
+    std::atomic<size_t> Used;
+    std::atomic<unsigned long long> Failures;
+};
+
+#endif // _cmnObjectPool_h
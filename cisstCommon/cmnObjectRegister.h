@@ -33,6 +33,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstCommon/cmnClassRegister.h>
 
 #include <map>
+#include <unordered_map>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -77,6 +78,17 @@ private:
     /*! Map of class pointers registered. */
     ContainerType ObjectContainer;
 
+    /*! Indices of the registered objects by name hash (see
+      cmnClassRegister::NameHash) and by address.  Objects whose name
+      hash collides with an already registered object are not indexed
+      by hash. */
+    //@{
+    typedef std::unordered_map<cmnClassRegister::NameHashType, cmnGenericObject *> HashContainerType;
+    HashContainerType HashContainer;
+    typedef std::unordered_map<const cmnGenericObject *, std::string> NameContainerType;
+    NameContainerType NameContainer;
+    //@}
+
 
     /*! Instance specific implementation of Register.
       \sa Register */
@@ -96,6 +108,12 @@ private:
     */
     cmnGenericObject* FindObjectInstance(const std::string & objectName) const;
 
+    /*! Instance specific implementation of FindObject
+      \param nameHash The name hash to look up.
+      \sa FindObject
+    */
+    cmnGenericObject* FindObjectInstance(const cmnClassRegister::NameHashType nameHash) const;
+
 
     /*! Instance specific implementation of FindName
 
@@ -182,6 +200,16 @@ protected:
         return Instance()->FindObjectInstance(objectName);
     }
 
+    /*! Get the object by hash of its name, see
+      cmnClassRegister::NameHash.  This doesn't require any string
+      comparison.  Returns null if no object with this name hash is
+      registered.
+      \param nameHash The hash to look up.
+    */
+    static inline cmnGenericObject * FindObject(const cmnClassRegister::NameHashType nameHash) {
+        return Instance()->FindObjectInstance(nameHash);
+    }
+
 
     /*! Get the name of an object. Returns "undefined" if the object is
       not registered.
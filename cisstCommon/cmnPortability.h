@@ -569,6 +569,16 @@ bool CISST_EXPORT cmnIsFinite(const double & value);
 #endif
 
 
+/*! Size of a cache line in bytes.  This is used to pad data
+  structures shared between threads (e.g. lock-free queues) so that
+  indices modified by different threads don't end up on the same
+  cache line (false sharing).  64 bytes is correct for all x86 and
+  most ARM processors. */
+#ifndef CMN_CACHE_LINE_SIZE
+  #define CMN_CACHE_LINE_SIZE 64
+#endif
+
+
 #ifndef DOXYGEN
 
 // No __FUNCTION__ for g++ version < 2.6 __FUNCDNAME__ Valid only
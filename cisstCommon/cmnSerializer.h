@@ -33,6 +33,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstCommon/cmnThrow.h>
 
 #include <string>
+#include <unordered_set>
 #include <vector>
 #include <fstream>
 #include <cstddef>
@@ -232,13 +233,20 @@ public:
     */
     void SerializeServices(const cmnClassServicesBase * servicesPointer);
 
+    /*! Output stream used by the serializer.  This can be used to
+      write the content of an object after Serialize was called with
+      serializeObject set to false. */
+    inline std::ostream & GetOutputStream(void) {
+        return OutputStream;
+    }
+
 
  private:
 
     std::ostream & OutputStream;
 
-    /*! List of types already sent, uses the native pointer type */
-    typedef std::list<const cmnClassServicesBase *> ServicesContainerType;
+    /*! Set of types already sent, uses the native pointer type */
+    typedef std::unordered_set<const cmnClassServicesBase *> ServicesContainerType;
     typedef ServicesContainerType::const_iterator const_iterator;
     typedef ServicesContainerType::iterator iterator;
 
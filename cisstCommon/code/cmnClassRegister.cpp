@@ -45,6 +45,15 @@ const std::string * cmnClassRegister::RegisterInstance(cmnClassServicesBase* cla
         EntryType newEntry(className, classServicesPointer);
         insertionResult = ServicesContainer.insert(newEntry);
         if (insertionResult.second) {
+            // add to indices, keep first class registered if hash collides
+            const NameHashType nameHash = NameHash(className);
+            if (!HashContainer.insert(HashContainerType::value_type(nameHash, classServicesPointer)).second) {
+                CMN_LOG_INIT_WARNING << "Class cmnClassRegister: Register: class \"" << className
+                                     << "\" has the same name hash as class \"" << HashContainer[nameHash]->GetName()
+                                     << "\", it can only be found by name" << std::endl;
+            }
+            TypeInfoContainer.insert(TypeInfoContainerType::value_type(std::type_index(*(classServicesPointer->TypeInfoPointer())),
+                                                                       classServicesPointer));
             if (cmnLogger::IsCreated()) {
                 CMN_LOG_INIT_VERBOSE << "Class cmnClassRegister: Register: class \"" << className
                                      << "\" has been registered with Log LoD \"" << cmnLogMaskToString(classServicesPointer->GetLoD()) << "\"" << std::endl;
@@ -144,6 +153,13 @@ bool cmnClassRegister::SetLogMaskClassMatchingInstance(const std::string & strin
 
 cmnClassServicesBase * cmnClassRegister::FindClassServicesInstance(const std::string & className)
 {
+    // fast path using the hash index, a single string comparison to
+    // handle collisions
+    const HashContainerType::const_iterator hashIterator = HashContainer.find(NameHash(className));
+    if ((hashIterator != HashContainer.end())
+        && (hashIterator->second->GetName() == className)) {
+        return hashIterator->second;
+    }
     const_iterator iterator;
     const const_iterator end = ServicesContainer.end();
     cmnClassServicesBase * result = NULL;
@@ -157,17 +173,33 @@ cmnClassServicesBase * cmnClassRegister::FindClassServicesInstance(const std::st
 
 cmnClassServicesBase * cmnClassRegister::FindClassServicesInstance(const std::type_info & typeInfo)
 {
-    const_iterator iterator;
-    const const_iterator end = ServicesContainer.end();
-    cmnClassServicesBase * result = NULL;
-    iterator = ServicesContainer.begin();
-    while ((iterator != end) && (result == NULL)) {
-        if (*((iterator->second)->TypeInfoPointer()) == typeInfo) {
-            result = iterator->second;
-        }
-        iterator++;
+    const TypeInfoContainerType::const_iterator iterator = TypeInfoContainer.find(std::type_index(typeInfo));
+    if (iterator != TypeInfoContainer.end()) {
+        return iterator->second;
     }
-    return result;
+    return NULL;
+}
+
+
+cmnClassServicesBase * cmnClassRegister::FindClassServicesInstance(const NameHashType nameHash) const
+{
+    const HashContainerType::const_iterator iterator = HashContainer.find(nameHash);
+    if (iterator != HashContainer.end()) {
+        return iterator->second;
+    }
+    return NULL;
+}
+
+
+cmnClassRegister::NameHashType cmnClassRegister::NameHash(const std::string & className)
+{
+    NameHashType hash = 14695981039346656037ull;
+    const size_t size = className.size();
+    for (size_t index = 0; index < size; ++index) {
+        hash ^= static_cast<unsigned char>(className[index]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
 }
 
 
@@ -22,6 +22,10 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <cisstCommon/cmnClassServicesBase.h>
 #include <cisstCommon/cmnClassRegister.h>
+#include <cisstCommon/cmnObjectPool.h>
+#include <cisstCommon/cmnLogger.h>
+
+#include <new>
 
 cmnClassServicesBase::cmnClassServicesBase(const std::string & className, const std::type_info * typeInfo,
                                            const cmnClassServicesBase * parentServices,
@@ -30,12 +34,24 @@ cmnClassServicesBase::cmnClassServicesBase(const std::string & className, const
     TypeInfoMember(typeInfo),
     ParentServices(parentServices),
     LibraryName(libraryName),
-    LogMask(mask)
+    LogMask(mask),
+    NameHashMember(cmnClassRegister::NameHash(className)),
+    Pool(0),
+    OwnPool(false),
+    CheckedHeapAllocations(0)
 {
     NameMember = cmnClassRegister::Register(this, className);
 }
 
 
+cmnClassServicesBase::~cmnClassServicesBase()
+{
+    if (OwnPool) {
+        delete Pool;
+    }
+}
+
+
 
 const std::string & cmnClassServicesBase::GetName(void) const
 {
@@ -78,3 +94,48 @@ const std::string & cmnClassServicesBase::GetLibraryName(void) const
 {
     return this->LibraryName;
 }
+
+
+bool cmnClassServicesBase::CreatePool(const size_t numberOfBlocks)
+{
+    if (Pool) {
+        CMN_LOG_INIT_ERROR << "cmnClassServicesBase::CreatePool: class \"" << GetName()
+                           << "\" already has a pool" << std::endl;
+        return false;
+    }
+    Pool = new cmnObjectPool(GetSize(), numberOfBlocks);
+    OwnPool = true;
+    return true;
+}
+
+
+bool cmnClassServicesBase::SetPool(cmnObjectPool * pool)
+{
+    if (Pool && (pool || OwnPool)) {
+        CMN_LOG_INIT_ERROR << "cmnClassServicesBase::SetPool: class \"" << GetName()
+                           << "\" already has a pool" << std::endl;
+        return false;
+    }
+    Pool = pool;
+    OwnPool = false;
+    return true;
+}
+
+
+void * cmnClassServicesBase::Allocate(const size_t size) const
+{
+    if (Pool) {
+        void * block = Pool->Allocate(size);
+        if (block) {
+            return block;
+        }
+    }
+    if (cmnObjectPool::GetHeapAllocationCheck()) {
+        if (CheckedHeapAllocations.fetch_add(1) == 0) {
+            CMN_LOG_RUN_WARNING << "cmnClassServicesBase::Allocate: heap allocation for an object of type \""
+                                << GetName() << "\" in a thread with heap allocation check enabled"
+                                << (Pool ? ", pool exhausted" : ", no pool") << std::endl;
+        }
+    }
+    return cmnObjectPool::AllocateFromHeap(size);
+}
@@ -30,7 +30,7 @@ size_t cmnDataSerializeBinary(const std::string & data, char * buffer, size_t bu
     buffer += cmnData<size_t>::SerializeBinary(length, buffer, cmnData<size_t>::SerializeBinaryByteSize(0));
     // serialize string itself
     const size_t numberOfBytes = length * sizeof(std::string::value_type);
-    memcpy(buffer, data.data(), length * numberOfBytes);
+    memcpy(buffer, data.data(), numberOfBytes);
     bufferSize -= numberOfBytes;
     return dataSize;
 }
@@ -53,7 +53,7 @@ size_t cmnDataDeSerializeBinary(std::string & data, const char * buffer, size_t
     }
     // make sure the buffer has the whole string
     const size_t sizeOfData = stringSize * sizeof(std::string::value_type);
-    if (bufferSize < sizeOfData) {
+    if ((bufferSize - byteRead) < sizeOfData) {
         return 0;
     }
     // get the string characters
@@ -24,9 +24,20 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstCommon/cmnGenericObject.h>
 #include <cisstCommon/cmnClassServices.h>
 #include <cisstCommon/cmnLogger.h>
+#include <cisstCommon/cmnObjectPool.h>
 
 #include <sstream>
 
+void * cmnGenericObject::operator new(size_t size) {
+    return cmnObjectPool::AllocateFromHeap(size);
+}
+
+
+void cmnGenericObject::operator delete(void * pointer) {
+    cmnObjectPool::ReleaseToOwner(pointer);
+}
+
+
 bool cmnGenericObject::ReconstructFrom(const cmnGenericObject & other) {
     const cmnClassServicesBase * services = this->Services();
 #if 0
@@ -0,0 +1,395 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstCommon/cmnLogAsyncStreambuf.h>
+
+#include <chrono>
+#include <cstring>
+#include <sstream>
+
+
+// Single producer (the thread owning the ring), single consumer
+// (whichever thread holds the OutputMutex).  Head is the number of
+// records committed by the producer, Tail the number of records
+// written to the outputs.  The ring is shared by the producer thread
+// and the streambuf, the last one to release it deletes it.
+class cmnLogAsyncRing
+{
+public:
+    struct RecordType {
+        cmnLogLevel Level;      // 0 for messages sent to all channels
+        unsigned short Length;
+        char Text[cmnLogAsyncStreambuf::RECORD_SIZE];
+    };
+
+    cmnLogAsyncRing(const cmnLogAsyncStreambuf * owner, const size_t numberOfRecords):
+        Records(numberOfRecords),
+        Head(0),
+        Tail(0),
+        InMessage(false),
+        MessageLevel(0),
+        Staging(false),
+        Dropping(false),
+        Dropped(0),
+        DroppedReported(0),
+        References(2),
+        Owner(owner)
+    {}
+
+    inline void Release(void) {
+        if (References.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+    // producer side
+    inline void Commit(void) {
+        if (Staging) {
+            Head.store(Head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+            Staging = false;
+        }
+    }
+
+    inline void EndMessage(void) {
+        Commit();
+        InMessage = false;
+        Dropping = false;
+    }
+
+    std::vector<RecordType> Records;
+    std::atomic<size_t> Head;
+    std::atomic<size_t> Tail;
+
+    // only used by the producer
+    bool InMessage;
+    cmnLogLevel MessageLevel;
+    bool Staging;
+    bool Dropping;
+
+    std::atomic<unsigned long long> Dropped;
+    // only used by the consumer
+    unsigned long long DroppedReported;
+
+    std::atomic<int> References;
+    std::atomic<const cmnLogAsyncStreambuf *> Owner;
+};
+
+
+namespace {
+    // rings used by the current thread, one per cmnLogAsyncStreambuf
+    struct cmnLogAsyncThreadRings {
+        ~cmnLogAsyncThreadRings() {
+            std::vector<cmnLogAsyncRing *>::iterator ring;
+            for (ring = Rings.begin(); ring != Rings.end(); ++ring) {
+                (*ring)->Release();
+            }
+        }
+        std::vector<cmnLogAsyncRing *> Rings;
+    };
+
+    thread_local cmnLogAsyncThreadRings cmnLogAsyncCurrentThreadRings;
+
+    cmnLogAsyncRing * cmnLogAsyncFindRing(const cmnLogAsyncStreambuf * owner) {
+        const std::vector<cmnLogAsyncRing *> & rings = cmnLogAsyncCurrentThreadRings.Rings;
+        const size_t size = rings.size();
+        for (size_t index = 0; index < size; ++index) {
+            if (rings[index]->Owner.load(std::memory_order_acquire) == owner) {
+                return rings[index];
+            }
+        }
+        return 0;
+    }
+}
+
+
+cmnLogAsyncStreambuf::cmnLogAsyncStreambuf(const size_t numberOfRecords, const double period):
+    NumberOfRecords((numberOfRecords > 0) ? numberOfRecords : 1),
+    Period(period),
+    Stopping(false),
+    DroppedWithoutRing(0),
+    DroppedWithoutRingReported(0)
+{
+    Thread = std::thread(&cmnLogAsyncStreambuf::Run, this);
+}
+
+
+cmnLogAsyncStreambuf::~cmnLogAsyncStreambuf()
+{
+    {
+        std::lock_guard<std::mutex> lock(ConditionMutex);
+        Stopping = true;
+    }
+    Condition.notify_one();
+    Thread.join();
+    Flush();
+    // threads still alive will release their rings when they exit
+    std::lock_guard<std::mutex> lock(RingsMutex);
+    std::vector<cmnLogAsyncRing *>::iterator ring;
+    for (ring = Rings.begin(); ring != Rings.end(); ++ring) {
+        (*ring)->Owner.store(0, std::memory_order_release);
+        (*ring)->Release();
+    }
+    Rings.clear();
+}
+
+
+cmnLogAsyncRing * cmnLogAsyncStreambuf::CurrentRing(void)
+{
+    cmnLogAsyncRing * ring = cmnLogAsyncFindRing(this);
+    if (ring) {
+        return ring;
+    }
+    // never wait for the background thread, drop the message instead
+    ring = new cmnLogAsyncRing(this, NumberOfRecords);
+    if (!RingsMutex.try_lock()) {
+        delete ring;
+        return 0;
+    }
+    Rings.push_back(ring);
+    RingsMutex.unlock();
+
+    // forget rings from cmnLogAsyncStreambuf already destroyed
+    std::vector<cmnLogAsyncRing *> & rings = cmnLogAsyncCurrentThreadRings.Rings;
+    std::vector<cmnLogAsyncRing *>::iterator iter = rings.begin();
+    while (iter != rings.end()) {
+        if ((*iter)->Owner.load(std::memory_order_acquire) == 0) {
+            (*iter)->Release();
+            iter = rings.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    rings.push_back(ring);
+    return ring;
+}
+
+
+bool cmnLogAsyncStreambuf::PrepareThread(void)
+{
+    if (cmnLogAsyncFindRing(this)) {
+        return true;
+    }
+    // not time critical, keep trying until the ring is registered
+    cmnLogAsyncRing * ring = 0;
+    while (!ring) {
+        ring = CurrentRing();
+        if (!ring) {
+            std::this_thread::yield();
+        }
+    }
+    return true;
+}
+
+
+void cmnLogAsyncStreambuf::Write(const char * s, std::streamsize n, const cmnLogLevel level)
+{
+    if (n <= 0) {
+        return;
+    }
+    const bool endOfMessage = (s[n - 1] == '\n');
+    cmnLogAsyncRing * ring = CurrentRing();
+    if (!ring) {
+        if (endOfMessage) {
+            DroppedWithoutRing.fetch_add(1, std::memory_order_relaxed);
+        }
+        return;
+    }
+
+    // a change of log level starts a new message
+    if (ring->InMessage && (ring->MessageLevel != level)) {
+        ring->EndMessage();
+    }
+    if (!ring->InMessage) {
+        ring->InMessage = true;
+        ring->MessageLevel = level;
+    }
+
+    const size_t size = ring->Records.size();
+    const char * end = s + n;
+    while ((s < end) && !ring->Dropping) {
+        const size_t head = ring->Head.load(std::memory_order_relaxed);
+        cmnLogAsyncRing::RecordType & record = ring->Records[head % size];
+        if (!ring->Staging) {
+            if ((head - ring->Tail.load(std::memory_order_acquire)) >= size) {
+                // full, drop the rest of this message
+                ring->Dropping = true;
+                ring->Dropped.fetch_add(1, std::memory_order_relaxed);
+                break;
+            }
+            record.Level = level;
+            record.Length = 0;
+            ring->Staging = true;
+        }
+        size_t length = static_cast<size_t>(end - s);
+        const size_t available = RECORD_SIZE - record.Length;
+        if (length > available) {
+            length = available;
+        }
+        memcpy(record.Text + record.Length, s, length);
+        record.Length = static_cast<unsigned short>(record.Length + length);
+        s += length;
+        if (record.Length == RECORD_SIZE) {
+            ring->Commit();
+        }
+    }
+
+    if (endOfMessage) {
+        ring->EndMessage();
+    }
+}
+
+
+std::streamsize cmnLogAsyncStreambuf::xsputn(const char * s, std::streamsize n, cmnLogLevel level)
+{
+    Write(s, n, level);
+    return n;
+}
+
+
+int cmnLogAsyncStreambuf::sync(void)
+{
+    // end of message for the caller, the outputs are synced by the
+    // background thread
+    cmnLogAsyncRing * ring = cmnLogAsyncFindRing(this);
+    if (ring) {
+        ring->EndMessage();
+    }
+    return 0;
+}
+
+
+cmnLogAsyncStreambuf::int_type cmnLogAsyncStreambuf::overflow(int_type c, cmnLogLevel level)
+{
+    if (traits_type::eq_int_type(traits_type::eof(), c)) {
+        return traits_type::not_eof(c);
+    }
+    const char character = traits_type::to_char_type(c);
+    Write(&character, 1, level);
+    return traits_type::not_eof(c);
+}
+
+
+std::streamsize cmnLogAsyncStreambuf::xsputn(const char * s, std::streamsize n)
+{
+    Write(s, n, 0);
+    return n;
+}
+
+
+cmnLogAsyncStreambuf::int_type cmnLogAsyncStreambuf::overflow(int_type c)
+{
+    return this->overflow(c, 0);
+}
+
+
+void cmnLogAsyncStreambuf::Flush(void)
+{
+    std::lock_guard<std::mutex> lock(OutputMutex);
+    Drain();
+}
+
+
+unsigned long long cmnLogAsyncStreambuf::GetNumberOfDroppedMessages(void) const
+{
+    unsigned long long result = DroppedWithoutRing.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(const_cast<std::mutex &>(RingsMutex));
+    std::vector<cmnLogAsyncRing *>::const_iterator ring;
+    for (ring = Rings.begin(); ring != Rings.end(); ++ring) {
+        result += (*ring)->Dropped.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+
+void cmnLogAsyncStreambuf::Run(void)
+{
+    std::unique_lock<std::mutex> lock(ConditionMutex);
+    while (!Stopping) {
+        Condition.wait_for(lock, std::chrono::duration<double>(Period));
+        lock.unlock();
+        Flush();
+        lock.lock();
+    }
+}
+
+
+void cmnLogAsyncStreambuf::Drain(void)
+{
+    std::vector<cmnLogAsyncRing *> rings;
+    {
+        std::lock_guard<std::mutex> lock(RingsMutex);
+        rings = Rings;
+    }
+
+    bool written = false;
+    unsigned long long dropped = 0;
+    std::vector<cmnLogAsyncRing *>::iterator ring;
+    for (ring = rings.begin(); ring != rings.end(); ++ring) {
+        const size_t size = (*ring)->Records.size();
+        size_t tail = (*ring)->Tail.load(std::memory_order_relaxed);
+        const size_t head = (*ring)->Head.load(std::memory_order_acquire);
+        for (; tail != head; ++tail) {
+            const cmnLogAsyncRing::RecordType & record = (*ring)->Records[tail % size];
+            if (record.Level == 0) {
+                BaseType::xsputn(record.Text, record.Length);
+            } else {
+                BaseType::xsputn(record.Text, record.Length, record.Level);
+            }
+            (*ring)->Tail.store(tail + 1, std::memory_order_release);
+            written = true;
+        }
+        const unsigned long long droppedTotal = (*ring)->Dropped.load(std::memory_order_relaxed);
+        dropped += droppedTotal - (*ring)->DroppedReported;
+        (*ring)->DroppedReported = droppedTotal;
+    }
+    const unsigned long long droppedWithoutRing = DroppedWithoutRing.load(std::memory_order_relaxed);
+    dropped += droppedWithoutRing - DroppedWithoutRingReported;
+    DroppedWithoutRingReported = droppedWithoutRing;
+
+    if (dropped > 0) {
+        std::stringstream message;
+        message << cmnLogLevelToString(CMN_LOG_LEVEL_RUN_WARNING)
+                << " cmnLogAsyncStreambuf: dropped " << dropped << " message(s), log buffer full" << std::endl;
+        const std::string text = message.str();
+        BaseType::xsputn(text.c_str(), static_cast<std::streamsize>(text.size()), CMN_LOG_LEVEL_RUN_WARNING);
+        written = true;
+    }
+    if (written) {
+        BaseType::sync();
+    }
+
+    // delete rings from threads that have exited once they are empty
+    std::lock_guard<std::mutex> lock(RingsMutex);
+    std::vector<cmnLogAsyncRing *>::iterator iter = Rings.begin();
+    while (iter != Rings.end()) {
+        if (((*iter)->References.load(std::memory_order_acquire) == 1)
+            && ((*iter)->Tail.load(std::memory_order_relaxed) == (*iter)->Head.load(std::memory_order_acquire))) {
+            // keep the drop count of exited threads, messages dropped
+            // after the loop above will be reported by the next call
+            const unsigned long long droppedTotal = (*iter)->Dropped.load(std::memory_order_relaxed);
+            DroppedWithoutRing.fetch_add(droppedTotal, std::memory_order_relaxed);
+            DroppedWithoutRingReported += (*iter)->DroppedReported;
+            (*iter)->Release();
+            iter = Rings.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
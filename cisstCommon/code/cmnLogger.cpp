@@ -24,6 +24,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstRevision.h>
 #include <cisstCommon/cmnPortability.h>
 #include <cisstCommon/cmnLogger.h>
+#include <cisstCommon/cmnLogAsyncStreambuf.h>
 #include <cisstCommon/cmnClassRegister.h>
 
 // to provide some information regarding this build
@@ -49,7 +50,9 @@ bool cmnLogger::SetDefaultLogFileName(const std::string & defaultLogFileName)
 cmnLogger::cmnLogger(const std::string & defaultLogFileName):
     Mask(CMN_LOG_ALLOW_ALL),
     FunctionMask(CMN_LOG_ALLOW_ERRORS),
-    LoDMultiplexerStreambuf()
+    LoDMultiplexerStreambuf(),
+    AsyncStreambuf(0),
+    CurrentMultiplexer(&LoDMultiplexerStreambuf)
 {
     cmnLogger::InstanceCreated = true;
     LoDMultiplexerStreambuf.AddChannel(*(DefaultLogFile(defaultLogFileName)), CMN_LOG_ALLOW_DEFAULT);
@@ -64,6 +67,16 @@ cmnLogger::cmnLogger(const std::string & defaultLogFileName):
 }
 
 
+cmnLogger::~cmnLogger()
+{
+    CurrentMultiplexer.store(&LoDMultiplexerStreambuf);
+    if (AsyncStreambuf) {
+        delete AsyncStreambuf;
+        AsyncStreambuf = 0;
+    }
+}
+
+
 cmnLogger * cmnLogger::Instance(void)
 {
     // create a static variable, i.e. singleton
@@ -100,7 +113,7 @@ cmnLogMask cmnLogger::GetMaskFunctionInstance(void)
 
 cmnLogger::StreamBufType * cmnLogger::GetMultiplexerInstance(void)
 {
-    return &(LoDMultiplexerStreambuf);
+    return CurrentMultiplexer.load(std::memory_order_acquire);
 }
 
 
@@ -113,25 +126,36 @@ std::ofstream * cmnLogger::DefaultLogFile(const std::string & defaultLogFileName
 
 void cmnLogger::HaltDefaultLogInstance(void)
 {
+    FlushInstance();
+    LockOutputs();
     LoDMultiplexerStreambuf.RemoveChannel(*(DefaultLogFile()));
+    UnlockOutputs();
 }
 
 
 void cmnLogger::ResumeDefaultLogInstance(cmnLogMask newMask)
 {
+    LockOutputs();
     LoDMultiplexerStreambuf.AddChannel(*(DefaultLogFile()), newMask);
+    UnlockOutputs();
 }
 
 
 void cmnLogger::AddChannelInstance(std::ostream & outputStream, cmnLogMask mask)
 {
+    LockOutputs();
     LoDMultiplexerStreambuf.AddChannel(outputStream, mask);
+    UnlockOutputs();
 }
 
 
 void cmnLogger::RemoveChannelInstance(std::ostream & outputStream)
 {
+    // write pending messages before the caller can close the stream
+    FlushInstance();
+    LockOutputs();
     LoDMultiplexerStreambuf.RemoveChannel(outputStream);
+    UnlockOutputs();
 }
 
 
@@ -173,5 +197,65 @@ void cmnLogger::KillInstance(void)
     cmnLogger::SetMaskClassAll(CMN_LOG_ALLOW_NONE);
     cmnLogger::SetMaskFunction(CMN_LOG_ALLOW_NONE);
     cmnLogger::SetMask(CMN_LOG_ALLOW_NONE);
+    FlushInstance();
+    LockOutputs();
     LoDMultiplexerStreambuf.RemoveAllChannels();
+    UnlockOutputs();
+}
+
+
+void cmnLogger::SetAsynchronousInstance(const bool asynchronous, const size_t numberOfRecords)
+{
+    if (asynchronous) {
+        if (!AsyncStreambuf) {
+            AsyncStreambuf = new cmnLogAsyncStreambuf(numberOfRecords);
+            AsyncStreambuf->AddMultiplexer(&LoDMultiplexerStreambuf);
+        }
+        CurrentMultiplexer.store(AsyncStreambuf, std::memory_order_release);
+    } else {
+        // threads might still be using the asynchronous multiplexer,
+        // keep it until the logger is destroyed
+        CurrentMultiplexer.store(&LoDMultiplexerStreambuf, std::memory_order_release);
+        FlushInstance();
+    }
+}
+
+
+bool cmnLogger::IsAsynchronousInstance(void) const
+{
+    return (AsyncStreambuf != 0)
+        && (CurrentMultiplexer.load(std::memory_order_acquire) == AsyncStreambuf);
+}
+
+
+void cmnLogger::FlushInstance(void)
+{
+    if (AsyncStreambuf) {
+        AsyncStreambuf->Flush();
+    }
+}
+
+
+unsigned long long cmnLogger::GetNumberOfDroppedMessagesInstance(void) const
+{
+    if (AsyncStreambuf) {
+        return AsyncStreambuf->GetNumberOfDroppedMessages();
+    }
+    return 0;
+}
+
+
+void cmnLogger::LockOutputs(void)
+{
+    if (AsyncStreambuf) {
+        AsyncStreambuf->LockOutputs();
+    }
+}
+
+
+void cmnLogger::UnlockOutputs(void)
+{
+    if (AsyncStreambuf) {
+        AsyncStreambuf->UnlockOutputs();
+    }
 }
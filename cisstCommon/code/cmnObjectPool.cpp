@@ -0,0 +1,165 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstCommon/cmnObjectPool.h>
+#include <cisstCommon/cmnAssert.h>
+#include <cisstCommon/cmnLogger.h>
+
+#include <new>
+
+namespace {
+    // the owner of each block (pool or 0 for the heap) is stored in
+    // front of the block, cmnObjectPool::ReleaseToOwner doesn't need
+    // any lookup
+    const size_t HEADER_SIZE = alignof(std::max_align_t);
+
+    thread_local bool HeapAllocationCheck = false;
+
+    const unsigned long long INDEX_MASK = 0xFFFFFFFFull;
+    const unsigned long long TAG_INCREMENT = 0x100000000ull;
+}
+
+
+cmnObjectPool::cmnObjectPool(const size_t blockSize, const size_t numberOfBlocks):
+    NumberOfBlocks(numberOfBlocks),
+    Memory(0),
+    End(0),
+    Next(0),
+    Head(0),
+    Used(0),
+    Failures(0)
+{
+    // round up block size so all blocks are aligned
+    const size_t alignment = alignof(std::max_align_t);
+    BlockSize = ((blockSize + alignment - 1) / alignment) * alignment;
+    if (BlockSize == 0) {
+        BlockSize = alignment;
+    }
+    if (NumberOfBlocks >= INDEX_MASK) {
+        NumberOfBlocks = INDEX_MASK - 1;
+    }
+    if (NumberOfBlocks == 0) {
+        return;
+    }
+
+    Memory = static_cast<char *>(::operator new((BlockSize + HEADER_SIZE) * NumberOfBlocks));
+    End = Memory + (BlockSize + HEADER_SIZE) * NumberOfBlocks;
+    Next = new std::atomic<unsigned int>[NumberOfBlocks];
+    for (size_t index = 0; index < NumberOfBlocks; ++index) {
+        Next[index].store(static_cast<unsigned int>((index + 2 <= NumberOfBlocks) ? index + 2 : 0));
+    }
+    Head.store(1);
+}
+
+
+cmnObjectPool::~cmnObjectPool()
+{
+    if (Used.load() != 0) {
+        CMN_LOG_INIT_ERROR << "cmnObjectPool: destructor called while "
+                           << Used.load() << " block(s) are still in use" << std::endl;
+    }
+    delete[] Next;
+    ::operator delete(Memory);
+}
+
+
+void * cmnObjectPool::Allocate(const size_t size)
+{
+    if (size > BlockSize) {
+        return 0;
+    }
+    unsigned long long head = Head.load(std::memory_order_acquire);
+    while (true) {
+        const unsigned long long index = head & INDEX_MASK;
+        if (index == 0) {
+            Failures.fetch_add(1, std::memory_order_relaxed);
+            return 0;
+        }
+        const unsigned long long next = Next[index - 1].load(std::memory_order_relaxed);
+        const unsigned long long newHead = ((head & ~INDEX_MASK) + TAG_INCREMENT) | next;
+        if (Head.compare_exchange_weak(head, newHead,
+                                       std::memory_order_acquire, std::memory_order_acquire)) {
+            Used.fetch_add(1, std::memory_order_relaxed);
+            char * start = Memory + (index - 1) * (BlockSize + HEADER_SIZE);
+            *reinterpret_cast<cmnObjectPool **>(start) = this;
+            return start + HEADER_SIZE;
+        }
+    }
+}
+
+
+void cmnObjectPool::Release(void * block)
+{
+    CMN_ASSERT(Owns(block));
+    const unsigned long long index = (static_cast<char *>(block) - HEADER_SIZE - Memory) / (BlockSize + HEADER_SIZE) + 1;
+    unsigned long long head = Head.load(std::memory_order_relaxed);
+    while (true) {
+        Next[index - 1].store(static_cast<unsigned int>(head & INDEX_MASK), std::memory_order_relaxed);
+        const unsigned long long newHead = ((head & ~INDEX_MASK) + TAG_INCREMENT) | index;
+        if (Head.compare_exchange_weak(head, newHead,
+                                       std::memory_order_release, std::memory_order_relaxed)) {
+            Used.fetch_sub(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+
+size_t cmnObjectPool::GetNumberOfBlocksUsed(void) const
+{
+    return Used.load();
+}
+
+
+unsigned long long cmnObjectPool::GetNumberOfFailures(void) const
+{
+    return Failures.load();
+}
+
+
+void * cmnObjectPool::AllocateFromHeap(const size_t size)
+{
+    char * start = static_cast<char *>(::operator new(size + HEADER_SIZE));
+    *reinterpret_cast<cmnObjectPool **>(start) = 0;
+    return start + HEADER_SIZE;
+}
+
+
+void cmnObjectPool::ReleaseToOwner(void * block)
+{
+    char * start = static_cast<char *>(block) - HEADER_SIZE;
+    cmnObjectPool * pool = *reinterpret_cast<cmnObjectPool **>(start);
+    if (pool) {
+        pool->Release(block);
+    } else {
+        ::operator delete(start);
+    }
+}
+
+
+void cmnObjectPool::SetHeapAllocationCheck(const bool enable)
+{
+    HeapAllocationCheck = enable;
+}
+
+
+bool cmnObjectPool::GetHeapAllocationCheck(void)
+{
+    return HeapAllocationCheck;
+}
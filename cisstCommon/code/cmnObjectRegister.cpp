@@ -36,24 +36,18 @@ bool cmnObjectRegister::RegisterInstance(const std::string & objectName,
     iterator what = ObjectContainer.find(objectName);
     if (what == ObjectContainer.end()) {
         // verify that the pointer itself is not registered
-        const iterator end = ObjectContainer.end();
-        iterator iter = ObjectContainer.begin();
-        iterator found = end;
-        while ((iter != end) && (found == end)) {
-            if (iter->second == objectPointer) {
-                found = iter;
-            }
-            iter++;
-        }
-        if (found != end) {
+        const NameContainerType::const_iterator found = NameContainer.find(objectPointer);
+        if (found != NameContainer.end()) {
             // pointer already registered
             CMN_LOG_INIT_ERROR << "class cmnObjectRegister: Registration failed.  There is already a registered object with the address: "
                                << objectPointer
-                               << " (name: " << found->first << ")" << std::endl;
+                               << " (name: " << found->second << ")" << std::endl;
             return false;
         } else {
             // actually register
             ObjectContainer[objectName] = objectPointer;
+            NameContainer[objectPointer] = objectName;
+            HashContainer.insert(HashContainerType::value_type(cmnClassRegister::NameHash(objectName), objectPointer));
             return true;
         }
     } else {
@@ -67,17 +61,33 @@ bool cmnObjectRegister::RegisterInstance(const std::string & objectName,
 
 
 bool cmnObjectRegister::RemoveInstance(const std::string & objectName) {
-    if (ObjectContainer.erase(objectName) == 0) {
+    const iterator what = ObjectContainer.find(objectName);
+    if (what == ObjectContainer.end()) {
         CMN_LOG_INIT_ERROR << "class cmnObjectRegister: " << objectName
                            << " can not be removed from the register since it is not registered"
                            << std::endl;
         return false;
     }
+    const HashContainerType::iterator hashIterator = HashContainer.find(cmnClassRegister::NameHash(objectName));
+    if ((hashIterator != HashContainer.end()) && (hashIterator->second == what->second)) {
+        HashContainer.erase(hashIterator);
+    }
+    NameContainer.erase(what->second);
+    ObjectContainer.erase(what);
     return true;
 }
 
 
 cmnGenericObject * cmnObjectRegister::FindObjectInstance(const std::string& objectName) const {
+    // fast path using the hash index, a single string comparison to
+    // handle collisions
+    const HashContainerType::const_iterator hashIterator = HashContainer.find(cmnClassRegister::NameHash(objectName));
+    if (hashIterator != HashContainer.end()) {
+        const NameContainerType::const_iterator nameIterator = NameContainer.find(hashIterator->second);
+        if ((nameIterator != NameContainer.end()) && (nameIterator->second == objectName)) {
+            return hashIterator->second;
+        }
+    }
     cmnGenericObject * result = NULL;
     const_iterator what = ObjectContainer.find(objectName);
     if (what != ObjectContainer.end()) {
@@ -87,15 +97,19 @@ cmnGenericObject * cmnObjectRegister::FindObjectInstance(const std::string& obje
 }
 
 
+cmnGenericObject * cmnObjectRegister::FindObjectInstance(const cmnClassRegister::NameHashType nameHash) const {
+    const HashContainerType::const_iterator iterator = HashContainer.find(nameHash);
+    if (iterator != HashContainer.end()) {
+        return iterator->second;
+    }
+    return NULL;
+}
+
+
 std::string cmnObjectRegister::FindNameInstance(cmnGenericObject * objectPointer) const {
-    const const_iterator end = ObjectContainer.end();
-    const_iterator iter = ObjectContainer.begin();
-    const_iterator found = end;
-    while ((iter != end) && (found == end)) {
-        if (iter->second == objectPointer) {
-            return iter->first;
-        }
-        iter++;
+    const NameContainerType::const_iterator found = NameContainer.find(objectPointer);
+    if (found != NameContainer.end()) {
+        return found->second;
     }
     return "undefined";
 }
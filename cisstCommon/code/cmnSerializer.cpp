@@ -35,10 +35,7 @@ cmnSerializer::~cmnSerializer()
 
 bool cmnSerializer::ServicesSerialized(const cmnClassServicesBase *servicesPointer) const {
     // search for services pointer to see if the information has been sent
-    const const_iterator begin = ServicesContainer.begin();
-    const const_iterator end = ServicesContainer.end();
-    const_iterator found = std::find(begin, end, servicesPointer);
-    return (found != end);
+    return (ServicesContainer.find(servicesPointer) != ServicesContainer.end());
 }
 
 void cmnSerializer::Reset(void)
@@ -70,7 +67,7 @@ void cmnSerializer::SerializeServices(const cmnClassServicesBase * servicesPoint
         cmnSerializeRaw(this->OutputStream, servicesPointer->GetName());
         TypeId typeId = reinterpret_cast<TypeId>(servicesPointer);
         cmnSerializeRaw(this->OutputStream, typeId);
-        ServicesContainer.push_back(servicesPointer);
+        ServicesContainer.insert(servicesPointer);
     }
 }
 
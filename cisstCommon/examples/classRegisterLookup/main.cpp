@@ -0,0 +1,136 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+/*
+  Throughput of cmnClassRegister lookups for all registered classes,
+  i.e. what the de-serializer and the dynamic creation do for each
+  object received.  This compares a search in a std::map sorted by
+  name and a linear search by std::type_info (previous implementation)
+  to the lookups by name, by name hash and by std::type_info.
+*/
+
+#include <cisstCommon/cmnClassRegister.h>
+#include <cisstCommon/cmnClassServicesBase.h>
+#include <cisstCommon/cmnCommandLineOptions.h>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <vector>
+
+struct ClassEntry {
+    std::string Name;
+    cmnClassRegister::NameHashType NameHash;
+    const std::type_info * TypeInfo;
+};
+
+template <class _lookup>
+void Benchmark(const std::string & name, const std::vector<ClassEntry> & classes,
+               size_t numberOfIterations, _lookup lookup)
+{
+    size_t found = 0;
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (size_t iteration = 0; iteration < numberOfIterations; ++iteration) {
+        for (size_t index = 0; index < classes.size(); ++index) {
+            if (lookup(classes[index])) {
+                found++;
+            }
+        }
+    }
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    const double elapsed = std::chrono::duration<double>(end - start).count();
+    const double numberOfLookups = static_cast<double>(numberOfIterations * classes.size());
+    std::cout << std::fixed << std::setprecision(1)
+              << std::setw(32) << std::left << name << std::right
+              << std::setw(10) << (elapsed / numberOfLookups) * 1.0e9 << " ns/lookup"
+              << std::setw(10) << (numberOfLookups / elapsed) * 1.0e-6 << " Mlookups/s";
+    if (found != numberOfIterations * classes.size()) {
+        std::cout << " (" << numberOfIterations * classes.size() - found << " not found)";
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char ** argv)
+{
+    cmnLogger::SetMask(CMN_LOG_ALLOW_ALL);
+    cmnLogger::AddChannel(std::cout, CMN_LOG_ALLOW_ERRORS_AND_WARNINGS);
+
+    int numberOfIterations = 20000;
+    cmnCommandLineOptions options;
+    options.AddOptionOneValue("n", "number",
+                              "number of lookups per registered class (default 20000)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &numberOfIterations);
+    if (!options.Parse(argc, argv, std::cerr)) {
+        return -1;
+    }
+    if (numberOfIterations <= 0) {
+        std::cerr << "number must be greater than 0" << std::endl;
+        return -1;
+    }
+
+    // copy of the register content, lookups are performed in the
+    // register order
+    std::vector<ClassEntry> classes;
+    std::map<std::string, cmnClassServicesBase *> byName;
+    cmnClassRegister::const_iterator iterator;
+    const cmnClassRegister::const_iterator end = cmnClassRegister::end();
+    for (iterator = cmnClassRegister::begin(); iterator != end; ++iterator) {
+        ClassEntry entry;
+        entry.Name = iterator->first;
+        entry.NameHash = iterator->second->GetNameHash();
+        entry.TypeInfo = iterator->second->TypeInfoPointer();
+        classes.push_back(entry);
+        byName[iterator->first] = iterator->second;
+    }
+    std::cout << classes.size() << " registered classes, "
+              << numberOfIterations << " lookups per class" << std::endl;
+
+    const size_t iterations = static_cast<size_t>(numberOfIterations);
+    Benchmark("std::map by name", classes, iterations,
+              [&byName](const ClassEntry & entry) {
+                  return byName.find(entry.Name) != byName.end();
+              });
+    // linear search by type, only a tenth of the iterations
+    Benchmark("linear search by type_info", classes, iterations / 10 + 1,
+              [&byName](const ClassEntry & entry) {
+                  std::map<std::string, cmnClassServicesBase *>::const_iterator it;
+                  for (it = byName.begin(); it != byName.end(); ++it) {
+                      if (*(it->second->TypeInfoPointer()) == *(entry.TypeInfo)) {
+                          return true;
+                      }
+                  }
+                  return false;
+              });
+    Benchmark("FindClassServices(name)", classes, iterations,
+              [](const ClassEntry & entry) {
+                  return cmnClassRegister::FindClassServices(entry.Name) != 0;
+              });
+    Benchmark("FindClassServices(hash)", classes, iterations,
+              [](const ClassEntry & entry) {
+                  return cmnClassRegister::FindClassServices(entry.NameHash) != 0;
+              });
+    Benchmark("FindClassServices(type_info)", classes, iterations,
+              [](const ClassEntry & entry) {
+                  return cmnClassRegister::FindClassServices(*(entry.TypeInfo)) != 0;
+              });
+
+    return 0;
+}
@@ -355,3 +355,29 @@ void cmnClassRegisterTest::TestIterators(void)
     CPPUNIT_ASSERT(foundC2);
 }
 
+
+void cmnClassRegisterTest::TestNameHash(void)
+{
+    // hash only depends on the name, reference value for 64 bits FNV-1a
+    CPPUNIT_ASSERT_EQUAL(14695981039346656037ull, cmnClassRegister::NameHash(""));
+    CPPUNIT_ASSERT_EQUAL(0xaf63dc4c8601ec8cull, cmnClassRegister::NameHash("a"));
+    CPPUNIT_ASSERT(cmnClassRegister::NameHash("TestA") != cmnClassRegister::NameHash("TestB"));
+
+    // hash computed at registration
+    const cmnClassServicesBase * servicesA = TestA::ClassServices();
+    CPPUNIT_ASSERT_EQUAL(cmnClassRegister::NameHash("TestA"), servicesA->GetNameHash());
+
+    // lookups by hash, name and type info all agree
+    CPPUNIT_ASSERT(cmnClassRegister::FindClassServices(servicesA->GetNameHash()) == servicesA);
+    CPPUNIT_ASSERT(cmnClassRegister::FindClassServices(cmnClassRegister::NameHash("TestC2")) == TestC2::ClassServices());
+    CPPUNIT_ASSERT(cmnClassRegister::FindClassServices(typeid(TestA)) == servicesA);
+    CPPUNIT_ASSERT(cmnClassRegister::FindClassServices(cmnClassRegister::NameHash("TestC1")) == 0);
+
+    // all registered classes can be found by hash
+    cmnClassRegister::const_iterator iter = cmnClassRegister::begin();
+    const cmnClassRegister::const_iterator end = cmnClassRegister::end();
+    for (; iter != end; ++iter) {
+        CPPUNIT_ASSERT(cmnClassRegister::FindClassServices(iter->second->GetNameHash()) == iter->second);
+        CPPUNIT_ASSERT(cmnClassRegister::FindClassServices(iter->first) == iter->second);
+    }
+}
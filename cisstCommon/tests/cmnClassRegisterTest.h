@@ -131,6 +131,7 @@ class cmnClassRegisterTest : public CppUnit::TestFixture
     CPPUNIT_TEST(TestLog);
     CPPUNIT_TEST(TestDynamicCreation);
     CPPUNIT_TEST(TestIterators);
+    CPPUNIT_TEST(TestNameHash);
     CPPUNIT_TEST_SUITE_END();
 
  public:
@@ -163,6 +164,9 @@ class cmnClassRegisterTest : public CppUnit::TestFixture
     /*! Test iterators */
     void TestIterators(void);
 
+    /*! Test lookups by name hash and type info */
+    void TestNameHash(void);
+
 protected:
     /* add an output stream to check the log */
     std::stringstream OutputStream;
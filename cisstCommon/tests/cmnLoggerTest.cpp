@@ -21,6 +21,10 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <cisstCommon/cmnLogger.h>
 #include <cisstCommon/cmnPath.h>
+#include <cisstCommon/cmnLogAsyncStreambuf.h>
+
+#include <sstream>
+#include <thread>
 
 void cmnLoggerTest::TestLoggerFileName(void)
 {
@@ -59,3 +63,76 @@ void cmnLoggerTest::TestLoggerFileName(void)
         CPPUNIT_ASSERT_EQUAL(std::string("cisstLog.txt"), cmnLogger::GetDefaultLogFileName());
     }
 }
+
+
+namespace {
+    void cmnLoggerTestLogMessages(const std::string & prefix) {
+        for (size_t index = 0; index < 100; ++index) {
+            CMN_LOG_INIT_ERROR << prefix << " message " << index << std::endl;
+        }
+    }
+
+    size_t cmnLoggerTestCount(const std::string & text, const std::string & pattern) {
+        size_t count = 0;
+        size_t position = text.find(pattern);
+        while (position != std::string::npos) {
+            ++count;
+            position = text.find(pattern, position + pattern.size());
+        }
+        return count;
+    }
+}
+
+
+void cmnLoggerTest::TestAsynchronous(void)
+{
+    std::stringstream output;
+    cmnLogger::AddChannel(output, CMN_LOG_ALLOW_ERRORS);
+    cmnLogger::SetAsynchronous(true);
+    CPPUNIT_ASSERT(cmnLogger::IsAsynchronous());
+
+    std::thread other(cmnLoggerTestLogMessages, std::string("other"));
+    cmnLoggerTestLogMessages("main");
+    other.join();
+
+    cmnLogger::SetAsynchronous(false);
+    CPPUNIT_ASSERT(!cmnLogger::IsAsynchronous());
+    cmnLogger::RemoveChannel(output);
+
+    // all messages are complete and on their own line
+    const std::string text = output.str();
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(100), cmnLoggerTestCount(text, " main message "));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(100), cmnLoggerTestCount(text, " other message "));
+    CPPUNIT_ASSERT(text.find("main message 99\n") != std::string::npos);
+    CPPUNIT_ASSERT(text.find("other message 99\n") != std::string::npos);
+    CPPUNIT_ASSERT_EQUAL(static_cast<unsigned long long>(0), cmnLogger::GetNumberOfDroppedMessages());
+}
+
+
+void cmnLoggerTest::TestAsynchronousDropped(void)
+{
+    std::stringstream output;
+    {
+        // long period so the background thread doesn't drain the ring
+        cmnLogAsyncStreambuf asyncStreambuf(4, 100.0);
+        asyncStreambuf.AddChannel(output, CMN_LOG_ALLOW_ALL);
+        for (size_t index = 0; index < 10; ++index) {
+            cmnLODOutputMultiplexer(&asyncStreambuf, CMN_LOG_LEVEL_RUN_WARNING).Ref()
+                << "message " << index << std::endl;
+        }
+        CPPUNIT_ASSERT_EQUAL(static_cast<unsigned long long>(6), asyncStreambuf.GetNumberOfDroppedMessages());
+        asyncStreambuf.Flush();
+        std::string text = output.str();
+        CPPUNIT_ASSERT(text.find("message 3\n") != std::string::npos);
+        CPPUNIT_ASSERT(text.find("message 4\n") == std::string::npos);
+        CPPUNIT_ASSERT(text.find("dropped 6 message(s)") != std::string::npos);
+
+        // messages longer than a record use multiple records
+        const std::string longMessage(cmnLogAsyncStreambuf::RECORD_SIZE * 2 + 10, 'x');
+        cmnLODOutputMultiplexer(&asyncStreambuf, CMN_LOG_LEVEL_RUN_WARNING).Ref()
+            << longMessage << std::endl;
+        asyncStreambuf.Flush();
+        text = output.str();
+        CPPUNIT_ASSERT(text.find(longMessage + "\n") != std::string::npos);
+    }
+}
@@ -27,6 +27,8 @@ class cmnLoggerTest : public CppUnit::TestFixture
     CPPUNIT_TEST_SUITE(cmnLoggerTest);
     {
         CPPUNIT_TEST(TestLoggerFileName);
+        CPPUNIT_TEST(TestAsynchronous);
+        CPPUNIT_TEST(TestAsynchronousDropped);
     }
     CPPUNIT_TEST_SUITE_END();
     
@@ -38,6 +40,14 @@ class cmnLoggerTest : public CppUnit::TestFixture
     }
     
     void TestLoggerFileName(void);
+
+    /*! Check that messages from multiple threads are all written
+      when the logger is asynchronous */
+    void TestAsynchronous(void);
+
+    /*! Check that messages are dropped and counted when a thread's
+      buffer is full */
+    void TestAsynchronousDropped(void);
 };
 
 
@@ -0,0 +1,156 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+#include "cmnObjectPoolTest.h"
+
+#include <set>
+#include <thread>
+#include <vector>
+
+CMN_IMPLEMENT_SERVICES(cmnObjectPoolTestObject);
+
+
+void cmnObjectPoolTest::TestPool(void)
+{
+    cmnObjectPool pool(20, 4);
+    CPPUNIT_ASSERT(pool.GetBlockSize() >= 20);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), pool.GetNumberOfBlocks());
+
+    // too large
+    CPPUNIT_ASSERT(pool.Allocate(pool.GetBlockSize() + 1) == 0);
+
+    // use all blocks, all different and aligned
+    std::set<void *> blocks;
+    for (size_t index = 0; index < 4; ++index) {
+        void * block = pool.Allocate(20);
+        CPPUNIT_ASSERT(block != 0);
+        CPPUNIT_ASSERT(pool.Owns(block));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0),
+                             reinterpret_cast<size_t>(block) % alignof(std::max_align_t));
+        blocks.insert(block);
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), blocks.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), pool.GetNumberOfBlocksUsed());
+
+    // exhausted
+    CPPUNIT_ASSERT(pool.Allocate(20) == 0);
+    CPPUNIT_ASSERT_EQUAL(1ull, pool.GetNumberOfFailures());
+
+    // release and reuse
+    void * block = *(blocks.begin());
+    pool.Release(block);
+    CPPUNIT_ASSERT(pool.Allocate(20) == block);
+
+    int onStack;
+    CPPUNIT_ASSERT(!pool.Owns(&onStack));
+    for (std::set<void *>::iterator iter = blocks.begin(); iter != blocks.end(); ++iter) {
+        cmnObjectPool::ReleaseToOwner(*iter);
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), pool.GetNumberOfBlocksUsed());
+}
+
+
+void cmnObjectPoolTest::TestMultiThreading(void)
+{
+    const size_t numberOfThreads = 4;
+    const size_t numberOfBlocks = 16;
+    cmnObjectPool pool(sizeof(size_t), numberOfBlocks);
+    std::vector<std::thread> threads;
+    std::vector<bool> results(numberOfThreads, true);
+    for (size_t threadIndex = 0; threadIndex < numberOfThreads; ++threadIndex) {
+        threads.push_back(std::thread([&pool, &results, threadIndex]() {
+                    for (size_t iteration = 0; iteration < 20000; ++iteration) {
+                        size_t * blocks[2];
+                        for (size_t index = 0; index < 2; ++index) {
+                            blocks[index] = static_cast<size_t *>(pool.Allocate(sizeof(size_t)));
+                            if (!blocks[index]) {
+                                results[threadIndex] = false;
+                                return;
+                            }
+                            *(blocks[index]) = threadIndex;
+                        }
+                        // another thread using the same block would
+                        // overwrite the values
+                        for (size_t index = 0; index < 2; ++index) {
+                            if (*(blocks[index]) != threadIndex) {
+                                results[threadIndex] = false;
+                            }
+                            pool.Release(blocks[index]);
+                        }
+                    }
+                }));
+    }
+    for (size_t threadIndex = 0; threadIndex < numberOfThreads; ++threadIndex) {
+        threads[threadIndex].join();
+        CPPUNIT_ASSERT(results[threadIndex]);
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), pool.GetNumberOfBlocksUsed());
+}
+
+
+void cmnObjectPoolTest::TestClassServices(void)
+{
+    cmnClassServicesBase * services = cmnObjectPoolTestObject::ClassServices();
+    cmnObjectPool pool(services->GetSize(), 2);
+    CPPUNIT_ASSERT(services->SetPool(&pool));
+    CPPUNIT_ASSERT(!services->SetPool(&pool));
+    CPPUNIT_ASSERT(services->GetPool() == &pool);
+
+    // default constructor and copy constructor use the pool
+    cmnGenericObject * object1 = services->Create();
+    CPPUNIT_ASSERT(pool.Owns(object1));
+    cmnObjectPoolTestObject * typed1 = dynamic_cast<cmnObjectPoolTestObject *>(object1);
+    CPPUNIT_ASSERT(typed1);
+    typed1->Values[2] = 3.0;
+    cmnGenericObject * object2 = services->Create(*object1);
+    CPPUNIT_ASSERT(pool.Owns(object2));
+    CPPUNIT_ASSERT_EQUAL(3.0, dynamic_cast<cmnObjectPoolTestObject *>(object2)->Values[2]);
+
+    // pool exhausted, use heap and count if check is enabled
+    cmnObjectPool::SetHeapAllocationCheck(true);
+    CPPUNIT_ASSERT(cmnObjectPool::GetHeapAllocationCheck());
+    cmnGenericObject * object3 = services->Create();
+    cmnObjectPool::SetHeapAllocationCheck(false);
+    CPPUNIT_ASSERT(object3);
+    CPPUNIT_ASSERT(!pool.Owns(object3));
+    CPPUNIT_ASSERT_EQUAL(1ull, services->GetNumberOfCheckedHeapAllocations());
+
+    // operator delete releases to the pool or heap
+    delete object1;
+    delete object2;
+    delete object3;
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), pool.GetNumberOfBlocksUsed());
+    object1 = services->Create();
+    CPPUNIT_ASSERT(pool.Owns(object1));
+    delete object1;
+
+    // pool already set
+    CPPUNIT_ASSERT(!services->CreatePool(4));
+
+    // remove the pool, back to heap
+    CPPUNIT_ASSERT(services->SetPool(0));
+    CPPUNIT_ASSERT(services->GetPool() == 0);
+    object1 = services->Create();
+    CPPUNIT_ASSERT(!pool.Owns(object1));
+    delete object1;
+}
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(cmnObjectPoolTest);
@@ -0,0 +1,65 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cisstCommon/cmnObjectPool.h>
+#include <cisstCommon/cmnGenericObject.h>
+#include <cisstCommon/cmnClassRegister.h>
+
+
+class cmnObjectPoolTestObject: public cmnGenericObject {
+    CMN_DECLARE_SERVICES(CMN_DYNAMIC_CREATION, CMN_LOG_ALLOW_DEFAULT);
+ public:
+    double Values[4];
+    inline cmnObjectPoolTestObject(void) {
+        Values[0] = Values[1] = Values[2] = Values[3] = 0.0;
+    }
+};
+CMN_DECLARE_SERVICES_INSTANTIATION(cmnObjectPoolTestObject);
+
+
+class cmnObjectPoolTest : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(cmnObjectPoolTest);
+    {
+        CPPUNIT_TEST(TestPool);
+        CPPUNIT_TEST(TestMultiThreading);
+        CPPUNIT_TEST(TestClassServices);
+    }
+    CPPUNIT_TEST_SUITE_END();
+
+ public:
+    void setUp(void) {
+    }
+
+    void tearDown(void) {
+    }
+
+    /*! Test allocations and releases */
+    void TestPool(void);
+
+    /*! Test concurrent allocations and releases */
+    void TestMultiThreading(void);
+
+    /*! Test objects created by class services with a pool */
+    void TestClassServices(void);
+};
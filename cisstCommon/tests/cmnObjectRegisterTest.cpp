@@ -40,6 +40,10 @@ void cmnObjectRegisterTest::TestRegistration(void) {
     std::string name = cmnObjectRegister::FindName(&object1);
     CPPUNIT_ASSERT(name == "object1");
 
+    // and find it by name hash
+    CPPUNIT_ASSERT(cmnObjectRegister::FindObject(cmnClassRegister::NameHash("object1")) == &object1);
+    CPPUNIT_ASSERT(cmnObjectRegister::FindObject(cmnClassRegister::NameHash("object2")) == 0);
+
     // try to re-register it with the same name
     CPPUNIT_ASSERT(!(cmnObjectRegister::Register("object1", &object1)));
 
@@ -56,5 +60,13 @@ void cmnObjectRegisterTest::TestRegistration(void) {
 
     // try to remove it again
     CPPUNIT_ASSERT(!(cmnObjectRegister::Remove("object1")));
+    CPPUNIT_ASSERT(cmnObjectRegister::FindObject("object1") == 0);
+    CPPUNIT_ASSERT(cmnObjectRegister::FindObject(cmnClassRegister::NameHash("object1")) == 0);
+    CPPUNIT_ASSERT(cmnObjectRegister::FindName(&object1) == "undefined");
+
+    // the address can be registered again
+    CPPUNIT_ASSERT(cmnObjectRegister::Register("object1bis", &object1));
+    CPPUNIT_ASSERT(cmnObjectRegister::FindName(&object1) == "object1bis");
+    CPPUNIT_ASSERT(cmnObjectRegister::Remove("object1bis"));
 }
 
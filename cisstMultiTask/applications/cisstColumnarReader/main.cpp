@@ -0,0 +1,113 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstCommon/cmnCommandLineOptions.h>
+#include <cisstMultiTask/mtsCollectorColumnarReader.h>
+
+#include <iostream>
+#include <fstream>
+#include <limits>
+
+int main(int argc, char * argv[])
+{
+    std::string inputFile;
+    std::string outputFile;
+    double startTime = -std::numeric_limits<double>::max();
+    double endTime = std::numeric_limits<double>::max();
+
+    cmnCommandLineOptions options;
+
+    options.AddOptionOneValue("f", "file",
+                              "columnar file created by a state collector (.ccol)",
+                              cmnCommandLineOptions::REQUIRED_OPTION, &inputFile);
+
+    options.AddOptionOneValue("s", "start",
+                              "start time, default is beginning of file",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &startTime);
+
+    options.AddOptionOneValue("e", "end",
+                              "end time, default is end of file",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &endTime);
+
+    options.AddOptionOneValue("o", "output",
+                              "CSV file to save the rows in the time range, if not provided only the file information is displayed",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &outputFile);
+
+    std::string errorMessage;
+    if (!options.Parse(argc, argv, errorMessage)) {
+        std::cerr << "Error: " << errorMessage << std::endl;
+        options.PrintUsage(std::cerr);
+        return -1;
+    }
+
+    mtsCollectorColumnarReader reader;
+    if (!reader.Open(inputFile)) {
+        std::cerr << "Error: failed to open \"" << inputFile << "\"" << std::endl;
+        return -1;
+    }
+
+    std::cout << "File          : " << inputFile << std::endl
+              << "Rows          : " << reader.GetNumberOfRows() << std::endl
+              << "Chunks        : " << reader.GetNumberOfChunks() << std::endl
+              << "Time range    : " << reader.GetStartTime() << " - " << reader.GetEndTime() << std::endl
+              << "Columns       : " << reader.GetNumberOfColumns() << std::endl;
+    size_t column;
+    for (column = 0; column < reader.GetNumberOfColumns(); ++column) {
+        const mtsCollectorColumnarReader::ColumnDescription & description = reader.GetColumn(column);
+        std::cout << " - " << description.Name << " (" << description.ElementSize << " bytes, "
+                  << (description.ElementSize / description.ScalarSize) << " x "
+                  << static_cast<char>(description.Kind) << description.ScalarSize << ")" << std::endl;
+    }
+
+    if (outputFile.empty()) {
+        return 0;
+    }
+
+    mtsCollectorColumnarReader::Rows rows;
+    if (!reader.ReadTimeRange(startTime, endTime, rows)) {
+        std::cerr << "Error: failed to read \"" << inputFile << "\"" << std::endl;
+        return -1;
+    }
+
+    std::ofstream output(outputFile.c_str());
+    if (!output.is_open()) {
+        std::cerr << "Error: failed to create \"" << outputFile << "\"" << std::endl;
+        return -1;
+    }
+    output.precision(17);
+    output << "Ticks,Time";
+    for (column = 0; column < reader.GetNumberOfColumns(); ++column) {
+        output << ',' << reader.GetColumn(column).Fields;
+    }
+    output << std::endl;
+    for (size_t row = 0; row < rows.size(); ++row) {
+        output << rows.Ticks[row] << ',' << rows.Times[row];
+        for (column = 0; column < reader.GetNumberOfColumns(); ++column) {
+            const mtsCollectorColumnarReader::ColumnDescription & description = reader.GetColumn(column);
+            const size_t numberOfScalars = description.ElementSize / description.ScalarSize;
+            for (size_t scalar = 0; scalar < numberOfScalars; ++scalar) {
+                output << ',' << reader.GetScalar(rows, column, row, scalar);
+            }
+        }
+        output << std::endl;
+    }
+    std::cout << "Saved " << rows.size() << " rows to \"" << outputFile << "\"" << std::endl;
+    return 0;
+}
@@ -18,6 +18,7 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <string>
 #include <set>
+#include <map>
 #include <functional>
 #include <fstream>
 
@@ -27,6 +28,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstMultiTask/mtsManagerGlobal.h>
 #include <cisstMultiTask/mtsTaskContinuous.h>
 #include <cisstMultiTask/mtsManagerComponentServices.h>
+#include <cisstMultiTask/mtsCommandStatistics.h>
 
 class MainDispatcher : public mtsTaskMain
 {
@@ -244,6 +246,10 @@ class shellTask : public mtsTaskContinuous
    typedef std::set<CommandEntryBase *, CmdListLess> CmdListType;
    CmdListType CommandList;
 
+   // functions used to read command statistics, one per connected provided interface
+   typedef std::map<std::string, mtsFunctionRead *> StatisticsFunctionsType;
+   StatisticsFunctionsType StatisticsFunctions;
+
 public:
     // The constructor specifies that a new thread should be created (third parameter true)
     // because otherwise the system doesn't work. It seems that the blocking I/O (i.e., waiting
@@ -270,6 +276,9 @@ public:
     bool Viewer(void) const;
     bool WaitFor(const std::vector<std::string> &args);
     bool Echo(const std::string &message) const;
+    bool Statistics(const std::string &componentName, const std::string &interfaceName) const;
+    bool Statistics(const std::string &processName, const std::string &componentName,
+                    const std::string &interfaceName) const;
 };
 
 CMN_DECLARE_SERVICES_INSTANTIATION(shellTask)
@@ -301,6 +310,11 @@ void shellTask::Configure(const std::string &)
                                                              &shellTask::WaitFor, this));
     CommandList.insert(new CommandEntryMethodStr1<shellTask>("echo", "<\"message_string\">",
                                                              &shellTask::Echo, this));
+    CommandList.insert(new CommandEntryMethodStr2<shellTask>("statistics", "<component_name> <interface_name>",
+                                                             &shellTask::Statistics, this));
+    CommandList.insert(new CommandEntryMethodStr3<shellTask>("statistics",
+                                                             "<process_name> <component_name> <interface_name>",
+                                                             &shellTask::Statistics, this));
     mtsManagerComponentServices *Manager = GetManagerComponentServices();
     if (Manager) {
         CommandList.insert(new CommandEntryMethodStr2<mtsManagerComponentServices>(
@@ -684,6 +698,56 @@ bool shellTask::Echo(const std::string &message) const
     return true;
 }
 
+bool shellTask::Statistics(const std::string &componentName, const std::string &interfaceName) const
+{
+    return Statistics(mtsManagerLocal::GetInstance()->GetProcessName(), componentName, interfaceName);
+}
+
+// Read the command statistics of a provided interface, see mtsInterfaceProvided::EnableCommandStatistics.
+// A required interface is added and connected the first time statistics are requested.
+bool shellTask::Statistics(const std::string &processName, const std::string &componentName,
+                           const std::string &interfaceName) const
+{
+    shellTask *nonConstThis = const_cast<shellTask *>(this);
+    const std::string requiredName = "Statistics-" + processName + "-" + componentName + "-" + interfaceName;
+    mtsFunctionRead *getStatistics;
+    StatisticsFunctionsType::const_iterator found = StatisticsFunctions.find(requiredName);
+    if (found == StatisticsFunctions.end()) {
+        mtsInterfaceRequired *required = nonConstThis->AddInterfaceRequired(requiredName);
+        if (!required) {
+            std::cout << "Statistics: failed to add required interface " << requiredName << std::endl;
+            return false;
+        }
+        getStatistics = new mtsFunctionRead;
+        required->AddFunction("GetCommandStatistics", *getStatistics);
+        nonConstThis->StatisticsFunctions[requiredName] = getStatistics;
+        const std::string thisProcessName = mtsManagerLocal::GetInstance()->GetProcessName();
+        if (!ManagerComponentServices->Connect(thisProcessName, GetName(), requiredName,
+                                               processName, componentName, interfaceName)) {
+            std::cout << "Statistics: failed to connect to " << processName << ":" << componentName
+                      << ":" << interfaceName << std::endl;
+            return false;
+        }
+    } else {
+        getStatistics = found->second;
+    }
+    // connection is performed by the manager component, wait for it to complete
+    for (size_t attempt = 0; !getStatistics->IsValid() && (attempt < 20); attempt++) {
+        osaSleep(0.1);
+    }
+    mtsCommandStatistics statistics;
+    mtsExecutionResult result = (*getStatistics)(statistics);
+    if (!result.IsOK()) {
+        std::cout << "Statistics: failed to read command statistics (" << result << "), make sure "
+                  << "EnableCommandStatistics was called for interface " << interfaceName << std::endl;
+        return false;
+    }
+    std::cout << "Command statistics for " << processName << ":" << componentName << ":" << interfaceName
+              << " (times in seconds)" << std::endl
+              << statistics;
+    return true;
+}
+
 // Syntax:  cisstComponentManager [global|local|ip_addr] [process_name] [-e filename] [-c commands]
 int main(int argc, char * argv[])
 {
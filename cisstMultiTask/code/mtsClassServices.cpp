@@ -80,6 +80,9 @@ CMN_IMPLEMENT_SERVICES_DERIVED(mtsTaskFromSignal, mtsTaskContinuous)
 #include <cisstMultiTask/mtsTaskPeriodic.h>
 CMN_IMPLEMENT_SERVICES_DERIVED(mtsTaskPeriodic, mtsTaskContinuous)
 
+#include <cisstMultiTask/mtsTaskPooled.h>
+CMN_IMPLEMENT_SERVICES_DERIVED(mtsTaskPooled, mtsTask)
+
 #endif  // MTS_CLASS_SERVICES_PART1
 
 #ifdef MTS_CLASS_SERVICES_PART2
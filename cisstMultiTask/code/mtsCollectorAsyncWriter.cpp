@@ -0,0 +1,217 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstMultiTask/mtsCollectorAsyncWriter.h>
+
+#include <cisstCommon/cmnLogger.h>
+#include <cisstCommon/cmnUnits.h>
+#include <cisstOSAbstraction/osaSleep.h>
+
+
+void mtsCollectorAsyncWriter::BufferType::Attach(std::vector<char> & data)
+{
+    this->Data = &data;
+    this->setp(&(data[0]), &(data[0]) + data.size());
+}
+
+
+void mtsCollectorAsyncWriter::BufferType::Truncate(size_t used)
+{
+    this->setp(this->pbase(), this->epptr());
+    this->pbump(static_cast<int>(used));
+}
+
+
+mtsCollectorAsyncWriter::BufferType::int_type
+mtsCollectorAsyncWriter::BufferType::overflow(int_type character)
+{
+    if (traits_type::eq_int_type(character, traits_type::eof())) {
+        return traits_type::not_eof(character);
+    }
+    // grow, this only happens if a sample doesn't fit in the buffer
+    const size_t used = this->Used();
+    this->Data->resize(2 * this->Data->size());
+    this->Attach(*(this->Data));
+    this->pbump(static_cast<int>(used));
+    *(this->pptr()) = traits_type::to_char_type(character);
+    this->pbump(1);
+    return character;
+}
+
+
+mtsCollectorAsyncWriter::mtsCollectorAsyncWriter(void):
+    Output(0),
+    BufferSize(0),
+    Running(false),
+    FrontIndex(0),
+    Stream(&FrontBuffer),
+    SampleStart(0),
+    BackPending(false),
+    BackSize(0),
+    StopRequested(false),
+    Overflowing(false),
+    NumberOfSamples(0),
+    NumberOfDroppedSamples(0),
+    NumberOfOverflows(0)
+{
+}
+
+
+mtsCollectorAsyncWriter::~mtsCollectorAsyncWriter()
+{
+    this->Stop();
+}
+
+
+bool mtsCollectorAsyncWriter::Start(std::ostream & output, size_t bufferSize)
+{
+    if (this->Running) {
+        CMN_LOG_INIT_ERROR << "mtsCollectorAsyncWriter::Start: writer thread already running" << std::endl;
+        return false;
+    }
+    if (bufferSize < 1024) {
+        bufferSize = 1024;
+    }
+    this->Output = &output;
+    this->BufferSize = bufferSize;
+    // buffers are allocated once, a buffer only grows if a single
+    // sample doesn't fit
+    this->Buffers[0].resize(bufferSize);
+    this->Buffers[1].resize(bufferSize);
+    this->FrontIndex = 0;
+    this->FrontBuffer.Attach(this->Buffers[0]);
+    this->Stream.clear();
+    this->SampleStart = 0;
+    this->BackSize = 0;
+    this->Overflowing = false;
+    this->BackPending.store(false, std::memory_order_release);
+    this->StopRequested.store(false, std::memory_order_release);
+    this->Thread.Create<mtsCollectorAsyncWriter, void *>(this, &mtsCollectorAsyncWriter::Run, 0, "CollectorWriter");
+    this->Running = true;
+    return true;
+}
+
+
+void mtsCollectorAsyncWriter::Stop(void)
+{
+    if (!this->Running) {
+        return;
+    }
+    // writer thread finishes the pending buffer before exiting
+    this->StopRequested.store(true, std::memory_order_release);
+    this->Signal.Raise();
+    this->Thread.Wait();
+    this->Running = false;
+    // remaining data, including the last sample even if EndSample
+    // wasn't called
+    this->Write(this->Buffers[this->FrontIndex], this->FrontBuffer.Used());
+    this->FrontBuffer.Truncate(0);
+    this->SampleStart = 0;
+    this->Output->flush();
+}
+
+
+void mtsCollectorAsyncWriter::EndSample(void)
+{
+    this->NumberOfSamples.fetch_add(1, std::memory_order_relaxed);
+    const size_t used = this->FrontBuffer.Used();
+    if (used < this->BufferSize / 2) {
+        this->SampleStart = used;
+        return;
+    }
+    if (!this->BackPending.load(std::memory_order_acquire)) {
+        this->Swap();
+        return;
+    }
+    if (used >= this->BufferSize) {
+        // writer thread can't keep up, drop this sample
+        this->FrontBuffer.Truncate(this->SampleStart);
+        this->NumberOfDroppedSamples.fetch_add(1, std::memory_order_relaxed);
+        if (!this->Overflowing) {
+            this->Overflowing = true;
+            this->NumberOfOverflows.fetch_add(1, std::memory_order_relaxed);
+            CMN_LOG_RUN_WARNING << "mtsCollectorAsyncWriter::EndSample: writer thread can't keep up, dropping samples" << std::endl;
+        }
+        return;
+    }
+    this->SampleStart = used;
+}
+
+
+void mtsCollectorAsyncWriter::Flush(void)
+{
+    if ((this->FrontBuffer.Used() > 0)
+        && !this->BackPending.load(std::memory_order_acquire)) {
+        this->Swap();
+    }
+}
+
+
+void mtsCollectorAsyncWriter::ResetCounters(void)
+{
+    this->NumberOfSamples.store(0, std::memory_order_relaxed);
+    this->NumberOfDroppedSamples.store(0, std::memory_order_relaxed);
+    this->NumberOfOverflows.store(0, std::memory_order_relaxed);
+}
+
+
+void mtsCollectorAsyncWriter::Swap(void)
+{
+    this->BackSize = this->FrontBuffer.Used();
+    this->FrontIndex = 1 - this->FrontIndex;
+    this->FrontBuffer.Attach(this->Buffers[this->FrontIndex]);
+    this->SampleStart = 0;
+    this->Overflowing = false;
+    // publish BackSize and the back buffer content
+    this->BackPending.store(true, std::memory_order_release);
+    this->Signal.Raise();
+}
+
+
+void mtsCollectorAsyncWriter::Write(const std::vector<char> & buffer, size_t size)
+{
+    if (size == 0) {
+        return;
+    }
+    this->Output->write(&(buffer[0]), size);
+    if (!this->Output->good()) {
+        CMN_LOG_RUN_ERROR << "mtsCollectorAsyncWriter::Write: failed to write " << size << " bytes" << std::endl;
+    }
+}
+
+
+void * mtsCollectorAsyncWriter::Run(void * CMN_UNUSED(argument))
+{
+    while (true) {
+        if (this->BackPending.load(std::memory_order_acquire)) {
+            // FrontIndex can't change while the back buffer is pending
+            this->Write(this->Buffers[1 - this->FrontIndex], this->BackSize);
+            this->Output->flush();
+            this->BackPending.store(false, std::memory_order_release);
+        } else if (this->StopRequested.load(std::memory_order_acquire)) {
+            break;
+        } else {
+            // osaThreadSignal doesn't remember signals raised while
+            // not waiting so we can't wait forever
+            this->Signal.Wait(10.0 * cmn_ms);
+        }
+    }
+    return 0;
+}
@@ -18,6 +18,7 @@ http://www.cisst.org/cisst/license.txt.
 */
 
 #include <cisstMultiTask/mtsCollectorBase.h>
+#include <cisstMultiTask/mtsCollectorColumnarWriter.h>
 
 #include <cisstCommon/cmnPath.h>
 #include <cisstOSAbstraction/osaSleep.h>
@@ -46,7 +47,12 @@ mtsCollectorBase::mtsCollectorBase(const std::string & collectorName,
     Width(4),
     FillCharacter(' '),
     FileOpened(false),
-    Serializer(0)
+    Serializer(0),
+    ColumnarWriter(0),
+    ColumnarRowsPerChunk(1024),
+    ColumnarCompression(false),
+    AsyncWriterEnabled(false),
+    AsyncWriterBufferSize(1024 * 1024)
 {
     // set working directory
     this->WorkingDirectoryMember.Data = cmnPath::GetWorkingDirectory();
@@ -65,6 +71,11 @@ mtsCollectorBase::mtsCollectorBase(const std::string & collectorName,
 mtsCollectorBase::~mtsCollectorBase()
 {
     CMN_LOG_CLASS_INIT_VERBOSE << "destructor: collector " << GetName() << " ends." << std::endl;
+    this->StopAsyncWriter();
+    if (this->ColumnarWriter) {
+        delete this->ColumnarWriter;
+        this->ColumnarWriter = 0;
+    }
 }
 
 
@@ -80,6 +91,11 @@ void mtsCollectorBase::SetupControlInterface(void)
                                           "SetWorkingDirectory");
         ControlInterface->AddCommandRead(&mtsCollectorBase::GetWorkingDirectory, this,
                                          "GetWorkingDirectory");
+        // asynchronous writer counters
+        ControlInterface->AddCommandRead(&mtsCollectorBase::GetNumberOfDroppedSamples, this,
+                                         "GetNumberOfDroppedSamples");
+        ControlInterface->AddCommandRead(&mtsCollectorBase::GetNumberOfOverflows, this,
+                                         "GetNumberOfOverflows");
         // start/stop commands
         ControlInterface->AddCommandVoid(&mtsCollectorBase::StartCollectionCommand, this,
                                          "StartCollection");
@@ -105,6 +121,9 @@ void mtsCollectorBase::SetOutput(const std::string & fileName,
 {
     CMN_LOG_CLASS_INIT_DEBUG << "SetOutput: file \"" << fileName
                              << "\" using file format \"" << fileFormat << "\"" << std::endl;
+    // pending data needs to be written before closing the file
+    this->StopAsyncWriter();
+    this->AsyncWriter.ResetCounters();
     // test if there was a file opened before
     if (this->OutputFile) {
         CMN_LOG_CLASS_INIT_VERBOSE << "SetOutput: closing file \"" << this->OutputFileName << "\"" << std::endl;
@@ -114,6 +133,9 @@ void mtsCollectorBase::SetOutput(const std::string & fileName,
         CMN_LOG_CLASS_INIT_VERBOSE << "SetOutput: closing file \"" << this->OutputFileName << "\"" << std::endl;
         this->OutputHeaderFile->close();
     }
+    if (this->ColumnarWriter) {
+        this->ColumnarWriter->Close();
+    }
     // create the output file
     this->OutputFile = new std::ofstream;
     this->OutputHeaderFile = new std::ofstream;
@@ -143,6 +165,9 @@ void mtsCollectorBase::SetOutput(const std::string & fileName,
         case COLLECTOR_FILE_FORMAT_PLAIN_TEXT:
             ext = ".txt";
             break;
+        case COLLECTOR_FILE_FORMAT_COLUMNAR:
+            ext = ".ccol";
+            break;
         default:
             ext = ".cdat";
             break;
@@ -161,6 +186,13 @@ void mtsCollectorBase::SetOutput(const std::string & fileName,
         Serializer = new cmnSerializer(StringStreamBufferForSerialization);
     }
 
+    // columnar writer, file is created in OpenFileIfNeeded
+    if (FileFormat == COLLECTOR_FILE_FORMAT_COLUMNAR) {
+        if (!this->ColumnarWriter) {
+            this->ColumnarWriter = new mtsCollectorColumnarWriter;
+        }
+    }
+
     // set an appropriate delimiter according to the log file format.
     switch (FileFormat) {
     case COLLECTOR_FILE_FORMAT_CSV:
@@ -178,10 +210,14 @@ void mtsCollectorBase::SetOutput(const std::string & fileName,
 
 void mtsCollectorBase::CloseOutput(void)
 {
+    this->StopAsyncWriter();
     if (this->FileOpened) {
         CMN_LOG_CLASS_INIT_VERBOSE << "CloseOutput: closing file \"" << this->OutputFileName << "\"" << std::endl;
         this->OutputFile->close();
         this->OutputHeaderFile->close();
+        if (this->ColumnarWriter) {
+            this->ColumnarWriter->Close();
+        }
         this->FileOpened = false;
     }
     else {
@@ -212,6 +248,17 @@ void mtsCollectorBase::OpenFileIfNeeded(void)
         this->OutputHeaderFile->open(this->OutputHeaderFileName.c_str(), std::ios::trunc);
         this->FileOpened = true;
         break;
+    case COLLECTOR_FILE_FORMAT_COLUMNAR:
+        CMN_LOG_CLASS_INIT_VERBOSE << "SetOutput: opening file \"" << this->OutputFileName << "\" in columnar/memory mapped mode" << std::endl;
+        if (!this->ColumnarWriter->Open(this->OutputFileName,
+                                        this->ColumnarRowsPerChunk,
+                                        this->ColumnarCompression)) {
+            CMN_LOG_CLASS_INIT_ERROR << "SetOutput: failed to create columnar file \"" << this->OutputFileName << "\"" << std::endl;
+            break;
+        }
+        this->OutputHeaderFile->open(this->OutputHeaderFileName.c_str(), std::ios::trunc);
+        this->FileOpened = true;
+        break;
     default:
         CMN_LOG_CLASS_INIT_ERROR << "SetOutput: unexpected file format.";
         break;
@@ -220,6 +267,40 @@ void mtsCollectorBase::OpenFileIfNeeded(void)
     if (!this->OutputStream->good()) {
         CMN_LOG_CLASS_INIT_ERROR << "SetOutput: output stream is no good" << std::endl;
     }
+
+    // from now on, format in memory and let the writer thread do the I/O
+    if (this->FileOpened && this->AsyncWriterEnabled
+        && (this->FileFormat != COLLECTOR_FILE_FORMAT_COLUMNAR)) {
+        if (this->AsyncWriter.Start(*(this->OutputFile), this->AsyncWriterBufferSize)) {
+            // keep precision, width, notation...
+            this->AsyncWriter.GetStream().copyfmt(*(this->OutputFile));
+            this->OutputStream = &(this->AsyncWriter.GetStream());
+        }
+    }
+}
+
+
+void mtsCollectorBase::StopAsyncWriter(void)
+{
+    if (this->AsyncWriter.IsRunning()) {
+        this->AsyncWriter.Stop();
+        CMN_LOG_CLASS_INIT_VERBOSE << "StopAsyncWriter: " << this->AsyncWriter.GetNumberOfSamples()
+                                   << " samples, " << this->AsyncWriter.GetNumberOfDroppedSamples()
+                                   << " dropped" << std::endl;
+        this->OutputStream = this->OutputFile;
+    }
+}
+
+
+void mtsCollectorBase::GetNumberOfDroppedSamples(mtsUInt & placeHolder) const
+{
+    placeHolder = this->AsyncWriter.GetNumberOfDroppedSamples();
+}
+
+
+void mtsCollectorBase::GetNumberOfOverflows(mtsUInt & placeHolder) const
+{
+    placeHolder = this->AsyncWriter.GetNumberOfOverflows();
 }
 
 
@@ -232,6 +313,8 @@ void mtsCollectorBase::SetOutputToDefault(const CollectorFileFormat fileFormat)
         suffix = "txt";
     } else if (fileFormat == COLLECTOR_FILE_FORMAT_CSV) {
         suffix = "csv";
+    } else if (fileFormat == COLLECTOR_FILE_FORMAT_COLUMNAR) {
+        suffix = "ccol"; // for cisst columnar
     } else {
         suffix = "cdat"; // for cisst dat
     }
@@ -266,6 +349,11 @@ void mtsCollectorBase::SetOutputToDefault(void)
 void mtsCollectorBase::SetOutput(std::ostream & outputStream, const CollectorFileFormat fileFormat)
 {
     CMN_LOG_CLASS_INIT_DEBUG << "SetOutput: using user provided output stream with file format \"" << fileFormat << "\"" << std::endl;
+    this->StopAsyncWriter();
+    if (fileFormat == COLLECTOR_FILE_FORMAT_COLUMNAR) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetOutput: columnar file format requires a file name, can't use a stream" << std::endl;
+        return;
+    }
     // test if there was a file opened before
     if (this->OutputFile) {
         CMN_LOG_CLASS_INIT_VERBOSE << "SetOutput: closing file \"" << this->OutputFileName << "\"" << std::endl;
@@ -394,6 +482,35 @@ void mtsCollectorBase::SetOutputStreamFill(const char fillCharacter)
     }
 }
 
+void mtsCollectorBase::SetColumnarChunkSize(const size_t rowsPerChunk)
+{
+    if (rowsPerChunk == 0) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetColumnarChunkSize: number of rows per chunk must be greater than 0" << std::endl;
+        return;
+    }
+    this->ColumnarRowsPerChunk = rowsPerChunk;
+    if (this->Status == COLLECTOR_COLLECTING) {
+        CMN_LOG_CLASS_RUN_WARNING << "SetColumnarChunkSize: chunk size modified while collecting, the setting will only be applied to future files" << std::endl;
+    }
+}
+
+void mtsCollectorBase::SetColumnarCompression(const bool compression)
+{
+    this->ColumnarCompression = compression;
+    if (this->Status == COLLECTOR_COLLECTING) {
+        CMN_LOG_CLASS_RUN_WARNING << "SetColumnarCompression: compression modified while collecting, the setting will only be applied to future files" << std::endl;
+    }
+}
+
+void mtsCollectorBase::SetAsynchronousWriter(const bool enable, const size_t bufferSize)
+{
+    this->AsyncWriterEnabled = enable;
+    this->AsyncWriterBufferSize = bufferSize;
+    if (this->Status == COLLECTOR_COLLECTING) {
+        CMN_LOG_CLASS_RUN_WARNING << "SetAsynchronousWriter: asynchronous writer modified while collecting, the setting will only be applied to future files" << std::endl;
+    }
+}
+
 void mtsCollectorBase::Init(void)
 {
     Status = COLLECTOR_STOP;
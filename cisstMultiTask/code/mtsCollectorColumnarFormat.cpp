@@ -0,0 +1,272 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstMultiTask/mtsCollectorColumnarFormat.h>
+
+#include <cstring>
+#include <vector>
+
+const char mtsCollectorColumnarFormat::FileMagic[8] = {'c', 'i', 's', 's', 't', 'C', 'O', 'L'};
+const char mtsCollectorColumnarFormat::TrailerMagic[8] = {'c', 'i', 's', 's', 't', 'I', 'D', 'X'};
+const uint32_t mtsCollectorColumnarFormat::ChunkMagic = 0x4b4e4843; // "CHNK"
+
+namespace {
+    // sequences are made of a token, literals, a 16 bits offset and a match length
+    const size_t MinimumMatch = 4;
+    // the last bytes are always stored as literals, this simplifies decoding
+    const size_t LastLiterals = 5;
+    const size_t MatchFindLimit = 12;
+    const size_t MaximumOffset = 65535;
+    const unsigned int HashLog = 12;
+
+    inline uint32_t Read32(const char * data) {
+        uint32_t value;
+        memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    inline size_t Hash(uint32_t sequence) {
+        return (sequence * 2654435761U) >> (32 - HashLog);
+    }
+
+    // write a length using 255 continuation bytes, returns false if out of space
+    inline bool WriteLength(size_t length, char * destination, size_t & position, size_t capacity) {
+        while (length >= 255) {
+            if (position >= capacity) {
+                return false;
+            }
+            destination[position++] = static_cast<char>(255);
+            length -= 255;
+        }
+        if (position >= capacity) {
+            return false;
+        }
+        destination[position++] = static_cast<char>(length);
+        return true;
+    }
+
+    inline bool ReadLength(const unsigned char * source, size_t & position, size_t size, size_t & length) {
+        unsigned char byte;
+        do {
+            if (position >= size) {
+                return false;
+            }
+            byte = source[position++];
+            length += byte;
+        } while (byte == 255);
+        return true;
+    }
+}
+
+
+size_t mtsCollectorColumnarFormat::CompressBound(size_t size)
+{
+    return size + (size / 255) + 16;
+}
+
+
+size_t mtsCollectorColumnarFormat::Compress(const char * source, size_t sourceSize,
+                                            char * destination, size_t destinationCapacity)
+{
+    std::vector<size_t> table(static_cast<size_t>(1) << HashLog, 0);
+    size_t input = 0;
+    size_t anchor = 0;
+    size_t output = 0;
+
+    if (sourceSize > MatchFindLimit) {
+        const size_t matchLimit = sourceSize - LastLiterals;
+        const size_t inputLimit = sourceSize - MatchFindLimit;
+        while (input < inputLimit) {
+            const uint32_t sequence = Read32(source + input);
+            const size_t hash = Hash(sequence);
+            const size_t reference = table[hash];
+            table[hash] = input;
+            if ((reference >= input)
+                || ((input - reference) > MaximumOffset)
+                || (Read32(source + reference) != sequence)) {
+                // no match, skip faster in incompressible areas
+                input += 1 + ((input - anchor) >> 6);
+                continue;
+            }
+            size_t matchLength = MinimumMatch;
+            while (((input + matchLength) < matchLimit)
+                   && (source[reference + matchLength] == source[input + matchLength])) {
+                ++matchLength;
+            }
+            // token
+            const size_t literalLength = input - anchor;
+            if (output >= destinationCapacity) {
+                return 0;
+            }
+            const size_t tokenPosition = output++;
+            unsigned char token;
+            if (literalLength >= 15) {
+                token = 15 << 4;
+                if (!WriteLength(literalLength - 15, destination, output, destinationCapacity)) {
+                    return 0;
+                }
+            } else {
+                token = static_cast<unsigned char>(literalLength << 4);
+            }
+            // literals
+            if ((output + literalLength + 2) > destinationCapacity) {
+                return 0;
+            }
+            memcpy(destination + output, source + anchor, literalLength);
+            output += literalLength;
+            // offset, little endian
+            const size_t offset = input - reference;
+            destination[output++] = static_cast<char>(offset & 0xFF);
+            destination[output++] = static_cast<char>((offset >> 8) & 0xFF);
+            // match length
+            const size_t extraLength = matchLength - MinimumMatch;
+            if (extraLength >= 15) {
+                token |= 15;
+                if (!WriteLength(extraLength - 15, destination, output, destinationCapacity)) {
+                    return 0;
+                }
+            } else {
+                token |= static_cast<unsigned char>(extraLength);
+            }
+            destination[tokenPosition] = static_cast<char>(token);
+            input += matchLength;
+            anchor = input;
+        }
+    }
+
+    // last literals
+    const size_t literalLength = sourceSize - anchor;
+    if (output >= destinationCapacity) {
+        return 0;
+    }
+    const size_t tokenPosition = output++;
+    if (literalLength >= 15) {
+        destination[tokenPosition] = static_cast<char>(15 << 4);
+        if (!WriteLength(literalLength - 15, destination, output, destinationCapacity)) {
+            return 0;
+        }
+    } else {
+        destination[tokenPosition] = static_cast<char>(literalLength << 4);
+    }
+    if ((output + literalLength) > destinationCapacity) {
+        return 0;
+    }
+    memcpy(destination + output, source + anchor, literalLength);
+    output += literalLength;
+
+    // not worth it
+    if (output >= sourceSize) {
+        return 0;
+    }
+    return output;
+}
+
+
+bool mtsCollectorColumnarFormat::Decompress(const char * source, size_t sourceSize,
+                                            char * destination, size_t destinationSize)
+{
+    const unsigned char * input = reinterpret_cast<const unsigned char *>(source);
+    size_t inputPosition = 0;
+    size_t output = 0;
+    while (inputPosition < sourceSize) {
+        const unsigned char token = input[inputPosition++];
+        // literals
+        size_t literalLength = token >> 4;
+        if ((literalLength == 15)
+            && !ReadLength(input, inputPosition, sourceSize, literalLength)) {
+            return false;
+        }
+        if (((inputPosition + literalLength) > sourceSize)
+            || ((output + literalLength) > destinationSize)) {
+            return false;
+        }
+        memcpy(destination + output, source + inputPosition, literalLength);
+        inputPosition += literalLength;
+        output += literalLength;
+        // last sequence only has literals
+        if (inputPosition == sourceSize) {
+            break;
+        }
+        // match
+        if ((inputPosition + 2) > sourceSize) {
+            return false;
+        }
+        const size_t offset = input[inputPosition] | (input[inputPosition + 1] << 8);
+        inputPosition += 2;
+        if ((offset == 0) || (offset > output)) {
+            return false;
+        }
+        size_t matchLength = token & 15;
+        if ((matchLength == 15)
+            && !ReadLength(input, inputPosition, sourceSize, matchLength)) {
+            return false;
+        }
+        matchLength += MinimumMatch;
+        if ((output + matchLength) > destinationSize) {
+            return false;
+        }
+        // byte per byte since source and destination can overlap
+        const char * match = destination + output - offset;
+        for (size_t index = 0; index < matchLength; ++index) {
+            destination[output + index] = match[index];
+        }
+        output += matchLength;
+    }
+    return (output == destinationSize);
+}
+
+
+double mtsCollectorColumnarFormat::ScalarToDouble(const char * data, size_t scalarSize, ScalarKind kind)
+{
+    switch (kind) {
+    case SCALAR_BOOL:
+        return (*data != 0) ? 1.0 : 0.0;
+    case SCALAR_FLOAT:
+        if (scalarSize == sizeof(float)) {
+            float value;
+            memcpy(&value, data, sizeof(value));
+            return value;
+        } else if (scalarSize == sizeof(double)) {
+            double value;
+            memcpy(&value, data, sizeof(value));
+            return value;
+        }
+        break;
+    case SCALAR_SIGNED:
+        switch (scalarSize) {
+        case 1: { int8_t value; memcpy(&value, data, 1); return value; }
+        case 2: { int16_t value; memcpy(&value, data, 2); return value; }
+        case 4: { int32_t value; memcpy(&value, data, 4); return value; }
+        case 8: { int64_t value; memcpy(&value, data, 8); return static_cast<double>(value); }
+        }
+        break;
+    case SCALAR_UNSIGNED:
+        switch (scalarSize) {
+        case 1: { uint8_t value; memcpy(&value, data, 1); return value; }
+        case 2: { uint16_t value; memcpy(&value, data, 2); return value; }
+        case 4: { uint32_t value; memcpy(&value, data, 4); return value; }
+        case 8: { uint64_t value; memcpy(&value, data, 8); return static_cast<double>(value); }
+        }
+        break;
+    default:
+        break;
+    }
+    return 0.0;
+}
@@ -0,0 +1,304 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstMultiTask/mtsCollectorColumnarReader.h>
+
+#include <cisstCommon/cmnLogger.h>
+
+#include <cstring>
+
+
+void mtsCollectorColumnarReader::Rows::Clear(void)
+{
+    Ticks.clear();
+    Times.clear();
+    Columns.clear();
+    ElementSizes.clear();
+}
+
+
+mtsCollectorColumnarReader::mtsCollectorColumnarReader(void)
+{
+    memset(&(this->Header), 0, sizeof(this->Header));
+}
+
+
+mtsCollectorColumnarReader::~mtsCollectorColumnarReader()
+{
+    this->Close();
+}
+
+
+bool mtsCollectorColumnarReader::ReadString(std::string & value)
+{
+    size_t length;
+    if (!this->ReadUInt32(length)) {
+        return false;
+    }
+    value.resize(length);
+    if (length > 0) {
+        this->File.read(&(value[0]), length);
+    }
+    return this->File.good();
+}
+
+
+bool mtsCollectorColumnarReader::ReadUInt32(size_t & value)
+{
+    uint32_t value32;
+    this->File.read(reinterpret_cast<char *>(&value32), sizeof(value32));
+    value = value32;
+    return this->File.good();
+}
+
+
+bool mtsCollectorColumnarReader::Open(const std::string & fileName)
+{
+    this->Close();
+    this->FileName = fileName;
+    this->File.open(fileName.c_str(), std::ios::in | std::ios::binary);
+    if (!this->File.is_open()) {
+        CMN_LOG_INIT_ERROR << "mtsCollectorColumnarReader::Open: unable to open \"" << fileName << "\"" << std::endl;
+        return false;
+    }
+
+    // header
+    this->File.read(reinterpret_cast<char *>(&(this->Header)), sizeof(this->Header));
+    if (!this->File.good()
+        || (memcmp(this->Header.Magic, FormatType::FileMagic, sizeof(this->Header.Magic)) != 0)) {
+        CMN_LOG_INIT_ERROR << "mtsCollectorColumnarReader::Open: \"" << fileName << "\" is not a columnar file" << std::endl;
+        this->Close();
+        return false;
+    }
+    if (this->Header.Version != FormatType::VERSION) {
+        CMN_LOG_INIT_ERROR << "mtsCollectorColumnarReader::Open: \"" << fileName << "\" uses version "
+                           << this->Header.Version << ", expected " << FormatType::VERSION << std::endl;
+        this->Close();
+        return false;
+    }
+
+    // columns
+    this->Columns.resize(this->Header.NumberOfColumns);
+    for (size_t index = 0; index < this->Columns.size(); ++index) {
+        ColumnDescription & column = this->Columns[index];
+        size_t kind;
+        if (!this->ReadString(column.Name)
+            || !this->ReadString(column.Fields)
+            || !this->ReadUInt32(column.ElementSize)
+            || !this->ReadUInt32(column.ScalarSize)
+            || !this->ReadUInt32(kind)) {
+            CMN_LOG_INIT_ERROR << "mtsCollectorColumnarReader::Open: corrupted header in \"" << fileName << "\"" << std::endl;
+            this->Close();
+            return false;
+        }
+        column.Kind = static_cast<FormatType::ScalarKind>(kind);
+    }
+
+    // trailer and index
+    FormatType::Trailer trailer;
+    this->File.seekg(-static_cast<std::streamoff>(sizeof(trailer)), std::ios::end);
+    this->File.read(reinterpret_cast<char *>(&trailer), sizeof(trailer));
+    if (!this->File.good()
+        || (memcmp(trailer.Magic, FormatType::TrailerMagic, sizeof(trailer.Magic)) != 0)) {
+        CMN_LOG_INIT_ERROR << "mtsCollectorColumnarReader::Open: missing index in \"" << fileName
+                           << "\", file might not have been closed properly" << std::endl;
+        this->Close();
+        return false;
+    }
+    this->Index.resize(static_cast<size_t>(trailer.NumberOfChunks));
+    if (!this->Index.empty()) {
+        this->File.seekg(static_cast<std::streamoff>(trailer.IndexOffset), std::ios::beg);
+        this->File.read(reinterpret_cast<char *>(&(this->Index[0])),
+                        this->Index.size() * sizeof(FormatType::IndexEntry));
+        if (!this->File.good()) {
+            CMN_LOG_INIT_ERROR << "mtsCollectorColumnarReader::Open: corrupted index in \"" << fileName << "\"" << std::endl;
+            this->Close();
+            return false;
+        }
+    }
+    return true;
+}
+
+
+void mtsCollectorColumnarReader::Close(void)
+{
+    if (this->File.is_open()) {
+        this->File.close();
+    }
+    this->File.clear();
+    this->Columns.clear();
+    this->Index.clear();
+}
+
+
+int mtsCollectorColumnarReader::FindColumn(const std::string & name) const
+{
+    for (size_t index = 0; index < this->Columns.size(); ++index) {
+        if (this->Columns[index].Name == name) {
+            return static_cast<int>(index);
+        }
+    }
+    return -1;
+}
+
+
+unsigned long long mtsCollectorColumnarReader::GetNumberOfRows(void) const
+{
+    unsigned long long result = 0;
+    std::vector<FormatType::IndexEntry>::const_iterator entry;
+    for (entry = this->Index.begin(); entry != this->Index.end(); ++entry) {
+        result += entry->NumberOfRows;
+    }
+    return result;
+}
+
+
+double mtsCollectorColumnarReader::GetStartTime(void) const
+{
+    return this->Index.empty() ? 0.0 : this->Index.front().FirstTime;
+}
+
+
+double mtsCollectorColumnarReader::GetEndTime(void) const
+{
+    return this->Index.empty() ? 0.0 : this->Index.back().LastTime;
+}
+
+
+bool mtsCollectorColumnarReader::ReadChunk(size_t chunk, Rows & rows)
+{
+    if (chunk >= this->Index.size()) {
+        return false;
+    }
+    FormatType::ChunkHeader header;
+    this->File.seekg(static_cast<std::streamoff>(this->Index[chunk].Offset), std::ios::beg);
+    this->File.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!this->File.good() || (header.Magic != FormatType::ChunkMagic)) {
+        CMN_LOG_RUN_ERROR << "mtsCollectorColumnarReader::ReadChunk: corrupted chunk " << chunk
+                          << " in \"" << this->FileName << "\"" << std::endl;
+        return false;
+    }
+    const size_t numberOfRows = header.NumberOfRows;
+    size_t expectedSize = numberOfRows * (sizeof(unsigned long long) + sizeof(double));
+    size_t column;
+    const size_t numberOfColumns = this->Columns.size();
+    for (column = 0; column < numberOfColumns; ++column) {
+        expectedSize += numberOfRows * this->Columns[column].ElementSize;
+    }
+    if (header.RawSize != expectedSize) {
+        CMN_LOG_RUN_ERROR << "mtsCollectorColumnarReader::ReadChunk: unexpected size for chunk " << chunk
+                          << " in \"" << this->FileName << "\"" << std::endl;
+        return false;
+    }
+    this->RawBuffer.resize(expectedSize);
+    if (header.Compressed) {
+        this->StoredBuffer.resize(static_cast<size_t>(header.StoredSize));
+        this->File.read(&(this->StoredBuffer[0]), this->StoredBuffer.size());
+        if (!this->File.good()
+            || !FormatType::Decompress(&(this->StoredBuffer[0]), this->StoredBuffer.size(),
+                                       &(this->RawBuffer[0]), expectedSize)) {
+            CMN_LOG_RUN_ERROR << "mtsCollectorColumnarReader::ReadChunk: failed to decompress chunk " << chunk
+                              << " in \"" << this->FileName << "\"" << std::endl;
+            return false;
+        }
+    } else {
+        this->File.read(&(this->RawBuffer[0]), expectedSize);
+        if (!this->File.good()) {
+            CMN_LOG_RUN_ERROR << "mtsCollectorColumnarReader::ReadChunk: failed to read chunk " << chunk
+                              << " in \"" << this->FileName << "\"" << std::endl;
+            return false;
+        }
+    }
+
+    // append to rows
+    if (rows.Columns.size() != numberOfColumns) {
+        rows.Clear();
+        rows.Columns.resize(numberOfColumns);
+        for (column = 0; column < numberOfColumns; ++column) {
+            rows.ElementSizes.push_back(this->Columns[column].ElementSize);
+        }
+    }
+    const char * cursor = &(this->RawBuffer[0]);
+    const unsigned long long * ticks = reinterpret_cast<const unsigned long long *>(cursor);
+    rows.Ticks.insert(rows.Ticks.end(), ticks, ticks + numberOfRows);
+    cursor += numberOfRows * sizeof(unsigned long long);
+    const double * times = reinterpret_cast<const double *>(cursor);
+    rows.Times.insert(rows.Times.end(), times, times + numberOfRows);
+    cursor += numberOfRows * sizeof(double);
+    for (column = 0; column < numberOfColumns; ++column) {
+        const size_t size = numberOfRows * this->Columns[column].ElementSize;
+        rows.Columns[column].insert(rows.Columns[column].end(), cursor, cursor + size);
+        cursor += size;
+    }
+    return true;
+}
+
+
+bool mtsCollectorColumnarReader::ReadTimeRange(double startTime, double endTime, Rows & rows)
+{
+    rows.Clear();
+    // first chunk that ends after start time, chunks are sorted by time
+    size_t first = 0;
+    size_t last = this->Index.size();
+    while (first < last) {
+        const size_t middle = (first + last) / 2;
+        if (this->Index[middle].LastTime < startTime) {
+            first = middle + 1;
+        } else {
+            last = middle;
+        }
+    }
+    Rows chunkRows;
+    for (size_t chunk = first;
+         (chunk < this->Index.size()) && (this->Index[chunk].FirstTime <= endTime);
+         ++chunk) {
+        chunkRows.Clear();
+        if (!this->ReadChunk(chunk, chunkRows)) {
+            return false;
+        }
+        if (rows.Columns.size() != chunkRows.Columns.size()) {
+            rows.Columns.resize(chunkRows.Columns.size());
+            rows.ElementSizes = chunkRows.ElementSizes;
+        }
+        // only copy rows in range
+        for (size_t row = 0; row < chunkRows.size(); ++row) {
+            const double time = chunkRows.Times[row];
+            if ((time < startTime) || (time > endTime)) {
+                continue;
+            }
+            rows.Ticks.push_back(chunkRows.Ticks[row]);
+            rows.Times.push_back(time);
+            for (size_t column = 0; column < chunkRows.Columns.size(); ++column) {
+                const char * element = chunkRows.GetElement(column, row);
+                rows.Columns[column].insert(rows.Columns[column].end(),
+                                            element, element + chunkRows.ElementSizes[column]);
+            }
+        }
+    }
+    return true;
+}
+
+
+double mtsCollectorColumnarReader::GetScalar(const Rows & rows, size_t column, size_t row, size_t scalarIndex) const
+{
+    const ColumnDescription & description = this->Columns[column];
+    return FormatType::ScalarToDouble(rows.GetElement(column, row) + scalarIndex * description.ScalarSize,
+                                      description.ScalarSize, description.Kind);
+}
@@ -0,0 +1,400 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstMultiTask/mtsCollectorColumnarWriter.h>
+
+#include <cisstCommon/cmnLogger.h>
+
+#include <cstring>
+
+#if (CISST_OS != CISST_WINDOWS)
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    inline void WriteBytes(char * & cursor, const void * data, size_t size) {
+        memcpy(cursor, data, size);
+        cursor += size;
+    }
+
+    inline void WriteString(char * & cursor, const std::string & value) {
+        const uint32_t length = static_cast<uint32_t>(value.size());
+        WriteBytes(cursor, &length, sizeof(length));
+        WriteBytes(cursor, value.data(), value.size());
+    }
+
+    inline void WriteUInt32(char * & cursor, size_t value) {
+        const uint32_t value32 = static_cast<uint32_t>(value);
+        WriteBytes(cursor, &value32, sizeof(value32));
+    }
+
+    // round file sizes to 1 MB
+    const size_t MapGranularity = 1024 * 1024;
+}
+
+
+mtsCollectorColumnarWriter::mtsCollectorColumnarWriter(void):
+    RowsPerChunk(1024),
+    Compression(false),
+    HeaderWritten(false),
+    RowsInChunk(0),
+    NumberOfRows(0),
+    Offset(0),
+#if (CISST_OS != CISST_WINDOWS)
+    FileDescriptor(-1),
+    Map(0),
+    MapSize(0)
+#else
+    File(0)
+#endif
+{
+}
+
+
+mtsCollectorColumnarWriter::~mtsCollectorColumnarWriter()
+{
+    if (this->IsOpen()) {
+        this->Close();
+    }
+}
+
+
+bool mtsCollectorColumnarWriter::Open(const std::string & fileName,
+                                      size_t rowsPerChunk,
+                                      bool compression,
+                                      size_t preallocatedSize)
+{
+    if (this->IsOpen()) {
+        CMN_LOG_INIT_ERROR << "mtsCollectorColumnarWriter::Open: file \"" << this->FileName
+                           << "\" is already open" << std::endl;
+        return false;
+    }
+    this->FileName = fileName;
+    this->RowsPerChunk = (rowsPerChunk > 0) ? rowsPerChunk : 1;
+    this->Compression = compression;
+    this->HeaderWritten = false;
+    this->Columns.clear();
+    this->ColumnBuffers.clear();
+    this->Index.clear();
+    this->RowsInChunk = 0;
+    this->NumberOfRows = 0;
+    this->Offset = 0;
+    this->TicksBuffer.resize(this->RowsPerChunk);
+    this->TimeBuffer.resize(this->RowsPerChunk);
+
+#if (CISST_OS != CISST_WINDOWS)
+    this->FileDescriptor = open(fileName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (this->FileDescriptor < 0) {
+        CMN_LOG_INIT_ERROR << "mtsCollectorColumnarWriter::Open: unable to create file \"" << fileName << "\"" << std::endl;
+        return false;
+    }
+    if (!this->Remap(preallocatedSize)) {
+        close(this->FileDescriptor);
+        this->FileDescriptor = -1;
+        return false;
+    }
+#else
+    this->File = fopen(fileName.c_str(), "wb");
+    if (!this->File) {
+        CMN_LOG_INIT_ERROR << "mtsCollectorColumnarWriter::Open: unable to create file \"" << fileName << "\"" << std::endl;
+        return false;
+    }
+#endif
+    return true;
+}
+
+
+bool mtsCollectorColumnarWriter::IsOpen(void) const
+{
+#if (CISST_OS != CISST_WINDOWS)
+    return (this->FileDescriptor >= 0);
+#else
+    return (this->File != 0);
+#endif
+}
+
+
+bool mtsCollectorColumnarWriter::AddColumn(const ColumnDescription & column)
+{
+    if (!this->IsOpen()) {
+        CMN_LOG_INIT_ERROR << "mtsCollectorColumnarWriter::AddColumn: file not open" << std::endl;
+        return false;
+    }
+    if (this->HeaderWritten || (this->RowsInChunk > 0)) {
+        CMN_LOG_INIT_ERROR << "mtsCollectorColumnarWriter::AddColumn: can't add column \"" << column.Name
+                           << "\" after rows have been added" << std::endl;
+        return false;
+    }
+    if (column.ElementSize == 0) {
+        CMN_LOG_INIT_ERROR << "mtsCollectorColumnarWriter::AddColumn: element size for column \"" << column.Name
+                           << "\" can't be 0" << std::endl;
+        return false;
+    }
+    this->Columns.push_back(column);
+    this->ColumnBuffers.push_back(std::vector<char>(this->RowsPerChunk * column.ElementSize, 0));
+    return true;
+}
+
+
+bool mtsCollectorColumnarWriter::AddRow(unsigned long long ticks, double time)
+{
+    if (!this->IsOpen()) {
+        return false;
+    }
+    if (this->RowsInChunk == this->RowsPerChunk) {
+        if (!this->WriteChunk()) {
+            return false;
+        }
+    }
+    this->TicksBuffer[this->RowsInChunk] = ticks;
+    this->TimeBuffer[this->RowsInChunk] = time;
+    this->RowsInChunk++;
+    this->NumberOfRows++;
+    return true;
+}
+
+
+bool mtsCollectorColumnarWriter::Close(void)
+{
+    if (!this->IsOpen()) {
+        return false;
+    }
+    bool result = this->WriteChunk();
+
+    // index footer and trailer
+    const size_t indexSize = this->Index.size() * sizeof(FormatType::IndexEntry);
+    FormatType::Trailer trailer;
+    memcpy(trailer.Magic, FormatType::TrailerMagic, sizeof(trailer.Magic));
+    trailer.NumberOfChunks = this->Index.size();
+    trailer.IndexOffset = this->Offset;
+    char * cursor = this->Reserve(indexSize + sizeof(trailer));
+    if (cursor) {
+        if (indexSize > 0) {
+            WriteBytes(cursor, &(this->Index[0]), indexSize);
+        }
+        WriteBytes(cursor, &trailer, sizeof(trailer));
+        result &= this->Commit(indexSize + sizeof(trailer));
+    } else {
+        result = false;
+    }
+
+#if (CISST_OS != CISST_WINDOWS)
+    if (this->Map) {
+        munmap(this->Map, this->MapSize);
+        this->Map = 0;
+        this->MapSize = 0;
+    }
+    // remove the preallocated space we didn't use
+    if (ftruncate(this->FileDescriptor, static_cast<off_t>(this->Offset)) != 0) {
+        CMN_LOG_RUN_ERROR << "mtsCollectorColumnarWriter::Close: failed to truncate \"" << this->FileName << "\"" << std::endl;
+        result = false;
+    }
+    close(this->FileDescriptor);
+    this->FileDescriptor = -1;
+#else
+    fclose(this->File);
+    this->File = 0;
+#endif
+    return result;
+}
+
+
+#if (CISST_OS != CISST_WINDOWS)
+bool mtsCollectorColumnarWriter::Remap(size_t size)
+{
+    size = ((size + MapGranularity - 1) / MapGranularity) * MapGranularity;
+    if (this->Map) {
+        munmap(this->Map, this->MapSize);
+        this->Map = 0;
+        this->MapSize = 0;
+    }
+    if (ftruncate(this->FileDescriptor, static_cast<off_t>(size)) != 0) {
+        CMN_LOG_RUN_ERROR << "mtsCollectorColumnarWriter: failed to resize \"" << this->FileName
+                          << "\" to " << size << " bytes" << std::endl;
+        return false;
+    }
+    void * map = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, this->FileDescriptor, 0);
+    if (map == MAP_FAILED) {
+        CMN_LOG_RUN_ERROR << "mtsCollectorColumnarWriter: failed to map \"" << this->FileName << "\"" << std::endl;
+        return false;
+    }
+    this->Map = static_cast<char *>(map);
+    this->MapSize = size;
+    return true;
+}
+#endif
+
+
+char * mtsCollectorColumnarWriter::Reserve(size_t size)
+{
+#if (CISST_OS != CISST_WINDOWS)
+    if ((this->Offset + size) > this->MapSize) {
+        size_t newSize = 2 * this->MapSize;
+        if (newSize < (this->Offset + size)) {
+            newSize = this->Offset + size;
+        }
+        if (!this->Remap(newSize)) {
+            return 0;
+        }
+    }
+    return this->Map + this->Offset;
+#else
+    this->Staging.resize(size);
+    return this->Staging.empty() ? 0 : &(this->Staging[0]);
+#endif
+}
+
+
+bool mtsCollectorColumnarWriter::Commit(size_t size)
+{
+#if (CISST_OS == CISST_WINDOWS)
+    if (fwrite(&(this->Staging[0]), 1, size, this->File) != size) {
+        CMN_LOG_RUN_ERROR << "mtsCollectorColumnarWriter: failed to write to \"" << this->FileName << "\"" << std::endl;
+        return false;
+    }
+#endif
+    this->Offset += size;
+    return true;
+}
+
+
+bool mtsCollectorColumnarWriter::WriteHeader(void)
+{
+    size_t size = sizeof(FormatType::FileHeader);
+    std::vector<ColumnDescription>::const_iterator column;
+    for (column = this->Columns.begin(); column != this->Columns.end(); ++column) {
+        size += 5 * sizeof(uint32_t) + column->Name.size() + column->Fields.size();
+    }
+    FormatType::FileHeader header;
+    memcpy(header.Magic, FormatType::FileMagic, sizeof(header.Magic));
+    header.Version = FormatType::VERSION;
+    header.Flags = this->Compression ? FormatType::FLAG_COMPRESSION : 0;
+    header.NumberOfColumns = static_cast<uint32_t>(this->Columns.size());
+    header.RowsPerChunk = static_cast<uint32_t>(this->RowsPerChunk);
+    header.DataOffset = size;
+
+    char * cursor = this->Reserve(size);
+    if (!cursor) {
+        return false;
+    }
+    WriteBytes(cursor, &header, sizeof(header));
+    for (column = this->Columns.begin(); column != this->Columns.end(); ++column) {
+        WriteString(cursor, column->Name);
+        WriteString(cursor, column->Fields);
+        WriteUInt32(cursor, column->ElementSize);
+        WriteUInt32(cursor, column->ScalarSize);
+        WriteUInt32(cursor, column->Kind);
+    }
+    this->HeaderWritten = this->Commit(size);
+    return this->HeaderWritten;
+}
+
+
+bool mtsCollectorColumnarWriter::WriteChunk(void)
+{
+    if (!this->HeaderWritten) {
+        if (!this->WriteHeader()) {
+            return false;
+        }
+    }
+    const size_t rows = this->RowsInChunk;
+    if (rows == 0) {
+        return true;
+    }
+
+    // size of uncompressed payload
+    size_t rawSize = rows * (sizeof(unsigned long long) + sizeof(double));
+    const size_t numberOfColumns = this->Columns.size();
+    size_t column;
+    for (column = 0; column < numberOfColumns; ++column) {
+        rawSize += rows * this->Columns[column].ElementSize;
+    }
+
+    FormatType::IndexEntry entry;
+    entry.Offset = this->Offset;
+    entry.FirstTicks = this->TicksBuffer[0];
+    entry.LastTicks = this->TicksBuffer[rows - 1];
+    entry.FirstTime = this->TimeBuffer[0];
+    entry.LastTime = this->TimeBuffer[rows - 1];
+    entry.NumberOfRows = static_cast<uint32_t>(rows);
+    entry.Reserved = 0;
+
+    FormatType::ChunkHeader header;
+    header.Magic = FormatType::ChunkMagic;
+    header.NumberOfRows = static_cast<uint32_t>(rows);
+    header.Compressed = 0;
+    header.Reserved = 0;
+    header.RawSize = rawSize;
+    header.StoredSize = rawSize;
+
+    char * cursor;
+    if (this->Compression) {
+        // assemble the chunk and compress it
+        this->RawBuffer.resize(rawSize);
+        cursor = &(this->RawBuffer[0]);
+        WriteBytes(cursor, &(this->TicksBuffer[0]), rows * sizeof(unsigned long long));
+        WriteBytes(cursor, &(this->TimeBuffer[0]), rows * sizeof(double));
+        for (column = 0; column < numberOfColumns; ++column) {
+            WriteBytes(cursor, &(this->ColumnBuffers[column][0]), rows * this->Columns[column].ElementSize);
+        }
+        this->CompressedBuffer.resize(FormatType::CompressBound(rawSize));
+        const size_t compressedSize = FormatType::Compress(&(this->RawBuffer[0]), rawSize,
+                                                           &(this->CompressedBuffer[0]),
+                                                           this->CompressedBuffer.size());
+        const char * payload = &(this->RawBuffer[0]);
+        if (compressedSize > 0) {
+            header.Compressed = 1;
+            header.StoredSize = compressedSize;
+            payload = &(this->CompressedBuffer[0]);
+        }
+        const size_t size = sizeof(header) + header.StoredSize;
+        cursor = this->Reserve(size);
+        if (!cursor) {
+            return false;
+        }
+        WriteBytes(cursor, &header, sizeof(header));
+        WriteBytes(cursor, payload, header.StoredSize);
+        if (!this->Commit(size)) {
+            return false;
+        }
+    } else {
+        // copy columns directly to the file
+        const size_t size = sizeof(header) + rawSize;
+        cursor = this->Reserve(size);
+        if (!cursor) {
+            return false;
+        }
+        WriteBytes(cursor, &header, sizeof(header));
+        WriteBytes(cursor, &(this->TicksBuffer[0]), rows * sizeof(unsigned long long));
+        WriteBytes(cursor, &(this->TimeBuffer[0]), rows * sizeof(double));
+        for (column = 0; column < numberOfColumns; ++column) {
+            WriteBytes(cursor, &(this->ColumnBuffers[column][0]), rows * this->Columns[column].ElementSize);
+        }
+        if (!this->Commit(size)) {
+            return false;
+        }
+    }
+    this->Index.push_back(entry);
+    this->RowsInChunk = 0;
+    return true;
+}
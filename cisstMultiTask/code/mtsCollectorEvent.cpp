@@ -484,6 +484,7 @@ void mtsCollectorEvent::SaveEventVoid(const CollectorEventVoid * event)
         }
         *(this->OutputStream) << mtsTaskManager::GetInstance()->GetTimeServer().GetRelativeTime()
                               << this->Delimiter << event->EventId << std::endl;
+        this->EndOfSample();
         this->SampleCounter++;
         this->SampleCounterForEvent++;
     }
@@ -503,6 +504,7 @@ void mtsCollectorEvent::SaveEventWrite(const CollectorEventWrite * event, const
                               << this->Delimiter << event->EventId << this->Delimiter;
         payload.ToStreamRaw(*(this->OutputStream), this->Delimiter);
         *(this->OutputStream) << std::endl;
+        this->EndOfSample();
         this->SampleCounter++;
         this->SampleCounterForEvent++;
     }
@@ -544,6 +546,9 @@ void mtsCollectorEvent::PrintHeader(const CollectorFileFormat & fileFormat)
         if (fileFormat == COLLECTOR_FILE_FORMAT_BINARY) {
             CMN_LOG_CLASS_INIT_ERROR << "PrintHeader: binary format not supported yet" << std::endl;
         }
+        if (fileFormat == COLLECTOR_FILE_FORMAT_COLUMNAR) {
+            CMN_LOG_CLASS_INIT_ERROR << "PrintHeader: columnar format is only supported for state collectors" << std::endl;
+        }
     } else {
         CMN_LOG_CLASS_RUN_ERROR << "PrintHeader: output stream for collector \""
                                 << this->GetName() << "\" is not available." << std::endl;
@@ -587,7 +592,8 @@ void mtsCollectorEvent::SetCollecting(bool collecting, double currentTime)
         this->ScheduledStartTime = 0.0;
         this->TimeOfLastProgressEvent = currentTime;
     } else {
-        // stop collecting
+        // stop collecting, hand over what's left to the writer thread
+        this->FlushAsyncWriter();
         this->CollectionStoppedEventTrigger(mtsUInt(this->SampleCounterForEvent));
         this->ScheduledStopTime = 0.0;
         this->SampleCounterForEvent = 0;
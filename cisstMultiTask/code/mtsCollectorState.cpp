@@ -27,10 +27,12 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstOSAbstraction/osaTimeServer.h>
 #include <cisstMultiTask/mtsTaskManager.h>
 #include <cisstMultiTask/mtsInterfaceRequired.h>
+#include <cisstMultiTask/mtsCollectorColumnarWriter.h>
 
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <cstring>
 
 /* Header Definition. The value of END_OF_HEADER_SIZE should match the size of
    END_OF_HEADER array. */
@@ -69,6 +71,8 @@ mtsCollectorState::mtsCollectorState(const std::string & targetComponentName,
 
 mtsCollectorState::~mtsCollectorState()
 {
+    // writer thread uses the output file
+    this->StopAsyncWriter();
     // serializer was created for a binary output
     if (this->Serializer) {
         delete this->Serializer;
@@ -379,6 +383,8 @@ void mtsCollectorState::BatchCollect(const mtsStateTable::IndexRange & range)
             }
         }
     }
+    // hand over the batch to the writer thread if it's idle
+    this->FlushAsyncWriter();
 }
 
 
@@ -392,13 +398,16 @@ void mtsCollectorState::PrintHeader(const CollectorFileFormat & fileFormat)
     osaAbsoluteTime origin;
     timeServer.GetTimeOrigin(origin);
     out.precision(20);
+    if (fileFormat == COLLECTOR_FILE_FORMAT_COLUMNAR) {
+        this->AddColumnarColumns();
+    }
     if (this->OutputHeaderStream) {
         this->OutputHeaderStream->precision(20);
         out << "Ticks";
         RegisteredSignalElementType::const_iterator it = RegisteredSignalElements.begin();
         for (; it != RegisteredSignalElements.end(); ++it) {
             out << this->Delimiter;
-            (*(TargetStateTable->StateVector[it->ID]))[0].ToStreamRaw(*((std::ostream*) &out), this->Delimiter, true,
+            TargetStateTable->StateVector[it->ID]->ElementToStreamRaw(0, *((std::ostream*) &out), this->Delimiter, true,
                                                                       TargetStateTable->StateVectorDataNames[it->ID]);
         }
         out << std::endl;
@@ -434,6 +443,8 @@ void mtsCollectorState::PrintHeader(const CollectorFileFormat & fileFormat)
             *(this->OutputHeaderStream) << "Text" << std::endl ;
         } else if (fileFormat == COLLECTOR_FILE_FORMAT_CSV) {
             *(this->OutputHeaderStream) << "CSV" << std::endl ;
+        } else if (fileFormat == COLLECTOR_FILE_FORMAT_COLUMNAR) {
+            *(this->OutputHeaderStream) << "Columnar" << std::endl ;
         } else {
             *(this->OutputHeaderStream) << "Binary" << std::endl;
         }
@@ -490,7 +501,7 @@ void mtsCollectorState::PrintHeader(const CollectorFileFormat & fileFormat)
         RegisteredSignalElementType::const_iterator it = RegisteredSignalElements.begin();
         for (; it != RegisteredSignalElements.end(); ++it) {
             *(this->OutputStream) << this->Delimiter;
-            (*(TargetStateTable->StateVector[it->ID]))[0].ToStreamRaw(*(this->OutputStream), this->Delimiter, true,
+            TargetStateTable->StateVector[it->ID]->ElementToStreamRaw(0, *(this->OutputStream), this->Delimiter, true,
                                                                       TargetStateTable->StateVectorDataNames[it->ID]);
         }
 
@@ -515,6 +526,47 @@ void mtsCollectorState::PrintHeader(const CollectorFileFormat & fileFormat)
 }
 
 
+void mtsCollectorState::AddColumnarColumns(void)
+{
+    ColumnarSignals.clear();
+    ColumnarElementSizes.clear();
+    if (!this->ColumnarWriter || !this->ColumnarWriter->IsOpen()) {
+        CMN_LOG_CLASS_INIT_ERROR << "AddColumnarColumns: columnar file not open for collector \""
+                                 << this->GetName() << "\"" << std::endl;
+        return;
+    }
+    for (size_t index = 0; index < RegisteredSignalElements.size(); ++index) {
+        const unsigned int id = RegisteredSignalElements[index].ID;
+        const mtsStateArrayBase * history = TargetStateTable->StateVector[id];
+        mtsCollectorColumnarWriter::ColumnDescription column;
+        char kind;
+        if (!history->GetRawLayout(column.ElementSize, kind, column.ScalarSize)) {
+            CMN_LOG_CLASS_INIT_WARNING << "AddColumnarColumns: collector \"" << this->GetName()
+                                       << "\", signal \"" << RegisteredSignalElements[index].Name
+                                       << "\" doesn't have a fixed binary layout and will not be recorded" << std::endl;
+            continue;
+        }
+        column.Kind = static_cast<mtsCollectorColumnarFormat::ScalarKind>(kind);
+        column.Name = RegisteredSignalElements[index].Name;
+        // raw elements only contain the data, not the timestamp nor valid flag
+        const size_t numberOfScalars = column.ElementSize / column.ScalarSize;
+        std::ostringstream fields;
+        if (numberOfScalars == 1) {
+            fields << column.Name;
+        } else {
+            for (size_t scalar = 0; scalar < numberOfScalars; ++scalar) {
+                fields << (scalar == 0 ? "" : ",") << column.Name << "-v" << scalar;
+            }
+        }
+        column.Fields = fields.str();
+        if (this->ColumnarWriter->AddColumn(column)) {
+            ColumnarSignals.push_back(index);
+            ColumnarElementSizes.push_back(column.ElementSize);
+        }
+    }
+}
+
+
 void mtsCollectorState::MarkHeaderEnd(std::ostream & output)
 {
     for (int i = 0; i < END_OF_HEADER_SIZE; ++i) {
@@ -539,6 +591,9 @@ bool mtsCollectorState::FetchStateTableData(const mtsStateTable * table,
                                             const size_t startIndex,
                                             const size_t endIndex)
 {
+    if (FileFormat == COLLECTOR_FILE_FORMAT_COLUMNAR) {
+        return FetchStateTableDataColumnar(table, startIndex, endIndex);
+    }
     if (this->OutputStream) {
         if (this->OutputStream->good()) {
             if (FileFormat == COLLECTOR_FILE_FORMAT_BINARY) {
@@ -552,9 +607,10 @@ bool mtsCollectorState::FetchStateTableData(const mtsStateTable * table,
 
                     for (j = 0; j < RegisteredSignalElements.size(); ++j) {
                         StringStreamBufferForSerialization.str("");
-                        Serializer->Serialize((*table->StateVector[RegisteredSignalElements[j].ID])[i]);
+                        table->StateVector[RegisteredSignalElements[j].ID]->ElementSerialize(i, *Serializer);
                         *(this->OutputStream) << StringStreamBufferForSerialization.str();
                     }
+                    this->EndOfSample();
                 }
                 OffsetForNextRead = (i - endIndex == 0 ? SamplingInterval : i - endIndex);
             } else {
@@ -563,9 +619,10 @@ bool mtsCollectorState::FetchStateTableData(const mtsStateTable * table,
                     *(this->OutputStream) << TargetStateTable->Ticks[i];
                     for (j = 0; j < RegisteredSignalElements.size(); ++j) {
                         *(this->OutputStream) << this->Delimiter;
-                        (*table->StateVector[RegisteredSignalElements[j].ID])[i].ToStreamRaw(*(this->OutputStream), this->Delimiter);
+                        table->StateVector[RegisteredSignalElements[j].ID]->ElementToStreamRaw(i, *(this->OutputStream), this->Delimiter);
                     }
                     *(this->OutputStream) << std::endl;
+                    this->EndOfSample();
                 }
                 OffsetForNextRead = (i - endIndex == 0 ? SamplingInterval : i - endIndex);
             }
@@ -580,6 +637,38 @@ bool mtsCollectorState::FetchStateTableData(const mtsStateTable * table,
 }
 
 
+bool mtsCollectorState::FetchStateTableDataColumnar(const mtsStateTable * table,
+                                                    const size_t startIndex,
+                                                    const size_t endIndex)
+{
+    if (!this->ColumnarWriter || !this->ColumnarWriter->IsOpen()) {
+        CMN_LOG_CLASS_RUN_ERROR << "FetchStateTableDataColumnar: columnar file for collector \"" << this->GetName() << "\" is not available." << std::endl;
+        return true;
+    }
+    const mtsStateArrayBase * ticHistory = table->StateVector[table->TicId];
+    const size_t numberOfColumns = ColumnarSignals.size();
+    size_t i, j;
+    for (i = startIndex; i <= endIndex; i += SamplingInterval) {
+        double time = 0.0;
+        ticHistory->GetRawElement(i, &time, sizeof(time));
+        if (!this->ColumnarWriter->AddRow(table->Ticks[i], time)) {
+            CMN_LOG_CLASS_RUN_ERROR << "FetchStateTableDataColumnar: failed to write to \"" << this->OutputFileName << "\"" << std::endl;
+            break;
+        }
+        for (j = 0; j < numberOfColumns; ++j) {
+            const mtsStateArrayBase * history = table->StateVector[RegisteredSignalElements[ColumnarSignals[j]].ID];
+            char * cell = this->ColumnarWriter->GetCell(j);
+            if (!history->GetRawElement(i, cell, ColumnarElementSizes[j])) {
+                // size changed since the header was written
+                memset(cell, 0, ColumnarElementSizes[j]);
+            }
+        }
+    }
+    OffsetForNextRead = (i - endIndex == 0 ? SamplingInterval : i - endIndex);
+    return true;
+}
+
+
 bool mtsCollectorState::ConvertBinaryToText(const std::string sourceBinaryFileName,
                                             const std::string targetPlainTextFileName,
                                             const char delimiter)
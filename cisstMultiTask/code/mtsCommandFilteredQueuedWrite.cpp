@@ -80,3 +80,10 @@ mtsExecutionResult mtsCommandFilteredQueuedWrite::Execute(const mtsGenericObject
     }
     return mtsExecutionResult::COMMAND_DISABLED;
 }
+
+
+mtsExecutionResult mtsCommandFilteredQueuedWrite::ExecuteShared(mtsSharedArgument * argument, mtsBlockingType blocking,
+                                                                mtsCommandWriteBase * finishedEventHandler)
+{
+    return this->Execute(*(argument->GetArgument()), blocking, finishedEventHandler);
+}
@@ -38,6 +38,89 @@ mtsExecutionResult mtsCommandQueuedWriteBase::Execute(const mtsGenericObject & a
     return Execute(argument, blocking, 0);
 }
 
+void mtsCommandQueuedWriteBase::AllocateBaseQueues(size_t size)
+{
+    BlockingFlagQueue.SetSize(size, MTS_NOT_BLOCKING);
+    mtsCommandWriteBase * cmd = 0;
+    FinishedEventQueue.SetSize(size, cmd);
+    mtsSharedArgument * shared = 0;
+    SharedArgumentsQueue.SetSize(size, shared);
+}
+
+
+mtsExecutionResult mtsCommandQueuedWriteBase::ExecuteShared(mtsSharedArgument * argument,
+                                                            mtsBlockingType blocking,
+                                                            mtsCommandWriteBase * finishedEventHandler)
+{
+    // check if this command is enabled
+    if (!this->IsEnabled()) {
+        return mtsExecutionResult::COMMAND_DISABLED;
+    }
+    // check if there is a mailbox (i.e. if the command is associated to an interface)
+    if (!MailBox) {
+        CMN_LOG_RUN_ERROR << "Class mtsCommandQueuedWriteBase: ExecuteShared: no mailbox for \""
+                          << this->Name << "\"" << std::endl;
+        return mtsExecutionResult::COMMAND_HAS_NO_MAILBOX;
+    }
+    // check if all queues have some space, the derived class argument queue is not used
+    if (BlockingFlagQueue.IsFull() || FinishedEventQueue.IsFull() || SharedArgumentsQueue.IsFull() || MailBox->IsFull()) {
+        CMN_LOG_RUN_WARNING << "Class mtsCommandQueuedWriteBase: ExecuteShared: Queue full for \""
+                            << this->Name << "\" ["
+                            << BlockingFlagQueue.IsFull() << "|"
+                            << FinishedEventQueue.IsFull() << "|"
+                            << SharedArgumentsQueue.IsFull() << "|"
+                            << MailBox->IsFull() << "]"
+                            << std::endl;
+        return mtsExecutionResult::COMMAND_ARGUMENT_QUEUE_FULL;
+    }
+    // reference released by SharedArgumentGet once the command is executed
+    argument->AddReference();
+    if (!SharedArgumentsQueue.Put(argument)) {
+        CMN_LOG_RUN_ERROR << "Class mtsCommandQueuedWriteBase: ExecuteShared: SharedArgumentsQueue.Put failed for \""
+                          << this->Name << "\"" << std::endl;
+        argument->Release();
+        cmnThrow("mtsCommandQueuedWriteBase: ExecuteShared: SharedArgumentsQueue.Put failed");
+        return mtsExecutionResult::UNDEFINED;
+    }
+    if (!BlockingFlagQueue.Put(blocking)) {
+        CMN_LOG_RUN_ERROR << "Class mtsCommandQueuedWriteBase: ExecuteShared: BlockingFlagQueue.Put failed for \""
+                          << this->Name << "\"" << std::endl;
+        SharedArgumentGet();        // Remove and release the argument that was already queued
+        cmnThrow("mtsCommandQueuedWriteBase: ExecuteShared: BlockingFlagQueue.Put failed");
+        return mtsExecutionResult::UNDEFINED;
+    }
+    if (!FinishedEventQueue.Put(finishedEventHandler)) {
+        CMN_LOG_RUN_ERROR << "Class mtsCommandQueuedWriteBase: ExecuteShared: FinishedEventQueue.Put failed for \""
+                          << this->Name << "\"" << std::endl;
+        SharedArgumentGet();        // Remove and release the argument that was already queued
+        BlockingFlagQueue.Get();    // Remove the blocking flag that was already queued
+        cmnThrow("mtsCommandQueuedWriteBase: ExecuteShared: FinishedEventQueue.Put failed");
+        return mtsExecutionResult::UNDEFINED;
+    }
+    if (!MailBox->Write(this)) {
+        CMN_LOG_RUN_ERROR << "Class mtsCommandQueuedWriteBase: ExecuteShared: MailBox.Write failed for \""
+                          << this->Name << "\"" << std::endl;
+        SharedArgumentGet();       // Remove and release the argument that was already queued
+        BlockingFlagQueue.Get();   // Remove the blocking flag that was already queued
+        FinishedEventQueue.Get();  // Remove the finished event handler that was already queued
+        cmnThrow("mtsCommandQueuedWriteBase: ExecuteShared: MailBox.Write failed");
+        return mtsExecutionResult::UNDEFINED;
+    }
+    return mtsExecutionResult::COMMAND_QUEUED;
+}
+
+
+bool mtsCommandQueuedWriteBase::SharedArgumentGet(void)
+{
+    mtsSharedArgument ** shared = this->SharedArgumentsQueue.Get();
+    if (shared && *shared) {
+        (*shared)->Release();
+        return true;
+    }
+    return false;
+}
+
+
 mtsBlockingType mtsCommandQueuedWriteBase::BlockingFlagGet(void)
 {
     return *(this->BlockingFlagQueue.Get());
@@ -60,9 +143,7 @@ mtsCommandQueuedWriteGeneric::mtsCommandQueuedWriteGeneric(mtsMailBox * mailBox,
     const mtsGenericObject * argumentPrototype = dynamic_cast<const mtsGenericObject *>(this->GetArgumentPrototype());
     if (argumentPrototype) {
         ArgumentsQueue.SetSize(size, *argumentPrototype);
-        BlockingFlagQueue.SetSize(size, MTS_NOT_BLOCKING);
-        mtsCommandWriteBase *cmd = 0;
-        FinishedEventQueue.SetSize(size, cmd);
+        this->AllocateBaseQueues(size);
     } else {
         CMN_LOG_INIT_DEBUG << "Class mtsCommandQueuedWriteGeneric: constructor: can't find argument prototype from actual command \""
                            << this->GetName() << "\"" << std::endl;
@@ -80,9 +161,7 @@ void mtsCommandQueuedWriteGeneric::Allocate(size_t size)
         const mtsGenericObject * argumentPrototype = dynamic_cast<const mtsGenericObject *>(this->GetArgumentPrototype());
         if (argumentPrototype) {
             ArgumentsQueue.SetSize(size, *argumentPrototype);
-            BlockingFlagQueue.SetSize(size, MTS_NOT_BLOCKING);
-            mtsCommandWriteBase *cmd = 0;
-            FinishedEventQueue.SetSize(size, cmd);
+            this->AllocateBaseQueues(size);
         } else {
             CMN_LOG_INIT_ERROR << "Class mtsCommandQueuedWriteGeneric: Allocate: can't find argument prototype from actual command \""
                                << this->GetName() << "\"" << std::endl;
@@ -106,7 +185,8 @@ mtsExecutionResult mtsCommandQueuedWriteGeneric::Execute(const mtsGenericObject
         return mtsExecutionResult::COMMAND_HAS_NO_MAILBOX;
     }
     // check if all queues have some space
-    if (ArgumentsQueue.IsFull() || BlockingFlagQueue.IsFull() || FinishedEventQueue.IsFull() || MailBox->IsFull()) {
+    if (ArgumentsQueue.IsFull() || BlockingFlagQueue.IsFull() || FinishedEventQueue.IsFull()
+        || SharedArgumentsQueue.IsFull() || MailBox->IsFull()) {
         CMN_LOG_RUN_WARNING << "Class mtsCommandQueuedWriteGeneric: Execute: Queue full for \""
                             << this->Name << "\" ["
                             << ArgumentsQueue.IsFull() << "|"
@@ -140,6 +220,16 @@ mtsExecutionResult mtsCommandQueuedWriteGeneric::Execute(const mtsGenericObject
         cmnThrow("mtsCommandQueuedWriteGeneric: Execute: FinishedEventQueue.Put failed");
         return mtsExecutionResult::UNDEFINED;
     }
+    // argument is not shared
+    if (!SharedArgumentsQueue.Put(0)) {
+        CMN_LOG_RUN_ERROR << "Class mtsCommandQueuedWriteGeneric: Execute: SharedArgumentsQueue.Put failed for \""
+                          << this->Name << "\"" << std::endl;
+        ArgumentsQueue.Get();       // Remove the argument that was already queued
+        BlockingFlagQueue.Get();    // Remove the blocking flag that was already queued
+        FinishedEventQueue.Get();   // Remove the finished event handler that was already queued
+        cmnThrow("mtsCommandQueuedWriteGeneric: Execute: SharedArgumentsQueue.Put failed");
+        return mtsExecutionResult::UNDEFINED;
+    }
     // finally try to queue to mailbox
     if (!MailBox->Write(this)) {
         CMN_LOG_RUN_ERROR << "Class mtsCommandQueuedWriteGeneric: Execute: MailBox.Write failed for \""
@@ -147,6 +237,7 @@ mtsExecutionResult mtsCommandQueuedWriteGeneric::Execute(const mtsGenericObject
         ArgumentsQueue.Get();      // Remove the argument that was already queued
         BlockingFlagQueue.Get();   // Remove the blocking flag that was already queued
         FinishedEventQueue.Get();  // Remove the finished event handler that was already queued
+        SharedArgumentsQueue.Get();
         cmnThrow("mtsCommandQueuedWriteGeneric: Execute: MailBox.Write failed");
         return mtsExecutionResult::UNDEFINED;
     }
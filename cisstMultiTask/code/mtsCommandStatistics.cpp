@@ -0,0 +1,135 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstMultiTask/mtsCommandStatistics.h>
+#include <cisstCommon/cmnSerializer.h>
+#include <cisstCommon/cmnDeSerializer.h>
+
+CMN_IMPLEMENT_SERVICES(mtsCommandStatistics);
+
+
+size_t mtsCommandStatistics::Index(const std::string & commandName)
+{
+    for (size_t index = 0; index < mNames.size(); ++index) {
+        if (mNames[index] == commandName) {
+            return index;
+        }
+    }
+    mNames.push_back(commandName);
+    mQueueLatencies.push_back(mtsLatencyHistogram());
+    mExecutionTimes.push_back(mtsLatencyHistogram());
+    mMaxQueueDepths.push_back(0);
+    mSumQueueDepths.push_back(0.0);
+    return mNames.size() - 1;
+}
+
+
+void mtsCommandStatistics::Add(const size_t index, const double queueLatency, const double executionTime,
+                               const size_t queueDepth)
+{
+    mQueueLatencies[index].Add(queueLatency);
+    mExecutionTimes[index].Add(executionTime);
+    if (queueDepth > mMaxQueueDepths[index]) {
+        mMaxQueueDepths[index] = static_cast<unsigned int>(queueDepth);
+    }
+    mSumQueueDepths[index] += static_cast<double>(queueDepth);
+}
+
+
+void mtsCommandStatistics::Reset(void)
+{
+    for (size_t index = 0; index < mNames.size(); ++index) {
+        mQueueLatencies[index].Reset();
+        mExecutionTimes[index].Reset();
+        mMaxQueueDepths[index] = 0;
+        mSumQueueDepths[index] = 0.0;
+    }
+}
+
+
+double mtsCommandStatistics::MeanQueueDepth(const size_t index) const
+{
+    const unsigned long long numberOfSamples = mQueueLatencies[index].NumberOfSamples();
+    if (numberOfSamples == 0) {
+        return 0.0;
+    }
+    return mSumQueueDepths[index] / static_cast<double>(numberOfSamples);
+}
+
+
+void mtsCommandStatistics::ToStream(std::ostream & outputStream) const
+{
+    for (size_t index = 0; index < mNames.size(); ++index) {
+        outputStream << mNames[index]
+                     << ": Calls: " << mQueueLatencies[index].NumberOfSamples()
+                     << " Queue P50: " << mQueueLatencies[index].P50()
+                     << " P99: " << mQueueLatencies[index].P99()
+                     << " Max: " << mQueueLatencies[index].Max()
+                     << " Execution P50: " << mExecutionTimes[index].P50()
+                     << " P99: " << mExecutionTimes[index].P99()
+                     << " Max: " << mExecutionTimes[index].Max()
+                     << " Depth Mean: " << MeanQueueDepth(index)
+                     << " Max: " << mMaxQueueDepths[index] << std::endl;
+    }
+}
+
+
+void mtsCommandStatistics::ToStreamRaw(std::ostream & outputStream, const char delimiter,
+                                       bool headerOnly, const std::string & headerPrefix) const
+{
+    mtsGenericObject::ToStreamRaw(outputStream, delimiter, headerOnly, headerPrefix);
+    for (size_t index = 0; index < mNames.size(); ++index) {
+        const std::string prefix = headerPrefix + "-" + mNames[index];
+        outputStream << delimiter;
+        mQueueLatencies[index].ToStreamRaw(outputStream, delimiter, headerOnly, prefix + "-Queue");
+        outputStream << delimiter;
+        mExecutionTimes[index].ToStreamRaw(outputStream, delimiter, headerOnly, prefix + "-Execution");
+        outputStream << delimiter;
+        if (headerOnly) {
+            outputStream << prefix << "-DepthMean" << delimiter
+                         << prefix << "-DepthMax";
+        } else {
+            outputStream << MeanQueueDepth(index) << delimiter
+                         << mMaxQueueDepths[index];
+        }
+    }
+}
+
+
+void mtsCommandStatistics::SerializeRaw(std::ostream & outputStream) const
+{
+    mtsGenericObject::SerializeRaw(outputStream);
+    cmnSerializeRaw(outputStream, mNames);
+    cmnSerializeRaw(outputStream, mQueueLatencies);
+    cmnSerializeRaw(outputStream, mExecutionTimes);
+    cmnSerializeRaw(outputStream, mMaxQueueDepths);
+    cmnSerializeRaw(outputStream, mSumQueueDepths);
+}
+
+
+void mtsCommandStatistics::DeSerializeRaw(std::istream & inputStream)
+{
+    mtsGenericObject::DeSerializeRaw(inputStream);
+    cmnDeSerializeRaw(inputStream, mNames);
+    cmnDeSerializeRaw(inputStream, mQueueLatencies);
+    cmnDeSerializeRaw(inputStream, mExecutionTimes);
+    cmnDeSerializeRaw(inputStream, mMaxQueueDepths);
+    cmnDeSerializeRaw(inputStream, mSumQueueDepths);
+}
@@ -197,7 +197,7 @@ void mtsEventReceiverVoid::ToStream(std::ostream & outputStream) const
 
 //************************************* mtsEventReceiverWrite ***************************************************
 
-mtsEventReceiverWrite::mtsEventReceiverWrite() : mtsEventReceiverBase(), Command(0), UserHandler(0), ArgPtr(0)
+mtsEventReceiverWrite::mtsEventReceiverWrite() : mtsEventReceiverBase(), Command(0), UserHandler(0), ArgPtr(0), ArgFailed(false)
 {}
 
 mtsEventReceiverWrite::~mtsEventReceiverWrite()
@@ -219,7 +219,7 @@ void mtsEventReceiverWrite::EventHandler(const mtsGenericObject &arg)
     if (ArgPtr && !ArgPtr->Services()->Create(ArgPtr, arg)) {
         CMN_LOG_RUN_ERROR << "mtsEventReceiverWrite: could not copy from " << arg.Services()->GetName()
                           << " to " << ArgPtr->Services()->GetName() << std::endl;
-        ArgPtr = 0; // Set this to signal an error
+        ArgFailed = true; // Set this to signal an error
     }
     if (UserHandler)
         UserHandler->Execute(arg, MTS_NOT_BLOCKING);
@@ -242,14 +242,36 @@ void mtsEventReceiverWrite::SetHandlerCommand(mtsCommandWriteBase *cmdHandler)
     }
 }
 
+bool mtsEventReceiverWrite::PrepareToWait(mtsGenericObject &obj)
+{
+    // Set ArgPtr before the event can be raised, i.e. before the command is issued
+    if (!mtsEventReceiverBase::PrepareToWait())
+        return false;
+    ArgPtr = &obj;
+    ArgFailed = false;
+    return true;
+}
+
+void mtsEventReceiverWrite::ClearWait(void)
+{
+    ArgPtr = 0;
+    ArgFailed = false;
+    mtsEventReceiverBase::ClearWait();
+}
+
 // Here, a false return value could mean that the wait failed, or that the wait succeeded but the return value (obj)
 // is invalid.
 bool mtsEventReceiverWrite::Wait(mtsGenericObject &obj)
 {
-    ArgPtr = &obj;
+    // ArgPtr is already set if PrepareToWait(obj) was called, the event might have been received
+    if (ArgPtr != &obj) {
+        ArgPtr = &obj;
+        ArgFailed = false;
+    }
     bool ret = mtsEventReceiverBase::Wait();
-    if (ArgPtr == 0) ret = false;
+    if (ArgFailed) ret = false;
     ArgPtr = 0;
+    ArgFailed = false;
     return ret;
 }
 
@@ -257,10 +279,14 @@ bool mtsEventReceiverWrite::Wait(mtsGenericObject &obj)
 // is invalid.
 bool mtsEventReceiverWrite::WaitWithTimeout(double timeoutInSec, mtsGenericObject &obj)
 {
-    ArgPtr = &obj;
+    if (ArgPtr != &obj) {
+        ArgPtr = &obj;
+        ArgFailed = false;
+    }
     bool ret = mtsEventReceiverBase::WaitWithTimeout(timeoutInSec);
-    if (ArgPtr == 0) ret = false;
+    if (ArgFailed) ret = false;
     ArgPtr = 0;
+    ArgFailed = false;
     return ret;
 }
 
@@ -73,10 +73,9 @@ mtsExecutionResult mtsFunctionBase::WaitForResult(mtsGenericObject &arg) const
     return ret;
 }
 
-mtsExecutionResult mtsFunctionBase::WaitForResult(void) const
+mtsExecutionResult mtsFunctionBase::WaitForResult(mtsExecutionResultProxy &result) const
 {
-    mtsExecutionResultProxy remoteResult;
-    if (CompletionCommand && CompletionCommand->Wait(remoteResult))
-        return remoteResult.GetData();
+    if (CompletionCommand && CompletionCommand->Wait(result))
+        return result.GetData();
     return mtsExecutionResult::INVALID_INPUT_TYPE;
 }
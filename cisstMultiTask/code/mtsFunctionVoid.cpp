@@ -73,10 +73,11 @@ mtsExecutionResult mtsFunctionVoid::ExecuteBlocking(void) const
     }
     // If Command is valid (not NULL), then CompletionCommand should also be valid
     CMN_ASSERT(CompletionCommand);
-    CompletionCommand->PrepareToWait();
+    mtsExecutionResultProxy remoteResult;
+    CompletionCommand->PrepareToWait(remoteResult);
     mtsExecutionResult executionResult = Command->Execute(MTS_BLOCKING, CompletionCommand->GetCommand());
     if (executionResult.GetResult() == mtsExecutionResult::COMMAND_QUEUED)
-        executionResult = WaitForResult();
+        executionResult = WaitForResult(remoteResult);
     CompletionCommand->ClearWait();
     return executionResult;
 }
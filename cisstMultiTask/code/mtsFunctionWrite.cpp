@@ -67,10 +67,11 @@ mtsExecutionResult mtsFunctionWrite::ExecuteBlockingGeneric(const mtsGenericObje
     }
     // If Command is valid (not NULL), then CompletionCommand should also be valid
     CMN_ASSERT(CompletionCommand);
-    CompletionCommand->PrepareToWait();
+    mtsExecutionResultProxy remoteResult;
+    CompletionCommand->PrepareToWait(remoteResult);
     mtsExecutionResult executionResult = Command->Execute(argument, MTS_BLOCKING, CompletionCommand->GetCommand());
     if (executionResult.GetResult() == mtsExecutionResult::COMMAND_QUEUED)
-        executionResult = WaitForResult();
+        executionResult = WaitForResult(remoteResult);
     CompletionCommand->ClearWait();
     return executionResult;
 }
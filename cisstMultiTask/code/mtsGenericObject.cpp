@@ -159,6 +159,44 @@ void cmnData<mtsGenericObject>::DeSerializeBinary(mtsGenericObject & data,
 }
 
 
+template <>
+size_t cmnData<mtsGenericObject>::SerializeBinaryByteSize(const mtsGenericObject & data)
+{
+    return cmnData<double>::SerializeBinaryByteSize(data.Timestamp())
+        + cmnData<bool>::SerializeBinaryByteSize(data.AutomaticTimestamp())
+        + cmnData<bool>::SerializeBinaryByteSize(data.Valid());
+}
+
+
+template <>
+size_t cmnData<mtsGenericObject>::SerializeBinary(const mtsGenericObject & data, char * buffer, size_t bufferSize)
+{
+    const size_t sizeOfData = cmnData<mtsGenericObject>::SerializeBinaryByteSize(data);
+    if (bufferSize < sizeOfData) {
+        return 0;
+    }
+    buffer += cmnData<double>::SerializeBinary(data.Timestamp(), buffer, bufferSize);
+    buffer += cmnData<bool>::SerializeBinary(data.AutomaticTimestamp(), buffer, sizeof(bool));
+    cmnData<bool>::SerializeBinary(data.Valid(), buffer, sizeof(bool));
+    return sizeOfData;
+}
+
+
+template <>
+size_t cmnData<mtsGenericObject>::DeSerializeBinary(mtsGenericObject & data, const char * buffer, size_t bufferSize,
+                                                    const cmnDataFormat & localFormat, const cmnDataFormat & remoteFormat)
+{
+    const size_t sizeOfData = cmnData<mtsGenericObject>::SerializeBinaryByteSize(data);
+    if (bufferSize < sizeOfData) {
+        return 0;
+    }
+    buffer += cmnData<double>::DeSerializeBinary(data.Timestamp(), buffer, bufferSize, localFormat, remoteFormat);
+    buffer += cmnData<bool>::DeSerializeBinary(data.AutomaticTimestamp(), buffer, sizeof(bool), localFormat, remoteFormat);
+    cmnData<bool>::DeSerializeBinary(data.Valid(), buffer, sizeof(bool), localFormat, remoteFormat);
+    return sizeOfData;
+}
+
+
 template <>
 void cmnData<mtsGenericObject>::SerializeText(const mtsGenericObject & data, std::ostream & outputStream, const char delimiter)
     CISST_THROW(std::runtime_error)
@@ -28,6 +28,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstMultiTask/mtsCommandFilteredWrite.h>
 #include <cisstMultiTask/mtsCommandFilteredQueuedWrite.h>
 #include <cisstMultiTask/mtsComponent.h>
+#include <cisstMultiTask/mtsCommandStatistics.h>
 
 #include <iostream>
 #include <string>
@@ -42,6 +43,9 @@ mtsInterfaceProvided::mtsInterfaceProvided(const std::string & name, mtsComponen
     MailBox(0),
     QueueingPolicy(queueingPolicy),
     ArgumentQueuesSize(DEFAULT_MAIL_BOX_AND_ARGUMENT_QUEUES_SIZE),
+    MailBoxProducerPolicy(MTS_MAILBOX_SINGLE_PRODUCER),
+    SharedMailBox(0),
+    CommandStatistics(0),
     BlockingCommandExecuted(0),
     BlockingCommandReturnExecuted(0),
     OriginalInterface(0),
@@ -114,13 +118,17 @@ void mtsInterfaceProvided::CloneCommands(const std::string &cmdType, const _MapT
 mtsInterfaceProvided::mtsInterfaceProvided(mtsInterfaceProvided * originalInterface,
                                            const std::string & userName,
                                            size_t mailBoxSize,
-                                           size_t argumentQueuesSize):
+                                           size_t argumentQueuesSize,
+                                           mtsMailBox * sharedMailBox):
     BaseType(mtsInterfaceProvided::GenerateEndUserInterfaceName(originalInterface, userName),
              originalInterface->Component),
     MailBox(0),
     QueueingPolicy(MTS_COMMANDS_SHOULD_BE_QUEUED),
     MailBoxSize(mailBoxSize),
     ArgumentQueuesSize(argumentQueuesSize),
+    MailBoxProducerPolicy(originalInterface->MailBoxProducerPolicy),
+    SharedMailBox(0),
+    CommandStatistics(0),
     BlockingCommandExecuted(0),
     BlockingCommandReturnExecuted(0),
     OriginalInterface(originalInterface),
@@ -150,10 +158,16 @@ mtsInterfaceProvided::mtsInterfaceProvided(mtsInterfaceProvided * originalInterf
     CommandsInternal.SetOwner(*this);
 
     if (mailBoxSize != 0) {
-        // duplicate what needs to be duplicated (i.e. void and write commands)
-        MailBox = new mtsMailBox(this->GetName(),
-                                 mailBoxSize,
-                                 this->PostCommandQueuedCallable);
+        // duplicate what needs to be duplicated (i.e. void and write
+        // commands), mailbox can be shared by all end-user interfaces
+        if (sharedMailBox) {
+            MailBox = sharedMailBox;
+        } else {
+            MailBox = new mtsMailBox(this->GetName(),
+                                     mailBoxSize,
+                                     this->PostCommandQueuedCallable);
+            MailBox->SetStatistics(originalInterface->CommandStatistics);
+        }
 
         // clone void commands
         CloneCommands<CommandVoidMapType, mtsCommandQueuedVoid>("void", originalInterface->CommandsVoid, CommandsVoid);
@@ -176,6 +190,17 @@ mtsInterfaceProvided::~mtsInterfaceProvided()
 	CMN_LOG_CLASS_INIT_VERBOSE << "Class mtsInterfaceProvided: Class destructor" << std::endl;
     // ADV: Need to add all cleanup, i.e. make sure all mailboxes are
     // properly deleted.
+
+    // end-user interfaces removed but not yet deleted by ProcessMailBoxes
+    InterfacesProvidedRemovedMutex.Lock();
+    InterfaceProvidedCreatedListType::iterator iterator;
+    for (iterator = InterfacesProvidedRemoved.begin();
+         iterator != InterfacesProvidedRemoved.end();
+         ++iterator) {
+        delete iterator->second;
+    }
+    InterfacesProvidedRemoved.clear();
+    InterfacesProvidedRemovedMutex.Unlock();
 }
 
 
@@ -217,6 +242,23 @@ void mtsInterfaceProvided::SetMailBoxSize(size_t desiredSize)
 }
 
 
+void mtsInterfaceProvided::SetMailBoxProducerPolicy(mtsMailBoxProducerPolicy policy)
+{
+    if (this->QueueingPolicy == MTS_COMMANDS_SHOULD_NOT_BE_QUEUED) {
+        CMN_LOG_CLASS_INIT_WARNING << "SetMailBoxProducerPolicy: interface \"" << this->GetFullName()
+                                   << "\" is not queuing commands, calling SetMailBoxProducerPolicy has no effect"
+                                   << std::endl;
+    }
+    if (!this->InterfacesProvidedCreated.empty() || this->SharedMailBox) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetMailBoxProducerPolicy: interface \"" << this->GetFullName()
+                                 << "\" already has end-user interfaces, policy can't be changed"
+                                 << std::endl;
+        return;
+    }
+    this->MailBoxProducerPolicy = policy;
+}
+
+
 void mtsInterfaceProvided::SetArgumentQueuesSize(size_t desiredSize)
 {
     if (this->QueueingPolicy == MTS_COMMANDS_SHOULD_NOT_BE_QUEUED) {
@@ -242,6 +284,64 @@ void mtsInterfaceProvided::SetMailBoxAndArgumentQueuesSize(size_t desiredSize)
 
 
 
+bool mtsInterfaceProvided::EnableCommandStatistics(void)
+{
+    if (this->EndUserInterface) {
+        CMN_LOG_CLASS_INIT_ERROR << "EnableCommandStatistics: called on end user interface for "
+                                 << this->GetFullName() << std::endl;
+        return false;
+    }
+    if ((this->QueueingPolicy == MTS_COMMANDS_SHOULD_NOT_BE_QUEUED) || (this->MailBoxSize == 0)) {
+        CMN_LOG_CLASS_INIT_ERROR << "EnableCommandStatistics: interface \"" << this->GetFullName()
+                                 << "\" is not queuing commands" << std::endl;
+        return false;
+    }
+    if (this->CommandStatistics) {
+        CMN_LOG_CLASS_INIT_WARNING << "EnableCommandStatistics: statistics already enabled for interface \""
+                                   << this->GetFullName() << "\"" << std::endl;
+        return true;
+    }
+
+    // use a separate state table with a short history, the
+    // statistics can be large and are only read from time to time
+    mtsStateTable * stateTable = new mtsStateTable(16, this->GetName() + "CommandStatistics");
+    if (!this->Component->AddStateTable(stateTable, false)) {
+        CMN_LOG_CLASS_INIT_ERROR << "EnableCommandStatistics: failed to add state table for interface \""
+                                 << this->GetFullName() << "\"" << std::endl;
+        delete stateTable;
+        return false;
+    }
+    this->CommandStatistics = new mtsCommandStatistics;
+    stateTable->AddData(*(this->CommandStatistics), "CommandStatistics");
+    this->AddCommandReadState(*stateTable, *(this->CommandStatistics), "GetCommandStatistics");
+    this->AddCommandVoid(&mtsInterfaceProvided::ResetCommandStatistics, this, "ResetCommandStatistics");
+
+    // existing end user interfaces
+    if (this->SharedMailBox) {
+        this->SharedMailBox->SetStatistics(this->CommandStatistics);
+    }
+    InterfaceProvidedCreatedListType::iterator iterator;
+    for (iterator = InterfacesProvidedCreated.begin();
+         iterator != InterfacesProvidedCreated.end();
+         ++iterator) {
+        mtsMailBox * mailBox = iterator->second->GetMailBox();
+        if (mailBox) {
+            mailBox->SetStatistics(this->CommandStatistics);
+        }
+    }
+    return true;
+}
+
+
+void mtsInterfaceProvided::ResetCommandStatistics(void)
+{
+    if (this->CommandStatistics) {
+        this->CommandStatistics->Reset();
+    }
+}
+
+
+
 // Execute all commands in the mailbox.  This is just a temporary implementation, where
 // all commands in a mailbox are executed before moving on the next mailbox.  The final
 // implementation will probably look at timestamps.  We may also want to pass in a
@@ -253,12 +353,39 @@ size_t mtsInterfaceProvided::ProcessMailBoxes(void)
         InterfaceProvidedCreatedListType::iterator iterator = InterfacesProvidedCreated.begin();
         //const InterfaceProvidedCreatedVectorType::iterator end = InterfacesProvidedCreated.end();
         mtsMailBox * mailBox;
+        // shared mailbox first, all end-user interfaces use it
+        if (this->SharedMailBox) {
+            // end-user interfaces removed before the mailbox is drained
+            // can't have commands left in the mailbox after
+            InterfacesProvidedRemovedMutex.Lock();
+            size_t numberOfRemoved = InterfacesProvidedRemoved.size();
+            InterfacesProvidedRemovedMutex.Unlock();
+            size_t commandsInMailbox = this->SharedMailBox->GetAvailable();
+            while (commandsInMailbox && this->SharedMailBox->ExecuteNext()) {
+                numberOfCommands++;
+                commandsInMailbox--;
+            }
+            // if a command was still being written, try again next time
+            if (numberOfRemoved && (commandsInMailbox == 0)) {
+                InterfacesProvidedRemovedMutex.Lock();
+                for (; numberOfRemoved != 0; --numberOfRemoved) {
+                    mtsInterfaceProvided * interfaceProvided = InterfacesProvidedRemoved.front().second;
+                    CMN_LOG_CLASS_RUN_VERBOSE << "ProcessMailBoxes: interface \"" << this->GetFullName()
+                                              << "\" deleting removed copy (#" << InterfacesProvidedRemoved.front().first
+                                              << ")" << std::endl;
+                    InterfacesProvidedRemoved.pop_front();
+                    interfaceProvided->SetSharedMailBoxPostCommandDequeuedCommands(false);
+                    delete interfaceProvided;
+                }
+                InterfacesProvidedRemovedMutex.Unlock();
+            }
+        }
         for (;
              //iterator != end;
              iterator != InterfacesProvidedCreated.end();
              ++iterator) {
             mailBox = iterator->second->GetMailBox();
-            if (mailBox) {
+            if (mailBox && (mailBox != this->SharedMailBox)) {
                 // process everything that is available now
                 size_t commandsInMailbox = mailBox->GetAvailable();
                 while (commandsInMailbox && mailBox->ExecuteNext()) {
@@ -691,11 +818,22 @@ mtsInterfaceProvided * mtsInterfaceProvided::GetEndUserInterface(const std::stri
     CMN_LOG_CLASS_INIT_VERBOSE << "GetEndUserInterface: interface \"" << this->GetFullName()
                                << "\" creating new copy (#" << this->UserCounter
                                << ") for user \"" << userName << "\"" << std::endl;
+    // create the shared mailbox for the first user if needed
+    if ((this->MailBoxProducerPolicy == MTS_MAILBOX_MULTIPLE_PRODUCERS)
+        && (this->MailBoxSize != 0)
+        && !this->SharedMailBox) {
+        this->SharedMailBox = new mtsMailBox(this->GetName() + "[shared]",
+                                             this->MailBoxSize,
+                                             this->PostCommandQueuedCallable,
+                                             MTS_MAILBOX_MULTIPLE_PRODUCERS);
+        this->SharedMailBox->SetStatistics(this->CommandStatistics);
+    }
     // new end user interface created with default size for mailbox; also adds system events
     mtsInterfaceProvided * interfaceProvided = new mtsInterfaceProvided(this,
                                                                         userName,
                                                                         this->MailBoxSize,
-                                                                        this->ArgumentQueuesSize);
+                                                                        this->ArgumentQueuesSize,
+                                                                        this->SharedMailBox);
     InterfacesProvidedCreated.push_back(InterfaceProvidedCreatedPairType(this->UserCounter, interfaceProvided));
 
     // finally, add system events
@@ -775,6 +913,15 @@ mtsInterfaceProvided * mtsInterfaceProvided::RemoveEndUserInterface(mtsInterface
             CMN_LOG_CLASS_RUN_VERBOSE << "RemoveEndUserInterface: interface \"" << this->GetFullName()
                                       << "\" removing copy (#" << iterator->first
                                       << ") for user \"" << userName << "\"" << std::endl;
+            // commands might still be queued in the shared mailbox,
+            // the interface will be deleted by ProcessMailBoxes
+            if (this->SharedMailBox && (interfaceProvided->MailBox == this->SharedMailBox)) {
+                InterfacesProvidedRemovedMutex.Lock();
+                InterfacesProvidedRemoved.push_back(*iterator);
+                InterfacesProvidedRemovedMutex.Unlock();
+                InterfacesProvidedCreated.erase(iterator);
+                return 0;
+            }
             InterfacesProvidedCreated.erase(iterator);
             delete interfaceProvided;
             return 0;
@@ -915,7 +1062,10 @@ bool mtsInterfaceProvided::AddSystemEvents(void)
         return false;
     }
     if (this->MailBox) {
-        MailBox->SetPostCommandDequeuedCommand(this->BlockingCommandExecuted);
+        // shared mailbox, events are set per command at the end
+        if (this->MailBox->GetProducerPolicy() != MTS_MAILBOX_MULTIPLE_PRODUCERS) {
+            MailBox->SetPostCommandDequeuedCommand(this->BlockingCommandExecuted);
+        }
     } else {
         CMN_LOG_CLASS_INIT_VERBOSE << "AddSystemEvents: can not set mailbox post dequeued command for blocking commands for interface \""
                                    << this->GetFullName() << "\"" << std::endl;
@@ -928,7 +1078,11 @@ bool mtsInterfaceProvided::AddSystemEvents(void)
         return false;
     }
     if (this->MailBox) {
-        MailBox->SetPostCommandReturnDequeuedCommand(this->BlockingCommandReturnExecuted);
+        if (this->MailBox->GetProducerPolicy() != MTS_MAILBOX_MULTIPLE_PRODUCERS) {
+            MailBox->SetPostCommandReturnDequeuedCommand(this->BlockingCommandReturnExecuted);
+        } else {
+            this->SetSharedMailBoxPostCommandDequeuedCommands(true);
+        }
     } else {
         CMN_LOG_CLASS_INIT_VERBOSE << "AddSystemEvents: can not set mailbox post dequeued command for blocking return commands for interface \""
                                    << this->GetFullName() << "\"" << std::endl;
@@ -937,6 +1091,36 @@ bool mtsInterfaceProvided::AddSystemEvents(void)
 }
 
 
+template <class _MapType>
+void mtsInterfaceProvided::SetSharedMailBoxPostCommandDequeuedCommands(const _MapType & commandMap, bool add)
+{
+    typename _MapType::const_iterator iter;
+    for (iter = commandMap.begin(); iter != commandMap.end(); iter++) {
+        if (add) {
+            this->MailBox->SetPostCommandDequeuedCommands(iter->second,
+                                                          this->BlockingCommandExecuted,
+                                                          this->BlockingCommandReturnExecuted);
+        } else {
+            this->MailBox->RemovePostCommandDequeuedCommands(iter->second);
+        }
+    }
+}
+
+
+void mtsInterfaceProvided::SetSharedMailBoxPostCommandDequeuedCommands(bool add)
+{
+    if (!this->MailBox) {
+        return;
+    }
+    SetSharedMailBoxPostCommandDequeuedCommands(CommandsVoid, add);
+    SetSharedMailBoxPostCommandDequeuedCommands(CommandsVoidReturn, add);
+    SetSharedMailBoxPostCommandDequeuedCommands(CommandsWrite, add);
+    SetSharedMailBoxPostCommandDequeuedCommands(CommandsWriteReturn, add);
+    SetSharedMailBoxPostCommandDequeuedCommands(CommandsRead, add);
+    SetSharedMailBoxPostCommandDequeuedCommands(CommandsQualifiedRead, add);
+}
+
+
 std::vector<std::string> mtsInterfaceProvided::GetNamesOfCommands(void) const
 {
     std::vector<std::string> commands = GetNamesOfCommandsVoid();
@@ -0,0 +1,203 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstMultiTask/mtsLatencyHistogram.h>
+#include <cisstCommon/cmnSerializer.h>
+#include <cisstCommon/cmnDeSerializer.h>
+
+#include <algorithm>
+#include <cmath>
+
+CMN_IMPLEMENT_SERVICES(mtsLatencyHistogram);
+
+namespace {
+    // one bucket per us up to 32 us, then 16 buckets per power of 2 up to 2^26 us (about 67 s)
+    const size_t LinearBuckets = 32;
+    const size_t LinearBits = 5;
+    const size_t SubBucketBits = 4;
+    const size_t SubBuckets = 16;
+    const size_t MaximumBits = 26;
+    const size_t NumberOfBuckets = LinearBuckets + (MaximumBits - LinearBits) * SubBuckets;
+}
+
+
+mtsLatencyHistogram::mtsLatencyHistogram(void):
+    mtsGenericObject(),
+    mCounts(NumberOfBuckets, 0)
+{
+    Reset();
+}
+
+
+size_t mtsLatencyHistogram::BucketIndex(const unsigned long long valueInMicroSeconds)
+{
+    unsigned long long value = valueInMicroSeconds;
+    if (value < LinearBuckets) {
+        return static_cast<size_t>(value);
+    }
+    const unsigned long long maximum = (1ULL << MaximumBits) - 1;
+    if (value > maximum) {
+        value = maximum;
+    }
+    size_t exponent = LinearBits;
+    while ((value >> (exponent + 1)) != 0) {
+        ++exponent;
+    }
+    const size_t subBucket = static_cast<size_t>(value >> (exponent - SubBucketBits)) & (SubBuckets - 1);
+    return LinearBuckets + (exponent - LinearBits) * SubBuckets + subBucket;
+}
+
+
+unsigned long long mtsLatencyHistogram::BucketUpperBound(const size_t index)
+{
+    if (index < LinearBuckets) {
+        return index + 1;
+    }
+    const size_t exponent = LinearBits + (index - LinearBuckets) / SubBuckets;
+    const size_t subBucket = (index - LinearBuckets) % SubBuckets;
+    return static_cast<unsigned long long>(SubBuckets + subBucket + 1) << (exponent - SubBucketBits);
+}
+
+
+void mtsLatencyHistogram::Add(const double valueInSeconds)
+{
+    const double value = (valueInSeconds > 0.0) ? valueInSeconds : 0.0;
+    const double microSeconds = value * 1.0e6;
+    const unsigned long long bucketValue =
+        (microSeconds < 1.0e12) ? static_cast<unsigned long long>(microSeconds) : 1000000000000ULL;
+    mCounts[BucketIndex(bucketValue)]++;
+    if ((mNumberOfSamples == 0) || (value < mMin)) {
+        mMin = value;
+    }
+    if (value > mMax) {
+        mMax = value;
+    }
+    mSum += value;
+    mNumberOfSamples++;
+}
+
+
+void mtsLatencyHistogram::Reset(void)
+{
+    std::fill(mCounts.begin(), mCounts.end(), 0);
+    mNumberOfSamples = 0;
+    mSum = 0.0;
+    mMin = 0.0;
+    mMax = 0.0;
+}
+
+
+double mtsLatencyHistogram::Min(void) const
+{
+    return mMin;
+}
+
+
+double mtsLatencyHistogram::Max(void) const
+{
+    return mMax;
+}
+
+
+double mtsLatencyHistogram::Mean(void) const
+{
+    if (mNumberOfSamples == 0) {
+        return 0.0;
+    }
+    return mSum / static_cast<double>(mNumberOfSamples);
+}
+
+
+double mtsLatencyHistogram::Percentile(const double fraction) const
+{
+    if (mNumberOfSamples == 0) {
+        return 0.0;
+    }
+    unsigned long long target =
+        static_cast<unsigned long long>(std::ceil(fraction * static_cast<double>(mNumberOfSamples)));
+    if (target < 1) {
+        target = 1;
+    }
+    unsigned long long cumulated = 0;
+    for (size_t index = 0; index < mCounts.size(); ++index) {
+        cumulated += mCounts[index];
+        if (cumulated >= target) {
+            const double upperBound = static_cast<double>(BucketUpperBound(index)) * 1.0e-6;
+            return (upperBound < mMax) ? upperBound : mMax;
+        }
+    }
+    return mMax;
+}
+
+
+void mtsLatencyHistogram::ToStream(std::ostream & outputStream) const
+{
+    outputStream << "Samples: " << mNumberOfSamples
+                 << " Min: " << Min()
+                 << " Mean: " << Mean()
+                 << " P50: " << P50()
+                 << " P99: " << P99()
+                 << " Max: " << Max();
+}
+
+
+void mtsLatencyHistogram::ToStreamRaw(std::ostream & outputStream, const char delimiter,
+                                      bool headerOnly, const std::string & headerPrefix) const
+{
+    mtsGenericObject::ToStreamRaw(outputStream, delimiter, headerOnly, headerPrefix);
+    outputStream << delimiter;
+    if (headerOnly) {
+        outputStream << headerPrefix << "-Samples" << delimiter
+                     << headerPrefix << "-Min" << delimiter
+                     << headerPrefix << "-Mean" << delimiter
+                     << headerPrefix << "-P50" << delimiter
+                     << headerPrefix << "-P99" << delimiter
+                     << headerPrefix << "-Max";
+    } else {
+        outputStream << mNumberOfSamples << delimiter
+                     << Min() << delimiter
+                     << Mean() << delimiter
+                     << P50() << delimiter
+                     << P99() << delimiter
+                     << Max();
+    }
+}
+
+
+void mtsLatencyHistogram::SerializeRaw(std::ostream & outputStream) const
+{
+    mtsGenericObject::SerializeRaw(outputStream);
+    cmnSerializeRaw(outputStream, mCounts);
+    cmnSerializeRaw(outputStream, mNumberOfSamples);
+    cmnSerializeRaw(outputStream, mSum);
+    cmnSerializeRaw(outputStream, mMin);
+    cmnSerializeRaw(outputStream, mMax);
+}
+
+
+void mtsLatencyHistogram::DeSerializeRaw(std::istream & inputStream)
+{
+    mtsGenericObject::DeSerializeRaw(inputStream);
+    cmnDeSerializeRaw(inputStream, mCounts);
+    cmnDeSerializeRaw(inputStream, mNumberOfSamples);
+    cmnDeSerializeRaw(inputStream, mSum);
+    cmnDeSerializeRaw(inputStream, mMin);
+    cmnDeSerializeRaw(inputStream, mMax);
+}
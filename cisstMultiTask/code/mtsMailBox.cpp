@@ -25,16 +25,27 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstMultiTask/mtsCommandQueuedVoidReturn.h>
 #include <cisstMultiTask/mtsCommandQueuedWrite.h>
 #include <cisstMultiTask/mtsCommandQueuedWriteReturn.h>
+#include <cisstMultiTask/mtsCommandStatistics.h>
+#include <cisstOSAbstraction/osaTrace.h>
+
+#include <chrono>
 
 
 mtsMailBox::mtsMailBox(const std::string & name,
                        size_t size,
-                       mtsCallableVoidBase * postCommandQueuedCallable):
-    CommandQueue(size, 0),
+                       mtsCallableVoidBase * postCommandQueuedCallable,
+                       mtsMailBoxProducerPolicy producerPolicy):
+    ProducerPolicy(producerPolicy),
+    CommandQueue((producerPolicy == MTS_MAILBOX_SINGLE_PRODUCER) ? size : 0, QueueEntry()),
+    BatchIndex(0),
+    BatchCount(0),
+    BatchAvailable(0),
+    CommandQueueMultipleProducers((producerPolicy == MTS_MAILBOX_MULTIPLE_PRODUCERS) ? size : 0, QueueEntry()),
     Name(name),
     PostCommandQueuedCallable(postCommandQueuedCallable),
     PostCommandDequeuedCommand(0),
-    PostCommandReturnDequeuedCommand(0)
+    PostCommandReturnDequeuedCommand(0),
+    Statistics(0)
 {}
 
 
@@ -48,10 +59,23 @@ const std::string & mtsMailBox::GetName(void) const
 }
 
 
+mtsMailBoxProducerPolicy mtsMailBox::GetProducerPolicy(void) const
+{
+    return this->ProducerPolicy;
+}
+
+
 bool mtsMailBox::Write(mtsCommandBase * command)
 {
     bool result;
-    result = (CommandQueue.Put(command) != 0);
+    // only timestamp commands if statistics are collected
+    const QueueEntry entry(command,
+                           this->Statistics.load(std::memory_order_relaxed) ? GetTime() : 0.0);
+    if (ProducerPolicy == MTS_MAILBOX_MULTIPLE_PRODUCERS) {
+        result = (CommandQueueMultipleProducers.Put(entry) != 0);
+    } else {
+        result = (CommandQueue.Put(entry) != 0);
+    }
     if (this->PostCommandQueuedCallable) {
         this->PostCommandQueuedCallable->Execute();
     }
@@ -62,12 +86,28 @@ bool mtsMailBox::Write(mtsCommandBase * command)
 // return false if nothing to execute; true otherwise.
 bool mtsMailBox::ExecuteNext(void)
 {
-   mtsCommandBase** command = CommandQueue.Peek();
+   // keep a copy of the pointer, with multiple producers the slot
+   // can be re-used as soon as the command is removed from the queue
+   const QueueEntry * entry = this->PeekCommand();
 
    // test for empty queue
-   if (!command) {
+   if (!entry) {
        return false;
    }
+   mtsCommandBase * command = entry->Command;
+
+   // commands queued before statistics were enabled don't have a timestamp
+   mtsCommandStatistics * statistics = this->Statistics.load(std::memory_order_relaxed);
+   const double queuedTime = entry->QueuedTime;
+   double startTime = 0.0;
+   size_t queueDepth = 0;
+   if (statistics && (queuedTime != 0.0)) {
+       startTime = GetTime();
+       const size_t available = this->GetAvailable();
+       queueDepth = (available > 0) ? (available - 1) : 0;
+   }
+
+   osaTraceScope trace("command", command->GetName());
 
    mtsCommandQueuedVoid * commandVoid;
    mtsCommandQueuedWriteBase * commandWrite;
@@ -83,17 +123,17 @@ bool mtsMailBox::ExecuteNext(void)
    bool isBlocking = false;
    bool isBlockingReturn = false;
    try {
-       if (!(*command)->Returns()) {
-           switch ((*command)->NumberOfArguments()) {
+       if (!command->Returns()) {
+           switch (command->NumberOfArguments()) {
            case 0:
-               commandVoid = dynamic_cast<mtsCommandQueuedVoid *>(*command);
+               commandVoid = dynamic_cast<mtsCommandQueuedVoid *>(command);
                CMN_ASSERT(commandVoid);
                isBlocking = (commandVoid->BlockingFlagGet() == MTS_BLOCKING);
                finishedEvent = commandVoid->FinishedEventGet();
                result = commandVoid->GetCallable()->Execute();
                break;
            case 1:
-               commandWrite = dynamic_cast<mtsCommandQueuedWriteBase *>(*command);
+               commandWrite = dynamic_cast<mtsCommandQueuedWriteBase *>(command);
                if (commandWrite) {
                    isBlocking = (commandWrite->BlockingFlagGet() == MTS_BLOCKING);
                    finishedEvent = commandWrite->FinishedEventGet();
@@ -109,7 +149,7 @@ bool mtsMailBox::ExecuteNext(void)
                else {
                    // For the Read command, NumberOfArguments() is 1, and Returns() is false.
                    // But, we will handle a queued Read command the same as a queued Void Return
-                   commandRead = dynamic_cast<mtsCommandQueuedRead *>(*command);
+                   commandRead = dynamic_cast<mtsCommandQueuedRead *>(command);
                    CMN_ASSERT(commandRead);
                    resultPointer = commandRead->ReturnGet();
                    finishedEvent = commandRead->FinishedEventGet();
@@ -120,7 +160,7 @@ bool mtsMailBox::ExecuteNext(void)
            case 2:
                // For the Qualified Read command, NumberOfArguments() is 2, and Returns() is false.
                // But, we will handle a queued Qualified Read command the same as a queued Write Return.
-               commandQualifiedRead = dynamic_cast<mtsCommandQueuedQualifiedRead *>(*command);
+               commandQualifiedRead = dynamic_cast<mtsCommandQueuedQualifiedRead *>(command);
                CMN_ASSERT(commandQualifiedRead);
                resultPointer = commandQualifiedRead->ReturnGet();
                finishedEvent = commandQualifiedRead->FinishedEventGet();
@@ -139,9 +179,9 @@ bool mtsMailBox::ExecuteNext(void)
                return false;
            }
        } else {
-           switch ((*command)->NumberOfArguments()) {
+           switch (command->NumberOfArguments()) {
            case 0:
-               commandVoidReturn = dynamic_cast<mtsCommandQueuedVoidReturn *>(*command);
+               commandVoidReturn = dynamic_cast<mtsCommandQueuedVoidReturn *>(command);
                CMN_ASSERT(commandVoidReturn);
                resultPointer = commandVoidReturn->ReturnGet();
                finishedEvent = commandVoidReturn->FinishedEventGet();
@@ -149,7 +189,7 @@ bool mtsMailBox::ExecuteNext(void)
                result = commandVoidReturn->GetCallable()->Execute(*resultPointer);
                break;
            case 1:
-               commandWriteReturn = dynamic_cast<mtsCommandQueuedWriteReturn *>(*command);
+               commandWriteReturn = dynamic_cast<mtsCommandQueuedWriteReturn *>(command);
                CMN_ASSERT(commandWriteReturn);
                resultPointer = commandWriteReturn->ReturnGet();
                finishedEvent = commandWriteReturn->FinishedEventGet();
@@ -170,47 +210,77 @@ bool mtsMailBox::ExecuteNext(void)
        }
    }
    catch (std::exception & exceptionCaught) {
-       CMN_LOG_RUN_WARNING << "mtsMailbox \"" << GetName() << "\": ExecuteNext for command \"" << (*command)->GetName()
+       CMN_LOG_RUN_WARNING << "mtsMailbox \"" << GetName() << "\": ExecuteNext for command \"" << command->GetName()
                            << "\" caught exception \"" << exceptionCaught.what() << "\"" << std::endl;
-       this->TriggerPostQueuedCommandIfNeeded(isBlocking, isBlockingReturn);
-       CommandQueue.Get();  // Remove command from mailbox queue
+       this->TriggerPostQueuedCommandIfNeeded(command, isBlocking, isBlockingReturn);
+       this->RemoveCommand();  // Remove command from mailbox queue
        if (resultPointer || isBlocking)
-          TriggerFinishedEventIfNeeded((*command)->GetName(), finishedEvent, resultPointer, result);
+          TriggerFinishedEventIfNeeded(command->GetName(), finishedEvent, resultPointer, result);
        throw;
    }
    catch (...) {
-       CMN_LOG_RUN_WARNING << "mtsMailbox \"" << GetName() << "\": ExecuteNext for command \"" << (*command)->GetName()
+       CMN_LOG_RUN_WARNING << "mtsMailbox \"" << GetName() << "\": ExecuteNext for command \"" << command->GetName()
                            << "\" caught exception, blocking = " << isBlocking << std::endl;
-       this->TriggerPostQueuedCommandIfNeeded(isBlocking, isBlockingReturn);
-       CommandQueue.Get();  // Remove command from mailbox queue
+       this->TriggerPostQueuedCommandIfNeeded(command, isBlocking, isBlockingReturn);
+       this->RemoveCommand();  // Remove command from mailbox queue
        if (resultPointer || isBlocking)
-           TriggerFinishedEventIfNeeded((*command)->GetName(), finishedEvent, resultPointer, result);
+           TriggerFinishedEventIfNeeded(command->GetName(), finishedEvent, resultPointer, result);
        throw;
    }
-   this->TriggerPostQueuedCommandIfNeeded(isBlocking, isBlockingReturn);
+   if (startTime != 0.0) {
+       const double endTime = GetTime();
+       std::unordered_map<const mtsCommandBase *, size_t>::const_iterator index = StatisticsIndices.find(command);
+       if (index == StatisticsIndices.end()) {
+           index = StatisticsIndices.insert(std::make_pair(command, statistics->Index(command->GetName()))).first;
+       }
+       statistics->Add(index->second, startTime - queuedTime, endTime - startTime, queueDepth);
+   }
+   this->TriggerPostQueuedCommandIfNeeded(command, isBlocking, isBlockingReturn);
    if (!result.IsOK()) {
-       CMN_LOG_RUN_WARNING << "mtsMailbox \"" << GetName() << "\": ExecuteNext for command \"" << (*command)->GetName()
+       CMN_LOG_RUN_WARNING << "mtsMailbox \"" << GetName() << "\": ExecuteNext for command \"" << command->GetName()
                            << "\" failed, execution result is \"" << result << "\"" << std::endl;
    }
-   CommandQueue.Get();  // Remove command from mailbox queue
+   this->RemoveCommand();  // Remove command from mailbox queue
    if (resultPointer || isBlocking)
-       TriggerFinishedEventIfNeeded((*command)->GetName(), finishedEvent, resultPointer, result);
+       TriggerFinishedEventIfNeeded(command->GetName(), finishedEvent, resultPointer, result);
    return true;
 }
 
 
-void mtsMailBox::TriggerPostQueuedCommandIfNeeded(bool isBlocking, bool isBlockingReturn)
-{
 #if CISST_MTS_HAS_ICE
-   if (isBlocking && this->PostCommandDequeuedCommand) {
-       this->PostCommandDequeuedCommand->Execute(MTS_NOT_BLOCKING);
+void mtsMailBox::TriggerPostQueuedCommandIfNeeded(const mtsCommandBase * command,
+                                                  bool isBlocking, bool isBlockingReturn)
+{
+   if (!isBlocking && !isBlockingReturn) {
+       return;
+   }
+   mtsCommandVoid * postCommandDequeued = this->PostCommandDequeuedCommand;
+   mtsCommandVoid * postCommandReturnDequeued = this->PostCommandReturnDequeuedCommand;
+   // shared mailbox, find the events of the end-user interface owning the command
+   if (ProducerPolicy == MTS_MAILBOX_MULTIPLE_PRODUCERS) {
+       PostCommandDequeuedMutex.Lock();
+       const PostCommandDequeuedMapType::const_iterator found = PostCommandDequeuedMap.find(command);
+       if (found != PostCommandDequeuedMap.end()) {
+           postCommandDequeued = found->second.first;
+           postCommandReturnDequeued = found->second.second;
+       }
+       PostCommandDequeuedMutex.Unlock();
+   }
+   if (isBlocking && postCommandDequeued) {
+       postCommandDequeued->Execute(MTS_NOT_BLOCKING);
    } else {
-       if (isBlockingReturn && this->PostCommandReturnDequeuedCommand) {
-           this->PostCommandReturnDequeuedCommand->Execute(MTS_NOT_BLOCKING);
+       if (isBlockingReturn && postCommandReturnDequeued) {
+           postCommandReturnDequeued->Execute(MTS_NOT_BLOCKING);
        }
    }
-#endif
 }
+#else
+void mtsMailBox::TriggerPostQueuedCommandIfNeeded(const mtsCommandBase * CMN_UNUSED(command),
+                                                  bool CMN_UNUSED(isBlocking),
+                                                  bool CMN_UNUSED(isBlockingReturn))
+{
+}
+#endif
 
 
 void mtsMailBox::TriggerFinishedEventIfNeeded(const std::string &commandName, mtsCommandWriteBase *finishedEvent,
@@ -241,26 +311,53 @@ void mtsMailBox::TriggerFinishedEventIfNeeded(const std::string &commandName, mt
 
 void mtsMailBox::SetSize(size_t size)
 {
-    if (CommandQueue.GetSize() != size) {
-        CommandQueue.SetSize(size, 0); // array of null pointers
+    if (ProducerPolicy == MTS_MAILBOX_MULTIPLE_PRODUCERS) {
+        if (CommandQueueMultipleProducers.GetSize() != size) {
+            CommandQueueMultipleProducers.SetSize(size, QueueEntry()); // array of null pointers
+        }
+    } else {
+        if (CommandQueue.GetSize() != size) {
+            CommandQueue.SetSize(size, QueueEntry()); // array of null pointers
+            BatchIndex = 0;
+            BatchCount = 0;
+            BatchAvailable.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+
+size_t mtsMailBox::GetSize(void) const
+{
+    if (ProducerPolicy == MTS_MAILBOX_MULTIPLE_PRODUCERS) {
+        return CommandQueueMultipleProducers.GetSize();
     }
+    return CommandQueue.GetSize();
 }
 
 
 bool mtsMailBox::IsEmpty(void) const
 {
-    return CommandQueue.IsEmpty();
+    if (ProducerPolicy == MTS_MAILBOX_MULTIPLE_PRODUCERS) {
+        return CommandQueueMultipleProducers.IsEmpty();
+    }
+    return (CommandQueue.IsEmpty() && (BatchAvailable.load(std::memory_order_relaxed) == 0));
 }
 
 
 bool mtsMailBox::IsFull(void) const
 {
+    if (ProducerPolicy == MTS_MAILBOX_MULTIPLE_PRODUCERS) {
+        return CommandQueueMultipleProducers.IsFull();
+    }
     return CommandQueue.IsFull();
 }
 
 size_t mtsMailBox::GetAvailable(void) const
 {
-    return CommandQueue.GetAvailable();
+    if (ProducerPolicy == MTS_MAILBOX_MULTIPLE_PRODUCERS) {
+        return CommandQueueMultipleProducers.GetAvailable();
+    }
+    return CommandQueue.GetAvailable() + BatchAvailable.load(std::memory_order_relaxed);
 }
 
 void mtsMailBox::SetPostCommandDequeuedCommand(mtsCommandVoid * command)
@@ -282,3 +379,37 @@ mtsCommandVoid *mtsMailBox::GetPostCommandReturnDequeuedCommand(void) const
 {
     return this->PostCommandReturnDequeuedCommand;
 }
+
+void mtsMailBox::SetPostCommandDequeuedCommands(const mtsCommandBase * queuedCommand,
+                                                mtsCommandVoid * command,
+                                                mtsCommandVoid * commandReturn)
+{
+    PostCommandDequeuedMutex.Lock();
+    PostCommandDequeuedMap[queuedCommand] = PostCommandDequeuedPairType(command, commandReturn);
+    PostCommandDequeuedMutex.Unlock();
+}
+
+void mtsMailBox::RemovePostCommandDequeuedCommands(const mtsCommandBase * queuedCommand)
+{
+    PostCommandDequeuedMutex.Lock();
+    PostCommandDequeuedMap.erase(queuedCommand);
+    PostCommandDequeuedMutex.Unlock();
+    // statistics cache is indexed by address, which can be re-used
+    StatisticsIndices.erase(queuedCommand);
+}
+
+void mtsMailBox::SetStatistics(mtsCommandStatistics * statistics)
+{
+    this->StatisticsIndices.clear();
+    this->Statistics.store(statistics, std::memory_order_relaxed);
+}
+
+mtsCommandStatistics * mtsMailBox::GetStatistics(void) const
+{
+    return this->Statistics.load(std::memory_order_relaxed);
+}
+
+double mtsMailBox::GetTime(void)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
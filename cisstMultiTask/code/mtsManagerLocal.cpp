@@ -38,6 +38,14 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstMultiTask/mtsManagerComponentServer.h>
 #include <cisstMultiTask/mtsLODMultiplexerStreambuf.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+
 // Time server used by all tasks
 osaTimeServer TimeServer;
 bool TimeServerOriginSet = false;
@@ -66,6 +74,151 @@ LogQueueType   LogQueue;
 std::string    ThisProcessName;
 // }}
 
+namespace {
+    // Calls an action for a set of components using a pool of
+    // threads.  A component is processed once all the components it
+    // depends on have been processed, except for components in the
+    // same dependency cycle which don't wait for each other.
+    class mtsManagerLocalParallelRun
+    {
+    public:
+        typedef std::function<void (size_t, mtsComponent *)> ActionType;
+
+        mtsManagerLocalParallelRun(const std::vector<mtsComponent *> & components,
+                                   const std::vector<std::vector<size_t> > & dependencies,
+                                   const ActionType & action):
+            Components(components),
+            Action(action),
+            Remaining(components.size(), 0),
+            Dependents(components.size()),
+            Durations(components.size(), 0.0),
+            NumberProcessed(0)
+        {
+            const size_t size = Components.size();
+            // find cycles, Tarjan's strongly connected components
+            Dependencies = &dependencies;
+            Order.assign(size, 0);
+            LowLink.assign(size, 0);
+            OnStack.assign(size, false);
+            Cycle.assign(size, 0);
+            NextOrder = 1;
+            NumberOfCycles = 0;
+            for (size_t index = 0; index < size; ++index) {
+                if (Order[index] == 0) {
+                    FindCycles(index);
+                }
+            }
+            // dependencies across cycles
+            for (size_t index = 0; index < size; ++index) {
+                const std::vector<size_t> & servers = dependencies[index];
+                for (size_t server = 0; server < servers.size(); ++server) {
+                    if (Cycle[servers[server]] != Cycle[index]) {
+                        Remaining[index]++;
+                        Dependents[servers[server]].push_back(index);
+                    }
+                }
+                if (Remaining[index] == 0) {
+                    Ready.push_back(index);
+                }
+            }
+        }
+
+        // durations is filled with the time spent processing each
+        // component, in seconds
+        void Run(size_t numberOfThreads, std::vector<double> & durations)
+        {
+            if (numberOfThreads == 0) {
+                numberOfThreads = std::max(static_cast<size_t>(std::thread::hardware_concurrency()),
+                                           static_cast<size_t>(4));
+            }
+            numberOfThreads = std::min(numberOfThreads, Components.size());
+            std::vector<std::thread> threads;
+            for (size_t index = 0; index < numberOfThreads; ++index) {
+                threads.push_back(std::thread(&mtsManagerLocalParallelRun::Worker, this));
+            }
+            for (size_t index = 0; index < threads.size(); ++index) {
+                threads[index].join();
+            }
+            durations = Durations;
+        }
+
+    private:
+        void FindCycles(const size_t index)
+        {
+            Order[index] = NextOrder;
+            LowLink[index] = NextOrder;
+            NextOrder++;
+            Stack.push_back(index);
+            OnStack[index] = true;
+            const std::vector<size_t> & servers = (*Dependencies)[index];
+            for (size_t server = 0; server < servers.size(); ++server) {
+                const size_t other = servers[server];
+                if (Order[other] == 0) {
+                    FindCycles(other);
+                    LowLink[index] = std::min(LowLink[index], LowLink[other]);
+                } else if (OnStack[other]) {
+                    LowLink[index] = std::min(LowLink[index], Order[other]);
+                }
+            }
+            if (LowLink[index] == Order[index]) {
+                size_t other;
+                do {
+                    other = Stack.back();
+                    Stack.pop_back();
+                    OnStack[other] = false;
+                    Cycle[other] = NumberOfCycles;
+                } while (other != index);
+                NumberOfCycles++;
+            }
+        }
+
+        void Worker(void)
+        {
+            std::unique_lock<std::mutex> lock(Mutex);
+            while (true) {
+                Condition.wait(lock, [this] {
+                        return !Ready.empty() || (NumberProcessed == Components.size());
+                    });
+                if (Ready.empty()) {
+                    return;
+                }
+                const size_t index = Ready.front();
+                Ready.pop_front();
+                lock.unlock();
+                const double start = osaGetTime();
+                Action(index, Components[index]);
+                const double duration = osaGetTime() - start;
+                lock.lock();
+                Durations[index] = duration;
+                NumberProcessed++;
+                const std::vector<size_t> & dependents = Dependents[index];
+                for (size_t dependent = 0; dependent < dependents.size(); ++dependent) {
+                    if (--Remaining[dependents[dependent]] == 0) {
+                        Ready.push_back(dependents[dependent]);
+                    }
+                }
+                Condition.notify_all();
+            }
+        }
+
+        const std::vector<mtsComponent *> & Components;
+        ActionType Action;
+        std::vector<size_t> Remaining;
+        std::vector<std::vector<size_t> > Dependents;
+        std::vector<double> Durations;
+        std::deque<size_t> Ready;
+        size_t NumberProcessed;
+        std::mutex Mutex;
+        std::condition_variable Condition;
+
+        // used to find cycles
+        const std::vector<std::vector<size_t> > * Dependencies;
+        std::vector<size_t> Order, LowLink, Cycle, Stack;
+        std::vector<bool> OnStack;
+        size_t NextOrder, NumberOfCycles;
+    };
+}
+
 mtsManagerLocal::mtsManagerLocal(void) : ComponentMap("ComponentMap")
 {
     CMN_LOG_CLASS_INIT_VERBOSE << "Local component manager: STANDALONE mode" << std::endl;
@@ -124,6 +277,9 @@ void mtsManagerLocal::Initialize(void)
 
     CurrentMainTask = 0;
 
+    ParallelStartup = false;
+    ParallelStartupNumberOfThreads = 0;
+
     SetGCMConnected(false);
 
     TimeServer.SetTimeOrigin();
@@ -742,16 +898,67 @@ bool mtsManagerLocal::ConfigureJSON(const std::list<std::string> & filenames)
 bool mtsManagerLocal::ConfigureJSON(const Json::Value & configuration, const cmnPath & configPath)
 {
     const Json::Value components = configuration["components"];
-    for (unsigned int index = 0;
-         index < components.size();
-         ++index) {
-        if (!ConfigureComponentJSON(components[index], configPath)) {
-            CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: failed to configure component ["
-                                     << index << "]" << std::endl;
-            return false;
+    const Json::Value connections = configuration["connections"];
+    if (ParallelStartup) {
+        // create all, configure all, then add all (see
+        // SetParallelStartup).  Creation is sequential since loading
+        // libraries and registering classes is not thread safe and
+        // components are added in the file order once configured.
+        std::vector<mtsComponent *> created;
+        for (unsigned int index = 0;
+             index < components.size();
+             ++index) {
+            mtsComponent * component = CreateComponentJSON(components[index]);
+            if (!component) {
+                CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: failed to configure component ["
+                                         << index << "]" << std::endl;
+                return false;
+            }
+            created.push_back(component);
+        }
+        // dependencies based on connections not yet established
+        std::map<std::string, size_t> indices;
+        for (size_t index = 0; index < created.size(); ++index) {
+            indices[created[index]->GetName()] = index;
+        }
+        std::vector<std::vector<size_t> > dependencies(created.size());
+        for (unsigned int index = 0;
+             index < connections.size();
+             ++index) {
+            const std::map<std::string, size_t>::const_iterator client
+                = indices.find(connections[index]["required"]["component"].asString());
+            const std::map<std::string, size_t>::const_iterator server
+                = indices.find(connections[index]["provided"]["component"].asString());
+            if ((client != indices.end()) && (server != indices.end())
+                && (client->second != server->second)) {
+                dependencies[client->second].push_back(server->second);
+            }
+        }
+        std::vector<double> durations;
+        mtsManagerLocalParallelRun run(created, dependencies,
+                                       [&components, &configPath, this](size_t index, mtsComponent * component) {
+                                           this->ConfigureCreatedComponentJSON(component, components[static_cast<unsigned int>(index)], configPath);
+                                       });
+        run.Run(ParallelStartupNumberOfThreads, durations);
+        for (size_t index = 0; index < created.size(); ++index) {
+            StartupTimes[created[index]->GetName()].Configure = durations[index];
+            if (!AddCreatedComponentJSON(created[index])) {
+                CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: failed to configure component ["
+                                         << index << "]" << std::endl;
+                return false;
+            }
+        }
+    } else {
+        for (unsigned int index = 0;
+             index < components.size();
+             ++index) {
+            if (!ConfigureComponentJSON(components[index], configPath)) {
+                CMN_LOG_CLASS_INIT_ERROR << "ConfigureJSON: failed to configure component ["
+                                         << index << "]" << std::endl;
+                return false;
+            }
         }
     }
-    const Json::Value connections = configuration["connections"];
     for (unsigned int index = 0;
          index < connections.size();
          ++index) {
@@ -765,6 +972,17 @@ bool mtsManagerLocal::ConfigureJSON(const Json::Value & configuration, const cmn
 }
 
 bool mtsManagerLocal::ConfigureComponentJSON(const Json::Value & componentConfiguration, const cmnPath & configPath)
+{
+    mtsComponent * component = this->CreateComponentJSON(componentConfiguration);
+    if (!component) {
+        return false;
+    }
+    this->ConfigureCreatedComponentJSON(component, componentConfiguration, configPath);
+    return this->AddCreatedComponentJSON(component);
+}
+
+
+mtsComponent * mtsManagerLocal::CreateComponentJSON(const Json::Value & componentConfiguration)
 {
     std::string sharedLibrary, className, constructorArgJSON;
     Json::Value jsonValue;
@@ -782,7 +1000,7 @@ bool mtsManagerLocal::ConfigureComponentJSON(const Json::Value & componentConfig
         className = jsonValue.asString();
     } else {
         CMN_LOG_CLASS_INIT_ERROR << "ConfigureComponentJSON: can't find \"class-name\"" << std::endl;
-        return false;
+        return 0;
     }
     // constructor argument is required
     jsonValue = componentConfiguration["constructor-arg"];
@@ -791,7 +1009,7 @@ bool mtsManagerLocal::ConfigureComponentJSON(const Json::Value & componentConfig
         constructorArgJSON = fastWriter.write(jsonValue);
     } else {
         CMN_LOG_CLASS_INIT_ERROR << "ConfigureComponentJSON: can't find \"constructor-arg\"" << std::endl;
-        return false;
+        return 0;
     }
     // create (the method CreateComponentDynamicallyJSON should handle case w/o shared library
     mtsComponent * component
@@ -801,8 +1019,16 @@ bool mtsManagerLocal::ConfigureComponentJSON(const Json::Value & componentConfig
     if (!component) {
         CMN_LOG_CLASS_INIT_ERROR << "ConfigureComponentJSON: failed to dynamically create component of type \""
                                  << className << "\"" << std::endl;
-        return false;
+        return 0;
     }
+    return component;
+}
+
+
+void mtsManagerLocal::ConfigureCreatedComponentJSON(mtsComponent * component,
+                                                    const Json::Value & componentConfiguration,
+                                                    const cmnPath & configPath)
+{
     // configure as needed
     Json::Value configureParameter = componentConfiguration["configure-parameter"];
     if (configureParameter.empty()) {
@@ -818,6 +1044,11 @@ bool mtsManagerLocal::ConfigureComponentJSON(const Json::Value & componentConfig
             component->Configure(configFile);
         }
     }
+}
+
+
+bool mtsManagerLocal::AddCreatedComponentJSON(mtsComponent * component)
+{
     // add if need, it is possible ctor or Configure already added the component itself to manager
     mtsComponent * existing = this->GetComponent(component->GetName());
     if (existing == component) {
@@ -1791,6 +2022,11 @@ bool mtsManagerLocal::WaitForStateAll(mtsComponentState desiredState, double tim
 
 void mtsManagerLocal::CreateAll(void)
 {
+    if (ParallelStartup) {
+        CreateAllParallel(3.0 * cmn_minute);
+        return;
+    }
+
     ComponentMapChange.Lock();
 
     ComponentMapType::const_iterator iterator = ComponentMap.begin();
@@ -1805,6 +2041,9 @@ void mtsManagerLocal::CreateAll(void)
 
 bool mtsManagerLocal::CreateAllAndWait(double timeoutInSeconds)
 {
+    if (ParallelStartup) {
+        return CreateAllParallel(timeoutInSeconds);
+    }
     this->CreateAll();
     return this->WaitForStateAll(mtsComponentState::READY, timeoutInSeconds);
 }
@@ -1819,6 +2058,11 @@ void mtsManagerLocal::StartAll(void)
         CMN_LOG_CLASS_RUN_WARNING << "StartAll: current thread is not main thread." << std::endl;
     }
 
+    if (ParallelStartup) {
+        StartAllParallel(3.0 * cmn_minute);
+        return;
+    }
+
     mtsTask * componentTask;
 
     ComponentMapChange.Lock();
@@ -1878,11 +2122,210 @@ void mtsManagerLocal::StartAll(void)
 
 bool mtsManagerLocal::StartAllAndWait(double timeoutInSeconds)
 {
+    if (ParallelStartup) {
+        return StartAllParallel(timeoutInSeconds);
+    }
     this->StartAll();
     return this->WaitForStateAll(mtsComponentState::ACTIVE, timeoutInSeconds);
 }
 
 
+void mtsManagerLocal::SetParallelStartup(const bool parallel, const size_t numberOfThreads)
+{
+    ParallelStartup = parallel;
+    ParallelStartupNumberOfThreads = numberOfThreads;
+}
+
+
+bool mtsManagerLocal::GetParallelStartup(void) const
+{
+    return ParallelStartup;
+}
+
+
+void mtsManagerLocal::GetStartupDependencies(const std::vector<mtsComponent *> & components,
+                                             std::vector<std::vector<size_t> > & dependencies) const
+{
+    std::map<const mtsComponent *, size_t> indices;
+    for (size_t index = 0; index < components.size(); ++index) {
+        indices[components[index]] = index;
+    }
+    dependencies.assign(components.size(), std::vector<size_t>());
+    for (size_t index = 0; index < components.size(); ++index) {
+        const std::vector<std::string> names = components[index]->GetNamesOfInterfacesRequired();
+        for (size_t name = 0; name < names.size(); ++name) {
+            const mtsInterfaceRequired * interfaceRequired = components[index]->GetInterfaceRequired(names[name]);
+            if (!interfaceRequired || !interfaceRequired->GetConnectedInterface()) {
+                continue;
+            }
+            // components not in the list, i.e. manager components, are ignored
+            const std::map<const mtsComponent *, size_t>::const_iterator server
+                = indices.find(interfaceRequired->GetConnectedInterface()->GetComponent());
+            if ((server != indices.end()) && (server->second != index)) {
+                dependencies[index].push_back(server->second);
+            }
+        }
+    }
+}
+
+
+bool mtsManagerLocal::CreateAllParallel(double timeoutInSeconds)
+{
+    // manager components and tasks using the current thread are
+    // created from the current thread first
+    std::vector<mtsComponent *> components, sequential;
+    ComponentMapChange.Lock();
+    ComponentMapType::const_iterator iterator = ComponentMap.begin();
+    const ComponentMapType::const_iterator end = ComponentMap.end();
+    for (; iterator != end; ++iterator) {
+        mtsTaskContinuous * taskContinuous = dynamic_cast<mtsTaskContinuous *>(iterator->second);
+        if (dynamic_cast<mtsManagerComponentBase *>(iterator->second)
+            || dynamic_cast<mtsTaskFromCallback *>(iterator->second)
+            || (taskContinuous && !taskContinuous->NewThread)) {
+            sequential.push_back(iterator->second);
+        } else {
+            components.push_back(iterator->second);
+        }
+    }
+    ComponentMapChange.Unlock();
+
+    for (size_t index = 0; index < sequential.size(); ++index) {
+        const double start = osaGetTime();
+        sequential[index]->Create();
+        StartupTimes[sequential[index]->GetName()].Create = osaGetTime() - start;
+    }
+
+    std::vector<std::vector<size_t> > dependencies;
+    GetStartupDependencies(components, dependencies);
+    const double timeEnd = osaGetTime() + timeoutInSeconds;
+    mtsManagerLocalParallelRun run(components, dependencies,
+                                   [timeEnd, this](size_t CMN_UNUSED(index), mtsComponent * component) {
+                                       component->Create();
+                                       // tasks with ExecIn are initialized by their parent's thread
+                                       mtsTask * task = dynamic_cast<mtsTask *>(component);
+                                       if (task && task->ExecIn && task->ExecIn->GetConnectedInterface()) {
+                                           return;
+                                       }
+                                       if (!component->WaitForState(mtsComponentState::READY,
+                                                                    std::max(timeEnd - osaGetTime(), 0.0))) {
+                                           CMN_LOG_CLASS_INIT_ERROR << "CreateAll: component \"" << component->GetName()
+                                                                    << "\" failed to reach state READY" << std::endl;
+                                       }
+                                   });
+    std::vector<double> durations;
+    run.Run(ParallelStartupNumberOfThreads, durations);
+    for (size_t index = 0; index < components.size(); ++index) {
+        StartupTimes[components[index]->GetName()].Create = durations[index];
+    }
+    return WaitForStateAll(mtsComponentState::READY, std::max(timeEnd - osaGetTime(), 0.0));
+}
+
+
+bool mtsManagerLocal::StartAllParallel(double timeoutInSeconds)
+{
+    const osaThreadId threadId = osaGetCurrentThreadId();
+    const double timeStartedAll = osaGetTime();
+    // tasks using the current thread are started from the current
+    // thread, the first one which is not a callback task last
+    std::vector<mtsComponent *> components, sequential;
+    mtsComponent * lastTask = 0;
+    ComponentMapChange.Lock();
+    ComponentMapType::const_iterator iterator = ComponentMap.begin();
+    const ComponentMapType::const_iterator end = ComponentMap.end();
+    for (; iterator != end; ++iterator) {
+        mtsTask * componentTask = dynamic_cast<mtsTask *>(iterator->second);
+        if (componentTask && (componentTask->Thread.GetId() == threadId)) {
+            if (dynamic_cast<mtsTaskFromCallback *>(iterator->second)) {
+                sequential.push_back(iterator->second);
+            } else if (lastTask) {
+                CMN_LOG_CLASS_INIT_ERROR << "StartAll: found another task using current thread (\""
+                                         << iterator->first << "\"), only first will be started (\""
+                                         << lastTask->GetName() << "\")." << std::endl;
+                sequential.push_back(iterator->second);
+            } else {
+                CMN_LOG_CLASS_INIT_WARNING << "StartAll: component \"" << iterator->first
+                                           << "\" uses current thread, will be started last." << std::endl;
+                lastTask = iterator->second;
+            }
+        } else if (dynamic_cast<mtsManagerComponentBase *>(iterator->second)) {
+            sequential.push_back(iterator->second);
+        } else {
+            components.push_back(iterator->second);
+        }
+    }
+    ComponentMapChange.Unlock();
+
+    for (size_t index = 0; index < sequential.size(); ++index) {
+        const double start = osaGetTime();
+        sequential[index]->Start();
+        StartupTimes[sequential[index]->GetName()].Start = osaGetTime() - start;
+    }
+
+    std::vector<std::vector<size_t> > dependencies;
+    GetStartupDependencies(components, dependencies);
+    const double timeEnd = timeStartedAll + timeoutInSeconds;
+    mtsManagerLocalParallelRun run(components, dependencies,
+                                   [timeEnd, this](size_t CMN_UNUSED(index), mtsComponent * component) {
+                                       component->Start();
+                                       mtsTask * task = dynamic_cast<mtsTask *>(component);
+                                       if (task && task->ExecIn && task->ExecIn->GetConnectedInterface()) {
+                                           return;
+                                       }
+                                       if (!component->WaitForState(mtsComponentState::ACTIVE,
+                                                                    std::max(timeEnd - osaGetTime(), 0.0))) {
+                                           CMN_LOG_CLASS_INIT_ERROR << "StartAll: component \"" << component->GetName()
+                                                                    << "\" failed to reach state ACTIVE" << std::endl;
+                                       }
+                                   });
+    std::vector<double> durations;
+    run.Run(ParallelStartupNumberOfThreads, durations);
+    for (size_t index = 0; index < components.size(); ++index) {
+        StartupTimes[components[index]->GetName()].Start = durations[index];
+    }
+
+    std::stringstream times;
+    StartupTimesToStream(times);
+    CMN_LOG_CLASS_INIT_VERBOSE << "StartAll: all components started in "
+                               << (osaGetTime() - timeStartedAll) << " seconds" << std::endl
+                               << times.str();
+
+    // the last task might use the current thread until it stops
+    if (lastTask) {
+        lastTask->Start();
+    }
+    return WaitForStateAll(mtsComponentState::ACTIVE, std::max(timeEnd - osaGetTime(), 0.0));
+}
+
+
+void mtsManagerLocal::StartupTimesToStream(std::ostream & outputStream) const
+{
+    typedef std::pair<double, std::string> EntryType;
+    std::vector<EntryType> entries;
+    StartupTimesMapType::const_iterator iterator = StartupTimes.begin();
+    const StartupTimesMapType::const_iterator end = StartupTimes.end();
+    size_t nameWidth = 9;
+    for (; iterator != end; ++iterator) {
+        const double total = iterator->second.Configure + iterator->second.Create + iterator->second.Start;
+        entries.push_back(EntryType(total, iterator->first));
+        nameWidth = std::max(nameWidth, iterator->first.size());
+    }
+    std::sort(entries.begin(), entries.end(), std::greater<EntryType>());
+    const std::ios_base::fmtflags flags = outputStream.flags();
+    outputStream << std::left << std::setw(nameWidth) << "component" << std::right
+                 << "  configure     create      start      total (ms)" << std::endl
+                 << std::fixed << std::setprecision(3);
+    for (size_t index = 0; index < entries.size(); ++index) {
+        const StartupTimesType & times = StartupTimes.find(entries[index].second)->second;
+        outputStream << std::left << std::setw(nameWidth) << entries[index].second << std::right
+                     << std::setw(11) << times.Configure * 1000.0
+                     << std::setw(11) << times.Create * 1000.0
+                     << std::setw(11) << times.Start * 1000.0
+                     << std::setw(11) << entries[index].first * 1000.0 << std::endl;
+    }
+    outputStream.flags(flags);
+}
+
+
 void mtsManagerLocal::KillAll(void)
 {
     mtsManagerComponentBase * isManager;
@@ -19,6 +19,7 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <algorithm>
 #include <cisstMultiTask/mtsMulticastCommandVoid.h>
+#include <cisstOSAbstraction/osaTrace.h>
 
 
 mtsMulticastCommandVoid::mtsMulticastCommandVoid(const std::string & name):
@@ -57,6 +58,7 @@ bool mtsMulticastCommandVoid::RemoveCommand(BaseType * command) {
 
 mtsExecutionResult mtsMulticastCommandVoid::Execute(mtsBlockingType CMN_UNUSED(blocking))
 {
+    osaTraceScope trace("event", this->Name);
     size_t index;
     const size_t commandsSize = Commands.size();
     for (index = 0; index < commandsSize; index++) {
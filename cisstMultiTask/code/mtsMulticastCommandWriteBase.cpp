@@ -21,6 +21,8 @@ http://www.cisst.org/cisst/license.txt.
 #include <algorithm>
 #include <cisstMultiTask/mtsMulticastCommandWriteBase.h>
 #include <cisstMultiTask/mtsCommandWrite.h>
+#include <cisstMultiTask/mtsCommandQueuedWriteBase.h>
+#include <cisstOSAbstraction/osaTrace.h>
 
 bool mtsMulticastCommandWriteBase::AddCommand(BaseType * command) {
     if (command) {
@@ -45,6 +47,7 @@ bool mtsMulticastCommandWriteBase::AddCommand(BaseType * command) {
                 this->GetArgumentPrototype()->Services()->Create(const_cast<mtsGenericObject *>(command->GetArgumentPrototype()), *(this->GetArgumentPrototype()));
                 // Add the command to the list
                 this->Commands.push_back(command);
+                this->AddQueuedCommand(command);
                 return true;
             }
         } else {
@@ -52,6 +55,7 @@ bool mtsMulticastCommandWriteBase::AddCommand(BaseType * command) {
             command->SetArgumentPrototype(reinterpret_cast<const mtsGenericObject *>(this->GetArgumentPrototype()->Services()->Create(*(this->GetArgumentPrototype()))));
             // Add the command to the list
             this->Commands.push_back(command);
+            this->AddQueuedCommand(command);
             return true;
         }
     }
@@ -63,6 +67,11 @@ bool mtsMulticastCommandWriteBase::RemoveCommand(BaseType * command) {
     if (command) {
         VectorType::iterator it = std::find(Commands.begin(), Commands.end(), command);
         if (it != Commands.end()) {
+            const size_t index = it - Commands.begin();
+            if (QueuedCommands[index]) {
+                NumberOfQueuedCommands--;
+            }
+            QueuedCommands.erase(QueuedCommands.begin() + index);
             Commands.erase(it);
             return true;
         }
@@ -76,6 +85,38 @@ bool mtsMulticastCommandWriteBase::RemoveCommand(BaseType * command) {
     return false;
 }
 
+void mtsMulticastCommandWriteBase::AddQueuedCommand(BaseType * command) {
+    mtsCommandQueuedWriteBase * queued = dynamic_cast<mtsCommandQueuedWriteBase *>(command);
+    this->QueuedCommands.push_back(queued);
+    if (queued) {
+        NumberOfQueuedCommands++;
+    }
+}
+
+
+void mtsMulticastCommandWriteBase::ExecuteAll(const mtsGenericObject & argument) {
+    osaTraceScope trace("event", this->Name);
+    // copy the argument only once if at least two commands would copy it
+    mtsSharedArgument * shared = 0;
+    if (UseSharedArguments && (NumberOfQueuedCommands > 1)) {
+        shared = SharedArguments.Acquire(argument);
+    }
+    size_t index;
+    const size_t commandsSize = Commands.size();
+    for (index = 0; index < commandsSize; index++) {
+        if (shared && QueuedCommands[index]) {
+            QueuedCommands[index]->ExecuteShared(shared, MTS_NOT_BLOCKING, 0);
+        } else {
+            Commands[index]->Execute(argument, MTS_NOT_BLOCKING);
+        }
+    }
+    // release the reference held while queueing
+    if (shared) {
+        shared->Release();
+    }
+}
+
+
 void mtsMulticastCommandWriteBase::ToStream(std::ostream & outputStream) const {
     outputStream << "mtsMulticastCommandWrite: \"" << this->Name << "\"";
     if (Commands.size() != 0) {
@@ -28,6 +28,7 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <cisstCommon/cmnSerializer.h>
 #include <cisstCommon/cmnDeSerializer.h>
+#include <cisstCommon/cmnDataFunctionsString.h>
 #include <cisstMultiTask/mtsGenericObject.h>
 
 /*!
@@ -35,9 +36,28 @@ http://www.cisst.org/cisst/license.txt.
 
   This class provides the feature of serialization and deserialization for
   command proxy and function proxy classes.
+
+  Objects that support serialization in a user provided buffer (see
+  cmnGenericObject::SerializeBinaryBuffer and the cisstDataGenerator
+  option "binary-buffer") are serialized directly in the caller's
+  buffer, without going through a string stream nor the class
+  services dictionary.  The buffer starts with BINARY_BUFFER_MARKER
+  (instead of the class services pointer used by cmnSerializer),
+  followed by the class name and the object itself.  Both ends are
+  assumed to share the same data format, as for the raw serialization
+  used by cmnSerializer.  Other objects fall back to cmnSerializer.
 */
 class mtsProxySerializer {
+public:
+    /*! Value used in place of the cmnSerializer::TypeId at the
+      beginning of objects serialized in a binary buffer.  cmnSerializer
+      uses either 0 (class services) or a pointer. */
+    enum {BINARY_BUFFER_MARKER = 1};
+
 private:
+    /*! Data format used for binary buffers, same for both ends */
+    cmnDataFormat DataFormat;
+
     /*! Internal buffer for serialization and deserialization. */
     std::stringstream SerializationBuffer;
     std::stringstream DeSerializationBuffer;
@@ -66,7 +86,104 @@ public:
         DeSerializer->Reset();
     }
 
+    /*! Number of bytes needed to serialize the object in a binary
+      buffer, 0 if the object doesn't support binary buffers. */
+    size_t SerializeBufferByteSize(const mtsGenericObject & originalObject) const {
+        const size_t objectSize = originalObject.SerializeBinaryByteSize();
+        if (objectSize == 0) {
+            return 0;
+        }
+        return sizeof(cmnSerializer::TypeId)
+            + cmnData<std::string>::SerializeBinaryByteSize(originalObject.Services()->GetName())
+            + objectSize;
+    }
+
+    /*! Serialize the object in a user provided buffer.  Returns the
+      number of bytes used, 0 if the object doesn't support binary
+      buffers or the buffer is too small. */
+    size_t SerializeBuffer(const mtsGenericObject & originalObject, char * buffer, size_t bufferSize) const {
+        const cmnSerializer::TypeId marker = BINARY_BUFFER_MARKER;
+        if (bufferSize < sizeof(marker)) {
+            return 0;
+        }
+        memcpy(buffer, &marker, sizeof(marker));
+        size_t total = sizeof(marker);
+        size_t bytes = cmnData<std::string>::SerializeBinary(originalObject.Services()->GetName(),
+                                                             buffer + total, bufferSize - total);
+        if (bytes == 0) {
+            return 0;
+        }
+        total += bytes;
+        bytes = originalObject.SerializeBinaryBuffer(buffer + total, bufferSize - total);
+        if (bytes == 0) {
+            return 0;
+        }
+        return total + bytes;
+    }
+
+    /*! \return true if the serialized object starts with
+      BINARY_BUFFER_MARKER, i.e. was created by SerializeBuffer */
+    static bool IsBinaryBuffer(const char * buffer, size_t bufferSize) {
+        cmnSerializer::TypeId marker;
+        if (bufferSize < sizeof(marker)) {
+            return false;
+        }
+        memcpy(&marker, buffer, sizeof(marker));
+        return (marker == BINARY_BUFFER_MARKER);
+    }
+
+    /*! De-serialize an object created by SerializeBuffer.  The class
+      name in the buffer must match the class of the object. */
+    bool DeSerializeBuffer(const char * buffer, size_t bufferSize, mtsGenericObject & originalObject) {
+        if (!IsBinaryBuffer(buffer, bufferSize)) {
+            CMN_LOG_RUN_ERROR << "DeSerialization failed: not a binary buffer" << std::endl;
+            originalObject.SetValid(false);
+            return false;
+        }
+        size_t total = sizeof(cmnSerializer::TypeId);
+        // compare the class name in place
+        const std::string & className = originalObject.Services()->GetName();
+        size_t nameSize;
+        size_t bytes = cmnData<size_t>::DeSerializeBinary(nameSize, buffer + total, bufferSize - total,
+                                                         DataFormat, DataFormat);
+        if ((bytes == 0) || (nameSize > (bufferSize - total - bytes))) {
+            CMN_LOG_RUN_ERROR << "DeSerialization failed: binary buffer too short" << std::endl;
+            originalObject.SetValid(false);
+            return false;
+        }
+        total += bytes;
+        if ((nameSize != className.size())
+            || (memcmp(buffer + total, className.data(), nameSize) != 0)) {
+            CMN_LOG_RUN_ERROR << "DeSerialization failed: expected class " << className
+                              << ", received " << std::string(buffer + total, nameSize) << std::endl;
+            originalObject.SetValid(false);
+            return false;
+        }
+        total += nameSize;
+        bytes = originalObject.DeSerializeBinaryBuffer(buffer + total, bufferSize - total,
+                                                       DataFormat, DataFormat);
+        if (bytes == 0) {
+            CMN_LOG_RUN_ERROR << "DeSerialization failed: binary buffer too short for " << className << std::endl;
+            originalObject.SetValid(false);
+            return false;
+        }
+        return true;
+    }
+
+    /*! Serialize the object in a string.  Objects supporting binary
+      buffers are serialized using SerializeBuffer; the string is
+      resized in place so no memory is allocated once the string
+      capacity is large enough. */
     bool Serialize(const mtsGenericObject & originalObject, std::string & serializedObject) {
+        const size_t bufferSize = SerializeBufferByteSize(originalObject);
+        if (bufferSize != 0) {
+            serializedObject.resize(bufferSize);
+            if (SerializeBuffer(originalObject, &(serializedObject[0]), bufferSize) == bufferSize) {
+                return true;
+            }
+            CMN_LOG_RUN_WARNING << "Serialization in binary buffer failed, using serializer for: "
+                                << originalObject.Services()->GetName() << std::endl;
+        }
         try {
             SerializationBuffer.str("");
             Serializer->Serialize(originalObject);
@@ -117,6 +234,9 @@ public:
     }
 
     bool DeSerialize(const std::string & serializedObject, mtsGenericObject & originalObject) {
+        if (IsBinaryBuffer(serializedObject.data(), serializedObject.size())) {
+            return DeSerializeBuffer(serializedObject.data(), serializedObject.size(), originalObject);
+        }
         try {
             DeSerializationBuffer.str("");
             DeSerializationBuffer << serializedObject;
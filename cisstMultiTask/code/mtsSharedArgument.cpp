@@ -0,0 +1,81 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstMultiTask/mtsSharedArgument.h>
+
+
+mtsSharedArgumentPool::mtsSharedArgumentPool(void):
+    Next(0),
+    NumberOfCopies(0)
+{
+}
+
+
+mtsSharedArgumentPool::~mtsSharedArgumentPool()
+{
+    size_t inUse = 0;
+    for (size_t index = 0; index < Arguments.size(); ++index) {
+        if (Arguments[index]->GetReferenceCount() == 0) {
+            delete Arguments[index];
+        } else {
+            inUse++;
+        }
+    }
+    if (inUse != 0) {
+        CMN_LOG_INIT_WARNING << "mtsSharedArgumentPool: destructor called while "
+                             << inUse << " argument(s) are still queued" << std::endl;
+    }
+}
+
+
+mtsSharedArgument * mtsSharedArgumentPool::Acquire(const mtsGenericObject & argument)
+{
+    mtsSharedArgument * result = 0;
+    // look for an unused argument, starting after the last one used
+    const size_t size = Arguments.size();
+    for (size_t count = 0; count < size; ++count) {
+        mtsSharedArgument * candidate = Arguments[Next];
+        Next = (Next + 1) % size;
+        if (candidate->GetReferenceCount() == 0) {
+            if (!argument.Services()->Create(candidate->Argument, argument)) {
+                CMN_LOG_RUN_ERROR << "mtsSharedArgumentPool::Acquire: failed to copy argument of type "
+                                  << argument.Services()->GetName() << std::endl;
+                return 0;
+            }
+            result = candidate;
+            break;
+        }
+    }
+    // all arguments in use, allocate a new one
+    if (!result) {
+        mtsGenericObject * copy = dynamic_cast<mtsGenericObject *>(argument.Services()->Create(argument));
+        if (!copy) {
+            CMN_LOG_RUN_ERROR << "mtsSharedArgumentPool::Acquire: failed to create argument of type "
+                              << argument.Services()->GetName() << std::endl;
+            return 0;
+        }
+        result = new mtsSharedArgument(copy);
+        Arguments.push_back(result);
+        Next = 0;
+    }
+    result->AddReference();
+    NumberOfCopies++;
+    return result;
+}
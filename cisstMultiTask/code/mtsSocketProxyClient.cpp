@@ -53,6 +53,7 @@ void mtsSocketProxyClientConstructorArg::SerializeRaw(std::ostream & outputStrea
     cmnSerializeRaw(outputStream, Name);
     cmnSerializeRaw(outputStream, IP);
     cmnSerializeRaw(outputStream, Port);
+    cmnSerializeRaw(outputStream, SharedMemory);
 }
 
 void mtsSocketProxyClientConstructorArg::DeSerializeRaw(std::istream & inputStream)
@@ -61,13 +62,15 @@ void mtsSocketProxyClientConstructorArg::DeSerializeRaw(std::istream & inputStre
     cmnDeSerializeRaw(inputStream, Name);
     cmnDeSerializeRaw(inputStream, IP);
     cmnDeSerializeRaw(inputStream, Port);
+    cmnDeSerializeRaw(inputStream, SharedMemory);
 }
 
 void mtsSocketProxyClientConstructorArg::ToStream(std::ostream & outputStream) const
 {
     outputStream << "Name: " << Name
                  << ", IP: " << IP
-                 << ", Port: " << Port << std::endl;
+                 << ", Port: " << Port
+                 << ", SharedMemory: " << SharedMemory << std::endl;
 }
 
 void mtsSocketProxyClientConstructorArg::ToStreamRaw(std::ostream & outputStream, const char delimiter,
@@ -77,11 +80,13 @@ void mtsSocketProxyClientConstructorArg::ToStreamRaw(std::ostream & outputStream
     if (headerOnly) {
         outputStream << headerPrefix << "-name" << delimiter
                      << headerPrefix << "-ip" << delimiter
-                     << headerPrefix << "-port";
+                     << headerPrefix << "-port" << delimiter
+                     << headerPrefix << "-sharedMemory";
     } else {
         outputStream << this->Name << delimiter
                      << this->IP << delimiter
-                     << this->Port;
+                     << this->Port << delimiter
+                     << this->SharedMemory;
     }
 }
 
@@ -90,7 +95,7 @@ bool mtsSocketProxyClientConstructorArg::FromStreamRaw(std::istream & inputStrea
     mtsGenericObject::FromStreamRaw(inputStream, delimiter);
     if (inputStream.fail())
         return false;
-    inputStream >> Name >> IP >> Port;
+    inputStream >> Name >> IP >> Port >> SharedMemory;
     // PK TEMP: cmnData<std::string>::SerializeText adds an escape character ('\') before each space.
     // Same problem exists in other constructor arg FromStreamRaw methods.
     size_t len = Name.length();
@@ -189,7 +194,7 @@ public:
 // The implementation uses classes because there is data that needs to be associated with each class instance.
 // The CommandWrapperBase class contains the data that is needed by all derived classes:
 //    Name:           name of command
-//    Socket:         reference to mtsSocketProxyClient::Socket (single socket shared by all)
+//    Transport:      reference to mtsSocketProxyClient::Transport (single socket shared by all)
 //    Handle:         "handle" for this command (see mtsSocketProxyCommon); basically, this is the address of
 //                    the command object, preceeded by some identifying data (space, command type)
 //    Receiver:       An instance of the EventReceiverWriteProxy, which is used to receive return events from the Server
@@ -204,14 +209,14 @@ public:
 class CommandWrapperBase {
 protected:
     std::string Name;
-    osaSocket   &Socket;
+    mtsSocketProxyTransport &Transport;
     char        Handle[CommandHandle::COMMAND_HANDLE_STRING_SIZE];
     EventReceiverWriteProxy *Receiver;
     mtsCommandWriteBase     *receiveHandler;
     mtsSocketProxyClient    *Proxy;
 public:
-    CommandWrapperBase(const std::string &name, osaSocket &socket, mtsSocketProxyClient *proxy)
-        : Name(name), Socket(socket), Proxy(proxy)
+    CommandWrapperBase(const std::string &name, mtsSocketProxyTransport &transport, mtsSocketProxyClient *proxy)
+        : Name(name), Transport(transport), Proxy(proxy)
     {
         Handle[0] = 0;
         Receiver = new EventReceiverWriteProxy(Proxy->Serializer);
@@ -219,8 +224,8 @@ public:
                                                                                    Receiver, name+"Receiver", std::string());
     }
 
-    CommandWrapperBase(const std::string &name, osaSocket &socket, mtsSocketProxyClient *proxy, const char *handle)
-        : Name(name), Socket(socket), Proxy(proxy)
+    CommandWrapperBase(const std::string &name, mtsSocketProxyTransport &transport, mtsSocketProxyClient *proxy, const char *handle)
+        : Name(name), Transport(transport), Proxy(proxy)
     {
         SetHandle(handle);
         Receiver = new EventReceiverWriteProxy(Proxy->Serializer);
@@ -254,15 +259,15 @@ public:
 
 class CommandWrapperVoid : public CommandWrapperBase {
 public:
-    CommandWrapperVoid(const std::string &name, osaSocket &socket, mtsSocketProxyClient *proxy)
-        : CommandWrapperBase(name, socket, proxy) {}
-    CommandWrapperVoid(const std::string &name, osaSocket &socket, mtsSocketProxyClient *proxy, const char *handle)
-        : CommandWrapperBase(name, socket, proxy, handle) {}
+    CommandWrapperVoid(const std::string &name, mtsSocketProxyTransport &transport, mtsSocketProxyClient *proxy)
+        : CommandWrapperBase(name, transport, proxy) {}
+    CommandWrapperVoid(const std::string &name, mtsSocketProxyTransport &transport, mtsSocketProxyClient *proxy, const char *handle)
+        : CommandWrapperBase(name, transport, proxy, handle) {}
     ~CommandWrapperVoid() {}
 
     CommandWrapperVoid *Clone(void) const
     {
-        return new CommandWrapperVoid(Name, Socket, Proxy, Handle);
+        return new CommandWrapperVoid(Name, Transport, Proxy, Handle);
     }
 
     // This is called just before the Method is called via the command object
@@ -281,7 +286,7 @@ public:
             sendBuffer[1] = 'v';
         CommandHandle recv_handle('W', receiveHandler);
         recv_handle.ToString(sendBuffer+CommandHandle::COMMAND_HANDLE_STRING_SIZE);
-        Socket.Send(sendBuffer, sizeof(sendBuffer));
+        Transport.Send(sendBuffer, sizeof(sendBuffer));
         // Now return to the caller. If this is a blocking command, the caller will
         // wait on a thread signal, which will be raised in the Receiver object.
     }
@@ -289,15 +294,15 @@ public:
 
 class CommandWrapperWrite : public CommandWrapperBase {
 public:
-    CommandWrapperWrite(const std::string &name, osaSocket &socket, mtsSocketProxyClient *proxy)
-        : CommandWrapperBase(name, socket, proxy) {}
-    CommandWrapperWrite(const std::string &name, osaSocket &socket, mtsSocketProxyClient *proxy, const char *handle)
-        : CommandWrapperBase(name, socket, proxy, handle) {}
+    CommandWrapperWrite(const std::string &name, mtsSocketProxyTransport &transport, mtsSocketProxyClient *proxy)
+        : CommandWrapperBase(name, transport, proxy) {}
+    CommandWrapperWrite(const std::string &name, mtsSocketProxyTransport &transport, mtsSocketProxyClient *proxy, const char *handle)
+        : CommandWrapperBase(name, transport, proxy, handle) {}
     ~CommandWrapperWrite() {}
 
     CommandWrapperWrite *Clone(void) const
     {
-        return new CommandWrapperWrite(Name, Socket, Proxy, Handle);
+        return new CommandWrapperWrite(Name, Transport, Proxy, Handle);
     }
 
     // This is called just before the Method is called via the command object
@@ -319,7 +324,7 @@ public:
             CommandHandle recv_handle('W', receiveHandler);
             recv_handle.ToString(cmdBuffer+CommandHandle::COMMAND_HANDLE_STRING_SIZE);
             sendBuffer.insert(0, cmdBuffer, sizeof(cmdBuffer));
-            Socket.SendAsPackets(sendBuffer, mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE, 0.05);
+            Transport.Send(sendBuffer);
             // Now return to the caller. If this is a blocking command, the caller will
             // wait on a thread signal, which will be raised in the Receiver object.
         }
@@ -330,16 +335,16 @@ class CommandWrapperRead : public CommandWrapperBase {
 public:
     typedef mtsCallableReadMethodGeneric<CommandWrapperRead> CallableType;
 
-    CommandWrapperRead(const std::string &name, osaSocket &socket, mtsSocketProxyClient *proxy)
-        : CommandWrapperBase(name, socket, proxy) { }
-    CommandWrapperRead(const std::string &name, osaSocket &socket, mtsSocketProxyClient *proxy, const char *handle)
-        : CommandWrapperBase(name, socket, proxy, handle) { }
+    CommandWrapperRead(const std::string &name, mtsSocketProxyTransport &transport, mtsSocketProxyClient *proxy)
+        : CommandWrapperBase(name, transport, proxy) { }
+    CommandWrapperRead(const std::string &name, mtsSocketProxyTransport &transport, mtsSocketProxyClient *proxy, const char *handle)
+        : CommandWrapperBase(name, transport, proxy, handle) { }
 
     ~CommandWrapperRead() { }
 
     CommandWrapperRead *Clone(void) const
     {
-        return new CommandWrapperRead(Name, Socket, Proxy, Handle);
+        return new CommandWrapperRead(Name, Transport, Proxy, Handle);
     }
 
     bool Method(mtsGenericObject &arg) const
@@ -353,7 +358,7 @@ public:
         memcpy(sendBuffer, Handle, sizeof(Handle));
         CommandHandle recv_handle('W', receiveHandler);
         recv_handle.ToString(sendBuffer+CommandHandle::COMMAND_HANDLE_STRING_SIZE);
-        return (Socket.Send(sendBuffer, sizeof(sendBuffer)) > 0);
+        return Transport.Send(sendBuffer, sizeof(sendBuffer));
     }
 };
 
@@ -361,15 +366,15 @@ class CommandWrapperQualifiedRead : public CommandWrapperBase {
 public:
     typedef mtsCallableQualifiedReadMethodGeneric<CommandWrapperQualifiedRead> CallableType;
 
-    CommandWrapperQualifiedRead(const std::string &name, osaSocket &socket, mtsSocketProxyClient *proxy)
-        : CommandWrapperBase(name, socket, proxy) {}
-    CommandWrapperQualifiedRead(const std::string &name, osaSocket &socket, mtsSocketProxyClient *proxy, const char *handle)
-        : CommandWrapperBase(name, socket, proxy, handle) {}
+    CommandWrapperQualifiedRead(const std::string &name, mtsSocketProxyTransport &transport, mtsSocketProxyClient *proxy)
+        : CommandWrapperBase(name, transport, proxy) {}
+    CommandWrapperQualifiedRead(const std::string &name, mtsSocketProxyTransport &transport, mtsSocketProxyClient *proxy, const char *handle)
+        : CommandWrapperBase(name, transport, proxy, handle) {}
     ~CommandWrapperQualifiedRead() {}
 
     CommandWrapperQualifiedRead *Clone(void) const
     {
-        return new CommandWrapperQualifiedRead(Name, Socket, Proxy, Handle);
+        return new CommandWrapperQualifiedRead(Name, Transport, Proxy, Handle);
     }
 
     bool Method(const mtsGenericObject &arg1, mtsGenericObject &arg2) const
@@ -386,7 +391,7 @@ public:
             CommandHandle recv_handle('W', receiveHandler);
             recv_handle.ToString(cmdBuffer+CommandHandle::COMMAND_HANDLE_STRING_SIZE);
             sendBuffer.insert(0, cmdBuffer, sizeof(cmdBuffer));
-            return (Socket.SendAsPackets(sendBuffer, mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE, 0.05) > 0);
+            return Transport.Send(sendBuffer);
         }
         return false;
     }
@@ -396,16 +401,16 @@ class CommandWrapperVoidReturn : public CommandWrapperBase {
 public:
     typedef mtsCallableVoidReturnMethodGeneric<CommandWrapperVoidReturn> CallableType;
 
-    CommandWrapperVoidReturn(const std::string &name, osaSocket &socket, mtsSocketProxyClient *proxy)
-        : CommandWrapperBase(name, socket, proxy) { }
-    CommandWrapperVoidReturn(const std::string &name, osaSocket &socket, mtsSocketProxyClient *proxy, const char *handle)
-        : CommandWrapperBase(name, socket, proxy, handle) { }
+    CommandWrapperVoidReturn(const std::string &name, mtsSocketProxyTransport &transport, mtsSocketProxyClient *proxy)
+        : CommandWrapperBase(name, transport, proxy) { }
+    CommandWrapperVoidReturn(const std::string &name, mtsSocketProxyTransport &transport, mtsSocketProxyClient *proxy, const char *handle)
+        : CommandWrapperBase(name, transport, proxy, handle) { }
 
     ~CommandWrapperVoidReturn() { }
 
     CommandWrapperVoidReturn *Clone(void) const
     {
-        return new CommandWrapperVoidReturn(Name, Socket, Proxy, Handle);
+        return new CommandWrapperVoidReturn(Name, Transport, Proxy, Handle);
     }
 
     void Method(mtsGenericObject &arg)
@@ -419,7 +424,7 @@ public:
         memcpy(sendBuffer, Handle, sizeof(Handle));
         CommandHandle recv_handle('W', receiveHandler);
         recv_handle.ToString(sendBuffer+CommandHandle::COMMAND_HANDLE_STRING_SIZE);
-        Socket.Send(sendBuffer, sizeof(sendBuffer));
+        Transport.Send(sendBuffer, sizeof(sendBuffer));
         // Now return to the caller. The caller will wait on a thread signal, which
         // will be raised in the Receiver object.
     }
@@ -429,16 +434,16 @@ class CommandWrapperWriteReturn : public CommandWrapperBase {
 public:
     typedef mtsCallableWriteReturnMethodGeneric<CommandWrapperWriteReturn> CallableType;
 
-    CommandWrapperWriteReturn(const std::string &name, osaSocket &socket, mtsSocketProxyClient *proxy)
-        : CommandWrapperBase(name, socket, proxy) { }
-    CommandWrapperWriteReturn(const std::string &name, osaSocket &socket, mtsSocketProxyClient *proxy, const char *handle)
-        : CommandWrapperBase(name, socket, proxy, handle) { }
+    CommandWrapperWriteReturn(const std::string &name, mtsSocketProxyTransport &transport, mtsSocketProxyClient *proxy)
+        : CommandWrapperBase(name, transport, proxy) { }
+    CommandWrapperWriteReturn(const std::string &name, mtsSocketProxyTransport &transport, mtsSocketProxyClient *proxy, const char *handle)
+        : CommandWrapperBase(name, transport, proxy, handle) { }
 
     ~CommandWrapperWriteReturn() { }
 
     CommandWrapperWriteReturn *Clone(void) const
     {
-        return new CommandWrapperWriteReturn(Name, Socket, Proxy, Handle);
+        return new CommandWrapperWriteReturn(Name, Transport, Proxy, Handle);
     }
 
     void Method(const mtsGenericObject &arg1, mtsGenericObject &arg2)
@@ -455,7 +460,7 @@ public:
             CommandHandle recv_handle('W', receiveHandler);
             recv_handle.ToString(cmdBuffer+CommandHandle::COMMAND_HANDLE_STRING_SIZE);
             sendBuffer.insert(0, cmdBuffer, sizeof(cmdBuffer));
-            Socket.SendAsPackets(sendBuffer, mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE, 0.05);
+            Transport.Send(sendBuffer);
             // Now return to the caller. The caller will wait on a thread signal, which
             // will be raised in the Receiver object.
         }
@@ -800,9 +805,11 @@ mtsExecutionResult MulticastCommandWriteProxy::ExecuteSerialized(const std::stri
 // It creates a socket connection to the mtsSocketProxyServer object (server proxy)
 // at the specified IP and port
 
-mtsSocketProxyClient::mtsSocketProxyClient(const std::string & proxyName, const std::string & ip, short port) :
+mtsSocketProxyClient::mtsSocketProxyClient(const std::string & proxyName, const std::string & ip, short port,
+                                           bool sharedMemory) :
     mtsTaskContinuous(proxyName),
-    Socket(osaSocket::UDP),
+    Socket(sharedMemory ? osaSocket::SHARED_MEMORY : osaSocket::UDP),
+    Transport(Socket),
     Serializer(0),
     localUnblockingCommand(0),
     EventEnableCommand(0),
@@ -810,11 +817,13 @@ mtsSocketProxyClient::mtsSocketProxyClient(const std::string & proxyName, const
 {
     Socket.SetDestination(ip, port);
     CreateClientProxy("Provided");
+    CreateStatisticsInterface();
 }
 
 mtsSocketProxyClient::mtsSocketProxyClient(const mtsSocketProxyClientConstructorArg &arg) :
     mtsTaskContinuous(arg.Name),
-    Socket(osaSocket::UDP),
+    Socket(arg.SharedMemory ? osaSocket::SHARED_MEMORY : osaSocket::UDP),
+    Transport(Socket),
     Serializer(0),
     localUnblockingCommand(0),
     EventEnableCommand(0),
@@ -822,6 +831,7 @@ mtsSocketProxyClient::mtsSocketProxyClient(const mtsSocketProxyClientConstructor
 {
     Socket.SetDestination(arg.IP, arg.Port);
     CreateClientProxy("Provided");
+    CreateStatisticsInterface();
 }
 
 mtsSocketProxyClient::~mtsSocketProxyClient()
@@ -849,60 +859,86 @@ void mtsSocketProxyClient::Run(void)
     CheckForEvents(0.001);
 }
 
-// Check for events
+// Check for events, after sending the commands queued since the last call.
+// All the messages coalesced in the datagram received are processed.
 void mtsSocketProxyClient::CheckForEvents(double timeoutInSec)
 {
-    std::string inputArgString;
-    char packetBuffer[mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE];
-    int bytesRead = Socket.ReceiveAsPackets(inputArgString, packetBuffer, sizeof(packetBuffer), timeoutInSec, 0.5);
-    if (bytesRead > 0) {
-        size_t pos = inputArgString.find(' ');
-        if ((pos == 0) && (inputArgString.size() >= CommandHandle::COMMAND_HANDLE_STRING_SIZE)) {
-            CommandHandle handle(inputArgString);
-            inputArgString.erase(0, CommandHandle::COMMAND_HANDLE_STRING_SIZE);
-            // Since we know the command type (handle.cmdType) we could reinterpret_cast directly to
-            // the correct mtsCommandXXXX type, but to be safe we first reinterpret_cast to the base
-            // type, mtsCommandBase, and then do a dynamic_cast to the expected type. If the address
-            // (handle.addr) is corrupted, this would lead to either a dynamic_cast failure (i.e.,
-            // a null pointer) or possibly a runtime exception.
-            mtsCommandBase *commandBase = reinterpret_cast<mtsCommandBase *>(handle.addr);
-            try {
-                MulticastCommandVoidProxy *commandVoid;
-                MulticastCommandWriteProxy *commandWrite;
-                mtsCommandWriteBase *commandWriteInternal;
-                switch (handle.cmdType) {
-                  case 'V':
-                      commandVoid = dynamic_cast<MulticastCommandVoidProxy *>(commandBase);
-                      if (commandVoid)
-                          commandVoid->Execute(MTS_NOT_BLOCKING);
+    Transport.Flush();
+    std::string & inputArgString = InputArgString;
+    osaIPandPort sender;
+    int bytesRead = Transport.Receive(inputArgString, sender, timeoutInSec, 0.5);
+    while (bytesRead > 0) {
+        ProcessMessage(inputArgString);
+        bytesRead = Transport.HasPendingMessage() ? Transport.Receive(inputArgString, sender, 0.0, 0.5) : 0;
+    }
+}
+
+// Process an event or the reply to a command
+void mtsSocketProxyClient::ProcessMessage(std::string & inputArgString)
+{
+    size_t pos = inputArgString.find(' ');
+    if ((pos == 0) && (inputArgString.size() >= CommandHandle::COMMAND_HANDLE_STRING_SIZE)) {
+        CommandHandle handle(inputArgString);
+        inputArgString.erase(0, CommandHandle::COMMAND_HANDLE_STRING_SIZE);
+        // Since we know the command type (handle.cmdType) we could reinterpret_cast directly to
+        // the correct mtsCommandXXXX type, but to be safe we first reinterpret_cast to the base
+        // type, mtsCommandBase, and then do a dynamic_cast to the expected type. If the address
+        // (handle.addr) is corrupted, this would lead to either a dynamic_cast failure (i.e.,
+        // a null pointer) or possibly a runtime exception.
+        mtsCommandBase *commandBase = reinterpret_cast<mtsCommandBase *>(handle.addr);
+        try {
+            MulticastCommandVoidProxy *commandVoid;
+            MulticastCommandWriteProxy *commandWrite;
+            mtsCommandWriteBase *commandWriteInternal;
+            switch (handle.cmdType) {
+              case 'V':
+                  commandVoid = dynamic_cast<MulticastCommandVoidProxy *>(commandBase);
+                  if (commandVoid)
+                      commandVoid->Execute(MTS_NOT_BLOCKING);
+                  else
+                      CMN_LOG_CLASS_RUN_ERROR << "MulticastCommandVoidProxy dynamic cast failed" << std::endl;
+                  break;
+              case 'W':
+                  commandWrite = dynamic_cast<MulticastCommandWriteProxy *>(commandBase);
+                  if (commandWrite)
+                      commandWrite->ExecuteSerialized(inputArgString, MTS_NOT_BLOCKING);
+                  else {
+                      // Check if this command is the event with the return value
+                      commandWriteInternal = dynamic_cast<mtsCommandWrite<EventReceiverWriteProxy, std::string> *>(commandBase);
+                      if (commandWriteInternal)
+                          commandWriteInternal->Execute(mtsStdString(inputArgString), MTS_NOT_BLOCKING);
                       else
-                          CMN_LOG_CLASS_RUN_ERROR << "MulticastCommandVoidProxy dynamic cast failed" << std::endl;
-                      break;
-                  case 'W':
-                      commandWrite = dynamic_cast<MulticastCommandWriteProxy *>(commandBase);
-                      if (commandWrite)
-                          commandWrite->ExecuteSerialized(inputArgString, MTS_NOT_BLOCKING);
-                      else {
-                          // Check if this command is the event with the return value
-                          commandWriteInternal = dynamic_cast<mtsCommandWrite<EventReceiverWriteProxy, std::string> *>(commandBase);
-                          if (commandWriteInternal)
-                              commandWriteInternal->Execute(mtsStdString(inputArgString), MTS_NOT_BLOCKING);
-                          else
-                              CMN_LOG_CLASS_RUN_ERROR << "MulticastCommandWriteProxy dynamic cast failed" << std::endl;
-                      }
-                      break;
-                  default:
-                      CMN_LOG_CLASS_RUN_ERROR << "Received invalid event handle, type = " << handle.cmdType << std::endl;
-                }
-            }
-            catch (const std::runtime_error &e) {
-                CMN_LOG_CLASS_RUN_ERROR << "Exception while using command handle for type " << handle.cmdType
-                                        << ", addr = " << std::hex << handle.addr << ": " << e.what() << std::endl;
+                          CMN_LOG_CLASS_RUN_ERROR << "MulticastCommandWriteProxy dynamic cast failed" << std::endl;
+                  }
+                  break;
+              default:
+                  CMN_LOG_CLASS_RUN_ERROR << "Received invalid event handle, type = " << handle.cmdType << std::endl;
             }
         }
-        else
-            CMN_LOG_CLASS_RUN_ERROR << "Received invalid data: " << inputArgString << std::endl;
+        catch (const std::runtime_error &e) {
+            CMN_LOG_CLASS_RUN_ERROR << "Exception while using command handle for type " << handle.cmdType
+                                    << ", addr = " << std::hex << handle.addr << ": " << e.what() << std::endl;
+        }
+    }
+    else
+        CMN_LOG_CLASS_RUN_ERROR << "Received invalid data: " << inputArgString << std::endl;
+}
+
+void mtsSocketProxyClient::GetStatistics(mtsSocketProxyStatistics & statistics) const
+{
+    Transport.GetStatistics(statistics);
+}
+
+void mtsSocketProxyClient::CreateStatisticsInterface(void)
+{
+    // not queued, the transport protects its counters
+    mtsInterfaceProvided * interfaceProvided = AddInterfaceProvided("Statistics", MTS_COMMANDS_SHOULD_NOT_BE_QUEUED);
+    if (!interfaceProvided) {
+        CMN_LOG_CLASS_INIT_ERROR << "CreateStatisticsInterface: failed to add \"Statistics\" interface to "
+                                 << GetName() << std::endl;
+        return;
     }
+    interfaceProvided->AddCommandRead(&mtsSocketProxyClient::GetStatistics, this, "GetStatistics");
 }
 
 bool mtsSocketProxyClient::Serialize(const mtsGenericObject & originalObject, std::string & serializedObject)
@@ -963,7 +999,7 @@ bool mtsSocketProxyClient::CreateClientProxy(const std::string & providedInterfa
     localUnblockingCommand = new mtsCommandWriteGeneric<mtsSocketProxyClient>(&mtsSocketProxyClient::LocalUnblockingHandler, this,
                                                                               "UnblockingCommand", 0);
 
-    CommandWrapperRead GetInitData("GetInitData", Socket, this);
+    CommandWrapperRead GetInitData("GetInitData", Transport, this);
     GetInitData.SetHandle(" I        ");
     GetInitData.SetCallerEvent(localUnblockingCommand);
     LocalWaiting = true;
@@ -988,17 +1024,17 @@ bool mtsSocketProxyClient::CreateClientProxy(const std::string & providedInterfa
     // to enable or disable sending of events on the server. If thread safety is required, it would be better to
     // make AddObserver and RemoveObserver available as queued commands.
     mtsStdString arg;
-    CommandWrapperWrite *eventEnableWrapper = new CommandWrapperWrite("EventEnable", Socket, this, ServerData.EventEnable());
+    CommandWrapperWrite *eventEnableWrapper = new CommandWrapperWrite("EventEnable", Transport, this, ServerData.EventEnable());
     EventEnableCommand = new mtsCommandWriteGeneric<CommandWrapperWrite>(&CommandWrapperWrite::Method, eventEnableWrapper,
                                                                          "EventEnable", &arg);
-    CommandWrapperWrite *eventDisableWrapper = new CommandWrapperWrite("EventDisable", Socket, this, ServerData.EventDisable());
+    CommandWrapperWrite *eventDisableWrapper = new CommandWrapperWrite("EventDisable", Transport, this, ServerData.EventDisable());
     EventDisableCommand = new mtsCommandWriteGeneric<CommandWrapperWrite>(&CommandWrapperWrite::Method, eventDisableWrapper,
                                                                           "EventDisable", &arg);
 
 
     // Create the client proxy based on the provided interface description obtained from the server proxy.
     mtsGenericObjectProxy<mtsInterfaceProvidedDescription> descProxy;
-    CommandWrapperRead GetInterfaceDescription("GetInterfaceDescription", Socket, this, ServerData.GetInterfaceDescription());
+    CommandWrapperRead GetInterfaceDescription("GetInterfaceDescription", Transport, this, ServerData.GetInterfaceDescription());
     GetInterfaceDescription.SetCallerEvent(localUnblockingCommand);
     LocalWaiting = true;
     if (!GetInterfaceDescription.Method(descProxy) || !WaitForResponse(3.0)) {
@@ -1019,11 +1055,11 @@ bool mtsSocketProxyClient::CreateClientProxy(const std::string & providedInterfa
     mtsStdString handleSerialized;
 
     // Create Void command proxies
-    CommandWrapperQualifiedRead GetHandleVoid("GetHandleVoid", Socket, this, ServerData.GetHandleVoid());
+    CommandWrapperQualifiedRead GetHandleVoid("GetHandleVoid", Transport, this, ServerData.GetHandleVoid());
     GetHandleVoid.SetCallerEvent(localUnblockingCommand);
     for (i = 0; i < providedInterfaceDescription.CommandsVoid.size(); ++i) {
         std::string commandName = providedInterfaceDescription.CommandsVoid[i].Name;
-        CommandWrapperVoid *wrapper = new CommandWrapperVoid(commandName, Socket, this);
+        CommandWrapperVoid *wrapper = new CommandWrapperVoid(commandName, Transport, this);
         LocalWaiting = true;
         if (GetHandleVoid.Method(mtsStdString(commandName), handleSerialized) && WaitForResponse(2.0))
             wrapper->SetHandle(handleSerialized);
@@ -1035,11 +1071,11 @@ bool mtsSocketProxyClient::CreateClientProxy(const std::string & providedInterfa
     }
 
     // Create Write command proxies
-    CommandWrapperQualifiedRead GetHandleWrite("GetHandleWrite", Socket, this, ServerData.GetHandleWrite());
+    CommandWrapperQualifiedRead GetHandleWrite("GetHandleWrite", Transport, this, ServerData.GetHandleWrite());
     GetHandleWrite.SetCallerEvent(localUnblockingCommand);
     for (i = 0; i < providedInterfaceDescription.CommandsWrite.size(); ++i) {
         const mtsCommandWriteDescription &cmd = providedInterfaceDescription.CommandsWrite[i];
-        CommandWrapperWrite *wrapper = new CommandWrapperWrite(cmd.Name, Socket, this);
+        CommandWrapperWrite *wrapper = new CommandWrapperWrite(cmd.Name, Transport, this);
         LocalWaiting = true;
         if (GetHandleWrite.Method(mtsStdString(cmd.Name), handleSerialized) && WaitForResponse(2.0))
             wrapper->SetHandle(handleSerialized);
@@ -1061,11 +1097,11 @@ bool mtsSocketProxyClient::CreateClientProxy(const std::string & providedInterfa
     }
 
     // Create Read command proxies
-    CommandWrapperQualifiedRead GetHandleRead("GetHandleRead", Socket, this, ServerData.GetHandleRead());
+    CommandWrapperQualifiedRead GetHandleRead("GetHandleRead", Transport, this, ServerData.GetHandleRead());
     GetHandleRead.SetCallerEvent(localUnblockingCommand);
     for (i = 0; i < providedInterfaceDescription.CommandsRead.size(); ++i) {
         const mtsCommandReadDescription &cmd = providedInterfaceDescription.CommandsRead[i];
-        CommandWrapperRead *wrapper = new CommandWrapperRead(cmd.Name, Socket, this);
+        CommandWrapperRead *wrapper = new CommandWrapperRead(cmd.Name, Transport, this);
         LocalWaiting = true;
         if (GetHandleRead.Method(mtsStdString(cmd.Name), handleSerialized) && WaitForResponse(2.0))
             wrapper->SetHandle(handleSerialized);
@@ -1087,11 +1123,11 @@ bool mtsSocketProxyClient::CreateClientProxy(const std::string & providedInterfa
     }
 
     // Create QualifiedRead command proxies
-    CommandWrapperQualifiedRead GetHandleQualifiedRead("GetHandleQualifiedRead", Socket, this, ServerData.GetHandleQualifiedRead());
+    CommandWrapperQualifiedRead GetHandleQualifiedRead("GetHandleQualifiedRead", Transport, this, ServerData.GetHandleQualifiedRead());
     GetHandleQualifiedRead.SetCallerEvent(localUnblockingCommand);
     for (i = 0; i < providedInterfaceDescription.CommandsQualifiedRead.size(); ++i) {
         const mtsCommandQualifiedReadDescription &cmd = providedInterfaceDescription.CommandsQualifiedRead[i];
-        CommandWrapperQualifiedRead *wrapper = new CommandWrapperQualifiedRead(cmd.Name, Socket, this);
+        CommandWrapperQualifiedRead *wrapper = new CommandWrapperQualifiedRead(cmd.Name, Transport, this);
         LocalWaiting = true;
         if (GetHandleQualifiedRead.Method(mtsStdString(cmd.Name), handleSerialized) && WaitForResponse(2.0))
             wrapper->SetHandle(handleSerialized);
@@ -1116,11 +1152,11 @@ bool mtsSocketProxyClient::CreateClientProxy(const std::string & providedInterfa
     }
 
     // Create VoidReturn command proxies
-    CommandWrapperQualifiedRead GetHandleVoidReturn("GetHandleVoidReturn", Socket, this, ServerData.GetHandleVoidReturn());
+    CommandWrapperQualifiedRead GetHandleVoidReturn("GetHandleVoidReturn", Transport, this, ServerData.GetHandleVoidReturn());
     GetHandleVoidReturn.SetCallerEvent(localUnblockingCommand);
     for (i = 0; i < providedInterfaceDescription.CommandsVoidReturn.size(); ++i) {
         const mtsCommandVoidReturnDescription &cmd = providedInterfaceDescription.CommandsVoidReturn[i];
-        CommandWrapperVoidReturn *wrapper = new CommandWrapperVoidReturn(cmd.Name, Socket, this);
+        CommandWrapperVoidReturn *wrapper = new CommandWrapperVoidReturn(cmd.Name, Transport, this);
         LocalWaiting = true;
         if (GetHandleVoidReturn.Method(mtsStdString(cmd.Name), handleSerialized) && WaitForResponse(2.0))
             wrapper->SetHandle(handleSerialized);
@@ -1142,11 +1178,11 @@ bool mtsSocketProxyClient::CreateClientProxy(const std::string & providedInterfa
     }
 
     // Create WriteReturn command proxies
-    CommandWrapperQualifiedRead GetHandleWriteReturn("GetHandleWriteReturn", Socket, this, ServerData.GetHandleWriteReturn());
+    CommandWrapperQualifiedRead GetHandleWriteReturn("GetHandleWriteReturn", Transport, this, ServerData.GetHandleWriteReturn());
     GetHandleWriteReturn.SetCallerEvent(localUnblockingCommand);
     for (i = 0; i < providedInterfaceDescription.CommandsWriteReturn.size(); ++i) {
         const mtsCommandWriteReturnDescription &cmd = providedInterfaceDescription.CommandsWriteReturn[i];
-        CommandWrapperWriteReturn *wrapper = new CommandWrapperWriteReturn(cmd.Name, Socket, this);
+        CommandWrapperWriteReturn *wrapper = new CommandWrapperWriteReturn(cmd.Name, Transport, this);
         LocalWaiting = true;
         if (GetHandleWriteReturn.Method(mtsStdString(cmd.Name), handleSerialized) && WaitForResponse(2.0))
             wrapper->SetHandle(handleSerialized);
@@ -1,197 +1,696 @@
-/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
-/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
-
-/*
-
-  Author(s):  Peter Kazanzides
-  Created on: 2013-09-08
-
-  (C) Copyright 2013-2014 Johns Hopkins University (JHU), All Rights Reserved.
-
---- begin cisst license - do not edit ---
-
-This software is provided "as is" under an open source license, with
-no warranty.  The complete license can be found in license.txt and
-http://www.cisst.org/cisst/license.txt.
-
---- end cisst license ---
-*/
-
-#include <cisstMultiTask/mtsSocketProxyCommon.h>
-
-CommandHandle::CommandHandle(char cmd, void *ptr) : cmdType(cmd)
-{
-    addr = (long long int)ptr;
-}
-
-CommandHandle::CommandHandle(const char *str)
-{
-    FromString(str);
-}
-
-CommandHandle::CommandHandle(const std::string &str)
-{
-    FromString(str);
-}
-
-bool CommandHandle::IsValidType(char cmd_type)
-{
-    return ((cmd_type == 'V') || (cmd_type == 'R') || (cmd_type == 'W') || (cmd_type == 'Q') ||
-            (cmd_type == 'v') || (cmd_type == 'r') || (cmd_type == 'w') || (cmd_type == 'q') ||
-            (cmd_type == 'I'));
-}
-
-bool CommandHandle::IsValid(void) const
-{
-    return IsValidType(cmdType);
-}
-
-int CommandHandle::ToString(char *str) const
-{
-    str[0] = ' ';  // leading space
-    str[1] = cmdType;
-    *reinterpret_cast<long long int *>(str+2) = addr;
-    return COMMAND_HANDLE_STRING_SIZE;
-}
-
-int CommandHandle::ToString(std::string &str) const
-{
-    str.clear();
-    str.reserve(COMMAND_HANDLE_STRING_SIZE);
-    str.push_back(' ');
-    str.push_back(cmdType);
-    str.append(reinterpret_cast<const char *>(&addr), sizeof(long long int));
-    return COMMAND_HANDLE_STRING_SIZE;
-}
-
-int CommandHandle::FromString(const char *str)
-{
-    if (str[0] != ' ')
-        return 0;
-    if (!IsValidType(str[1]))
-        return 0;
-    cmdType = str[1];
-    addr = *reinterpret_cast<const long long int *>(str+2);    
-    return COMMAND_HANDLE_STRING_SIZE;
-}
-
-int CommandHandle::FromString(const std::string &str)
-{
-    if (str.size() < sizeof(long long int)+2)
-        return 0;
-    return FromString(str.data());
-}
-
-bool CommandHandle::operator == (const CommandHandle &other) const
-{
-    return (cmdType == other.cmdType) && (addr == other.addr);
-}
-
-bool CommandHandle::operator != (const CommandHandle &other) const
-{
-    return !(*this == other);
-}
-
-CMN_IMPLEMENT_SERVICES(mtsSocketProxyInitData)
-
-mtsSocketProxyInitData::mtsSocketProxyInitData() : mtsGenericObject(), 
-    version(mtsSocketProxy::SOCKET_PROXY_VERSION), packetSize(mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE)
-{
-    getInterfaceDescription[0] = 0;
-    getHandleVoid[0] = 0;
-    getHandleRead[0] = 0;
-    getHandleWrite[0] = 0;
-    getHandleQualifiedRead[0] = 0;
-    getHandleVoidReturn[0] = 0;
-    getHandleWriteReturn[0] = 0;
-    eventEnable[0] = 0;
-    eventDisable[0] = 0;
-}
-
-mtsSocketProxyInitData::mtsSocketProxyInitData(unsigned int psize, mtsFunctionRead *gid, mtsFunctionQualifiedRead *ghv,
-                        mtsFunctionQualifiedRead *ghr, mtsFunctionQualifiedRead *ghw, mtsFunctionQualifiedRead *ghqr,
-                        mtsFunctionQualifiedRead *ghvr, mtsFunctionQualifiedRead *ghwr,
-                        mtsFunctionWrite *ee, mtsFunctionWrite *ed)
-                        : mtsGenericObject(), version(mtsSocketProxy::SOCKET_PROXY_VERSION), packetSize(psize)
-{
-    CommandHandle handle('R', gid);
-    handle.ToString(getInterfaceDescription);
-    handle = CommandHandle('Q', ghv);
-    handle.ToString(getHandleVoid);
-    handle = CommandHandle('Q', ghr);
-    handle.ToString(getHandleRead);
-    handle = CommandHandle('Q', ghw);
-    handle.ToString(getHandleWrite);
-    handle = CommandHandle('Q', ghqr);
-    handle.ToString(getHandleQualifiedRead);
-    handle = CommandHandle('Q', ghvr);
-    handle.ToString(getHandleVoidReturn);
-    handle = CommandHandle('Q', ghwr);
-    handle.ToString(getHandleWriteReturn);
-    handle = CommandHandle('W', ee);
-    handle.ToString(eventEnable);
-    handle = CommandHandle('W', ed);
-    handle.ToString(eventDisable);
-}
-
-void mtsSocketProxyInitData::SerializeRaw(std::ostream & outputStream) const
-{
-    mtsGenericObject::SerializeRaw(outputStream);
-    cmnSerializeRaw(outputStream, version);
-    cmnSerializeRaw(outputStream, packetSize);
-    outputStream.write(getInterfaceDescription, sizeof(getInterfaceDescription));
-    outputStream.write(getHandleVoid, sizeof(getHandleVoid));
-    outputStream.write(getHandleRead, sizeof(getHandleRead));
-    outputStream.write(getHandleWrite, sizeof(getHandleWrite));
-    outputStream.write(getHandleQualifiedRead, sizeof(getHandleQualifiedRead));
-    outputStream.write(getHandleVoidReturn, sizeof(getHandleVoidReturn));
-    outputStream.write(getHandleWriteReturn, sizeof(getHandleWriteReturn));
-    outputStream.write(eventEnable, sizeof(eventEnable));
-    outputStream.write(eventDisable, sizeof(eventDisable));
-}
-
-void mtsSocketProxyInitData::DeSerializeRaw(std::istream & inputStream)
-{
-    mtsGenericObject::DeSerializeRaw(inputStream);
-    cmnDeSerializeRaw(inputStream, version);
-    cmnDeSerializeRaw(inputStream, packetSize);
-    inputStream.read(getInterfaceDescription, sizeof(getInterfaceDescription));
-    inputStream.read(getHandleVoid, sizeof(getHandleVoid));
-    inputStream.read(getHandleRead, sizeof(getHandleRead));
-    inputStream.read(getHandleWrite, sizeof(getHandleWrite));
-    inputStream.read(getHandleQualifiedRead, sizeof(getHandleQualifiedRead));
-    inputStream.read(getHandleVoidReturn, sizeof(getHandleVoidReturn));
-    inputStream.read(getHandleWriteReturn, sizeof(getHandleWriteReturn));
-    inputStream.read(eventEnable, sizeof(eventEnable));
-    inputStream.read(eventDisable, sizeof(eventDisable));
-}
-
-void mtsSocketProxyInitData::ToStream(std::ostream & outputStream) const
-{
-    outputStream << "Version: " << version << ", PacketSize: " << packetSize << std::endl;
-}
-
-// Following implementation is incomplete (only handles Version and PacketSize)
-void mtsSocketProxyInitData::ToStreamRaw(std::ostream & outputStream, const char delimiter,
-                                         bool headerOnly, const std::string & headerPrefix) const
-{
-    mtsGenericObject::ToStreamRaw(outputStream, delimiter, headerOnly, headerPrefix);
-    if (headerOnly)
-        outputStream << headerPrefix << "-Version" << delimiter
-                     << headerPrefix << "-PacketSize";
-    else
-        outputStream << this->version << delimiter
-                     << this->packetSize;
-}
-
-// Following implementation is incomplete (only handles Version and PacketSize)
-bool mtsSocketProxyInitData::FromStreamRaw(std::istream & inputStream, const char delimiter)
-{
-    mtsGenericObject::FromStreamRaw(inputStream, delimiter);
-    if (inputStream.fail())
-        return false;
-    inputStream >> version >> packetSize;
-    if (inputStream.fail())
-        return false;
-    return (typeid(*this) == typeid(mtsSocketProxyInitData));
-}
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  Peter Kazanzides
+  Created on: 2013-09-08
+
+  (C) Copyright 2013-2014 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstMultiTask/mtsSocketProxyCommon.h>
+
+#include <cisstCommon/cmnUnits.h>
+#include <cisstOSAbstraction/osaGetTime.h>
+#include <cisstOSAbstraction/osaSleep.h>
+
+#include <algorithm>
+#include <cstring>
+
+CommandHandle::CommandHandle(char cmd, void *ptr) : cmdType(cmd)
+{
+    addr = (long long int)ptr;
+}
+
+CommandHandle::CommandHandle(const char *str)
+{
+    FromString(str);
+}
+
+CommandHandle::CommandHandle(const std::string &str)
+{
+    FromString(str);
+}
+
+bool CommandHandle::IsValidType(char cmd_type)
+{
+    return ((cmd_type == 'V') || (cmd_type == 'R') || (cmd_type == 'W') || (cmd_type == 'Q') ||
+            (cmd_type == 'v') || (cmd_type == 'r') || (cmd_type == 'w') || (cmd_type == 'q') ||
+            (cmd_type == 'I'));
+}
+
+bool CommandHandle::IsValid(void) const
+{
+    return IsValidType(cmdType);
+}
+
+int CommandHandle::ToString(char *str) const
+{
+    str[0] = ' ';  // leading space
+    str[1] = cmdType;
+    *reinterpret_cast<long long int *>(str+2) = addr;
+    return COMMAND_HANDLE_STRING_SIZE;
+}
+
+int CommandHandle::ToString(std::string &str) const
+{
+    str.clear();
+    str.reserve(COMMAND_HANDLE_STRING_SIZE);
+    str.push_back(' ');
+    str.push_back(cmdType);
+    str.append(reinterpret_cast<const char *>(&addr), sizeof(long long int));
+    return COMMAND_HANDLE_STRING_SIZE;
+}
+
+int CommandHandle::FromString(const char *str)
+{
+    if (str[0] != ' ')
+        return 0;
+    if (!IsValidType(str[1]))
+        return 0;
+    cmdType = str[1];
+    addr = *reinterpret_cast<const long long int *>(str+2);    
+    return COMMAND_HANDLE_STRING_SIZE;
+}
+
+int CommandHandle::FromString(const std::string &str)
+{
+    if (str.size() < sizeof(long long int)+2)
+        return 0;
+    return FromString(str.data());
+}
+
+bool CommandHandle::operator == (const CommandHandle &other) const
+{
+    return (cmdType == other.cmdType) && (addr == other.addr);
+}
+
+bool CommandHandle::operator != (const CommandHandle &other) const
+{
+    return !(*this == other);
+}
+
+CMN_IMPLEMENT_SERVICES(mtsSocketProxyInitData)
+
+mtsSocketProxyInitData::mtsSocketProxyInitData() : mtsGenericObject(), 
+    version(mtsSocketProxy::SOCKET_PROXY_VERSION), packetSize(mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE)
+{
+    getInterfaceDescription[0] = 0;
+    getHandleVoid[0] = 0;
+    getHandleRead[0] = 0;
+    getHandleWrite[0] = 0;
+    getHandleQualifiedRead[0] = 0;
+    getHandleVoidReturn[0] = 0;
+    getHandleWriteReturn[0] = 0;
+    eventEnable[0] = 0;
+    eventDisable[0] = 0;
+}
+
+mtsSocketProxyInitData::mtsSocketProxyInitData(unsigned int psize, mtsFunctionRead *gid, mtsFunctionQualifiedRead *ghv,
+                        mtsFunctionQualifiedRead *ghr, mtsFunctionQualifiedRead *ghw, mtsFunctionQualifiedRead *ghqr,
+                        mtsFunctionQualifiedRead *ghvr, mtsFunctionQualifiedRead *ghwr,
+                        mtsFunctionWrite *ee, mtsFunctionWrite *ed)
+                        : mtsGenericObject(), version(mtsSocketProxy::SOCKET_PROXY_VERSION), packetSize(psize)
+{
+    CommandHandle handle('R', gid);
+    handle.ToString(getInterfaceDescription);
+    handle = CommandHandle('Q', ghv);
+    handle.ToString(getHandleVoid);
+    handle = CommandHandle('Q', ghr);
+    handle.ToString(getHandleRead);
+    handle = CommandHandle('Q', ghw);
+    handle.ToString(getHandleWrite);
+    handle = CommandHandle('Q', ghqr);
+    handle.ToString(getHandleQualifiedRead);
+    handle = CommandHandle('Q', ghvr);
+    handle.ToString(getHandleVoidReturn);
+    handle = CommandHandle('Q', ghwr);
+    handle.ToString(getHandleWriteReturn);
+    handle = CommandHandle('W', ee);
+    handle.ToString(eventEnable);
+    handle = CommandHandle('W', ed);
+    handle.ToString(eventDisable);
+}
+
+void mtsSocketProxyInitData::SerializeRaw(std::ostream & outputStream) const
+{
+    mtsGenericObject::SerializeRaw(outputStream);
+    cmnSerializeRaw(outputStream, version);
+    cmnSerializeRaw(outputStream, packetSize);
+    outputStream.write(getInterfaceDescription, sizeof(getInterfaceDescription));
+    outputStream.write(getHandleVoid, sizeof(getHandleVoid));
+    outputStream.write(getHandleRead, sizeof(getHandleRead));
+    outputStream.write(getHandleWrite, sizeof(getHandleWrite));
+    outputStream.write(getHandleQualifiedRead, sizeof(getHandleQualifiedRead));
+    outputStream.write(getHandleVoidReturn, sizeof(getHandleVoidReturn));
+    outputStream.write(getHandleWriteReturn, sizeof(getHandleWriteReturn));
+    outputStream.write(eventEnable, sizeof(eventEnable));
+    outputStream.write(eventDisable, sizeof(eventDisable));
+}
+
+void mtsSocketProxyInitData::DeSerializeRaw(std::istream & inputStream)
+{
+    mtsGenericObject::DeSerializeRaw(inputStream);
+    cmnDeSerializeRaw(inputStream, version);
+    cmnDeSerializeRaw(inputStream, packetSize);
+    inputStream.read(getInterfaceDescription, sizeof(getInterfaceDescription));
+    inputStream.read(getHandleVoid, sizeof(getHandleVoid));
+    inputStream.read(getHandleRead, sizeof(getHandleRead));
+    inputStream.read(getHandleWrite, sizeof(getHandleWrite));
+    inputStream.read(getHandleQualifiedRead, sizeof(getHandleQualifiedRead));
+    inputStream.read(getHandleVoidReturn, sizeof(getHandleVoidReturn));
+    inputStream.read(getHandleWriteReturn, sizeof(getHandleWriteReturn));
+    inputStream.read(eventEnable, sizeof(eventEnable));
+    inputStream.read(eventDisable, sizeof(eventDisable));
+}
+
+void mtsSocketProxyInitData::ToStream(std::ostream & outputStream) const
+{
+    outputStream << "Version: " << version << ", PacketSize: " << packetSize << std::endl;
+}
+
+// Following implementation is incomplete (only handles Version and PacketSize)
+void mtsSocketProxyInitData::ToStreamRaw(std::ostream & outputStream, const char delimiter,
+                                         bool headerOnly, const std::string & headerPrefix) const
+{
+    mtsGenericObject::ToStreamRaw(outputStream, delimiter, headerOnly, headerPrefix);
+    if (headerOnly)
+        outputStream << headerPrefix << "-Version" << delimiter
+                     << headerPrefix << "-PacketSize";
+    else
+        outputStream << this->version << delimiter
+                     << this->packetSize;
+}
+
+// Following implementation is incomplete (only handles Version and PacketSize)
+bool mtsSocketProxyInitData::FromStreamRaw(std::istream & inputStream, const char delimiter)
+{
+    mtsGenericObject::FromStreamRaw(inputStream, delimiter);
+    if (inputStream.fail())
+        return false;
+    inputStream >> version >> packetSize;
+    if (inputStream.fail())
+        return false;
+    return (typeid(*this) == typeid(mtsSocketProxyInitData));
+}
+
+
+CMN_IMPLEMENT_SERVICES(mtsSocketProxyStatistics)
+
+mtsSocketProxyStatistics::mtsSocketProxyStatistics() : mtsGenericObject(),
+    PacketsSent(0), PacketsReceived(0), BytesSent(0), BytesReceived(0),
+    MessagesSent(0), MessagesReceived(0), Retransmits(0), MessagesDropped(0)
+{
+}
+
+void mtsSocketProxyStatistics::SerializeRaw(std::ostream & outputStream) const
+{
+    mtsGenericObject::SerializeRaw(outputStream);
+    cmnSerializeRaw(outputStream, PacketsSent);
+    cmnSerializeRaw(outputStream, PacketsReceived);
+    cmnSerializeRaw(outputStream, BytesSent);
+    cmnSerializeRaw(outputStream, BytesReceived);
+    cmnSerializeRaw(outputStream, MessagesSent);
+    cmnSerializeRaw(outputStream, MessagesReceived);
+    cmnSerializeRaw(outputStream, Retransmits);
+    cmnSerializeRaw(outputStream, MessagesDropped);
+}
+
+void mtsSocketProxyStatistics::DeSerializeRaw(std::istream & inputStream)
+{
+    mtsGenericObject::DeSerializeRaw(inputStream);
+    cmnDeSerializeRaw(inputStream, PacketsSent);
+    cmnDeSerializeRaw(inputStream, PacketsReceived);
+    cmnDeSerializeRaw(inputStream, BytesSent);
+    cmnDeSerializeRaw(inputStream, BytesReceived);
+    cmnDeSerializeRaw(inputStream, MessagesSent);
+    cmnDeSerializeRaw(inputStream, MessagesReceived);
+    cmnDeSerializeRaw(inputStream, Retransmits);
+    cmnDeSerializeRaw(inputStream, MessagesDropped);
+}
+
+void mtsSocketProxyStatistics::ToStream(std::ostream & outputStream) const
+{
+    outputStream << "Packets sent: " << PacketsSent << " (" << BytesSent << " bytes)"
+                 << ", received: " << PacketsReceived << " (" << BytesReceived << " bytes)"
+                 << ", Messages sent: " << MessagesSent << ", received: " << MessagesReceived
+                 << ", dropped: " << MessagesDropped
+                 << ", Retransmits: " << Retransmits << std::endl;
+}
+
+void mtsSocketProxyStatistics::ToStreamRaw(std::ostream & outputStream, const char delimiter,
+                                           bool headerOnly, const std::string & headerPrefix) const
+{
+    mtsGenericObject::ToStreamRaw(outputStream, delimiter, headerOnly, headerPrefix);
+    if (headerOnly)
+        outputStream << delimiter << headerPrefix << "-PacketsSent"
+                     << delimiter << headerPrefix << "-PacketsReceived"
+                     << delimiter << headerPrefix << "-BytesSent"
+                     << delimiter << headerPrefix << "-BytesReceived"
+                     << delimiter << headerPrefix << "-MessagesSent"
+                     << delimiter << headerPrefix << "-MessagesReceived"
+                     << delimiter << headerPrefix << "-Retransmits"
+                     << delimiter << headerPrefix << "-MessagesDropped";
+    else
+        outputStream << delimiter << PacketsSent
+                     << delimiter << PacketsReceived
+                     << delimiter << BytesSent
+                     << delimiter << BytesReceived
+                     << delimiter << MessagesSent
+                     << delimiter << MessagesReceived
+                     << delimiter << Retransmits
+                     << delimiter << MessagesDropped;
+}
+
+// Datagram header: type (1 byte), protocol version (1 byte), 2 unused bytes,
+// message id, fragment index and message size (4 bytes each).  The index is
+// the number of missing ranges for negative acknowledgments, followed by the
+// first and last + 1 indices of each range.
+static const char SOCKET_PROXY_BATCH = 'B';
+static const char SOCKET_PROXY_FRAGMENT = 'F';
+static const char SOCKET_PROXY_NACK = 'N';
+
+// Pause after each window of fragments on UDP sockets
+static const double SOCKET_PROXY_FRAGMENT_PAUSE = 100.0 * cmn_us;
+
+const double mtsSocketProxyTransport::NACK_TIMEOUT = 10.0 * cmn_ms;
+
+static void mtsSocketProxyWriteHeader(char * packet, char type, unsigned int id,
+                                      unsigned int index, unsigned int size)
+{
+    packet[0] = type;
+    packet[1] = static_cast<char>(mtsSocketProxy::SOCKET_PROXY_VERSION);
+    packet[2] = 0;
+    packet[3] = 0;
+    memcpy(packet + 4, &id, sizeof(id));
+    memcpy(packet + 8, &index, sizeof(index));
+    memcpy(packet + 12, &size, sizeof(size));
+}
+
+static void mtsSocketProxyReadHeader(const char * packet, unsigned int & id,
+                                     unsigned int & index, unsigned int & size)
+{
+    memcpy(&id, packet + 4, sizeof(id));
+    memcpy(&index, packet + 8, sizeof(index));
+    memcpy(&size, packet + 12, sizeof(size));
+}
+
+mtsSocketProxyTransport::mtsSocketProxyTransport(osaSocket & socket, unsigned int packetSize) :
+    Socket(socket),
+    PacketSize(packetSize),
+    MaxMessageSize(DEFAULT_MAX_MESSAGE_SIZE),
+    NextMessageId(0),
+    Pending(packetSize),
+    PendingSize(HEADER_SIZE),
+    PendingMessages(0),
+    PendingUsesDestination(false),
+    Packet(packetSize),
+    SentMessages(MAX_SENT_MESSAGES),
+    NextSentMessage(0),
+    ReceiveBuffer(packetSize),
+    ReceivedOffset(0)
+{
+    CMN_ASSERT(packetSize > HEADER_SIZE + RECORD_HEADER_SIZE);
+}
+
+bool mtsSocketProxyTransport::Send(const char * message, size_t size)
+{
+    return Queue(false, osaIPandPort(), message, size);
+}
+
+bool mtsSocketProxyTransport::Send(const osaIPandPort & destination, const char * message, size_t size)
+{
+    return Queue(true, destination, message, size);
+}
+
+bool mtsSocketProxyTransport::Queue(bool useDestination, const osaIPandPort & destination,
+                                    const char * message, size_t size)
+{
+    bool result = true;
+    Mutex.Lock();
+    if ((PendingMessages > 0)
+        && ((useDestination != PendingUsesDestination)
+            || (useDestination && (destination != PendingDestination)))) {
+        result = FlushLocked();
+    }
+    PendingUsesDestination = useDestination;
+    if (useDestination) {
+        PendingDestination = destination;
+    }
+    const size_t recordSize = RECORD_HEADER_SIZE + size;
+    if (HEADER_SIZE + recordSize > PacketSize) {
+        // flush first to preserve the order of messages
+        result = FlushLocked() && result;
+        if (useDestination) {
+            Socket.SetDestination(destination);
+        }
+        if (SendFragments(message, size)) {
+            Statistics.MessagesSent++;
+        } else {
+            Statistics.MessagesDropped++;
+            result = false;
+        }
+    } else {
+        if (PendingSize + recordSize > PacketSize) {
+            result = FlushLocked() && result;
+        }
+        const unsigned int recordLength = static_cast<unsigned int>(size);
+        memcpy(&Pending[PendingSize], &recordLength, RECORD_HEADER_SIZE);
+        memcpy(&Pending[PendingSize + RECORD_HEADER_SIZE], message, size);
+        PendingSize += recordSize;
+        PendingMessages++;
+    }
+    Mutex.Unlock();
+    return result;
+}
+
+bool mtsSocketProxyTransport::Flush(void)
+{
+    Mutex.Lock();
+    const bool result = FlushLocked();
+    Mutex.Unlock();
+    return result;
+}
+
+bool mtsSocketProxyTransport::FlushLocked(void)
+{
+    if (PendingMessages == 0) {
+        return true;
+    }
+    if (PendingUsesDestination) {
+        Socket.SetDestination(PendingDestination);
+    }
+    mtsSocketProxyWriteHeader(&Pending[0], SOCKET_PROXY_BATCH, NextMessageId++, 0, 0);
+    const bool result = SendPacket(&Pending[0], PendingSize);
+    if (result) {
+        Statistics.MessagesSent += PendingMessages;
+    } else {
+        Statistics.MessagesDropped += PendingMessages;
+    }
+    PendingSize = HEADER_SIZE;
+    PendingMessages = 0;
+    return result;
+}
+
+bool mtsSocketProxyTransport::SendFragments(const char * message, size_t size)
+{
+    // keep a copy for retransmissions
+    const unsigned int id = NextMessageId++;
+    SentMessage & sent = SentMessages[NextSentMessage];
+    NextSentMessage = (NextSentMessage + 1) % SentMessages.size();
+    sent.Id = id;
+    sent.Data.assign(message, size);
+
+    const size_t fragmentSize = PacketSize - HEADER_SIZE;
+    const size_t numberOfFragments = (size + fragmentSize - 1) / fragmentSize;
+    for (size_t index = 0; index < numberOfFragments; ++index) {
+        if (!SendFragment(id, message, size, static_cast<unsigned int>(index))) {
+            return false;
+        }
+        PauseAfterFragments(index + 1);
+    }
+    return true;
+}
+
+bool mtsSocketProxyTransport::SendFragment(unsigned int id, const char * message, size_t size,
+                                           unsigned int index)
+{
+    const size_t fragmentSize = PacketSize - HEADER_SIZE;
+    const size_t offset = index * fragmentSize;
+    const size_t length = std::min(fragmentSize, size - offset);
+    char * packet = &Packet[0];
+    mtsSocketProxyWriteHeader(packet, SOCKET_PROXY_FRAGMENT, id, index, static_cast<unsigned int>(size));
+    memcpy(packet + HEADER_SIZE, message + offset, length);
+    return SendPacket(packet, HEADER_SIZE + length);
+}
+
+bool mtsSocketProxyTransport::SendPacket(const char * packet, size_t size)
+{
+    for (unsigned int attempt = 0; attempt <= MAX_RETRANSMITS; ++attempt) {
+        if (attempt > 0) {
+            Statistics.Retransmits++;
+        }
+        if (Socket.Send(packet, static_cast<unsigned int>(size), 0.05) == static_cast<int>(size)) {
+            Statistics.PacketsSent++;
+            Statistics.BytesSent += size;
+            return true;
+        }
+    }
+    CMN_LOG_RUN_WARNING << "mtsSocketProxyTransport: failed to send " << size << " bytes" << std::endl;
+    return false;
+}
+
+// UDP has no flow control, a long burst of fragments would overflow the
+// receive buffer of the peer.  Shared memory queues block when full.
+void mtsSocketProxyTransport::PauseAfterFragments(size_t numberOfFragments) const
+{
+    if ((Socket.GetType() == osaSocket::UDP)
+        && ((numberOfFragments % FRAGMENT_WINDOW) == 0)) {
+        osaSleep(SOCKET_PROXY_FRAGMENT_PAUSE);
+    }
+}
+
+int mtsSocketProxyTransport::Receive(std::string & message, osaIPandPort & sender,
+                                     double timeoutStartSec, double timeoutNextSec)
+{
+    if (NextBatchMessage(message)) {
+        sender = ReceivedFrom;
+        return static_cast<int>(message.size());
+    }
+    double timeout = timeoutStartSec;
+    while (true) {
+        // wake up to ask for missing fragments
+        const bool repairing = SendNacks();
+        const double wait = repairing ? std::min(timeout, NACK_TIMEOUT) : timeout;
+        const int bytesRead = Socket.Receive(&ReceiveBuffer[0], PacketSize, wait);
+        if (bytesRead < 0) {
+            return bytesRead;
+        }
+        if (bytesRead == 0) {
+            timeout -= wait;
+            if (!repairing || (timeout <= 0.0)) {
+                return 0;
+            }
+            continue;
+        }
+        Socket.GetDestination(sender);
+        const size_t size = static_cast<size_t>(bytesRead);
+        const bool valid = (size >= HEADER_SIZE)
+            && (ReceiveBuffer[1] == static_cast<char>(mtsSocketProxy::SOCKET_PROXY_VERSION));
+        Mutex.Lock();
+        Statistics.PacketsReceived++;
+        Statistics.BytesReceived += size;
+        Mutex.Unlock();
+        if (valid && (ReceiveBuffer[0] == SOCKET_PROXY_BATCH)) {
+            ReceivedBatch.assign(&ReceiveBuffer[HEADER_SIZE], size - HEADER_SIZE);
+            ReceivedOffset = 0;
+            ReceivedFrom = sender;
+            if (NextBatchMessage(message)) {
+                return static_cast<int>(message.size());
+            }
+        } else if (valid && (ReceiveBuffer[0] == SOCKET_PROXY_FRAGMENT)) {
+            if (AddFragment(&ReceiveBuffer[0], size, sender, message)) {
+                return static_cast<int>(message.size());
+            }
+            timeout = timeoutNextSec;
+        } else if (valid && (ReceiveBuffer[0] == SOCKET_PROXY_NACK)) {
+            Retransmit(sender, &ReceiveBuffer[0], size);
+        } else {
+            CMN_LOG_RUN_WARNING << "mtsSocketProxyTransport: received invalid packet from "
+                                << sender.IP << ":" << sender.Port << std::endl;
+            CountDropped();
+        }
+    }
+}
+
+bool mtsSocketProxyTransport::NextBatchMessage(std::string & message)
+{
+    if (ReceivedOffset + RECORD_HEADER_SIZE > ReceivedBatch.size()) {
+        ReceivedOffset = ReceivedBatch.size();
+        return false;
+    }
+    unsigned int length;
+    memcpy(&length, ReceivedBatch.data() + ReceivedOffset, RECORD_HEADER_SIZE);
+    const size_t start = ReceivedOffset + RECORD_HEADER_SIZE;
+    if (length > ReceivedBatch.size() - start) {
+        CountDropped();
+        ReceivedOffset = ReceivedBatch.size();
+        return false;
+    }
+    Mutex.Lock();
+    Statistics.MessagesReceived++;
+    Mutex.Unlock();
+    message.assign(ReceivedBatch, start, length);
+    ReceivedOffset = start + length;
+    return true;
+}
+
+bool mtsSocketProxyTransport::AddFragment(const char * packet, size_t packetSize,
+                                          const osaIPandPort & sender, std::string & message)
+{
+    unsigned int id, index, size;
+    mtsSocketProxyReadHeader(packet, id, index, size);
+    // the size comes from the packet, don't trust it for the allocation
+    if (size > MaxMessageSize) {
+        CMN_LOG_RUN_WARNING << "mtsSocketProxyTransport: dropped message of " << size
+                            << " bytes from " << sender.IP << ":" << sender.Port
+                            << ", larger than maximum message size " << MaxMessageSize << std::endl;
+        CountDropped();
+        return false;
+    }
+    const size_t fragmentSize = PacketSize - HEADER_SIZE;
+    const size_t count = (static_cast<size_t>(size) + fragmentSize - 1) / fragmentSize;
+    const size_t offset = index * fragmentSize;
+    const size_t length = packetSize - HEADER_SIZE;
+    if ((index >= count)
+        || (length != std::min(fragmentSize, size - offset))) {
+        CMN_LOG_RUN_WARNING << "mtsSocketProxyTransport: received invalid fragment from "
+                            << sender.IP << ":" << sender.Port << std::endl;
+        CountDropped();
+        return false;
+    }
+    Reassembly & entry = Reassemblies[sender];
+    if ((entry.Id != id) || (entry.Fragments.size() != count)) {
+        // a sender sends all fragments of a message before the next one
+        if (entry.Received < entry.Fragments.size()) {
+            CountDropped();
+        }
+        entry.Id = id;
+        entry.Received = 0;
+        entry.Fragments.assign(count, false);
+        entry.Data.resize(size);
+    }
+    entry.Nacks = 0;
+    entry.LastUpdate = osaGetTime();
+    if (entry.Received == count) {
+        return false;  // late retransmission of a complete message
+    }
+    if (!entry.Fragments[index]) {
+        entry.Fragments[index] = true;
+        entry.Received++;
+        memcpy(&entry.Data[offset], packet + HEADER_SIZE, length);
+    }
+    if (entry.Received < count) {
+        return false;
+    }
+    message.swap(entry.Data);
+    Mutex.Lock();
+    Statistics.MessagesReceived++;
+    Mutex.Unlock();
+    return true;
+}
+
+// Returns true if some messages are still being reassembled
+bool mtsSocketProxyTransport::SendNacks(void)
+{
+    bool repairing = false;
+    double now = 0.0;
+    ReassemblyMapType::iterator iter;
+    for (iter = Reassemblies.begin(); iter != Reassemblies.end(); ++iter) {
+        Reassembly & entry = iter->second;
+        if ((entry.Received == entry.Fragments.size()) || (entry.Nacks >= MAX_NACKS)) {
+            continue;
+        }
+        repairing = true;
+        if (now == 0.0) {
+            now = osaGetTime();
+        }
+        if ((now - entry.LastUpdate) >= NACK_TIMEOUT) {
+            SendNack(iter->first, entry);
+            entry.Nacks++;
+            entry.LastUpdate = now;
+        }
+    }
+    return repairing;
+}
+
+void mtsSocketProxyTransport::SendNack(const osaIPandPort & sender, const Reassembly & entry)
+{
+    // list as many ranges of missing fragments as fit in a datagram
+    Mutex.Lock();
+    char * packet = &Packet[0];
+    const size_t maxRanges = (PacketSize - HEADER_SIZE) / (2 * sizeof(unsigned int));
+    unsigned int numberOfRanges = 0;
+    const size_t count = entry.Fragments.size();
+    size_t index = 0;
+    while ((index < count) && (numberOfRanges < maxRanges)) {
+        if (entry.Fragments[index]) {
+            ++index;
+            continue;
+        }
+        const unsigned int first = static_cast<unsigned int>(index);
+        while ((index < count) && !entry.Fragments[index]) {
+            ++index;
+        }
+        const unsigned int last = static_cast<unsigned int>(index);
+        char * range = packet + HEADER_SIZE + numberOfRanges * 2 * sizeof(unsigned int);
+        memcpy(range, &first, sizeof(first));
+        memcpy(range + sizeof(first), &last, sizeof(last));
+        ++numberOfRanges;
+    }
+    mtsSocketProxyWriteHeader(packet, SOCKET_PROXY_NACK, entry.Id, numberOfRanges, 0);
+    Socket.SetDestination(sender);
+    SendPacket(packet, HEADER_SIZE + numberOfRanges * 2 * sizeof(unsigned int));
+    Mutex.Unlock();
+}
+
+void mtsSocketProxyTransport::Retransmit(const osaIPandPort & sender, const char * packet, size_t size)
+{
+    unsigned int id, numberOfRanges, unused;
+    mtsSocketProxyReadHeader(packet, id, numberOfRanges, unused);
+    if (HEADER_SIZE + numberOfRanges * 2 * sizeof(unsigned int) > size) {
+        CountDropped();
+        return;
+    }
+    Mutex.Lock();
+    const SentMessage * sent = 0;
+    for (size_t i = 0; i < SentMessages.size(); ++i) {
+        if ((SentMessages[i].Id == id) && !SentMessages[i].Data.empty()) {
+            sent = &(SentMessages[i]);
+        }
+    }
+    if (!sent) {
+        Mutex.Unlock();
+        CMN_LOG_RUN_WARNING << "mtsSocketProxyTransport: message " << id << " requested by "
+                            << sender.IP << ":" << sender.Port << " is no longer available" << std::endl;
+        return;
+    }
+    Socket.SetDestination(sender);
+    const size_t fragmentSize = PacketSize - HEADER_SIZE;
+    const size_t count = (sent->Data.size() + fragmentSize - 1) / fragmentSize;
+    size_t numberSent = 0;
+    for (unsigned int range = 0; range < numberOfRanges; ++range) {
+        unsigned int first, last;
+        memcpy(&first, packet + HEADER_SIZE + range * 2 * sizeof(unsigned int), sizeof(first));
+        memcpy(&last, packet + HEADER_SIZE + range * 2 * sizeof(unsigned int) + sizeof(first), sizeof(last));
+        for (unsigned int index = first; (index < last) && (index < count); ++index) {
+            Statistics.Retransmits++;
+            SendFragment(id, sent->Data.data(), sent->Data.size(), index);
+            PauseAfterFragments(++numberSent);
+        }
+    }
+    Mutex.Unlock();
+}
+
+void mtsSocketProxyTransport::CountDropped(void)
+{
+    Mutex.Lock();
+    Statistics.MessagesDropped++;
+    Mutex.Unlock();
+}
+
+void mtsSocketProxyTransport::GetStatistics(mtsSocketProxyStatistics & statistics) const
+{
+    Mutex.Lock();
+    statistics = Statistics;
+    Mutex.Unlock();
+}
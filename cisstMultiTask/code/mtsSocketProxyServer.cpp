@@ -49,6 +49,7 @@ void mtsSocketProxyServerConstructorArg::SerializeRaw(std::ostream & outputStrea
     cmnSerializeRaw(outputStream, ComponentName);
     cmnSerializeRaw(outputStream, ProvidedInterfaceName);
     cmnSerializeRaw(outputStream, Port);
+    cmnSerializeRaw(outputStream, SharedMemory);
 }
 
 void mtsSocketProxyServerConstructorArg::DeSerializeRaw(std::istream & inputStream)
@@ -58,6 +59,7 @@ void mtsSocketProxyServerConstructorArg::DeSerializeRaw(std::istream & inputStre
     cmnDeSerializeRaw(inputStream, ComponentName);
     cmnDeSerializeRaw(inputStream, ProvidedInterfaceName);
     cmnDeSerializeRaw(inputStream, Port);
+    cmnDeSerializeRaw(inputStream, SharedMemory);
 }
 
 void mtsSocketProxyServerConstructorArg::ToStream(std::ostream & outputStream) const
@@ -65,7 +67,8 @@ void mtsSocketProxyServerConstructorArg::ToStream(std::ostream & outputStream) c
     outputStream << "Name: " << Name
                  << ", ComponentName: " << ComponentName
                  << ", ProvidedInterfaceName: " << ProvidedInterfaceName
-                 << ", Port: " << Port << std::endl;
+                 << ", Port: " << Port
+                 << ", SharedMemory: " << SharedMemory << std::endl;
 }
 
 void mtsSocketProxyServerConstructorArg::ToStreamRaw(std::ostream & outputStream, const char delimiter,
@@ -76,12 +79,14 @@ void mtsSocketProxyServerConstructorArg::ToStreamRaw(std::ostream & outputStream
         outputStream << headerPrefix << "-name" << delimiter
                      << headerPrefix << "-componentName" << delimiter
                      << headerPrefix << "-providedInterfaceName" << delimiter
-                     << headerPrefix << "-port";
+                     << headerPrefix << "-port" << delimiter
+                     << headerPrefix << "-sharedMemory";
     } else {
         outputStream << this->Name << delimiter
                      << this->ComponentName << delimiter
                      << this->ProvidedInterfaceName << delimiter
-                     << this->Port;
+                     << this->Port << delimiter
+                     << this->SharedMemory;
     }
 }
 
@@ -90,7 +95,7 @@ bool mtsSocketProxyServerConstructorArg::FromStreamRaw(std::istream & inputStrea
     mtsGenericObject::FromStreamRaw(inputStream, delimiter);
     if (inputStream.fail())
         return false;
-    inputStream >> Name >> ComponentName >> ProvidedInterfaceName >> Port;
+    inputStream >> Name >> ComponentName >> ProvidedInterfaceName >> Port >> SharedMemory;
     if (inputStream.fail())
         return false;
     return (typeid(*this) == typeid(mtsSocketProxyServerConstructorArg));
@@ -105,7 +110,7 @@ bool mtsSocketProxyServerConstructorArg::FromStreamRaw(std::istream & inputStrea
 
 class mtsEventSenderBase {
 protected:
-    osaSocket   &Socket;
+    mtsSocketProxyTransport &Transport;
 
     struct ClientInfo {
         osaIPandPort IP_Port;
@@ -124,7 +129,7 @@ protected:
 
 public:
 
-    mtsEventSenderBase(osaSocket &socket) : Socket(socket) {}
+    mtsEventSenderBase(mtsSocketProxyTransport &transport) : Transport(transport) {}
     ~mtsEventSenderBase() {}
 
     bool AddClient(const osaIPandPort &ip_port, const char *handle, mtsProxySerializer *serializer);
@@ -157,26 +162,28 @@ bool mtsEventSenderBase::RemoveClient(const osaIPandPort &ip_port, const char *h
 
 class mtsEventSenderVoid : public mtsEventSenderBase {
 public:
-    mtsEventSenderVoid(osaSocket &socket) : mtsEventSenderBase(socket) {}
+    mtsEventSenderVoid(mtsSocketProxyTransport &transport) : mtsEventSenderBase(transport) {}
     ~mtsEventSenderVoid() {}
     void Method(void)
     {
         std::vector<ClientInfo>::const_iterator it;
         for (it = ClientList.begin(); it != ClientList.end(); it++) {
-            Socket.SetDestination(it->IP_Port);
-            Socket.Send(it->Handle, sizeof(it->Handle));
+            Transport.Send(it->IP_Port, it->Handle, sizeof(it->Handle));
         }
     }
 };
 
 class mtsEventSenderWrite : public mtsEventSenderBase {
+    // kept between events to avoid memory allocations
+    std::string sendBuffer;
+    std::string sendBufferWithServices;
 public:
-    mtsEventSenderWrite(osaSocket &socket) : mtsEventSenderBase(socket) {}
+    mtsEventSenderWrite(mtsSocketProxyTransport &transport) : mtsEventSenderBase(transport) {}
     ~mtsEventSenderWrite() {}
     void Method(const mtsGenericObject &arg)
     {
-        std::string sendBuffer;
-        std::string sendBufferWithServices;
+        sendBuffer.clear();
+        sendBufferWithServices.clear();
         std::vector<ClientInfo>::const_iterator it;
         for (it = ClientList.begin(); it != ClientList.end(); it++) {
             if (it->Serializer->ServicesSerialized(arg.Services())) {
@@ -187,8 +194,7 @@ public:
                 else
                     sendBuffer.replace(0, CommandHandle::COMMAND_HANDLE_STRING_SIZE,
                                        it->Handle,CommandHandle::COMMAND_HANDLE_STRING_SIZE);
-                Socket.SetDestination(it->IP_Port);
-                Socket.SendAsPackets(sendBuffer, mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE, 0.05);
+                Transport.Send(it->IP_Port, sendBuffer);
             }
             else {
                 if (sendBufferWithServices.empty()) {
@@ -198,8 +204,7 @@ public:
                 else
                     sendBufferWithServices.replace(0, CommandHandle::COMMAND_HANDLE_STRING_SIZE,
                                                it->Handle,CommandHandle::COMMAND_HANDLE_STRING_SIZE);
-                Socket.SetDestination(it->IP_Port);
-                Socket.SendAsPackets(sendBufferWithServices, mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE, 0.05);
+                Transport.Send(it->IP_Port, sendBufferWithServices);
             }
         }
     }
@@ -216,15 +221,15 @@ public:
 // along with the RecvHandle, to the client via the socket.
 
 class FinishedEventEntry {
-    osaSocket *Socket;
+    mtsSocketProxyTransport *Transport;
     osaIPandPort IP_Port;
     char RecvHandle[CommandHandle::COMMAND_HANDLE_STRING_SIZE];
     mtsProxySerializer *Serializer;
     bool Used;
 public:
-    FinishedEventEntry() : Socket(0), Serializer(0), Used(false) {}
-    FinishedEventEntry(osaSocket *socket, const osaIPandPort &ip_port, const std::string &recv_handle, mtsProxySerializer *serializer) :
-        Socket(socket), IP_Port(ip_port), Serializer(serializer), Used(true)
+    FinishedEventEntry() : Transport(0), Serializer(0), Used(false) {}
+    FinishedEventEntry(mtsSocketProxyTransport *transport, const osaIPandPort &ip_port, const std::string &recv_handle, mtsProxySerializer *serializer) :
+        Transport(transport), IP_Port(ip_port), Serializer(serializer), Used(true)
     {
         // Make sure recv_handle string is big enough (should be exactly COMMAND_HANDLE_STRING_SIZE)
         CMN_ASSERT(recv_handle.size() >= sizeof(CommandHandle::COMMAND_HANDLE_STRING_SIZE));
@@ -263,12 +268,11 @@ void FinishedEventEntry::Method(const mtsStdString &argSerialized)
     if (!Used) {
         CMN_LOG_RUN_WARNING << "FinishedEventEntry: attempt to execute unused entry" << std::endl;
     }
-    CMN_ASSERT(Socket);
+    CMN_ASSERT(Transport);
     CMN_ASSERT(Serializer);
     std::string sendBuffer(RecvHandle, sizeof(RecvHandle));
     sendBuffer.append(argSerialized.GetData());
-    Socket->SetDestination(IP_Port);
-    Socket->SendAsPackets(sendBuffer, mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE, 0.05);
+    Transport->Send(IP_Port, sendBuffer);
     Used = false;
 }
 
@@ -287,7 +291,7 @@ public:
     FinishedEventList(size_t size, mtsMailBox *mbox, size_t mbox_size);
     ~FinishedEventList();
 
-    mtsCommandWriteBase *AllocateEntry(osaSocket *socket, const osaIPandPort &ip_port,
+    mtsCommandWriteBase *AllocateEntry(mtsSocketProxyTransport *transport, const osaIPandPort &ip_port,
                                        const std::string &recv_handle, mtsProxySerializer *serializer);
 
     bool FreeEntry(mtsCommandWriteBase *cmd);
@@ -318,12 +322,12 @@ FinishedEventList::~FinishedEventList()
     }
 }
 
-mtsCommandWriteBase *FinishedEventList::AllocateEntry(osaSocket *socket, const osaIPandPort &ip_port,
+mtsCommandWriteBase *FinishedEventList::AllocateEntry(mtsSocketProxyTransport *transport, const osaIPandPort &ip_port,
                                                       const std::string &recv_handle, mtsProxySerializer *serializer)
 {
     for (size_t i = 0; i < List.size(); i++) {
         if (List[i].IsAvailable()) {
-            List[i] = FinishedEventEntry(socket, ip_port, recv_handle, serializer);
+            List[i] = FinishedEventEntry(transport, ip_port, recv_handle, serializer);
             return Cmd[i];
         }
     }
@@ -735,9 +739,11 @@ mtsExecutionResult FunctionWriteReturnProxy::ExecuteSerialized(const std::string
 // This is the main server proxy class. It is a continuous task so that it can poll the socket for commands.
 
 mtsSocketProxyServer::mtsSocketProxyServer(const std::string & proxyName, const std::string & componentName,
-                                           const std::string & providedInterfaceName, unsigned short port) :
+                                           const std::string & providedInterfaceName, unsigned short port,
+                                           bool sharedMemory) :
     mtsTaskContinuous(proxyName),
-    Socket(osaSocket::UDP),
+    Socket(sharedMemory ? osaSocket::SHARED_MEMORY : osaSocket::UDP),
+    Transport(Socket),
     FunctionVoidProxyMap("FunctionVoidProxyMap"),
     FunctionWriteProxyMap("FunctionWriteProxyMap"),
     FunctionReadProxyMap("FunctionReadProxyMap"),
@@ -752,11 +758,13 @@ mtsSocketProxyServer::mtsSocketProxyServer(const std::string & proxyName, const
         CMN_LOG_CLASS_INIT_VERBOSE << "Created required interface in " << proxyName << std::endl;
     }
     Socket.AssignPort(port);
+    CreateStatisticsInterface();
 }
 
 mtsSocketProxyServer::mtsSocketProxyServer(const mtsSocketProxyServerConstructorArg &arg) :
     mtsTaskContinuous(arg.Name),
-    Socket(osaSocket::UDP),
+    Socket(arg.SharedMemory ? osaSocket::SHARED_MEMORY : osaSocket::UDP),
+    Transport(Socket),
     FunctionVoidProxyMap("FunctionVoidProxyMap"),
     FunctionWriteProxyMap("FunctionWriteProxyMap"),
     FunctionReadProxyMap("FunctionReadProxyMap"),
@@ -771,6 +779,7 @@ mtsSocketProxyServer::mtsSocketProxyServer(const mtsSocketProxyServerConstructor
         CMN_LOG_CLASS_INIT_VERBOSE << "Created required interface in " << arg.Name << std::endl;
     }
     Socket.AssignPort(arg.Port);
+    CreateStatisticsInterface();
 }
 
 mtsSocketProxyServer::~mtsSocketProxyServer()
@@ -805,294 +814,296 @@ void mtsSocketProxyServer::Run(void)
     ProcessQueuedCommands();
     ProcessQueuedEvents();
 
-    std::string inputArgString;
-    char packetBuffer[mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE];
-    int bytesRead = Socket.ReceiveAsPackets(inputArgString, packetBuffer, sizeof(packetBuffer), 0.001, 0.1);
-    if (bytesRead > 0) {
-
-        // Process the input string. The code currently supports two protocols, which
-        // are distinguished by looking at the first byte. If it is a space, then
-        // we are using a CommandHandle (#1 below); otherwise, we are using a
-        // CommandString (#2 below). The CommandHandle protocol is more run-time
-        // efficient because there is no string lookup.
-        //
-        // 1) CommandHandle protocol: The first 10 bytes are the CommandHandle, where
-        //    the first byte is a space, the second byte is a character that designates
-        //    the type of command (e.g., 'V', 'R', 'W', 'Q'), and the last 8 bytes are a 64-bit
-        //    address of the mtsFunctionXXXX object to be invoked. The next 10 bytes
-        //    are the EventReceiverHandle; this is also a CommandHandle, but is actually
-        //    the address of the client's EventReceiverWriteProxy object. The serialized command
-        //    argument (e.g., for Write, QualifiedRead, and WriteReturn commands) immediately
-        //    follows the EventReceiverHandle.
-        //
-        // 2) CommandString protocol: All characters up to the first delimiter (space, or end
-        //    of string) designate the command name. If there is a space, then it is assumed
-        //    that the serialized command argument immediately follows the space. Since
-        //    this protocol requires a string lookup to find the address of the mtsFunctionXXXX
-        //    object, some efficiency is obtained by splitting the code between the commands
-        //    that do not use an argument (Void, Read, VoidReturn) and those that do (Write,
-        //    QualifiedRead, WriteReturn). NOTE: This protocol is currently broken, since
-        //    it does not provide a proper return value. This can be fixed by passing a symbolic
-        //    name (string) for the return value; the server proxy can then send a message (event)
-        //    that is identified by this symbolic name.
-        //
-        // There is currently only one protocol for the response packet. It begins with the
-        // EventReceiverHandle (which is an empty string for the CommandString protocol), followed by
-        // the serialized serialized return value (for read, qualified read, void return, write return)
-        // or by the serialized mtsExecutionResult (for blocking void and write).
-
-        mtsExecutionResult ret;
-        std::string        RecvHandle;
-        std::string        outputArgString;
-
-        osaIPandPort ip_port;
-        Socket.GetDestination(ip_port);
-        mtsProxySerializer *serializer = GetSerializerForClient(ip_port);
-        // Most commands are blocking
-        bool isBlocking = true;
-        // Event sender command
-        mtsCommandWriteBase *eventSenderCommand = 0;
-
-        size_t pos = inputArgString.find(' ');
-        if ((pos == 0) && (inputArgString.size() >= 2*CommandHandle::COMMAND_HANDLE_STRING_SIZE)) {
-            CommandHandle handle(inputArgString);
-            RecvHandle = inputArgString.substr(CommandHandle::COMMAND_HANDLE_STRING_SIZE,
-                                               CommandHandle::COMMAND_HANDLE_STRING_SIZE);
-            inputArgString.erase(0, 2*CommandHandle::COMMAND_HANDLE_STRING_SIZE);
-            // Since we know the command type (handle.cmdType) we could reinterpret_cast directly to
-            // the correct mtsFunctionXXXX type, but to be safe we first reinterpret_cast to the base
-            // type, mtsFunctionBase, and then do a dynamic_cast to the expected type. If the address
-            // (handle.addr) is corrupted, this would lead to either a dynamic_cast failure (i.e.,
-            // a null pointer) or possibly a runtime exception.
-            mtsFunctionBase *functionBase = reinterpret_cast<mtsFunctionBase *>(handle.addr);
-            try {
-                FunctionVoidProxy *functionVoid;
-                FunctionReadProxy *functionReadProxy;
-                FunctionWriteProxy *functionWriteProxy;
-                FunctionQualifiedReadProxy *functionQualifiedReadProxy;
+    // Send the replies and events queued so far before waiting for commands, then
+    // process all the messages coalesced in the datagram received.  The replies
+    // are sent together at the end of the cycle.
+    Transport.Flush();
+    std::string & inputArgString = InputArgString;
+    int bytesRead = Transport.Receive(inputArgString, CurrentClient, 0.001, 0.1);
+    while (bytesRead > 0) {
+        ProcessMessage(inputArgString);
+        bytesRead = Transport.HasPendingMessage() ? Transport.Receive(inputArgString, CurrentClient, 0.0, 0.1) : 0;
+    }
+    Transport.Flush();
+}
+
+// Process a command received from CurrentClient
+void mtsSocketProxyServer::ProcessMessage(std::string & inputArgString)
+{
+    // Process the input string. The code currently supports two protocols, which
+    // are distinguished by looking at the first byte. If it is a space, then
+    // we are using a CommandHandle (#1 below); otherwise, we are using a
+    // CommandString (#2 below). The CommandHandle protocol is more run-time
+    // efficient because there is no string lookup.
+    //
+    // 1) CommandHandle protocol: The first 10 bytes are the CommandHandle, where
+    //    the first byte is a space, the second byte is a character that designates
+    //    the type of command (e.g., 'V', 'R', 'W', 'Q'), and the last 8 bytes are a 64-bit
+    //    address of the mtsFunctionXXXX object to be invoked. The next 10 bytes
+    //    are the EventReceiverHandle; this is also a CommandHandle, but is actually
+    //    the address of the client's EventReceiverWriteProxy object. The serialized command
+    //    argument (e.g., for Write, QualifiedRead, and WriteReturn commands) immediately
+    //    follows the EventReceiverHandle.
+    //
+    // 2) CommandString protocol: All characters up to the first delimiter (space, or end
+    //    of string) designate the command name. If there is a space, then it is assumed
+    //    that the serialized command argument immediately follows the space. Since
+    //    this protocol requires a string lookup to find the address of the mtsFunctionXXXX
+    //    object, some efficiency is obtained by splitting the code between the commands
+    //    that do not use an argument (Void, Read, VoidReturn) and those that do (Write,
+    //    QualifiedRead, WriteReturn). NOTE: This protocol is currently broken, since
+    //    it does not provide a proper return value. This can be fixed by passing a symbolic
+    //    name (string) for the return value; the server proxy can then send a message (event)
+    //    that is identified by this symbolic name.
+    //
+    // There is currently only one protocol for the response packet. It begins with the
+    // EventReceiverHandle (which is an empty string for the CommandString protocol), followed by
+    // the serialized serialized return value (for read, qualified read, void return, write return)
+    // or by the serialized mtsExecutionResult (for blocking void and write).
+
+    mtsExecutionResult ret;
+    std::string        RecvHandle;
+    std::string &      outputArgString = OutputArgString;
+    outputArgString.clear();
+
+    mtsProxySerializer *serializer = GetSerializerForClient(CurrentClient);
+    // Most commands are blocking
+    bool isBlocking = true;
+    // Event sender command
+    mtsCommandWriteBase *eventSenderCommand = 0;
+
+    size_t pos = inputArgString.find(' ');
+    if ((pos == 0) && (inputArgString.size() >= 2*CommandHandle::COMMAND_HANDLE_STRING_SIZE)) {
+        CommandHandle handle(inputArgString);
+        RecvHandle = inputArgString.substr(CommandHandle::COMMAND_HANDLE_STRING_SIZE,
+                                           CommandHandle::COMMAND_HANDLE_STRING_SIZE);
+        inputArgString.erase(0, 2*CommandHandle::COMMAND_HANDLE_STRING_SIZE);
+        // Since we know the command type (handle.cmdType) we could reinterpret_cast directly to
+        // the correct mtsFunctionXXXX type, but to be safe we first reinterpret_cast to the base
+        // type, mtsFunctionBase, and then do a dynamic_cast to the expected type. If the address
+        // (handle.addr) is corrupted, this would lead to either a dynamic_cast failure (i.e.,
+        // a null pointer) or possibly a runtime exception.
+        mtsFunctionBase *functionBase = reinterpret_cast<mtsFunctionBase *>(handle.addr);
+        try {
+            FunctionVoidProxy *functionVoid;
+            FunctionReadProxy *functionReadProxy;
+            FunctionWriteProxy *functionWriteProxy;
+            FunctionQualifiedReadProxy *functionQualifiedReadProxy;
 				FunctionVoidReturnProxy *functionVoidReturnProxy;
 				FunctionWriteReturnProxy *functionWriteReturnProxy;
-                switch (handle.cmdType) {
-                  case 'I':
-                      ret = GetInitData(outputArgString, serializer);
-                      break;
-                  case 'V':
-                      isBlocking = false;
-                      functionVoid = dynamic_cast<FunctionVoidProxy *>(functionBase);
-                      if (functionVoid)
-                          ret = functionVoid->ExecuteSerialized(MTS_NOT_BLOCKING, 0);
-                      else {
-                          CMN_LOG_CLASS_RUN_ERROR << "FunctionVoidProxy dynamic cast failed" << std::endl;
-                          ret = mtsExecutionResult::INVALID_COMMAND_ID;
-                      }
-                      break;
-                  case 'v':   // blocking
-                      functionVoid = dynamic_cast<FunctionVoidProxy *>(functionBase);
-                      if (functionVoid) {
-                          eventSenderCommand = AllocateFinishedEvent(RecvHandle);
-                          if (eventSenderCommand)
-                              ret = functionVoid->ExecuteSerialized(MTS_BLOCKING, eventSenderCommand);
-                          else
-                              ret = mtsExecutionResult::NO_FINISHED_EVENT;
-                      }
-                      else {
-                          CMN_LOG_CLASS_RUN_ERROR << "FunctionVoidProxy(blocking) dynamic cast failed" << std::endl;
-                          ret = mtsExecutionResult::INVALID_COMMAND_ID;
-                      }
-                      break;
-                  case 'R':
-                      functionReadProxy = dynamic_cast<FunctionReadProxy *>(functionBase);
-                      if (functionReadProxy) {
-                          eventSenderCommand = AllocateFinishedEvent(RecvHandle);
-                          if (eventSenderCommand)
-                              ret = functionReadProxy->ExecuteSerialized(outputArgString, eventSenderCommand);
-                          else
-                              ret = mtsExecutionResult::NO_FINISHED_EVENT;
-                      }
-                      else {
-                          CMN_LOG_CLASS_RUN_ERROR << "FunctionReadProxy dynamic cast failed" << std::endl;
-                          ret = mtsExecutionResult::INVALID_COMMAND_ID;
-                      }
-                      break;
-                  case 'W':
-                      isBlocking = false;
-                      functionWriteProxy = dynamic_cast<FunctionWriteProxy *>(functionBase);
-                      if (functionWriteProxy)
-                          ret = functionWriteProxy->ExecuteSerialized(inputArgString, MTS_NOT_BLOCKING, 0);
-                      else {
-                          CMN_LOG_CLASS_RUN_ERROR << "FunctionWriteProxy dynamic cast failed" << std::endl;
-                          ret = mtsExecutionResult::INVALID_COMMAND_ID;
-                      }
-                      break;
-                  case 'w':   // blocking
-                      functionWriteProxy = dynamic_cast<FunctionWriteProxy *>(functionBase);
-                      if (functionWriteProxy) {
-                          eventSenderCommand = AllocateFinishedEvent(RecvHandle);
-                          if (eventSenderCommand)
-                              ret = functionWriteProxy->ExecuteSerialized(inputArgString, MTS_BLOCKING, eventSenderCommand);
-                          else
-                              ret = mtsExecutionResult::NO_FINISHED_EVENT;
-                      }
-                      else {
-                          CMN_LOG_CLASS_RUN_ERROR << "FunctionWriteProxy dynamic cast failed" << std::endl;
-                          ret = mtsExecutionResult::INVALID_COMMAND_ID;
-                      }
-                      break;
-                  case 'Q':
-                      functionQualifiedReadProxy = dynamic_cast<FunctionQualifiedReadProxy *>(functionBase);
-                      if (functionQualifiedReadProxy) {
-                          eventSenderCommand = AllocateFinishedEvent(RecvHandle);
-                          if (eventSenderCommand)
-                              ret = functionQualifiedReadProxy->ExecuteSerialized(inputArgString, outputArgString, eventSenderCommand);
-                          else
-                              ret = mtsExecutionResult::NO_FINISHED_EVENT;
-                      }
-                      else {
-                          CMN_LOG_CLASS_RUN_ERROR << "FunctionQualifiedReadProxy dynamic cast failed" << std::endl;
-                          ret = mtsExecutionResult::INVALID_COMMAND_ID;
-                      }
-                      break;
-                  case 'r':
-                      functionVoidReturnProxy = dynamic_cast<FunctionVoidReturnProxy *>(functionBase);
-                      if (functionVoidReturnProxy) {
-                          eventSenderCommand = AllocateFinishedEvent(RecvHandle);
-                          if (eventSenderCommand)
-                              ret = functionVoidReturnProxy->ExecuteSerialized(eventSenderCommand);
-                          else
-                              ret = mtsExecutionResult::NO_FINISHED_EVENT;
-                      }
-                      else {
-                          CMN_LOG_CLASS_RUN_ERROR << "FunctionVoidReturnProxy dynamic cast failed" << std::endl;
-                          ret = mtsExecutionResult::INVALID_COMMAND_ID;
-                      }
-                      break;
-                  case 'q':
-                      functionWriteReturnProxy = dynamic_cast<FunctionWriteReturnProxy *>(functionBase);
-                      if (functionWriteReturnProxy) {
-                          eventSenderCommand = AllocateFinishedEvent(RecvHandle);
-                          if (eventSenderCommand)
-                              ret = functionWriteReturnProxy->ExecuteSerialized(inputArgString, eventSenderCommand);
-                          else
-                              ret = mtsExecutionResult::NO_FINISHED_EVENT;
-                      }
-                      else {
-                          CMN_LOG_CLASS_RUN_ERROR << "FunctionWriteReturnProxy dynamic cast failed" << std::endl;
-                          ret = mtsExecutionResult::INVALID_COMMAND_ID;
-                      }
-                      break;
-                default:
-                    CMN_LOG_CLASS_RUN_ERROR << "Invalid command type: " << handle.cmdType << std::endl;
-                }
-            }
-            catch (const std::runtime_error &e) {
-                CMN_LOG_CLASS_RUN_ERROR << "Exception while using command handle for type " << handle.cmdType
-                                        << ", addr = " << std::hex << handle.addr << ": " << e.what() << std::endl;
-                ret = mtsExecutionResult::INVALID_COMMAND_ID;
-            }
-            if (!ret.IsOK()) {
-                CMN_LOG_CLASS_RUN_WARNING << "Command type: " << handle.cmdType << ", result = " << ret << std::endl;
+            switch (handle.cmdType) {
+              case 'I':
+                  ret = GetInitData(outputArgString, serializer);
+                  break;
+              case 'V':
+                  isBlocking = false;
+                  functionVoid = dynamic_cast<FunctionVoidProxy *>(functionBase);
+                  if (functionVoid)
+                      ret = functionVoid->ExecuteSerialized(MTS_NOT_BLOCKING, 0);
+                  else {
+                      CMN_LOG_CLASS_RUN_ERROR << "FunctionVoidProxy dynamic cast failed" << std::endl;
+                      ret = mtsExecutionResult::INVALID_COMMAND_ID;
+                  }
+                  break;
+              case 'v':   // blocking
+                  functionVoid = dynamic_cast<FunctionVoidProxy *>(functionBase);
+                  if (functionVoid) {
+                      eventSenderCommand = AllocateFinishedEvent(RecvHandle);
+                      if (eventSenderCommand)
+                          ret = functionVoid->ExecuteSerialized(MTS_BLOCKING, eventSenderCommand);
+                      else
+                          ret = mtsExecutionResult::NO_FINISHED_EVENT;
+                  }
+                  else {
+                      CMN_LOG_CLASS_RUN_ERROR << "FunctionVoidProxy(blocking) dynamic cast failed" << std::endl;
+                      ret = mtsExecutionResult::INVALID_COMMAND_ID;
+                  }
+                  break;
+              case 'R':
+                  functionReadProxy = dynamic_cast<FunctionReadProxy *>(functionBase);
+                  if (functionReadProxy) {
+                      eventSenderCommand = AllocateFinishedEvent(RecvHandle);
+                      if (eventSenderCommand)
+                          ret = functionReadProxy->ExecuteSerialized(outputArgString, eventSenderCommand);
+                      else
+                          ret = mtsExecutionResult::NO_FINISHED_EVENT;
+                  }
+                  else {
+                      CMN_LOG_CLASS_RUN_ERROR << "FunctionReadProxy dynamic cast failed" << std::endl;
+                      ret = mtsExecutionResult::INVALID_COMMAND_ID;
+                  }
+                  break;
+              case 'W':
+                  isBlocking = false;
+                  functionWriteProxy = dynamic_cast<FunctionWriteProxy *>(functionBase);
+                  if (functionWriteProxy)
+                      ret = functionWriteProxy->ExecuteSerialized(inputArgString, MTS_NOT_BLOCKING, 0);
+                  else {
+                      CMN_LOG_CLASS_RUN_ERROR << "FunctionWriteProxy dynamic cast failed" << std::endl;
+                      ret = mtsExecutionResult::INVALID_COMMAND_ID;
+                  }
+                  break;
+              case 'w':   // blocking
+                  functionWriteProxy = dynamic_cast<FunctionWriteProxy *>(functionBase);
+                  if (functionWriteProxy) {
+                      eventSenderCommand = AllocateFinishedEvent(RecvHandle);
+                      if (eventSenderCommand)
+                          ret = functionWriteProxy->ExecuteSerialized(inputArgString, MTS_BLOCKING, eventSenderCommand);
+                      else
+                          ret = mtsExecutionResult::NO_FINISHED_EVENT;
+                  }
+                  else {
+                      CMN_LOG_CLASS_RUN_ERROR << "FunctionWriteProxy dynamic cast failed" << std::endl;
+                      ret = mtsExecutionResult::INVALID_COMMAND_ID;
+                  }
+                  break;
+              case 'Q':
+                  functionQualifiedReadProxy = dynamic_cast<FunctionQualifiedReadProxy *>(functionBase);
+                  if (functionQualifiedReadProxy) {
+                      eventSenderCommand = AllocateFinishedEvent(RecvHandle);
+                      if (eventSenderCommand)
+                          ret = functionQualifiedReadProxy->ExecuteSerialized(inputArgString, outputArgString, eventSenderCommand);
+                      else
+                          ret = mtsExecutionResult::NO_FINISHED_EVENT;
+                  }
+                  else {
+                      CMN_LOG_CLASS_RUN_ERROR << "FunctionQualifiedReadProxy dynamic cast failed" << std::endl;
+                      ret = mtsExecutionResult::INVALID_COMMAND_ID;
+                  }
+                  break;
+              case 'r':
+                  functionVoidReturnProxy = dynamic_cast<FunctionVoidReturnProxy *>(functionBase);
+                  if (functionVoidReturnProxy) {
+                      eventSenderCommand = AllocateFinishedEvent(RecvHandle);
+                      if (eventSenderCommand)
+                          ret = functionVoidReturnProxy->ExecuteSerialized(eventSenderCommand);
+                      else
+                          ret = mtsExecutionResult::NO_FINISHED_EVENT;
+                  }
+                  else {
+                      CMN_LOG_CLASS_RUN_ERROR << "FunctionVoidReturnProxy dynamic cast failed" << std::endl;
+                      ret = mtsExecutionResult::INVALID_COMMAND_ID;
+                  }
+                  break;
+              case 'q':
+                  functionWriteReturnProxy = dynamic_cast<FunctionWriteReturnProxy *>(functionBase);
+                  if (functionWriteReturnProxy) {
+                      eventSenderCommand = AllocateFinishedEvent(RecvHandle);
+                      if (eventSenderCommand)
+                          ret = functionWriteReturnProxy->ExecuteSerialized(inputArgString, eventSenderCommand);
+                      else
+                          ret = mtsExecutionResult::NO_FINISHED_EVENT;
+                  }
+                  else {
+                      CMN_LOG_CLASS_RUN_ERROR << "FunctionWriteReturnProxy dynamic cast failed" << std::endl;
+                      ret = mtsExecutionResult::INVALID_COMMAND_ID;
+                  }
+                  break;
+            default:
+                CMN_LOG_CLASS_RUN_ERROR << "Invalid command type: " << handle.cmdType << std::endl;
             }
         }
+        catch (const std::runtime_error &e) {
+            CMN_LOG_CLASS_RUN_ERROR << "Exception while using command handle for type " << handle.cmdType
+                                    << ", addr = " << std::hex << handle.addr << ": " << e.what() << std::endl;
+            ret = mtsExecutionResult::INVALID_COMMAND_ID;
+        }
+        if (!ret.IsOK()) {
+            CMN_LOG_CLASS_RUN_WARNING << "Command type: " << handle.cmdType << ", result = " << ret << std::endl;
+        }
+    }
+    else {
+        // PK TODO: RecvHandle is not handled
+        std::string commandName;
+        if (pos != std::string::npos) {
+            commandName = inputArgString.substr(0, pos);
+            inputArgString.erase(0, pos+1);
+        }
         else {
-            // PK TODO: RecvHandle is not handled
-            std::string commandName;
-            if (pos != std::string::npos) {
-                commandName = inputArgString.substr(0, pos);
-                inputArgString.erase(0, pos+1);
-            }
-            else {
-                commandName = inputArgString;
-                inputArgString.clear();
-            }
+            commandName = inputArgString;
+            inputArgString.clear();
+        }
 
-            if (commandName == "GetInitData")
-                ret = GetInitData(outputArgString, serializer);
-            else if (inputArgString.empty()) {
-                // Void, Read, or VoidReturn
-                FunctionVoidProxy *functionVoid = FunctionVoidProxyMap.GetItem(commandName);
-                if (functionVoid)
-                    ret = functionVoid->Execute();
+        if (commandName == "GetInitData")
+            ret = GetInitData(outputArgString, serializer);
+        else if (inputArgString.empty()) {
+            // Void, Read, or VoidReturn
+            FunctionVoidProxy *functionVoid = FunctionVoidProxyMap.GetItem(commandName);
+            if (functionVoid)
+                ret = functionVoid->Execute();
+            else {
+                FunctionReadProxy *functionRead = FunctionReadProxyMap.GetItem(commandName);
+                if (functionRead) {
+                    eventSenderCommand = AllocateFinishedEvent(RecvHandle);
+                    if (eventSenderCommand)
+                        ret = functionRead->ExecuteSerialized(outputArgString, eventSenderCommand);
+                    else
+                        ret = mtsExecutionResult::NO_FINISHED_EVENT;
+                }
                 else {
-                    FunctionReadProxy *functionRead = FunctionReadProxyMap.GetItem(commandName);
-                    if (functionRead) {
+                    FunctionVoidReturnProxy *functionVoidReturn = FunctionVoidReturnProxyMap.GetItem(commandName);
+                    if (functionVoidReturn) {
                         eventSenderCommand = AllocateFinishedEvent(RecvHandle);
                         if (eventSenderCommand)
-                            ret = functionRead->ExecuteSerialized(outputArgString, eventSenderCommand);
+                            ret = functionVoidReturn->ExecuteSerialized(eventSenderCommand);
                         else
                             ret = mtsExecutionResult::NO_FINISHED_EVENT;
                     }
-                    else {
-                        FunctionVoidReturnProxy *functionVoidReturn = FunctionVoidReturnProxyMap.GetItem(commandName);
-                        if (functionVoidReturn) {
-                            eventSenderCommand = AllocateFinishedEvent(RecvHandle);
-                            if (eventSenderCommand)
-                                ret = functionVoidReturn->ExecuteSerialized(eventSenderCommand);
-                            else
-                                ret = mtsExecutionResult::NO_FINISHED_EVENT;
-                        }
-                    }
                 }
             }
+        }
+        else {
+            // Write, QualifiedRead, or WriteReturn
+            FunctionWriteProxy *functionWrite = FunctionWriteProxyMap.GetItem(commandName);
+            if (functionWrite)
+                ret = functionWrite->ExecuteSerialized(inputArgString, MTS_NOT_BLOCKING, 0);
             else {
-                // Write, QualifiedRead, or WriteReturn
-                FunctionWriteProxy *functionWrite = FunctionWriteProxyMap.GetItem(commandName);
-                if (functionWrite)
-                    ret = functionWrite->ExecuteSerialized(inputArgString, MTS_NOT_BLOCKING, 0);
+                FunctionQualifiedReadProxy *functionQualifiedRead = FunctionQualifiedReadProxyMap.GetItem(commandName);
+                if (functionQualifiedRead) {
+                    eventSenderCommand = AllocateFinishedEvent(RecvHandle);
+                    if (eventSenderCommand)
+                        ret = functionQualifiedRead->ExecuteSerialized(inputArgString, outputArgString, eventSenderCommand);
+                    else
+                        ret = mtsExecutionResult::NO_FINISHED_EVENT;
+                }
                 else {
-                    FunctionQualifiedReadProxy *functionQualifiedRead = FunctionQualifiedReadProxyMap.GetItem(commandName);
-                    if (functionQualifiedRead) {
+                    FunctionWriteReturnProxy *functionWriteReturn = FunctionWriteReturnProxyMap.GetItem(commandName);
+                    if (functionWriteReturn) {
                         eventSenderCommand = AllocateFinishedEvent(RecvHandle);
                         if (eventSenderCommand)
-                            ret = functionQualifiedRead->ExecuteSerialized(inputArgString, outputArgString, eventSenderCommand);
+                            ret = functionWriteReturn->ExecuteSerialized(inputArgString, eventSenderCommand);
                         else
                             ret = mtsExecutionResult::NO_FINISHED_EVENT;
                     }
-                    else {
-                        FunctionWriteReturnProxy *functionWriteReturn = FunctionWriteReturnProxyMap.GetItem(commandName);
-                        if (functionWriteReturn) {
-                            eventSenderCommand = AllocateFinishedEvent(RecvHandle);
-                            if (eventSenderCommand)
-                                ret = functionWriteReturn->ExecuteSerialized(inputArgString, eventSenderCommand);
-                            else
-                                ret = mtsExecutionResult::NO_FINISHED_EVENT;
-                        }
-                    }
                 }
             }
-            if (!ret.IsOK()) {
-                CMN_LOG_CLASS_RUN_WARNING << "Command: " << commandName << ", result = " << ret << std::endl;
-            }
         }
+        if (!ret.IsOK()) {
+            CMN_LOG_CLASS_RUN_WARNING << "Command: " << commandName << ", result = " << ret << std::endl;
+        }
+    }
 
-        // If this was a blocking command, but was not queued, we need to send a response now.  If it was
-        // queued, we can rely on mtsMailBox::ExeuteNext to send the response via an event.
-        if (isBlocking && (ret.Value() != mtsExecutionResult::COMMAND_QUEUED)) {
-            // If the command failed, send the execution result instead
-            if (ret.Value() != mtsExecutionResult::COMMAND_SUCCEEDED) {
-                outputArgString.clear();
-                CMN_LOG_CLASS_RUN_WARNING << "Returning failed execution result: "
-                                          << mtsExecutionResult::ToString(ret.Value()) << std::endl;
-            }
-            if (outputArgString.empty()) {
-                if (!serializer->Serialize(mtsExecutionResultProxy(ret), outputArgString)) {
-                    CMN_LOG_CLASS_RUN_ERROR << "Failed to serialize execution result for blocking command" << std::endl;
-                }
+    // If this was a blocking command, but was not queued, we need to send a response now.  If it was
+    // queued, we can rely on mtsMailBox::ExeuteNext to send the response via an event.
+    if (isBlocking && (ret.Value() != mtsExecutionResult::COMMAND_QUEUED)) {
+        // If the command failed, send the execution result instead
+        if (ret.Value() != mtsExecutionResult::COMMAND_SUCCEEDED) {
+            outputArgString.clear();
+            CMN_LOG_CLASS_RUN_WARNING << "Returning failed execution result: "
+                                      << mtsExecutionResult::ToString(ret.Value()) << std::endl;
+        }
+        if (outputArgString.empty()) {
+            if (!serializer->Serialize(mtsExecutionResultProxy(ret), outputArgString)) {
+                CMN_LOG_CLASS_RUN_ERROR << "Failed to serialize execution result for blocking command" << std::endl;
             }
-            // We won't be using the eventSender, so free it
-            if (eventSenderCommand)
-                FinishedEvents->FreeEntry(eventSenderCommand);
-            // Send a reply to the caller with the following format:
-            //    RecvHandle | outputString
-            outputArgString.insert(0, RecvHandle);
-
-            size_t nBytes = outputArgString.size();
-            // If the packet size is an exact multiple of SOCKET_PROXY_PACKET_SIZE (nBytes == 0), then we
-            // send an extra byte so that the receiver does not have to rely on a timeout to figure out
-            // when a packet stream is finished.
-            if ((nBytes%mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE) == 0)
-                outputArgString.append(" ");
-            Socket.SendAsPackets(outputArgString, mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE, 0.1);
         }
+        // We won't be using the eventSender, so free it
+        if (eventSenderCommand)
+            FinishedEvents->FreeEntry(eventSenderCommand);
+        // Send a reply to the caller with the following format:
+        //    RecvHandle | outputString
+        outputArgString.insert(0, RecvHandle);
+        Transport.Send(CurrentClient, outputArgString);
     }
 }
 
@@ -1245,7 +1256,7 @@ bool mtsSocketProxyServer::CreateServerProxy(const std::string & requiredInterfa
     for (i = 0; i < InterfaceDescription.EventsVoid.size(); ++i) {
         const mtsEventVoidDescription &evt = InterfaceDescription.EventsVoid[i];
         if (!mtsInterfaceProvided::IsSystemEventVoid(evt.Name)) {
-            mtsEventSenderVoid *eventSender = new mtsEventSenderVoid(Socket);
+            mtsEventSenderVoid *eventSender = new mtsEventSenderVoid(Transport);
             success = false;
             if (requiredInterfaceProxy->AddEventHandlerVoid(&mtsEventSenderVoid::Method, eventSender, evt.Name))
                 success = EventGeneratorVoidProxyMap.AddItem(evt.Name, eventSender);
@@ -1260,7 +1271,7 @@ bool mtsSocketProxyServer::CreateServerProxy(const std::string & requiredInterfa
     // Create EventWrite proxies
     for (i = 0; i < InterfaceDescription.EventsWrite.size(); ++i) {
         const mtsEventWriteDescription &evt = InterfaceDescription.EventsWrite[i];
-        mtsEventSenderWrite *eventSender = new mtsEventSenderWrite(Socket);
+        mtsEventSenderWrite *eventSender = new mtsEventSenderWrite(Transport);
         success = false;
         std::stringstream argStream(evt.ArgumentPrototypeSerialized);
         cmnDeSerializer deserializer(argStream);
@@ -1400,19 +1411,31 @@ mtsProxySerializer *mtsSocketProxyServer::GetSerializerForClient(const osaIPandP
 
 mtsProxySerializer *mtsSocketProxyServer::GetSerializerForCurrentClient(void) const
 {
-    // Get IP and Port
-    osaIPandPort ip_port;
-    Socket.GetDestination(ip_port);
-    return GetSerializerForClient(ip_port);
+    return GetSerializerForClient(CurrentClient);
+}
+
+void mtsSocketProxyServer::GetStatistics(mtsSocketProxyStatistics & statistics) const
+{
+    Transport.GetStatistics(statistics);
+}
+
+void mtsSocketProxyServer::CreateStatisticsInterface(void)
+{
+    // not queued, the transport protects its counters
+    mtsInterfaceProvided * interfaceProvided = AddInterfaceProvided("Statistics", MTS_COMMANDS_SHOULD_NOT_BE_QUEUED);
+    if (!interfaceProvided) {
+        CMN_LOG_CLASS_INIT_ERROR << "CreateStatisticsInterface: failed to add \"Statistics\" interface to "
+                                 << GetName() << std::endl;
+        return;
+    }
+    interfaceProvided->AddCommandRead(&mtsSocketProxyServer::GetStatistics, this, "GetStatistics");
 }
 
 mtsCommandWriteBase *mtsSocketProxyServer::AllocateFinishedEvent(const std::string &eventHandle)
 {
     CMN_ASSERT(FinishedEvents);
-    osaIPandPort ip_port;
-    Socket.GetDestination(ip_port);
-    mtsProxySerializer *serializer = GetSerializerForClient(ip_port);
-    return FinishedEvents->AllocateEntry(&Socket, ip_port, eventHandle, serializer);
+    mtsProxySerializer *serializer = GetSerializerForClient(CurrentClient);
+    return FinishedEvents->AllocateEntry(&Transport, CurrentClient, eventHandle, serializer);
 }
 
 bool mtsSocketProxyServer::GetInterfaceDescription(mtsInterfaceProvidedDescription &desc) const
@@ -1493,12 +1516,10 @@ void mtsSocketProxyServer::EventEnable(const std::string &eventHandleAndName)
     else if (handle[1] == 'W')
         eventSender = EventGeneratorWriteProxyMap.GetItem(eventName);
     if (eventSender) {
-        osaIPandPort ip_port;
-        Socket.GetDestination(ip_port);
-        mtsProxySerializer *serializer = GetSerializerForClient(ip_port);
-        if (!eventSender->AddClient(ip_port, handle, serializer)) {
+        mtsProxySerializer *serializer = GetSerializerForClient(CurrentClient);
+        if (!eventSender->AddClient(CurrentClient, handle, serializer)) {
             CMN_LOG_CLASS_RUN_ERROR << "EventEnable " << eventName << " failed for "
-                                    << ip_port.IP << ":" << ip_port.Port << std::endl;
+                                    << CurrentClient.IP << ":" << CurrentClient.Port << std::endl;
         }
     }
     else {
@@ -1518,11 +1539,9 @@ void mtsSocketProxyServer::EventDisable(const std::string &eventHandleAndName)
     else if (handle[1] == 'W')
         eventSender = EventGeneratorWriteProxyMap.GetItem(eventName);
     if (eventSender) {
-        osaIPandPort ip_port;
-        Socket.GetDestination(ip_port);
-        if (!eventSender->RemoveClient(ip_port, handle)) {
+        if (!eventSender->RemoveClient(CurrentClient, handle)) {
             CMN_LOG_CLASS_RUN_ERROR << "EventDisable " << eventName << " failed for "
-                                    << ip_port.IP << ":" << ip_port.Port << std::endl;
+                                    << CurrentClient.IP << ":" << CurrentClient.Port << std::endl;
         }
     }
     else {
@@ -44,6 +44,7 @@ mtsStateTable::mtsStateTable(size_t size, const std::string & name):
     IndexDelayed(0),
     Delay(0),
     AutomaticAdvanceFlag(true),
+    ColumnarStorageFlag(false),
     StateVector(0),
     StateVectorDataNames(0),
     Ticks(size, mtsStateIndex::TimeTicksType(0)),
@@ -107,11 +108,14 @@ bool mtsStateTable::SetSize(const size_t size){
 /* All the const methods that can be called from reader or writer */
 mtsStateIndex mtsStateTable::GetIndexReader(void) const {
     size_t tmp = IndexReader;
+    // make sure the row is read after the index, see Advance
+    std::atomic_thread_fence(std::memory_order_acquire);
     return mtsStateIndex(this->Tic, static_cast<int>(tmp), Ticks[tmp], static_cast<int>(HistoryLength));
 }
 
 mtsStateIndex mtsStateTable::GetIndexDelayed(void) const {
     size_t tmp = IndexDelayed;
+    std::atomic_thread_fence(std::memory_order_acquire);
     return mtsStateIndex(this->Tic, static_cast<int>(tmp), Ticks[tmp], static_cast<int>(HistoryLength));
 }
 
@@ -228,7 +232,10 @@ void mtsStateTable::Advance(void) {
     for (i = TicId; i < StateVector.size(); i++) {
         if (StateVectorElements[i]) {
             StateVectorElements[i]->SetTimestampIfAutomatic(Tic.Data);
-            Write(static_cast<mtsStateDataId>(i), *(StateVectorElements[i]));
+            // columnar arrays can copy the element without type checks
+            if (!(StateVector[i] && StateVector[i]->SetFromCurrent(IndexWriter))) {
+                Write(static_cast<mtsStateDataId>(i), *(StateVectorElements[i]));
+            }
         }
     }
 
@@ -305,6 +312,10 @@ void mtsStateTable::Advance(void) {
     // now increment the IndexWriter and set its Tick value
     IndexWriter = newIndexWriter;
     Ticks[IndexWriter] = Ticks[tmpIndex] + 1;
+    // make sure the row is written and the new Ticks are visible
+    // before readers see the new index and before the next row gets
+    // overwritten, see ValidateReadIndex and Accessor::BeginRead
+    std::atomic_thread_fence(std::memory_order_release);
     // move index reader to recently written data
     IndexReader = tmpIndex;
 
@@ -396,8 +407,9 @@ void mtsStateTable::Debug(std::ostream & out, unsigned int * listColumn, unsigne
         out << Ticks[i] << " ";
         for (j = 0; j < number; j++) {
             if (listColumn[j] < StateVector.size() && StateVector[listColumn[j]]) {
-                out << " [" << listColumn[j] << "] "
-                    <<(*StateVector[listColumn[j]])[i] << " : ";
+                out << " [" << listColumn[j] << "] ";
+                StateVector[listColumn[j]]->ElementToStream(i, out);
+                out << " : ";
             }
         }
         if (i == IndexReader) {
@@ -424,7 +436,8 @@ void mtsStateTable::CSVWrite(std::ostream& out, bool nonZeroOnly) {
             out << i << " " << Ticks[i] << " ";
             for (unsigned int j = 0; j < StateVector.size(); j++)  {
                 if (StateVector[j]) {
-                    out << (*StateVector[j])[i] << " ";
+                    StateVector[j]->ElementToStream(i, out);
+                    out << " ";
                 }
             }
             out << std::endl;
@@ -442,7 +455,8 @@ void mtsStateTable::CSVWrite(std::ostream& out, unsigned int *listColumn, unsign
             out << i << " " << Ticks[i] << " ";
             for (j = 0; j < number; j++) {
                 if (listColumn[j] < StateVector.size() && StateVector[listColumn[j]]) {
-                    out << (*StateVector[listColumn[j]])[i] << " ";
+                    StateVector[listColumn[j]]->ElementToStream(i, out);
+                    out << " ";
                 }
             }
             out << std::endl;
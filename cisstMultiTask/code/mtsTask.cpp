@@ -21,6 +21,7 @@
 #include <cisstOSAbstraction/osaThread.h>
 #include <cisstOSAbstraction/osaSleep.h>
 #include <cisstOSAbstraction/osaGetTime.h>
+#include <cisstOSAbstraction/osaTrace.h>
 
 #include <cisstMultiTask/mtsTask.h>
 #include <cisstMultiTask/mtsInterfaceRequired.h>
@@ -37,6 +38,7 @@ std::runtime_error mtsTask::UnknownException("Unknown mtsTask exception");
 
 void mtsTask::DoRunInternal(void)
 {
+    osaTraceScope trace("task", this->GetName());
     RunEventCalled = false;
     StateTables.ForEachVoid(&mtsStateTable::StartIfAutomatic);
     try {
@@ -21,6 +21,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstMultiTask/mtsInterfaceProvided.h>
 #include <cisstMultiTask/mtsManagerLocal.h>
 #include <cisstCommon/cmnUnits.h>
+#include <cisstOSAbstraction/osaTrace.h>
 
 
 void * mtsTaskContinuous::RunInternal(void *data)
@@ -34,6 +35,7 @@ void * mtsTaskContinuous::RunInternal(void *data)
 
     if (this->State == mtsComponentState::INITIALIZING) {
         SaveThreadStartData(data);
+        osaTrace::SetThreadName(this->GetName());
         this->StartupInternal();
         if (CaptureThread)
             return 0;
@@ -22,6 +22,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstMultiTask/mtsInterfaceProvided.h>
 #include <cisstMultiTask/mtsCommandVoid.h>
 #include <cisstMultiTask/mtsManagerComponentBase.h>
+#include <cisstOSAbstraction/osaTrace.h>
 
 
 mtsTaskFromSignal::mtsTaskFromSignal(const std::string & name,
@@ -67,6 +68,7 @@ void * mtsTaskFromSignal::RunInternal(void * CMN_UNUSED(data)) {
 
     CMN_LOG_CLASS_INIT_VERBOSE << "RunInternal: begin task " << this->GetName() << std::endl;
     if (this->State == mtsComponentState::INITIALIZING) {
+        osaTrace::SetThreadName(this->GetName());
         this->StartupInternal();
     }
 
@@ -22,6 +22,8 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstCommon/cmnUnits.h>
 #include <cisstOSAbstraction/osaThreadBuddy.h>
 #include <cisstOSAbstraction/osaSleep.h>
+#include <cisstOSAbstraction/osaTrace.h>
+#include <cisstCommon/cmnObjectPool.h>
 
 
 void * mtsTaskPeriodic::RunInternal(void *data)
@@ -35,6 +37,7 @@ void * mtsTaskPeriodic::RunInternal(void *data)
 
     if (this->State == mtsComponentState::INITIALIZING) {
         SaveThreadStartData(data);
+        osaTrace::SetThreadName(this->GetName());
         this->StartupInternal();
         if (CaptureThread) {
             return 0;
@@ -45,6 +48,11 @@ void * mtsTaskPeriodic::RunInternal(void *data)
     // changed by another thread. Specifically, if the state is changed from READY to ACTIVE in between
     // these conditions, then both will evaluate to false.
     mtsComponentState currentState = this->State;
+    if (UseDeadlines) {
+        ThreadBuddy.ResetDeadline();
+    }
+    // startup is done, report objects created on the heap from now on
+    cmnObjectPool::SetHeapAllocationCheck(CheckHeapAllocations);
     while ((currentState == mtsComponentState::ACTIVE) || (currentState == mtsComponentState::READY)) {
         if (currentState == mtsComponentState::ACTIVE) {
             DoRunInternal();
@@ -53,10 +61,15 @@ void * mtsTaskPeriodic::RunInternal(void *data)
             }
         }
         // Wait for remaining period also handles thread suspension
-        ThreadBuddy.WaitForRemainingPeriod();
+        if (UseDeadlines) {
+            WaitForDeadline(currentState == mtsComponentState::ACTIVE);
+        } else {
+            ThreadBuddy.WaitForRemainingPeriod();
+        }
         currentState = this->State;
     }
 
+    cmnObjectPool::SetHeapAllocationCheck(false);
     CMN_LOG_CLASS_RUN_VERBOSE << "RunInternal: End of task " << Name << std::endl;
     CleanupInternal();
     return this->ReturnValue;
@@ -67,6 +80,18 @@ void mtsTaskPeriodic::StartupInternal(void) {
     // user defined initialization, find commands from associated resource interfaces
     ThreadBuddy.Create(GetName().c_str(), AbsoluteTimePeriod); // convert to nano seconds
 
+    // real-time scheduling and CPU pinning for deadline scheduling
+    if (UseDeadlines) {
+        if (RealTimePriority > 0) {
+            Thread.SetPriority(RealTimePriority);
+            Thread.SetSchedulingPolicy(SCHED_FIFO);
+        }
+        if ((CPUMask != OSA_CPUANY) && (osaCPUSetAffinity(CPUMask) != OSASUCCESS)) {
+            CMN_LOG_CLASS_INIT_WARNING << "StartupInternal: failed to set CPU affinity for task \""
+                                       << Name << "\"" << std::endl;
+        }
+    }
+
     // Call base class StartupInternal, which also calls user-supplied Startup.
     // If all goes well, this changes the state to READY.
     BaseType::StartupInternal();
@@ -105,6 +130,44 @@ void mtsTaskPeriodic::StartInternal(void)
     ThreadBuddy.Resume();
 }
 
+void mtsTaskPeriodic::WaitForDeadline(const bool active)
+{
+    double latency;
+    const unsigned int missed = ThreadBuddy.WaitForDeadline(latency);
+    if (!active) {
+        return;
+    }
+    WakeUpLatency.Add(latency);
+    ExecutionTime.Add(StateTable.GetToc() - StateTable.GetTic());
+    if (missed > 0) {
+        OverranPeriod = true;
+        NumberOfOverruns += missed;
+        OverrunEvent(mtsUInt(missed));
+    }
+}
+
+void mtsTaskPeriodic::GetWakeUpLatency(mtsLatencyHistogram & histogram)
+{
+    histogram = WakeUpLatency;
+}
+
+void mtsTaskPeriodic::GetExecutionTime(mtsLatencyHistogram & histogram)
+{
+    histogram = ExecutionTime;
+}
+
+void mtsTaskPeriodic::GetNumberOfOverruns(mtsUInt & overruns)
+{
+    overruns = NumberOfOverruns;
+}
+
+void mtsTaskPeriodic::ResetTimingStatistics(void)
+{
+    WakeUpLatency.Reset();
+    ExecutionTime.Reset();
+    NumberOfOverruns = 0;
+}
+
 /********************* Task constructor and destructor *****************/
 
 mtsTaskPeriodic::mtsTaskPeriodic(const std::string & name, double periodicityInSeconds,
@@ -113,7 +176,12 @@ mtsTaskPeriodic::mtsTaskPeriodic(const std::string & name, double periodicityInS
     mtsTaskContinuous(name, sizeStateTable, newThread),
     ThreadBuddy(),
     Period(periodicityInSeconds),
-    IsHardRealTime(isHardRealTime)
+    IsHardRealTime(isHardRealTime),
+    UseDeadlines(false),
+    RealTimePriority(0),
+    CPUMask(OSA_CPUANY),
+    NumberOfOverruns(0),
+    CheckHeapAllocations(false)
 {
     AbsoluteTimePeriod.FromSeconds(periodicityInSeconds);
     CMN_ASSERT(GetPeriodicity() > 0);
@@ -128,7 +196,12 @@ mtsTaskPeriodic::mtsTaskPeriodic( const std::string & name,
     ThreadBuddy(),
     Period(period.ToSeconds()),
     AbsoluteTimePeriod(period),
-    IsHardRealTime(isHardRealTime)
+    IsHardRealTime(isHardRealTime),
+    UseDeadlines(false),
+    RealTimePriority(0),
+    CPUMask(OSA_CPUANY),
+    NumberOfOverruns(0),
+    CheckHeapAllocations(false)
 {
     CMN_ASSERT(GetPeriodicity() > 0);
 }
@@ -137,7 +210,12 @@ mtsTaskPeriodic::mtsTaskPeriodic(const mtsTaskPeriodicConstructorArg &arg):
     mtsTaskContinuous(arg.Name, arg.StateTableSize, true),
     ThreadBuddy(),
     Period(arg.Period),
-    IsHardRealTime(arg.IsHardRealTime)
+    IsHardRealTime(arg.IsHardRealTime),
+    UseDeadlines(false),
+    RealTimePriority(0),
+    CPUMask(OSA_CPUANY),
+    NumberOfOverruns(0),
+    CheckHeapAllocations(false)
 {
     AbsoluteTimePeriod.FromSeconds(arg.Period);
     CMN_ASSERT(GetPeriodicity() > 0);
@@ -168,6 +246,49 @@ void mtsTaskPeriodic::Suspend(void)
 }
 
 
+void mtsTaskPeriodic::SetHeapAllocationCheck(const bool enable)
+{
+    if (this->State != mtsComponentState::CONSTRUCTED) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetHeapAllocationCheck: task \"" << Name
+                                 << "\" has already been created" << std::endl;
+        return;
+    }
+    CheckHeapAllocations = enable;
+}
+
+void mtsTaskPeriodic::SetDeadlineScheduling(const bool enable,
+                                            const int priority,
+                                            const osaCPUMask cpuMask)
+{
+    if (this->State != mtsComponentState::CONSTRUCTED) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetDeadlineScheduling: task \"" << Name
+                                 << "\" has already been created" << std::endl;
+        return;
+    }
+    UseDeadlines = enable;
+    RealTimePriority = priority;
+    CPUMask = cpuMask;
+    if (!enable || GetInterfaceProvided("Timing")) {
+        return;
+    }
+    mtsInterfaceProvided * interfaceProvided = AddInterfaceProvided("Timing");
+    if (!interfaceProvided) {
+        CMN_LOG_CLASS_INIT_ERROR << "SetDeadlineScheduling: failed to add \"Timing\" interface to task \""
+                                 << Name << "\"" << std::endl;
+        return;
+    }
+    interfaceProvided->AddCommandVoidReturn(&mtsTaskPeriodic::GetWakeUpLatency, this,
+                                            "GetWakeUpLatency", WakeUpLatency);
+    interfaceProvided->AddCommandVoidReturn(&mtsTaskPeriodic::GetExecutionTime, this,
+                                            "GetExecutionTime", ExecutionTime);
+    interfaceProvided->AddCommandVoidReturn(&mtsTaskPeriodic::GetNumberOfOverruns, this,
+                                            "GetNumberOfOverruns", mtsUInt());
+    interfaceProvided->AddCommandVoid(&mtsTaskPeriodic::ResetTimingStatistics, this,
+                                      "ResetTimingStatistics");
+    interfaceProvided->AddEventWrite(OverrunEvent, "Overrun", mtsUInt());
+}
+
+
 double mtsTaskPeriodic::GetPeriodicity(void) const
 {
     return AbsoluteTimePeriod.ToSeconds();
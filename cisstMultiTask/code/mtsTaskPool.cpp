@@ -0,0 +1,176 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstMultiTask/mtsTaskPool.h>
+#include <cisstMultiTask/mtsTaskPooled.h>
+
+#include <cisstCommon/cmnLogger.h>
+#include <cisstOSAbstraction/osaCPUAffinity.h>
+#include <cisstOSAbstraction/osaTrace.h>
+
+#include <sstream>
+
+// pool and worker running on the current thread, if any
+static thread_local mtsTaskPool * mtsTaskPoolCurrentPool = 0;
+static thread_local size_t mtsTaskPoolCurrentWorker = 0;
+
+
+mtsTaskPool::mtsTaskPool(const std::string & name, size_t numberOfThreads):
+    Name(name),
+    NumberOfPending(0),
+    NextWorker(0),
+    Stopping(false),
+    NumberOfIdle(0),
+    NumberOfExecutions(0),
+    NumberOfSteals(0)
+{
+    if (numberOfThreads == 0) {
+        const int numberOfCPUs = osaCPUGetCount();
+        numberOfThreads = (numberOfCPUs > 2) ? static_cast<size_t>(numberOfCPUs) : 2;
+    }
+    this->Workers.resize(numberOfThreads);
+    size_t index;
+    for (index = 0; index < numberOfThreads; ++index) {
+        WorkerType * worker = new WorkerType;
+        worker->Pool = this;
+        worker->Index = index;
+        this->Workers[index] = worker;
+    }
+    // start threads once all queues exist since workers steal from each other
+    for (index = 0; index < numberOfThreads; ++index) {
+        std::stringstream threadName;
+        threadName << "P" << index;
+        this->Workers[index]->Thread.Create<WorkerType, void *>(this->Workers[index], &WorkerType::Run, 0,
+                                                                threadName.str().c_str());
+    }
+    CMN_LOG_INIT_VERBOSE << "mtsTaskPool: started pool \"" << name << "\" with "
+                         << numberOfThreads << " threads" << std::endl;
+}
+
+
+mtsTaskPool::~mtsTaskPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(this->IdleMutex);
+        this->Stopping.store(true);
+        this->IdleCondition.notify_all();
+    }
+    size_t index;
+    for (index = 0; index < this->Workers.size(); ++index) {
+        this->Workers[index]->Thread.Wait();
+    }
+    if (this->NumberOfPending.load() != 0) {
+        CMN_LOG_INIT_WARNING << "mtsTaskPool: pool \"" << this->Name << "\" stopped with "
+                             << this->NumberOfPending.load() << " task(s) still scheduled" << std::endl;
+    }
+    for (index = 0; index < this->Workers.size(); ++index) {
+        delete this->Workers[index];
+    }
+    this->Workers.clear();
+}
+
+
+mtsTaskPool * mtsTaskPool::GetDefault(void)
+{
+    static mtsTaskPool defaultPool("Default");
+    return &defaultPool;
+}
+
+
+void mtsTaskPool::Push(mtsTaskPooled * task)
+{
+    WorkerType * worker;
+    if (mtsTaskPoolCurrentPool == this) {
+        worker = this->Workers[mtsTaskPoolCurrentWorker];
+    } else {
+        const size_t index = this->NextWorker.fetch_add(1, std::memory_order_relaxed) % this->Workers.size();
+        worker = this->Workers[index];
+    }
+    {
+        std::lock_guard<std::mutex> lock(worker->Mutex);
+        worker->Queue.push_back(task);
+    }
+    // sequentially consistent operations, see idle check in WorkerType::Run
+    this->NumberOfPending.fetch_add(1);
+    if (this->NumberOfIdle.load() > 0) {
+        std::lock_guard<std::mutex> lock(this->IdleMutex);
+        this->IdleCondition.notify_one();
+    }
+}
+
+
+mtsTaskPooled * mtsTaskPool::Pop(WorkerType * worker)
+{
+    mtsTaskPooled * task = 0;
+    {
+        std::lock_guard<std::mutex> lock(worker->Mutex);
+        if (!worker->Queue.empty()) {
+            task = worker->Queue.front();
+            worker->Queue.pop_front();
+        }
+    }
+    // steal from the back of other queues
+    const size_t numberOfWorkers = this->Workers.size();
+    for (size_t offset = 1; !task && (offset < numberOfWorkers); ++offset) {
+        WorkerType * victim = this->Workers[(worker->Index + offset) % numberOfWorkers];
+        std::lock_guard<std::mutex> lock(victim->Mutex);
+        if (!victim->Queue.empty()) {
+            task = victim->Queue.back();
+            victim->Queue.pop_back();
+            this->NumberOfSteals.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    if (task) {
+        this->NumberOfPending.fetch_sub(1);
+    }
+    return task;
+}
+
+
+void * mtsTaskPool::WorkerType::Run(void * CMN_UNUSED(argument))
+{
+    mtsTaskPoolCurrentPool = this->Pool;
+    mtsTaskPoolCurrentWorker = this->Index;
+    std::stringstream threadName;
+    threadName << this->Pool->GetName() << "[" << this->Index << "]";
+    osaTrace::SetThreadName(threadName.str());
+    while (true) {
+        mtsTaskPooled * task = this->Pool->Pop(this);
+        if (task) {
+            task->Execute();
+            this->Pool->NumberOfExecutions.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        // nothing to do, sleep until a task is pushed.  The idle count
+        // is incremented before checking the pending count while Push
+        // does the opposite so at least one of them sees the other.
+        std::unique_lock<std::mutex> lock(this->Pool->IdleMutex);
+        if (this->Pool->Stopping.load()) {
+            break;
+        }
+        this->Pool->NumberOfIdle.fetch_add(1);
+        if (this->Pool->NumberOfPending.load() == 0) {
+            this->Pool->IdleCondition.wait(lock);
+        }
+        this->Pool->NumberOfIdle.fetch_sub(1);
+    }
+    mtsTaskPoolCurrentPool = 0;
+    return 0;
+}
@@ -0,0 +1,258 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstMultiTask/mtsTaskPooled.h>
+#include <cisstMultiTask/mtsInterfaceRequired.h>
+#include <cisstMultiTask/mtsInterfaceProvided.h>
+#include <cisstMultiTask/mtsCallableVoidMethod.h>
+#include <cisstMultiTask/mtsManagerComponentBase.h>
+#include <cisstOSAbstraction/osaSleep.h>
+
+
+mtsTaskPooled::mtsTaskPooled(const std::string & name,
+                             unsigned int sizeStateTable,
+                             mtsTaskPool * pool):
+    mtsTask(name, sizeStateTable),
+    Pool(pool),
+    ScheduleState(SCHEDULE_IDLE),
+    PostCommandQueuedCallable(0),
+    ManagerCommandQueuedCallable(0)
+{
+    this->Init();
+}
+
+
+mtsTaskPooled::mtsTaskPooled(const mtsTaskConstructorArg & arg):
+    mtsTask(arg.Name, arg.StateTableSize),
+    Pool(0),
+    ScheduleState(SCHEDULE_IDLE),
+    PostCommandQueuedCallable(0),
+    ManagerCommandQueuedCallable(0)
+{
+    this->Init();
+}
+
+
+void mtsTaskPooled::Init(void)
+{
+    if (!this->Pool) {
+        this->Pool = mtsTaskPool::GetDefault();
+    }
+    this->PostCommandQueuedCallable = new mtsCallableVoidMethod<mtsTaskPooled>(&mtsTaskPooled::PostCommandQueuedMethod,
+                                                                               this);
+    this->ManagerCommandQueuedCallable = new mtsCallableVoidMethod<mtsTaskPooled>(&mtsTaskPooled::ManagerCommandQueuedMethod,
+                                                                                  this);
+}
+
+
+mtsTaskPooled::~mtsTaskPooled()
+{
+    CMN_LOG_CLASS_INIT_VERBOSE << "Deleting task " << this->GetName() << ", current state = " << this->State << std::endl;
+    if (!this->IsTerminated()) {
+        Kill();
+        WaitToTerminate(1.0 * cmn_s);
+    }
+    // make sure no worker is using nor will use this task.  The
+    // callables are not deleted since mailboxes still refer to them,
+    // once detached they don't do anything.
+    int expected = SCHEDULE_IDLE;
+    while (!this->ScheduleState.compare_exchange_weak(expected, SCHEDULE_DETACHED)) {
+        if (expected == SCHEDULE_DETACHED) {
+            break;
+        }
+        expected = SCHEDULE_IDLE;
+        osaSleep(1.0 * cmn_ms);
+    }
+}
+
+
+void mtsTaskPooled::Schedule(void)
+{
+    int current = this->ScheduleState.load();
+    while (true) {
+        if (current == SCHEDULE_IDLE) {
+            if (this->ScheduleState.compare_exchange_weak(current, SCHEDULE_QUEUED)) {
+                this->Pool->Push(this);
+                return;
+            }
+        } else if (current == SCHEDULE_RUNNING) {
+            // worker will queue the task again once done
+            if (this->ScheduleState.compare_exchange_weak(current, SCHEDULE_RUNNING_AND_REQUESTED)) {
+                return;
+            }
+        } else {
+            // already queued, requested or detached
+            return;
+        }
+    }
+}
+
+
+void mtsTaskPooled::Execute(void)
+{
+    // only the worker which popped the task can change the queued state
+    this->ScheduleState.store(SCHEDULE_RUNNING);
+    this->RunInternal(0);
+    int expected = SCHEDULE_RUNNING;
+    if (!this->ScheduleState.compare_exchange_strong(expected, SCHEDULE_IDLE)) {
+        // scheduled while running
+        this->ScheduleState.store(SCHEDULE_QUEUED);
+        this->Pool->Push(this);
+    }
+    // task might have been deleted by now if state was set to idle
+}
+
+
+void * mtsTaskPooled::RunInternal(void * CMN_UNUSED(data))
+{
+    // use a local variable since state can be changed by another thread
+    const mtsComponentState currentState = this->State;
+    if (currentState == mtsComponentState::INITIALIZING) {
+        this->StartupInternal();
+    } else if (currentState == mtsComponentState::ACTIVE) {
+        this->DoRunInternal();
+    } else if (currentState == mtsComponentState::FINISHING) {
+        CMN_LOG_CLASS_INIT_VERBOSE << "RunInternal: end of task \"" << this->GetName() << "\"" << std::endl;
+        this->CleanupInternal();
+    }
+    return 0;
+}
+
+
+void mtsTaskPooled::PostCommandQueuedMethod(void)
+{
+    this->Schedule();
+}
+
+
+void mtsTaskPooled::ManagerCommandQueuedMethod(void)
+{
+    this->ProcessManagerCommandsIfNotActive();
+    this->Schedule();
+}
+
+
+void mtsTaskPooled::Create(void * CMN_UNUSED(data))
+{
+    if (this->State != mtsComponentState::CONSTRUCTED) {
+        CMN_LOG_CLASS_INIT_VERBOSE << "Create: task " << this->GetName() << " cannot be created, state = "
+                                   << this->State << std::endl;
+        return;
+    }
+    // pooled tasks can't receive their thread from another component
+    RemoveInterfaceRequired("ExecIn", true);
+    ExecIn = 0;
+    CMN_LOG_CLASS_INIT_VERBOSE << "Create: using pool \"" << this->Pool->GetName()
+                               << "\" for task " << this->GetName() << std::endl;
+    ChangeState(mtsComponentState::INITIALIZING);
+    this->Schedule();
+}
+
+
+void mtsTaskPooled::Start(void)
+{
+    if (this->State == mtsComponentState::INITIALIZING) {
+        WaitToStart(this->InitializationDelay);
+    }
+
+    if (this->State == mtsComponentState::READY) {
+        CMN_LOG_CLASS_INIT_VERBOSE << "Start: starting task " << this->GetName() << std::endl;
+        ChangeState(mtsComponentState::ACTIVE);
+        // run once to process commands queued before start
+        this->Schedule();
+    } else if (this->State == mtsComponentState::ACTIVE) {
+        // NOP if task is already running
+        return;
+    } else {
+        CMN_LOG_CLASS_INIT_ERROR << "Start: could not start task " << this->GetName()
+                                 << ", state = " << this->State << std::endl;
+    }
+}
+
+
+void mtsTaskPooled::Suspend(void)
+{
+    if (this->State == mtsComponentState::ACTIVE) {
+        CMN_LOG_CLASS_RUN_VERBOSE << "Suspend: suspending task " << this->GetName() << std::endl;
+        ChangeState(mtsComponentState::READY);
+    }
+}
+
+
+void mtsTaskPooled::Kill(void)
+{
+    CMN_LOG_CLASS_INIT_VERBOSE << "Kill: task \"" << this->GetName() << "\", current state \"" << this->State << "\"" << std::endl;
+    mtsTask::Kill();
+    // a worker needs to call CleanupInternal
+    this->Schedule();
+}
+
+
+void mtsTaskPooled::Wakeup(void)
+{
+    this->Schedule();
+}
+
+
+mtsInterfaceRequired * mtsTaskPooled::AddInterfaceRequiredWithoutSystemEventHandlers(const std::string & interfaceRequiredName,
+                                                                                     mtsRequiredType required)
+{
+    // create a mailbox with post command queued command
+    mtsMailBox * mailBox = new mtsMailBox(interfaceRequiredName + "Events",
+                                          mtsInterfaceRequired::DEFAULT_MAIL_BOX_AND_ARGUMENT_QUEUES_SIZE,
+                                          this->PostCommandQueuedCallable);
+    mtsInterfaceRequired * result;
+    result = this->AddInterfaceRequiredUsingMailbox(interfaceRequiredName, mailBox, required);
+    if (!result) {
+        delete mailBox;
+    }
+    return result;
+}
+
+
+mtsInterfaceProvided * mtsTaskPooled::AddInterfaceProvidedWithoutSystemEvents(const std::string & interfaceProvidedName,
+                                                                              mtsInterfaceQueueingPolicy queueingPolicy,
+                                                                              bool isProxy)
+{
+    mtsInterfaceProvided * interfaceProvided;
+    if ((queueingPolicy == MTS_COMPONENT_POLICY)
+        || (queueingPolicy == MTS_COMMANDS_SHOULD_BE_QUEUED)) {
+        mtsCallableVoidBase * postCommandQueuedCallable = this->PostCommandQueuedCallable;
+        // see mtsTaskFromSignal, manager commands are processed right away if the task is not active
+        if (interfaceProvidedName == mtsManagerComponentBase::GetNameOfInterfaceInternalProvided()) {
+            postCommandQueuedCallable = this->ManagerCommandQueuedCallable;
+        }
+        interfaceProvided = new mtsInterfaceProvided(interfaceProvidedName, this, MTS_COMMANDS_SHOULD_BE_QUEUED, postCommandQueuedCallable, isProxy);
+    } else {
+        CMN_LOG_CLASS_INIT_WARNING << "AddInterfaceProvided: adding provided interface \"" << interfaceProvidedName
+                                   << "\" with policy MTS_COMMANDS_SHOULD_NOT_BE_QUEUED to task \""
+                                   << this->GetName() << "\". This bypasses built-in thread safety mechanisms, make sure your commands are thread safe.  "
+                                   << "Furthermore, the task will not be scheduled since the post queued command will not be executed. "
+                                   << std::endl;
+        interfaceProvided = new mtsInterfaceProvided(interfaceProvidedName, this, MTS_COMMANDS_SHOULD_NOT_BE_QUEUED, 0, isProxy);
+    }
+    if (InterfacesProvided.AddItem(interfaceProvidedName, interfaceProvided)) {
+        return interfaceProvided;
+    }
+    CMN_LOG_CLASS_INIT_ERROR << "AddInterfaceProvided: task \"" << this->GetName() << "\" unable to add interface \""
+                             << interfaceProvidedName << "\"" << std::endl;
+    delete interfaceProvided;
+    return 0;
+}
@@ -0,0 +1,178 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+/*
+  Sustained throughput benchmark for mtsCollectorState.  A periodic
+  task fills its state table at a given rate and a state collector
+  saves all rows in a CSV file, either directly from the collector
+  thread or using the asynchronous writer (option -a).  Once the
+  collection is over, the file is read back to count the rows actually
+  saved.  Rows missing from the file have either been dropped by the
+  asynchronous writer or lost because the collector was too slow to
+  read the state table before it wrapped around.
+
+  To see the difference between both modes, use a slow output
+  directory (network drive, SD card...) using option -o.
+*/
+
+#include <cisstCommon/cmnUnits.h>
+#include <cisstCommon/cmnPath.h>
+#include <cisstCommon/cmnCommandLineOptions.h>
+#include <cisstOSAbstraction/osaSleep.h>
+#include <cisstOSAbstraction/osaStopwatch.h>
+#include <cisstMultiTask/mtsTaskPeriodic.h>
+#include <cisstMultiTask/mtsManagerLocal.h>
+#include <cisstMultiTask/mtsCollectorState.h>
+#include <cisstMultiTask/mtsVector.h>
+
+#include <iostream>
+#include <fstream>
+
+class SourceTask: public mtsTaskPeriodic
+{
+public:
+    mtsDoubleVec Vector;
+    mtsDouble Scalar;
+    unsigned long long NumberOfRuns;
+
+    SourceTask(double period, size_t historyLength, size_t vectorSize):
+        mtsTaskPeriodic("Source", period, false, historyLength),
+        NumberOfRuns(0)
+    {
+        Vector.SetSize(vectorSize);
+        Vector.SetAll(0.0);
+        StateTable.AddData(Vector, "Vector");
+        StateTable.AddData(Scalar, "Scalar");
+    }
+
+    void Configure(const std::string & CMN_UNUSED(filename)) {}
+    void Startup(void) {}
+    void Cleanup(void) {}
+
+    void Run(void) {
+        ProcessQueuedCommands();
+        NumberOfRuns++;
+        Scalar = static_cast<double>(NumberOfRuns);
+        Vector.Add(1.0);
+    }
+};
+
+int main(int argc, char ** argv)
+{
+    cmnLogger::SetMask(CMN_LOG_ALLOW_ALL);
+    cmnLogger::AddChannel(std::cout, CMN_LOG_ALLOW_ERRORS_AND_WARNINGS);
+
+    double periodInMs = 0.1;
+    double duration = 5.0;
+    int historyLength = 2000;
+    int vectorSize = 32;
+    int bufferSize = 1024 * 1024;
+    std::string directory = cmnPath::GetWorkingDirectory();
+
+    cmnCommandLineOptions options;
+    options.AddOptionOneValue("p", "period",
+                              "source period in milliseconds (default 0.1)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &periodInMs);
+    options.AddOptionOneValue("d", "duration",
+                              "collection duration in seconds (default 5)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &duration);
+    options.AddOptionOneValue("l", "history",
+                              "state table history length (default 2000)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &historyLength);
+    options.AddOptionOneValue("n", "vector-size",
+                              "number of elements in the collected vector (default 32)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &vectorSize);
+    options.AddOptionNoValue("a", "async",
+                             "use the collector's asynchronous writer");
+    options.AddOptionOneValue("b", "buffer",
+                              "asynchronous writer buffer size in bytes (default 1048576)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &bufferSize);
+    options.AddOptionOneValue("o", "output",
+                              "output directory (default current directory)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &directory);
+    if (!options.Parse(argc, argv, std::cerr)) {
+        return -1;
+    }
+    const bool async = options.IsSet("async");
+
+    mtsManagerLocal * manager = mtsManagerLocal::GetInstance();
+
+    SourceTask * source = new SourceTask(periodInMs * cmn_ms, historyLength, vectorSize);
+    manager->AddComponent(source);
+
+    const std::string fileName = directory + cmnPath::DirectorySeparator() + "collectorThroughput.csv";
+    mtsCollectorState * collector = new mtsCollectorState("Collector");
+    collector->SetStateTable("Source", "StateTable");
+    collector->SetOutput(fileName, mtsCollectorBase::COLLECTOR_FILE_FORMAT_CSV);
+    collector->SetAsynchronousWriter(async, bufferSize);
+    collector->AddSignal("Vector");
+    collector->AddSignal("Scalar");
+    manager->AddComponent(collector);
+    collector->Connect();
+
+    manager->CreateAll();
+    manager->WaitForStateAll(mtsComponentState::READY);
+    manager->StartAll();
+    manager->WaitForStateAll(mtsComponentState::ACTIVE);
+
+    std::cout << "Collecting " << vectorSize + 1 << " signals at " << 1.0 / periodInMs
+              << " kHz for " << duration << " s using "
+              << (async ? "asynchronous writer" : "collector thread") << std::endl;
+
+    osaStopwatch stopwatch;
+    const unsigned long long firstRun = source->NumberOfRuns;
+    stopwatch.Start();
+    collector->StartCollection(0.0);
+    osaSleep(duration);
+    collector->StopCollection(0.0);
+    const unsigned long long lastRun = source->NumberOfRuns;
+    stopwatch.Stop();
+    osaSleep(0.5 * cmn_s); // let the collector process the last batch
+
+    mtsUInt dropped, overflows;
+    collector->GetNumberOfDroppedSamples(dropped);
+    collector->GetNumberOfOverflows(overflows);
+
+    manager->KillAll();
+    manager->WaitForStateAll(mtsComponentState::FINISHED, 2.0 * cmn_s);
+    collector->CloseOutput();
+
+    // count rows saved
+    std::ifstream input(fileName.c_str());
+    std::string line;
+    unsigned long long saved = 0;
+    while (std::getline(input, line)) {
+        if (!line.empty() && (line[0] != '#')) {
+            saved++;
+        }
+    }
+
+    const double elapsed = stopwatch.GetElapsedTime();
+    const unsigned long long produced = lastRun - firstRun;
+    std::cout << "Rows produced         : " << produced
+              << " (" << produced / elapsed << " rows/s)" << std::endl
+              << "Rows saved            : " << saved << std::endl
+              << "Rows dropped by writer: " << dropped.Data
+              << " in " << overflows.Data << " overflow(s)" << std::endl
+              << "Sustained throughput  : " << saved / elapsed << " samples/s" << std::endl;
+
+    manager->Cleanup();
+    return 0;
+}
@@ -0,0 +1,139 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+/*
+  Benchmark for events sent to many queued observers.  A vector
+  payload is sent using a multicast command to queued write commands,
+  as done for events between components, then all mailboxes are
+  emptied.  This compares arguments copied for each observer with
+  arguments shared by all observers.
+*/
+
+#include <cisstCommon/cmnUnits.h>
+#include <cisstCommon/cmnCommandLineOptions.h>
+#include <cisstOSAbstraction/osaStopwatch.h>
+#include <cisstMultiTask/mtsVector.h>
+#include <cisstMultiTask/mtsMailBox.h>
+#include <cisstMultiTask/mtsCommandWrite.h>
+#include <cisstMultiTask/mtsCommandQueuedWrite.h>
+#include <cisstMultiTask/mtsMulticastCommandWrite.h>
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+class Observer {
+public:
+    double Sum;
+    Observer(void): Sum(0.0) {}
+    void Handler(const mtsDoubleVec & payload) {
+        Sum += payload[0];
+    }
+};
+
+void Benchmark(bool useShared, size_t numberOfObservers, size_t payloadSize, size_t numberOfEvents)
+{
+    typedef mtsCommandWrite<Observer, mtsDoubleVec> CommandType;
+    const size_t queueSize = 64;
+    mtsDoubleVec payload(payloadSize);
+    payload.SetAll(1.0);
+    mtsMulticastCommandWriteGeneric multicast("Event", payload);
+    multicast.SetUseSharedArguments(useShared);
+
+    std::vector<Observer> observers(numberOfObservers);
+    std::vector<mtsMailBox *> mailBoxes(numberOfObservers);
+    std::vector<CommandType *> commands(numberOfObservers);
+    std::vector<mtsCommandQueuedWriteGeneric *> queuedCommands(numberOfObservers);
+    size_t index;
+    for (index = 0; index < numberOfObservers; ++index) {
+        std::stringstream name;
+        name << "MailBox" << index;
+        mailBoxes[index] = new mtsMailBox(name.str(), queueSize);
+        commands[index] = new CommandType(&Observer::Handler, &(observers[index]), "Event", payload);
+        queuedCommands[index] = new mtsCommandQueuedWriteGeneric(mailBoxes[index], commands[index], queueSize);
+        multicast.AddCommand(queuedCommands[index]);
+    }
+
+    // send a few events before emptying the mailboxes, as a component running at a lower rate would
+    const size_t eventsPerBatch = queueSize / 2;
+    osaStopwatch stopwatch;
+    stopwatch.Start();
+    size_t event = 0;
+    while (event < numberOfEvents) {
+        size_t batch;
+        for (batch = 0; (batch < eventsPerBatch) && (event < numberOfEvents); ++batch, ++event) {
+            payload[0] = static_cast<double>(event);
+            multicast.Execute(payload, MTS_NOT_BLOCKING);
+        }
+        for (index = 0; index < numberOfObservers; ++index) {
+            while (mailBoxes[index]->ExecuteNext()) {}
+        }
+    }
+    stopwatch.Stop();
+
+    // argument copies made by the multicast command or the queued commands
+    const unsigned long long copies =
+        useShared ? multicast.GetSharedArguments().GetNumberOfCopies() : numberOfEvents * numberOfObservers;
+    const double elapsed = stopwatch.GetElapsedTime();
+    const double expected = static_cast<double>(numberOfEvents) * static_cast<double>(numberOfEvents - 1) / 2.0;
+    std::cout << (useShared ? "shared" : "copied") << ": "
+              << numberOfEvents << " events to " << numberOfObservers << " observers in "
+              << elapsed / cmn_ms << " ms, " << elapsed / numberOfEvents * 1.0e6 << " us/event, "
+              << copies << " copies ("
+              << static_cast<double>(copies * payloadSize * sizeof(double)) / (1024.0 * 1024.0) << " MiB), "
+              << multicast.GetSharedArguments().GetSize() << " shared arguments allocated"
+              << ((observers[0].Sum == expected) ? "" : " (ERROR: events lost)") << std::endl;
+
+    for (index = 0; index < numberOfObservers; ++index) {
+        multicast.RemoveCommand(queuedCommands[index]);
+        delete queuedCommands[index];
+        delete commands[index];
+        delete mailBoxes[index];
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    cmnLogger::SetMask(CMN_LOG_ALLOW_ALL);
+    cmnLogger::AddChannel(std::cout, CMN_LOG_ALLOW_ERRORS_AND_WARNINGS);
+
+    int numberOfObservers = 10;
+    int payloadSize = 100;
+    int numberOfEvents = 100000;
+
+    cmnCommandLineOptions options;
+    options.AddOptionOneValue("o", "observers",
+                              "number of observers (default 10)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &numberOfObservers);
+    options.AddOptionOneValue("s", "size",
+                              "number of doubles in payload (default 100)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &payloadSize);
+    options.AddOptionOneValue("n", "number",
+                              "number of events (default 100000)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &numberOfEvents);
+    if (!options.Parse(argc, argv, std::cerr)) {
+        return -1;
+    }
+
+    Benchmark(false, numberOfObservers, payloadSize, numberOfEvents);
+    Benchmark(true, numberOfObservers, payloadSize, numberOfEvents);
+
+    return 0;
+}
@@ -0,0 +1,198 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+/*
+  Throughput benchmark for single producer/single consumer queues.  A
+  writer thread pushes a sequence of integers as fast as possible
+  while the main thread reads them back.  This compares mtsQueue,
+  mtsQueueAtomic with one element at a time and mtsQueueAtomic using
+  PutN/GetN batches.
+*/
+
+#include <cisstCommon/cmnUnits.h>
+#include <cisstCommon/cmnCommandLineOptions.h>
+#include <cisstOSAbstraction/osaThread.h>
+#include <cisstOSAbstraction/osaStopwatch.h>
+#include <cisstMultiTask/mtsQueue.h>
+#include <cisstMultiTask/mtsQueueAtomic.h>
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+typedef size_t ElementType;
+
+// writer for queues with Put only
+template <class _queueType>
+class SingleWriter {
+public:
+    _queueType * Queue;
+    size_t NumberOfElements;
+    void * Run(size_t CMN_UNUSED(unused)) {
+        for (ElementType value = 0; value < NumberOfElements; ++value) {
+            while (!Queue->Put(value)) {
+                osaCurrentThreadYield(); // queue is full
+            }
+        }
+        return 0;
+    }
+};
+
+// writer using PutN
+class BatchWriter {
+public:
+    mtsQueueAtomic<ElementType> * Queue;
+    size_t NumberOfElements;
+    size_t BatchSize;
+    void * Run(size_t CMN_UNUSED(unused)) {
+        std::vector<ElementType> batch(BatchSize);
+        ElementType value = 0;
+        while (value < NumberOfElements) {
+            size_t count = 0;
+            while ((count < BatchSize) && (value + count < NumberOfElements)) {
+                batch[count] = value + count;
+                count++;
+            }
+            size_t done = 0;
+            while (done < count) {
+                const size_t put = Queue->PutN(&(batch[done]), count - done);
+                if (put == 0) {
+                    osaCurrentThreadYield(); // queue is full
+                }
+                done += put;
+            }
+            value += count;
+        }
+        return 0;
+    }
+};
+
+template <class _queueType>
+bool ReadAll(_queueType & queue, size_t numberOfElements)
+{
+    ElementType expected = 0;
+    ElementType * element;
+    while (expected < numberOfElements) {
+        element = queue.Peek();
+        if (element) {
+            if (*element != expected) {
+                return false;
+            }
+            queue.Get();
+            expected++;
+        } else {
+            osaCurrentThreadYield(); // queue is empty
+        }
+    }
+    return true;
+}
+
+bool ReadAllBatch(mtsQueueAtomic<ElementType> & queue, size_t numberOfElements, size_t batchSize)
+{
+    std::vector<ElementType> batch(batchSize);
+    ElementType expected = 0;
+    while (expected < numberOfElements) {
+        const size_t count = queue.GetN(&(batch[0]), batchSize);
+        if (count == 0) {
+            osaCurrentThreadYield(); // queue is empty
+        }
+        for (size_t index = 0; index < count; ++index) {
+            if (batch[index] != expected) {
+                return false;
+            }
+            expected++;
+        }
+    }
+    return true;
+}
+
+void Report(const std::string & name, size_t numberOfElements, double elapsed, bool valid)
+{
+    std::cout << name << ": " << numberOfElements << " elements in "
+              << elapsed / cmn_ms << " ms, "
+              << static_cast<double>(numberOfElements) / elapsed / 1.0e6 << " M elements/s"
+              << (valid ? "" : " (ERROR: elements out of order)") << std::endl;
+}
+
+template <class _queueType>
+void BenchmarkSingle(const std::string & name, size_t queueSize, size_t numberOfElements)
+{
+    _queueType queue(queueSize, 0);
+    SingleWriter<_queueType> writer;
+    writer.Queue = &queue;
+    writer.NumberOfElements = numberOfElements;
+    osaStopwatch stopwatch;
+    osaThread thread;
+    stopwatch.Start();
+    thread.Create<SingleWriter<_queueType>, size_t>(&writer, &SingleWriter<_queueType>::Run, 0);
+    const bool valid = ReadAll(queue, numberOfElements);
+    thread.Wait();
+    stopwatch.Stop();
+    Report(name, numberOfElements, stopwatch.GetElapsedTime(), valid);
+}
+
+void BenchmarkBatch(size_t queueSize, size_t numberOfElements, size_t batchSize)
+{
+    mtsQueueAtomic<ElementType> queue(queueSize, 0);
+    BatchWriter writer;
+    writer.Queue = &queue;
+    writer.NumberOfElements = numberOfElements;
+    writer.BatchSize = batchSize;
+    osaStopwatch stopwatch;
+    osaThread thread;
+    stopwatch.Start();
+    thread.Create<BatchWriter, size_t>(&writer, &BatchWriter::Run, 0);
+    const bool valid = ReadAllBatch(queue, numberOfElements, batchSize);
+    thread.Wait();
+    stopwatch.Stop();
+    std::stringstream name;
+    name << "mtsQueueAtomic PutN/GetN (" << batchSize << ")";
+    Report(name.str(), numberOfElements, stopwatch.GetElapsedTime(), valid);
+}
+
+int main(int argc, char ** argv)
+{
+    cmnLogger::SetMask(CMN_LOG_ALLOW_ALL);
+    cmnLogger::AddChannel(std::cout, CMN_LOG_ALLOW_ERRORS_AND_WARNINGS);
+
+    int queueSize = 256;
+    int numberOfElements = 10000000;
+    int batchSize = 32;
+
+    cmnCommandLineOptions options;
+    options.AddOptionOneValue("s", "size",
+                              "queue size (default 256)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &queueSize);
+    options.AddOptionOneValue("n", "number",
+                              "number of elements to transfer (default 10000000)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &numberOfElements);
+    options.AddOptionOneValue("b", "batch",
+                              "batch size for PutN/GetN (default 32)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &batchSize);
+    if (!options.Parse(argc, argv, std::cerr)) {
+        return -1;
+    }
+
+    BenchmarkSingle<mtsQueue<ElementType> >("mtsQueue", queueSize, numberOfElements);
+    BenchmarkSingle<mtsQueueAtomic<ElementType> >("mtsQueueAtomic", queueSize, numberOfElements);
+    BenchmarkBatch(queueSize, numberOfElements, batchSize);
+
+    return 0;
+}
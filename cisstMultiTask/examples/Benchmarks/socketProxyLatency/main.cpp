@@ -0,0 +1,175 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+/*
+  Benchmark for the round trip latency between a socket proxy client
+  and server running in two processes on the same host.  The client
+  sends requests using the CommandHandle protocol (command handle
+  followed by the event receiver handle) and the server process
+  replies with a payload of the given size, as it would for a read
+  command.  This compares UDP sockets with shared memory sockets.
+*/
+
+#include <cisstCommon/cmnUnits.h>
+#include <cisstCommon/cmnCommandLineOptions.h>
+#include <cisstOSAbstraction/osaSleep.h>
+#include <cisstOSAbstraction/osaSocket.h>
+#include <cisstOSAbstraction/osaStopwatch.h>
+#include <cisstOSAbstraction/osaSharedMemoryQueue.h>
+#include <cisstMultiTask/mtsSocketProxyCommon.h>
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if (CISST_OS != CISST_WINDOWS)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// first byte of the request sent to stop the server process
+const char QuitRequest = 'X';
+
+// reply to all requests until asked to quit or nothing is received for a while
+void Server(osaSocket::SocketTypes type, unsigned short port, size_t replySize)
+{
+    osaSocket socket(type);
+    if (!socket.AssignPort(port)) {
+        return;
+    }
+    std::vector<char> reply(replySize, 'r');
+    char request[mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE];
+    while (true) {
+        int bytesRead = socket.Receive(request, sizeof(request), 5.0 * cmn_s);
+        if ((bytesRead <= 0) || (request[0] == QuitRequest)) {
+            break;
+        }
+        socket.SendAsPackets(&(reply[0]), static_cast<unsigned int>(reply.size()),
+                             mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE, 0.05);
+    }
+    socket.Close();
+}
+
+void Client(const std::string & name, osaSocket::SocketTypes type, unsigned short port,
+            size_t replySize, size_t numberOfRoundTrips)
+{
+    osaSocket socket(type);
+    socket.SetDestination("127.0.0.1", port);
+
+    // command handle followed by event receiver handle, as for a read command
+    int dummy;
+    char request[2 * CommandHandle::COMMAND_HANDLE_STRING_SIZE];
+    CommandHandle('R', &dummy).ToString(request);
+    CommandHandle('W', &dummy).ToString(request + CommandHandle::COMMAND_HANDLE_STRING_SIZE);
+
+    std::string reply;
+    char packetBuffer[mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE];
+
+    // wait for the server process to be ready
+    bool ready = false;
+    for (size_t attempt = 0; !ready && (attempt < 100); ++attempt) {
+        if (socket.Send(request, sizeof(request)) > 0) {
+            ready = (socket.ReceiveAsPackets(reply, packetBuffer, sizeof(packetBuffer), 0.1, 0.1) > 0);
+        } else {
+            osaSleep(10.0 * cmn_ms);
+        }
+    }
+    if (!ready) {
+        std::cout << name << ": server not responding" << std::endl;
+        return;
+    }
+
+    std::vector<double> latencies(numberOfRoundTrips);
+    size_t lost = 0;
+    osaStopwatch total, roundTrip;
+    total.Start();
+    for (size_t index = 0; index < numberOfRoundTrips; ++index) {
+        roundTrip.Reset();
+        roundTrip.Start();
+        socket.Send(request, sizeof(request));
+        const int bytesRead = socket.ReceiveAsPackets(reply, packetBuffer, sizeof(packetBuffer), 1.0, 0.1);
+        roundTrip.Stop();
+        if (bytesRead != static_cast<int>(replySize)) {
+            lost++;
+        }
+        latencies[index] = roundTrip.GetElapsedTime();
+    }
+    total.Stop();
+
+    const char quit = QuitRequest;
+    socket.Send(&quit, 1);
+    socket.Close();
+
+    std::sort(latencies.begin(), latencies.end());
+    std::cout << name << ": " << numberOfRoundTrips << " round trips in "
+              << total.GetElapsedTime() / cmn_ms << " ms, median "
+              << latencies[latencies.size() / 2] * 1.0e6 << " us, 99% "
+              << latencies[(latencies.size() * 99) / 100] * 1.0e6 << " us, max "
+              << latencies.back() * 1.0e6 << " us"
+              << ((lost == 0) ? "" : " (ERROR: replies lost)") << std::endl;
+}
+
+void Benchmark(const std::string & name, osaSocket::SocketTypes type, unsigned short port,
+               size_t replySize, size_t numberOfRoundTrips)
+{
+#if (CISST_OS != CISST_WINDOWS)
+    const pid_t server = fork();
+    if (server == 0) {
+        Server(type, port, replySize);
+        _exit(0);
+    }
+    Client(name, type, port, replySize, numberOfRoundTrips);
+    waitpid(server, 0, 0);
+#else
+    std::cout << name << ": not supported on Windows" << std::endl;
+#endif
+}
+
+int main(int argc, char ** argv)
+{
+    cmnLogger::SetMask(CMN_LOG_ALLOW_ALL);
+    cmnLogger::AddChannel(std::cout, CMN_LOG_ALLOW_ERRORS_AND_WARNINGS);
+
+    int port = 12345;
+    int replySize = 100;
+    int numberOfRoundTrips = 20000;
+
+    cmnCommandLineOptions options;
+    options.AddOptionOneValue("p", "port",
+                              "port used by the server (default 12345)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &port);
+    options.AddOptionOneValue("s", "size",
+                              "number of bytes in reply (default 100)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &replySize);
+    options.AddOptionOneValue("n", "number",
+                              "number of round trips (default 20000)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &numberOfRoundTrips);
+    if (!options.Parse(argc, argv, std::cerr)) {
+        return -1;
+    }
+
+    Benchmark("udp", osaSocket::UDP, static_cast<unsigned short>(port), replySize, numberOfRoundTrips);
+    if (osaSharedMemoryQueue::IsSupported()) {
+        Benchmark("shm", osaSocket::SHARED_MEMORY, static_cast<unsigned short>(port), replySize, numberOfRoundTrips);
+    }
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Defines mtsCollectorAsyncWriter
+*/
+
+#ifndef _mtsCollectorAsyncWriter_h
+#define _mtsCollectorAsyncWriter_h
+
+#include <cisstOSAbstraction/osaThread.h>
+#include <cisstOSAbstraction/osaThreadSignal.h>
+
+#include <atomic>
+#include <ostream>
+#include <streambuf>
+#include <vector>
+
+// Always include last
+#include <cisstMultiTask/mtsExport.h>
+
+/*!
+  \ingroup cisstMultiTask
+
+  Double buffered asynchronous writer used by the collectors (see
+  mtsCollectorBase::SetAsynchronousWriter).  The collector formats
+  its samples in the front buffer using the stream returned by
+  GetStream and calls EndSample after each sample.  Once enough data
+  has been accumulated, the front buffer is handed to a writer thread
+  which performs the actual I/O on the output stream while the
+  collector keeps filling the other buffer.
+
+  Memory is bounded: if the writer thread is still busy when the
+  front buffer reaches its size limit, new samples are dropped (the
+  partially formatted sample is removed so the output remains
+  consistent) and the drop counters are incremented.  This way a slow
+  disk doesn't back up in the collector and, indirectly, in the
+  observed state table.
+
+  Only the collector thread should use GetStream, EndSample and Flush.
+*/
+class CISST_EXPORT mtsCollectorAsyncWriter
+{
+public:
+    mtsCollectorAsyncWriter(void);
+
+    /*! Destructor, stops the writer thread if needed. */
+    ~mtsCollectorAsyncWriter();
+
+    /*! Start the writer thread.  Data will be written to \c output,
+      which must remain valid until Stop is called.  \c bufferSize is
+      the maximum size of each buffer in bytes. */
+    bool Start(std::ostream & output, size_t bufferSize);
+
+    /*! Write all pending data to the output stream and stop the
+      writer thread. */
+    void Stop(void);
+
+    /*! Check if the writer thread is running. */
+    inline bool IsRunning(void) const {
+        return this->Running;
+    }
+
+    /*! Stream used to format data in the front buffer. */
+    inline std::ostream & GetStream(void) {
+        return this->Stream;
+    }
+
+    /*! Mark the end of a sample.  If the front buffer is more than
+      half full and the writer thread is idle, buffers are swapped.
+      If the front buffer is full and the writer thread is busy, the
+      last sample is dropped. */
+    void EndSample(void);
+
+    /*! Hand the front buffer to the writer thread if it is idle and
+      the front buffer is not empty.  This method never blocks. */
+    void Flush(void);
+
+    /*! Counters, can be read from any thread. */
+    //@{
+    inline unsigned int GetNumberOfSamples(void) const {
+        return this->NumberOfSamples.load(std::memory_order_relaxed);
+    }
+    inline unsigned int GetNumberOfDroppedSamples(void) const {
+        return this->NumberOfDroppedSamples.load(std::memory_order_relaxed);
+    }
+    inline unsigned int GetNumberOfOverflows(void) const {
+        return this->NumberOfOverflows.load(std::memory_order_relaxed);
+    }
+    //@}
+
+    /*! Reset all counters. */
+    void ResetCounters(void);
+
+protected:
+    /*! Stream buffer writing directly in one of the two buffers, the
+      buffer grows if a single sample is larger than the buffer
+      size. */
+    class BufferType: public std::streambuf {
+        std::vector<char> * Data;
+    public:
+        BufferType(void): Data(0) {}
+        void Attach(std::vector<char> & data);
+        inline size_t Used(void) const {
+            return static_cast<size_t>(this->pptr() - this->pbase());
+        }
+        void Truncate(size_t used);
+    protected:
+        int_type overflow(int_type character) override;
+    };
+
+    std::ostream * Output;
+    size_t BufferSize;
+    bool Running;
+
+    std::vector<char> Buffers[2];
+    size_t FrontIndex;
+    BufferType FrontBuffer;
+    std::ostream Stream;
+
+    /*! Position in the front buffer where the current sample started. */
+    size_t SampleStart;
+
+    /*! Set when the back buffer has data for the writer thread, reset
+      by the writer thread once the data has been written. */
+    std::atomic<bool> BackPending;
+    size_t BackSize;
+    std::atomic<bool> StopRequested;
+
+    bool Overflowing;
+    std::atomic<unsigned int> NumberOfSamples;
+    std::atomic<unsigned int> NumberOfDroppedSamples;
+    std::atomic<unsigned int> NumberOfOverflows;
+
+    osaThread Thread;
+    osaThreadSignal Signal;
+
+    void * Run(void * argument);
+
+    /*! Swap front and back buffers, caller must check that the back
+      buffer is not pending. */
+    void Swap(void);
+
+    /*! Write a buffer to the output stream. */
+    void Write(const std::vector<char> & buffer, size_t size);
+};
+
+#endif // _mtsCollectorAsyncWriter_h
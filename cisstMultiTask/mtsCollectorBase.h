@@ -27,10 +27,13 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <cisstCommon/cmnNamedMap.h>
 #include <cisstMultiTask/mtsTaskFromSignal.h>
+#include <cisstMultiTask/mtsCollectorAsyncWriter.h>
 
 #include <string>
 #include <stdexcept>
 
+class mtsCollectorColumnarWriter;
+
 // Always include last
 #include <cisstMultiTask/mtsExport.h>
 
@@ -51,6 +54,7 @@ public:
         COLLECTOR_FILE_FORMAT_PLAIN_TEXT,
         COLLECTOR_FILE_FORMAT_BINARY,
         COLLECTOR_FILE_FORMAT_CSV,
+        COLLECTOR_FILE_FORMAT_COLUMNAR,
         COLLECTOR_FILE_FORMAT_UNDEFINED
     } CollectorFileFormat;
 
@@ -157,6 +161,48 @@ protected:
       ConvertBinaryToText() method so we don't define it here. */
     cmnSerializer * Serializer;
 
+    /*! Writer for COLLECTOR_FILE_FORMAT_COLUMNAR, created by
+      SetOutput and opened by OpenFileIfNeeded.  Only collectors
+      using fixed size data (see mtsCollectorState) support this
+      format. */
+    mtsCollectorColumnarWriter * ColumnarWriter;
+
+    /*! Settings for COLLECTOR_FILE_FORMAT_COLUMNAR */
+    //@{
+    size_t ColumnarRowsPerChunk;
+    bool ColumnarCompression;
+    //@}
+
+    /*! Asynchronous writer, see SetAsynchronousWriter.  When the
+      writer is running, OutputStream points to the writer's stream
+      and OutputFile is only used by the writer thread. */
+    //@{
+    mtsCollectorAsyncWriter AsyncWriter;
+    bool AsyncWriterEnabled;
+    size_t AsyncWriterBufferSize;
+    //@}
+
+    /*! Stop the asynchronous writer if needed, all pending data is
+      written to the output file. */
+    void StopAsyncWriter(void);
+
+    /*! Methods used by derived classes to mark the end of a sample
+      and to hand over the data formatted so far to the writer thread
+      (non blocking).  These do nothing if the asynchronous writer is
+      not used. */
+    //@{
+    inline void EndOfSample(void) {
+        if (this->AsyncWriter.IsRunning()) {
+            this->AsyncWriter.EndSample();
+        }
+    }
+    inline void FlushAsyncWriter(void) {
+        if (this->AsyncWriter.IsRunning()) {
+            this->AsyncWriter.Flush();
+        }
+    }
+    //@}
+
     /*! Update the delimiter used in output files based on file
       format.  Should be used everytime FileFormat is set. */
     void SetDelimiter(void);
@@ -269,6 +315,14 @@ public:
     /*! Get working directory, usable with commands as well */
     void GetWorkingDirectory(mtsStdString & placeHolder) const;
 
+    /*! Asynchronous writer counters for the current file, usable
+      with commands as well.  An overflow is a period during which
+      samples were dropped because the writer thread was too slow. */
+    //@{
+    void GetNumberOfDroppedSamples(mtsUInt & placeHolder) const;
+    void GetNumberOfOverflows(mtsUInt & placeHolder) const;
+    //@}
+
     /*! Set floating point notation for the output stream.  This
       setting will apply to all future files opened. */
     void SetOutputStreamFloatingNotation(const CollectorFileFloatingNotation floatingNotation);
@@ -284,6 +338,28 @@ public:
     /*! Set fill character for the output file. This setting will
       apply to all future files. */
     void SetOutputStreamFill(const char fillCharacter);
+
+    /*! Set the number of rows per chunk for the columnar file
+      format.  Larger chunks compress better but the reader has to
+      load more data to access a given time range.  This setting will
+      apply to all future files. */
+    void SetColumnarChunkSize(const size_t rowsPerChunk);
+
+    /*! Enable or disable per chunk compression for the columnar file
+      format.  This setting will apply to all future files. */
+    void SetColumnarCompression(const bool compression);
+
+    /*! Use a separate thread to write to the output file.  Samples
+      are formatted in memory, using two buffers of \c bufferSize
+      bytes, and written by the writer thread so slow I/O doesn't
+      delay the collector.  If the writer thread can't keep up,
+      samples are dropped and counted (see commands
+      GetNumberOfDroppedSamples and GetNumberOfOverflows on the
+      "Control" interface).  This setting applies to all future files
+      and is ignored for COLLECTOR_FILE_FORMAT_COLUMNAR and user
+      provided streams. */
+    void SetAsynchronousWriter(const bool enable,
+                               const size_t bufferSize = 1024 * 1024);
 };
 
 CMN_DECLARE_SERVICES_INSTANTIATION(mtsCollectorBase)
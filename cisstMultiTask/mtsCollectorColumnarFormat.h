@@ -0,0 +1,155 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Defines the file layout used by the columnar collector format
+*/
+
+#ifndef _mtsCollectorColumnarFormat_h
+#define _mtsCollectorColumnarFormat_h
+
+#include <cisstCommon/cmnPortability.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Always include last
+#include <cisstMultiTask/mtsExport.h>
+
+/*!
+  \ingroup cisstMultiTask
+
+  Definitions shared by mtsCollectorColumnarWriter and
+  mtsCollectorColumnarReader for the file format used by
+  mtsCollectorBase::COLLECTOR_FILE_FORMAT_COLUMNAR.  All values are
+  stored using the native byte order of the computer that recorded
+  the data.
+
+  The file is organized as follows:
+  - FileHeader
+  - For each column: uint32 name length, name, uint32 fields length,
+    fields (comma separated names of the scalars as generated by
+    ToStreamRaw), uint32 element size (in bytes), uint32 scalar size
+    (in bytes), uint32 scalar kind (see ScalarKind).
+  - Chunks, each starting with a ChunkHeader followed by the payload
+    (compressed or not).  Once decompressed, the payload contains the
+    ticks column (uint64 for each row), the time column (double for
+    each row, Tic of the state table) and then, for each column, the
+    raw elements back to back.
+  - Index footer, one IndexEntry per chunk.
+  - Trailer, located at the very end of the file.
+
+  The compression is a byte oriented LZ77 variant using the LZ4 block
+  layout (token, literals, 16 bits offset, match length).  It is fast
+  enough to compress chunks on the fly and each chunk can be
+  decompressed independently.
+*/
+class CISST_EXPORT mtsCollectorColumnarFormat
+{
+public:
+    /*! Kind of scalars stored in a column, used by readers to
+      interpret the raw data. */
+    typedef enum {
+        SCALAR_UNKNOWN = 0,
+        SCALAR_BOOL = 'b',
+        SCALAR_FLOAT = 'f',
+        SCALAR_SIGNED = 'i',
+        SCALAR_UNSIGNED = 'u'
+    } ScalarKind;
+
+    enum {VERSION = 1};
+
+    /*! Flags stored in the file header. */
+    enum {FLAG_COMPRESSION = 1};
+
+    class FileHeader {
+    public:
+        char Magic[8];
+        uint32_t Version;
+        uint32_t Flags;
+        uint32_t NumberOfColumns;
+        uint32_t RowsPerChunk;
+        uint64_t DataOffset;
+    };
+
+    class ChunkHeader {
+    public:
+        uint32_t Magic;
+        uint32_t NumberOfRows;
+        uint32_t Compressed;
+        uint32_t Reserved;
+        uint64_t RawSize;
+        uint64_t StoredSize;
+    };
+
+    class IndexEntry {
+    public:
+        uint64_t Offset;
+        uint64_t FirstTicks;
+        uint64_t LastTicks;
+        double FirstTime;
+        double LastTime;
+        uint32_t NumberOfRows;
+        uint32_t Reserved;
+    };
+
+    class Trailer {
+    public:
+        char Magic[8];
+        uint64_t NumberOfChunks;
+        uint64_t IndexOffset;
+    };
+
+    /*! Description of a column, i.e. a signal from the state table. */
+    class ColumnDescription {
+    public:
+        std::string Name;
+        std::string Fields;
+        size_t ElementSize;
+        size_t ScalarSize;
+        ScalarKind Kind;
+    };
+
+    static const char FileMagic[8];
+    static const char TrailerMagic[8];
+    static const uint32_t ChunkMagic;
+
+    /*! Maximum size of compressed data for a given input size. */
+    static size_t CompressBound(size_t size);
+
+    /*! Compress \c sourceSize bytes from source to destination.
+      Returns the compressed size or 0 if the destination is too small
+      or if the compressed data wouldn't be smaller than the source. */
+    static size_t Compress(const char * source, size_t sourceSize,
+                           char * destination, size_t destinationCapacity);
+
+    /*! Decompress data compressed with Compress.  Returns false if the
+      compressed data is corrupted or if the decompressed size doesn't
+      match \c destinationSize. */
+    static bool Decompress(const char * source, size_t sourceSize,
+                           char * destination, size_t destinationSize);
+
+    /*! Convert a scalar to a double, used by readers. */
+    static double ScalarToDouble(const char * data, size_t scalarSize, ScalarKind kind);
+};
+
+#endif // _mtsCollectorColumnarFormat_h
@@ -0,0 +1,128 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Defines mtsCollectorColumnarReader
+*/
+
+#ifndef _mtsCollectorColumnarReader_h
+#define _mtsCollectorColumnarReader_h
+
+#include <cisstMultiTask/mtsCollectorColumnarFormat.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Always include last
+#include <cisstMultiTask/mtsExport.h>
+
+/*!
+  \ingroup cisstMultiTask
+
+  Reader for files created using the columnar collector format (see
+  mtsCollectorColumnarFormat).  Open only reads the file header and
+  the index footer, data is then read chunk by chunk so a time range
+  can be extracted without parsing the whole file.
+*/
+class CISST_EXPORT mtsCollectorColumnarReader
+{
+public:
+    typedef mtsCollectorColumnarFormat FormatType;
+    typedef FormatType::ColumnDescription ColumnDescription;
+
+    /*! Rows read from the file.  Each column is stored as a
+      contiguous block of elements, see GetElement. */
+    class Rows {
+    public:
+        std::vector<unsigned long long> Ticks;
+        std::vector<double> Times;
+        std::vector<std::vector<char> > Columns;
+        std::vector<size_t> ElementSizes;
+
+        inline size_t size(void) const {
+            return Ticks.size();
+        }
+
+        inline const char * GetElement(size_t column, size_t row) const {
+            return &(Columns[column][row * ElementSizes[column]]);
+        }
+
+        void Clear(void);
+    };
+
+    mtsCollectorColumnarReader(void);
+    ~mtsCollectorColumnarReader();
+
+    /*! Open the file, read the header and index.  Returns false if
+      the file can't be opened or is not a valid columnar file. */
+    bool Open(const std::string & fileName);
+
+    void Close(void);
+
+    inline size_t GetNumberOfColumns(void) const {
+        return this->Columns.size();
+    }
+
+    inline const ColumnDescription & GetColumn(size_t column) const {
+        return this->Columns[column];
+    }
+
+    /*! Find a column by name, returns -1 if not found. */
+    int FindColumn(const std::string & name) const;
+
+    inline size_t GetNumberOfChunks(void) const {
+        return this->Index.size();
+    }
+
+    unsigned long long GetNumberOfRows(void) const;
+
+    /*! Time of the first and last rows, 0 if the file is empty. */
+    //@{
+    double GetStartTime(void) const;
+    double GetEndTime(void) const;
+    //@}
+
+    /*! Append all rows from a given chunk. */
+    bool ReadChunk(size_t chunk, Rows & rows);
+
+    /*! Read all rows with a time between startTime and endTime
+      (included).  The index is used to only read the chunks
+      overlapping the time range.  Rows are replaced. */
+    bool ReadTimeRange(double startTime, double endTime, Rows & rows);
+
+    /*! Get a scalar from an element as a double. */
+    double GetScalar(const Rows & rows, size_t column, size_t row, size_t scalarIndex) const;
+
+protected:
+    std::string FileName;
+    std::ifstream File;
+    FormatType::FileHeader Header;
+    std::vector<ColumnDescription> Columns;
+    std::vector<FormatType::IndexEntry> Index;
+    std::vector<char> StoredBuffer;
+    std::vector<char> RawBuffer;
+
+    bool ReadString(std::string & value);
+    bool ReadUInt32(size_t & value);
+};
+
+#endif // _mtsCollectorColumnarReader_h
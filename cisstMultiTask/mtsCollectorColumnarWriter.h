@@ -0,0 +1,167 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Defines mtsCollectorColumnarWriter
+*/
+
+#ifndef _mtsCollectorColumnarWriter_h
+#define _mtsCollectorColumnarWriter_h
+
+#include <cisstMultiTask/mtsCollectorColumnarFormat.h>
+
+#include <string>
+#include <vector>
+#include <cstdio>
+
+// Always include last
+#include <cisstMultiTask/mtsExport.h>
+
+/*!
+  \ingroup cisstMultiTask
+
+  Writer for the columnar collector file format (see
+  mtsCollectorColumnarFormat).  Rows are accumulated in memory, one
+  buffer per column, and written as a chunk once RowsPerChunk rows are
+  available.  On systems supporting it, the file is preallocated and
+  memory mapped so writing a chunk is a memcpy per column (or the
+  output of the compressor) and the file is only grown by doubling its
+  size.  The file is truncated to its actual size when closed, after
+  writing the index footer.
+
+  Typical use:
+  \code
+  writer.Open("data.ccol");
+  writer.AddColumn(description);
+  for (...) {
+      writer.AddRow(ticks, time);
+      memcpy(writer.GetCell(0), data, size);
+  }
+  writer.Close();
+  \endcode
+*/
+class CISST_EXPORT mtsCollectorColumnarWriter
+{
+public:
+    typedef mtsCollectorColumnarFormat FormatType;
+    typedef FormatType::ColumnDescription ColumnDescription;
+
+    mtsCollectorColumnarWriter(void);
+
+    /*! Destructor, closes the file if needed. */
+    ~mtsCollectorColumnarWriter();
+
+    /*! Create the file.  The file is preallocated using
+      \c preallocatedSize bytes (memory mapped files only).  Returns
+      false if the file can't be created. */
+    bool Open(const std::string & fileName,
+              size_t rowsPerChunk = 1024,
+              bool compression = false,
+              size_t preallocatedSize = 64 * 1024 * 1024);
+
+    /*! Check if the file is open. */
+    bool IsOpen(void) const;
+
+    /*! Add a column, must be called after Open and before the first
+      row is added.  Columns with an element size of 0 are not
+      allowed. */
+    bool AddColumn(const ColumnDescription & column);
+
+    /*! Number of columns. */
+    inline size_t GetNumberOfColumns(void) const {
+        return this->Columns.size();
+    }
+
+    /*! Start a new row.  Once this method has been called, the cells
+      of the row (one per column) should be filled using GetCell.  If
+      the current chunk is full, it is written to the file first. */
+    bool AddRow(unsigned long long ticks, double time);
+
+    /*! Pointer on the cell for the current row and given column, the
+      caller must copy exactly the element size defined for the
+      column. */
+    inline char * GetCell(size_t column) {
+        return &(this->ColumnBuffers[column][(this->RowsInChunk - 1) * this->Columns[column].ElementSize]);
+    }
+
+    /*! Write the last chunk, the index footer and close the file. */
+    bool Close(void);
+
+    /*! Number of rows written so far. */
+    inline unsigned long long GetNumberOfRows(void) const {
+        return this->NumberOfRows;
+    }
+
+    /*! Number of chunks written so far. */
+    inline size_t GetNumberOfChunks(void) const {
+        return this->Index.size();
+    }
+
+    /*! Number of bytes written so far. */
+    inline unsigned long long GetFileSize(void) const {
+        return this->Offset;
+    }
+
+protected:
+    std::string FileName;
+    size_t RowsPerChunk;
+    bool Compression;
+    bool HeaderWritten;
+
+    std::vector<ColumnDescription> Columns;
+
+    /*! Buffers for current chunk */
+    //@{
+    size_t RowsInChunk;
+    std::vector<unsigned long long> TicksBuffer;
+    std::vector<double> TimeBuffer;
+    std::vector<std::vector<char> > ColumnBuffers;
+    std::vector<char> RawBuffer;
+    std::vector<char> CompressedBuffer;
+    //@}
+
+    unsigned long long NumberOfRows;
+    std::vector<FormatType::IndexEntry> Index;
+
+    /*! Current position in the file, i.e. file size so far. */
+    unsigned long long Offset;
+
+#if (CISST_OS != CISST_WINDOWS)
+    int FileDescriptor;
+    char * Map;
+    size_t MapSize;
+    bool Remap(size_t size);
+#else
+    FILE * File;
+    std::vector<char> Staging;
+#endif
+
+    /*! Get a pointer on the file content to write \c size bytes at
+      the current offset.  Commit must be called once the data has
+      been copied. */
+    char * Reserve(size_t size);
+    bool Commit(size_t size);
+
+    bool WriteHeader(void);
+    bool WriteChunk(void);
+};
+
+#endif // _mtsCollectorColumnarWriter_h
@@ -100,6 +100,23 @@ class CISST_EXPORT mtsCollectorState : public mtsCollectorBase
     /*! Print out the signal names which are being collected. */
     void PrintHeader(const CollectorFileFormat & fileFormat);
 
+    /*! Signals recorded using the columnar file format, index in
+      RegisteredSignalElements and element size.  Signals without a
+      fixed binary layout are not recorded. */
+    //@{
+    std::vector<size_t> ColumnarSignals;
+    std::vector<size_t> ColumnarElementSizes;
+    //@}
+
+    /*! Add one column per registered signal to the columnar writer. */
+    void AddColumnarColumns(void);
+
+    /*! Fetch state table data for the columnar file format, copies
+      the raw elements directly into the writer's chunk buffers. */
+    bool FetchStateTableDataColumnar(const mtsStateTable * table,
+                                     const size_t startIdx,
+                                     const size_t endIdx);
+
     /*! Mark the end of the header. Called in case of binary log file. */
     void MarkHeaderEnd(std::ostream & logFile);
 
@@ -69,6 +69,11 @@ public:
     mtsExecutionResult Execute(const mtsGenericObject & argument,
                                mtsBlockingType blocking,
                                mtsCommandWriteBase *finishedEventHandler);
+
+    /*! The filter output is queued, not the shared argument. */
+    mtsExecutionResult ExecuteShared(mtsSharedArgument * argument,
+                                     mtsBlockingType blocking,
+                                     mtsCommandWriteBase * finishedEventHandler);
 };
 
 
@@ -52,7 +52,7 @@ public:
 
 protected:
     /*! Queue to store arguments */
-    mtsQueue<ArgumentQueueType> ArgumentsQueue;
+    mtsQueueAtomic<ArgumentQueueType> ArgumentsQueue;
 
 private:
     /*! Private copy constructor to prevent copies */
@@ -79,9 +79,7 @@ public:
         const ArgumentQueueType * argumentPrototype = dynamic_cast<const ArgumentQueueType *>(this->GetArgumentPrototype());
         if (argumentPrototype) {
             ArgumentsQueue.SetSize(size, *argumentPrototype);
-            BlockingFlagQueue.SetSize(size, MTS_NOT_BLOCKING);
-            mtsCommandWriteBase *cmd = 0;
-            FinishedEventQueue.SetSize(size, cmd);
+            this->AllocateBaseQueues(size);
         } else {
             CMN_LOG_INIT_ERROR << "Class mtsCommandQueuedWrite: constructor: can't find argument prototype from actual command."
                                << std::endl;
@@ -109,9 +107,7 @@ public:
             const ArgumentQueueType * argumentPrototype = dynamic_cast<const ArgumentQueueType *>(this->GetArgumentPrototype());
             if (argumentPrototype) {
                 ArgumentsQueue.SetSize(size, *argumentPrototype);
-                BlockingFlagQueue.SetSize(size, MTS_NOT_BLOCKING);
-                mtsCommandWriteBase *cmd = 0;
-                FinishedEventQueue.SetSize(size, cmd);
+                this->AllocateBaseQueues(size);
             } else {
                 CMN_LOG_INIT_ERROR << "Class mtsCommandQueuedWrite: constructor: can't find argument prototype from actual command."
                                    << std::endl;
@@ -138,7 +134,8 @@ public:
             return mtsExecutionResult::INVALID_INPUT_TYPE;
         }
         // check if all queues have some space
-        if (ArgumentsQueue.IsFull() || BlockingFlagQueue.IsFull() || FinishedEventQueue.IsFull() || MailBox->IsFull()) {
+        if (ArgumentsQueue.IsFull() || BlockingFlagQueue.IsFull() || FinishedEventQueue.IsFull()
+            || SharedArgumentsQueue.IsFull() || MailBox->IsFull()) {
             CMN_LOG_RUN_WARNING << "Class mtsCommandQueuedWrite: Execute: Queue full for \""
                                 << this->Name << "\" ["
                                 << ArgumentsQueue.IsFull() << "|"
@@ -172,13 +169,24 @@ public:
             cmnThrow("mtsCommandQueuedWrite: Execute: FinishedEventQueue.Put failed");
             return mtsExecutionResult::UNDEFINED;
         }
+        // argument is not shared
+        if (!SharedArgumentsQueue.Put(0)) {
+            CMN_LOG_RUN_ERROR << "Class mtsCommandQueuedWrite: Execute: SharedArgumentsQueue.Put failed for \""
+                              << this->Name << "\"" << std::endl;
+            ArgumentsQueue.Get();       // Remove the argument that was already queued
+            BlockingFlagQueue.Get();    // Remove the blocking flag that was already queued
+            FinishedEventQueue.Get();   // Remove the finished event handler that was already queued
+            cmnThrow("mtsCommandQueuedWrite: Execute: SharedArgumentsQueue.Put failed");
+            return mtsExecutionResult::UNDEFINED;
+        }
         // finally try to queue to mailbox
         if (!MailBox->Write(this)) {
             CMN_LOG_RUN_ERROR << "Class mtsCommandQueuedWrite: Execute: mailbox full for \""
                               << this->Name << "\"" << std::endl;
-            ArgumentsQueue.Get();  // pop argument, blocking flag, and finished event from local storage
+            ArgumentsQueue.Get();  // pop argument, blocking flag, finished event and shared argument from local storage
             BlockingFlagQueue.Get();
             FinishedEventQueue.Get();
+            SharedArgumentsQueue.Get();
             cmnThrow("mtsCommandQueuedWrite: Execute: MailBox.Write failed");
             return mtsExecutionResult::UNDEFINED;
         }
@@ -191,11 +199,16 @@ public:
     }
 
     inline virtual const mtsGenericObject * ArgumentPeek(void) const {
-        return ArgumentsQueue.Peek();
+        const mtsGenericObject * shared = this->SharedArgumentPeek();
+        return shared ? shared : ArgumentsQueue.Peek();
     }
 
 
+    // returns 0 if the argument was shared
     inline virtual mtsGenericObject * ArgumentGet(void) {
+        if (this->SharedArgumentGet()) {
+            return 0;
+        }
         return ArgumentsQueue.Get();
     }
 };
@@ -267,11 +280,16 @@ public:
 
 
     inline virtual const mtsGenericObject * ArgumentPeek(void) const {
-        return ArgumentsQueue.Peek();
+        const mtsGenericObject * shared = this->SharedArgumentPeek();
+        return shared ? shared : ArgumentsQueue.Peek();
     }
 
 
+    // returns 0 if the argument was shared
     inline virtual mtsGenericObject * ArgumentGet(void) {
+        if (this->SharedArgumentGet()) {
+            return 0;
+        }
         return ArgumentsQueue.Get();
     }
 };
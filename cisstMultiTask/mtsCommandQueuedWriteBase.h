@@ -28,6 +28,8 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <cisstMultiTask/mtsCommandWriteBase.h>
 #include <cisstMultiTask/mtsMailBox.h>
+#include <cisstMultiTask/mtsQueueAtomic.h>
+#include <cisstMultiTask/mtsSharedArgument.h>
 
 // Always include last
 #include <cisstMultiTask/mtsExport.h>
@@ -42,12 +44,17 @@ protected:
 
     /*! Queue of flags to indicate if the command is blocking or
       not */
-    mtsQueue<mtsBlockingType> BlockingFlagQueue;
+    mtsQueueAtomic<mtsBlockingType> BlockingFlagQueue;
 
     /*! Queue for return events (to send result to caller).
         If non-zero, this indicates that a blocking call was made
         (previously, this was a BlockingFlagQueue). */
-    mtsQueue<mtsCommandWriteBase *> FinishedEventQueue;
+    mtsQueueAtomic<mtsCommandWriteBase *> FinishedEventQueue;
+
+    /*! Queue of shared arguments, see ExecuteShared.  There is one
+      element per queued command, 0 if the argument has been copied
+      in the argument queue of the derived class. */
+    mtsQueueAtomic<mtsSharedArgument *> SharedArgumentsQueue;
 
     inline mtsCommandQueuedWriteBase(void):
         BaseType("??"),
@@ -57,8 +64,29 @@ protected:
     {
         mtsCommandWriteBase *cmd = 0;
         FinishedEventQueue.SetSize(0, cmd);
+        mtsSharedArgument * shared = 0;
+        SharedArgumentsQueue.SetSize(0, shared);
+    }
+
+    /*! Resize the queues shared by all derived classes. */
+    void AllocateBaseQueues(size_t size);
+
+    /*! Next argument if it is shared, 0 otherwise.  Used by
+      ArgumentPeek in derived classes. */
+    inline const mtsGenericObject * SharedArgumentPeek(void) const {
+        mtsSharedArgument * const * shared = SharedArgumentsQueue.Peek();
+        if (shared && *shared) {
+            return (*shared)->GetArgument();
+        }
+        return 0;
     }
 
+    /*! Remove next element from the shared arguments queue and
+      release the argument if shared.  Returns true if the argument
+      was shared, i.e. the derived class argument queue should not be
+      used.  Used by ArgumentGet in derived classes. */
+    bool SharedArgumentGet(void);
+
 public:
     inline mtsCommandQueuedWriteBase(mtsMailBox * mailBox, mtsCommandWriteBase * actualCommand, size_t size):
         BaseType(actualCommand->GetName()),
@@ -68,6 +96,8 @@ public:
     {
         mtsCommandWriteBase *cmd = 0;
         FinishedEventQueue.SetSize(size, cmd);
+        mtsSharedArgument * shared = 0;
+        SharedArgumentsQueue.SetSize(size, shared);
         this->SetArgumentPrototype(ActualCommand->GetArgumentPrototype());
     }
 
@@ -99,6 +129,17 @@ public:
                                mtsCommandWriteBase *finishedEventHandler) = 0;
 
 
+    /*! Queue a shared argument instead of copying it.  This is used
+      by multicast commands (events) so the argument is copied only
+      once for all observers.  A reference is added to the argument
+      and released once the command has been executed.  Derived
+      classes which need to modify the argument before queueing it
+      should override this method. */
+    virtual mtsExecutionResult ExecuteShared(mtsSharedArgument * argument,
+                                             mtsBlockingType blocking,
+                                             mtsCommandWriteBase * finishedEventHandler);
+
+
     virtual const mtsGenericObject * ArgumentPeek(void) const = 0;
 
 
@@ -0,0 +1,124 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Latency and execution time statistics for queued commands
+*/
+
+#ifndef _mtsCommandStatistics_h
+#define _mtsCommandStatistics_h
+
+#include <cisstMultiTask/mtsLatencyHistogram.h>
+
+#include <string>
+#include <vector>
+
+// Always include last
+#include <cisstMultiTask/mtsExport.h>
+
+/*!
+  \ingroup cisstMultiTask
+
+  Statistics for all queued commands of a provided interface.  For
+  each command, the mailbox records how long the command waited in
+  the queue (from mtsMailBox::Write to mtsMailBox::ExecuteNext), how
+  long the command took to execute and how many commands were still
+  queued when it was de-queued.
+
+  The statistics are collected when instrumentation is enabled using
+  mtsInterfaceProvided::EnableCommandStatistics.  They are updated by
+  the thread processing the mailboxes and stored in the component's
+  state table so other components can read them safely.
+
+  \sa mtsMailBox, mtsLatencyHistogram
+ */
+class CISST_EXPORT mtsCommandStatistics: public mtsGenericObject
+{
+    CMN_DECLARE_SERVICES(CMN_DYNAMIC_CREATION, CMN_LOG_ALLOW_DEFAULT);
+
+public:
+    /*! Base type */
+    typedef mtsGenericObject BaseType;
+
+    mtsCommandStatistics(void) {}
+    ~mtsCommandStatistics() {}
+
+    /*! Index of a command, the command is added if it doesn't exist
+      yet. */
+    size_t Index(const std::string & commandName);
+
+    /*! Add a sample for the command at a given index.  Durations are
+      in seconds and the queue depth is the number of commands left in
+      the mailbox after this one has been de-queued. */
+    void Add(const size_t index, const double queueLatency, const double executionTime,
+             const size_t queueDepth);
+
+    /*! Remove all samples, keeps the list of commands. */
+    void Reset(void);
+
+    /*! Number of commands. */
+    inline size_t size(void) const {
+        return mNames.size();
+    }
+
+    /*! Accessors for the command at a given index. */
+    //@{
+    inline const std::string & Name(const size_t index) const {
+        return mNames[index];
+    }
+    inline const mtsLatencyHistogram & QueueLatency(const size_t index) const {
+        return mQueueLatencies[index];
+    }
+    inline const mtsLatencyHistogram & ExecutionTime(const size_t index) const {
+        return mExecutionTimes[index];
+    }
+    inline size_t MaxQueueDepth(const size_t index) const {
+        return mMaxQueueDepths[index];
+    }
+    double MeanQueueDepth(const size_t index) const;
+    //@}
+
+    /*! Human readable text output, one line per command. */
+    void ToStream(std::ostream & outputStream) const override;
+
+    /*! Machine reabable text output */
+    void ToStreamRaw(std::ostream & outputStream, const char delimiter = ' ',
+                     bool headerOnly = false, const std::string & headerPrefix = "") const override;
+
+    /*! Serialize the content of the object without any extra
+      information, i.e. no class type nor format version. */
+    void SerializeRaw(std::ostream & outputStream) const override;
+
+    /*! De-serialize the content of the object without any extra
+      information, i.e. no class type nor format version. */
+    void DeSerializeRaw(std::istream & inputStream) override;
+
+protected:
+    std::vector<std::string> mNames;
+    std::vector<mtsLatencyHistogram> mQueueLatencies;
+    std::vector<mtsLatencyHistogram> mExecutionTimes;
+    std::vector<unsigned int> mMaxQueueDepths;
+    std::vector<double> mSumQueueDepths;
+};
+
+CMN_DECLARE_SERVICES_INSTANTIATION(mtsCommandStatistics)
+
+#endif // _mtsCommandStatistics_h
@@ -223,6 +223,7 @@ protected:
     mtsCommandWriteBase *Command;      // Command object for calling EventHandler method
     mtsCommandWriteBase *UserHandler;  // User supplied event handler
     mtsGenericObject *ArgPtr;
+    bool ArgFailed;
 
     // This one always gets added non-queued
     void EventHandler(const mtsGenericObject &arg);
@@ -248,10 +249,20 @@ public:
     // PK: Do we need the "generic" version (AddEventHandlerWriteGeneric)?
 
 
-    // Note that we are using the Wait and WaitWithTimeout member functions from the base class.
+    // Note that we are using the PrepareToWait, Wait and WaitWithTimeout member functions from the base class.
+    using mtsEventReceiverBase::PrepareToWait;
     using mtsEventReceiverBase::Wait;
     using mtsEventReceiverBase::WaitWithTimeout;
 
+    /*! Same as PrepareToWait but also sets the object receiving the event argument, so that
+        the argument is not lost if the event is raised before Wait or WaitWithTimeout is called.
+        The same object must then be passed to Wait or WaitWithTimeout.
+        \returns true if successful, false if failed. */
+    bool PrepareToWait(mtsGenericObject &obj);
+
+    /*! Clear the WaitState and the object receiving the event argument */
+    void ClearWait(void);
+
     /*! Wait for event to be issued and return received argument.
         \returns true if successful, false if failed (including case where wait succeeded but return value obj
                  is invalid) */
@@ -47,6 +47,13 @@ typedef enum {MTS_INTERFACE_COMMAND_POLICY, MTS_COMMAND_QUEUED, MTS_COMMAND_NOT_
   AddEventHandlerWrite. */
 typedef enum {MTS_INTERFACE_EVENT_POLICY, MTS_EVENT_QUEUED, MTS_EVENT_NOT_QUEUED} mtsEventQueueingPolicy;
 
+/*! Producer policy for the mailbox of a provided interface.  By
+  default, each required interface connected to a provided interface
+  gets its own mailbox with a single producer.  With multiple
+  producers, all end-user interfaces share a single lock-free mailbox.
+  See mtsInterfaceProvided::SetMailBoxProducerPolicy. */
+typedef enum {MTS_MAILBOX_SINGLE_PRODUCER, MTS_MAILBOX_MULTIPLE_PRODUCERS} mtsMailBoxProducerPolicy;
+
 /*! Type for optional functions and interfaces */
 typedef enum {MTS_OPTIONAL, MTS_REQUIRED} mtsRequiredType;
 
@@ -83,7 +90,10 @@ typedef mtsCommandQueuedVoidReturnBase<mtsCommandRead> mtsCommandQueuedRead;
 // write commands
 class mtsCommandWriteBase;
 template <class _classType, class _argumentType> class mtsCommandWrite;
+class mtsCommandQueuedWriteBase;
 class mtsFunctionWrite;
+class mtsSharedArgument;
+class mtsSharedArgumentPool;
 
 // write with returned value commands
 class mtsCallableWriteReturnBase;
@@ -131,6 +141,8 @@ class mtsTaskContinuous;
 class mtsTaskPeriodic;
 class mtsTaskFromCallback;
 class mtsTaskFromSignal;
+class mtsTaskPooled;
+class mtsTaskPool;
 
 // containers
 class mtsMailBox;
@@ -81,8 +81,11 @@ public:
     /*! Wait for return value (read, qualified read, void return, write return) */
     mtsExecutionResult WaitForResult(mtsGenericObject &arg) const;
 
-    /*! Wait for execution result (blocking void, blocking write) */
-    mtsExecutionResult WaitForResult(void) const;
+    /*! Wait for execution result (blocking void, blocking write).  The
+      result object should be passed to CompletionCommand->PrepareToWait
+      before the command is executed so the result can't be lost if the
+      command finishes before the caller starts waiting. */
+    mtsExecutionResult WaitForResult(mtsExecutionResultProxy &result) const;
 
 };
 
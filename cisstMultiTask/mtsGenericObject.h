@@ -154,6 +154,13 @@ template <> void CISST_EXPORT cmnData<mtsGenericObject>::SerializeBinary(const m
 template <> void CISST_EXPORT cmnData<mtsGenericObject>::DeSerializeBinary(mtsGenericObject & data, std::istream & inputStream,
                                                                            const cmnDataFormat & localFormat, const cmnDataFormat & remoteFormat) CISST_THROW(std::runtime_error);
 
+template <> size_t CISST_EXPORT cmnData<mtsGenericObject>::SerializeBinaryByteSize(const mtsGenericObject & data);
+
+template <> size_t CISST_EXPORT cmnData<mtsGenericObject>::SerializeBinary(const mtsGenericObject & data, char * buffer, size_t bufferSize);
+
+template <> size_t CISST_EXPORT cmnData<mtsGenericObject>::DeSerializeBinary(mtsGenericObject & data, const char * buffer, size_t bufferSize,
+                                                                             const cmnDataFormat & localFormat, const cmnDataFormat & remoteFormat);
+
 template <> void CISST_EXPORT cmnData<mtsGenericObject>::SerializeText(const mtsGenericObject & data, std::ostream & outputStream, const char delimiter) CISST_THROW(std::runtime_error);
 
 template <> std::string CISST_EXPORT cmnData<mtsGenericObject>::SerializeDescription(const mtsGenericObject & data, const char delimiter, const std::string & userDescription);
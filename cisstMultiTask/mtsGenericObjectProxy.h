@@ -109,10 +109,10 @@ public:
     inline static cmnGenericObject * Create(const cmnGenericObject & other) {
         const value_type * otherPointer = dynamic_cast<const value_type *>(&other);
         if (otherPointer)
-            return new value_type(*otherPointer);
+            return new(cmnClassServicesAllocate<value_type>()) value_type(*otherPointer);
         const value_reftype * otherRefPointer = dynamic_cast<const value_reftype *>(&other);
         if (otherRefPointer)
-            return new value_type(otherRefPointer->GetData());
+            return new(cmnClassServicesAllocate<value_type>()) value_type(otherRefPointer->GetData());
         return 0;
     }
 
@@ -168,7 +168,7 @@ public:
     /*! Specialization of create when dynamic create is enabled. */
     inline static _class * Create(const cmnGenericObject & arg) {
         const mtsGenericObject *mts = dynamic_cast<const mtsGenericObject *>(&arg);
-        if (mts) return new value_type(*mtsGenericTypes<_elementType>::CastArg(*mts));
+        if (mts) return new(cmnClassServicesAllocate<value_type>()) value_type(*mtsGenericTypes<_elementType>::CastArg(*mts));
         CMN_LOG_INIT_WARNING << "cmnConditionalObjectFactoryOneArg::Create for proxy could not create object" << std::endl;
         return 0;
     }
@@ -198,7 +198,7 @@ public:
         if (mts) {
             const _elementType *name = mtsGenericTypes<_elementType>::CastArg(*mts);
             if (name) {
-                _class *obj = new value_type;
+                _class *obj = new(cmnClassServicesAllocate<value_type>()) value_type;
                 obj->SetName(*name);
                 return obj;
             }
@@ -207,6 +207,45 @@ class CISST_EXPORT mtsInterfaceProvided: public mtsInterface {
       queues.  See SetMailBoxSize and SetArgumentQueuesSize. */
     void SetMailBoxAndArgumentQueuesSize(size_t desiredSize);
 
+    /*! Set the producer policy for the command mail box.  By
+      default (MTS_MAILBOX_SINGLE_PRODUCER), a mailbox is created for
+      each connected required interface and ProcessMailBoxes has to
+      iterate over all of them.  When using
+      MTS_MAILBOX_MULTIPLE_PRODUCERS, a single lock-free mailbox is
+      shared by all end-user interfaces.  Commands are still cloned
+      per end-user interface so each client keeps its own argument
+      queues but only one mailbox needs to be processed.  This is
+      recommended for interfaces with many clients.
+
+      The producer policy can't be changed once a required interface
+      is connected to the provided interface. */
+    void SetMailBoxProducerPolicy(mtsMailBoxProducerPolicy policy);
+
+    /*! Get the current mailbox producer policy. */
+    mtsMailBoxProducerPolicy GetMailBoxProducerPolicy(void) const { return MailBoxProducerPolicy; }
+
+    /*! Enable statistics for all queued commands of this interface.
+      For each command, the mailboxes record the time spent in the
+      queue, the execution time and the queue depth (see
+      mtsCommandStatistics).  The statistics are stored in a state
+      table named after the interface (interface name +
+      "CommandStatistics") added to the component so they can be read
+      safely from other threads.  This method also adds the read
+      command "GetCommandStatistics" and the void command
+      "ResetCommandStatistics" to this interface.
+
+      This should be called before the component is started, i.e.
+      usually in the component's constructor after all commands have
+      been added.  When statistics are not enabled, the overhead is a
+      single test when a command is queued and when it is executed.
+      Returns false if the interface doesn't queue commands. */
+    bool EnableCommandStatistics(void);
+
+    /*! Remove all samples collected since statistics have been
+      enabled.  This is the method used for the
+      "ResetCommandStatistics" command. */
+    void ResetCommandStatistics(void);
+
     /*! Get the names of commands provided by this interface. */
     //@{
     std::vector<std::string> GetNamesOfCommands(void) const;
@@ -606,7 +645,8 @@ class CISST_EXPORT mtsInterfaceProvided: public mtsInterface {
     mtsInterfaceProvided(mtsInterfaceProvided * interfaceProvided,
                          const std::string & userName,
                          size_t mailBoxSize,
-                         size_t argumentQueuesSize);
+                         size_t argumentQueuesSize,
+                         mtsMailBox * sharedMailBox = 0);
 
     static std::string GenerateEndUserInterfaceName(const mtsInterfaceProvided * originalInterface,
                                                     const std::string & userName);
@@ -648,6 +688,17 @@ protected: // PK TEMP
     template <class _MapType, class _QueuedType>
     void CloneCommands(const std::string &cmdType, const _MapType &CommandMapIn, _MapType &CommandMapOut);
 
+    /*! Templated utility method to set or remove the post dequeued
+      commands of the shared mailbox for all commands in a map */
+    template <class _MapType>
+    void SetSharedMailBoxPostCommandDequeuedCommands(const _MapType & commandMap, bool add);
+
+    /*! Set or remove the post dequeued commands of the shared mailbox
+      for all commands of this end-user interface.  The blocking
+      events are per end-user interface so they can't be set once for
+      the whole shared mailbox. */
+    void SetSharedMailBoxPostCommandDequeuedCommands(bool add);
+
     /*! Utility method to determine if a command should be queued or
       not based on the default policy for the interface and the user's
       requested policy.  This method also generates a warning or error
@@ -679,6 +730,29 @@ protected: // PK TEMP
     /*! Size to be used for argument queues */
     size_t ArgumentQueuesSize;
 
+    /*! Producer policy for mailboxes, see SetMailBoxProducerPolicy */
+    mtsMailBoxProducerPolicy MailBoxProducerPolicy;
+
+    /*! Mailbox shared by all end-user interfaces when the producer
+      policy is MTS_MAILBOX_MULTIPLE_PRODUCERS.  This is created by
+      the original interface when the first end-user interface is
+      created. */
+    mtsMailBox * SharedMailBox;
+
+    /*! End-user interfaces removed while using the shared mailbox.
+      Some of their commands might still be queued in the shared
+      mailbox so they are deleted by ProcessMailBoxes, once the shared
+      mailbox has been drained.  Protected by
+      InterfacesProvidedRemovedMutex since RemoveEndUserInterface is
+      not called by the thread processing the mailboxes. */
+    InterfaceProvidedCreatedListType InterfacesProvidedRemoved;
+    osaMutex InterfacesProvidedRemovedMutex;
+
+    /*! Statistics for queued commands, shared by all mailboxes of the
+      end-user interfaces.  0 unless EnableCommandStatistics has been
+      called. */
+    mtsCommandStatistics * CommandStatistics;
+
     /*! Command to trigger void event for blocking commands. */
     mtsCommandVoid * BlockingCommandExecuted;
 
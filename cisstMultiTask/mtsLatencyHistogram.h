@@ -0,0 +1,128 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Histogram for latencies and execution times
+*/
+
+#ifndef _mtsLatencyHistogram_h
+#define _mtsLatencyHistogram_h
+
+#include <cisstMultiTask/mtsGenericObject.h>
+
+#include <vector>
+
+// Always include last
+#include <cisstMultiTask/mtsExport.h>
+
+/*!
+  \ingroup cisstMultiTask
+
+  Histogram of durations (latencies, execution times...) used to
+  report percentiles without storing all samples.  Samples are
+  accumulated in microseconds using logarithmic buckets: one bucket
+  per microsecond below 32 us and 16 buckets per power of two above,
+  so the relative error on percentiles is at most 1/16 (about 6%).
+  Values of 2^26 microseconds (about 67 seconds) or more are
+  accumulated in the last bucket.
+  Min, max and mean are computed exactly.
+
+  Adding a sample doesn't allocate memory so this can be used in
+  real-time loops.
+ */
+class CISST_EXPORT mtsLatencyHistogram: public mtsGenericObject
+{
+    CMN_DECLARE_SERVICES(CMN_DYNAMIC_CREATION, CMN_LOG_ALLOW_DEFAULT);
+
+public:
+    /*! Base type */
+    typedef mtsGenericObject BaseType;
+
+    mtsLatencyHistogram(void);
+    ~mtsLatencyHistogram() {}
+
+    /*! Add one sample, in seconds.  Negative values are counted as
+      0. */
+    void Add(const double valueInSeconds);
+
+    /*! Remove all samples. */
+    void Reset(void);
+
+    /*! Number of samples added since last reset. */
+    inline unsigned long long NumberOfSamples(void) const {
+        return mNumberOfSamples;
+    }
+
+    /*! Minimum, maximum and mean of all samples, in seconds. */
+    //@{
+    double Min(void) const;
+    double Max(void) const;
+    double Mean(void) const;
+    //@}
+
+    /*! Value in seconds below which a given fraction of samples fall,
+      e.g. 0.99 for the 99th percentile.  The result is the upper
+      bound of the bucket containing the percentile, capped by the
+      maximum.  Returns 0 if the histogram is empty. */
+    double Percentile(const double fraction) const;
+
+    /*! Median and 99th percentile, in seconds. */
+    //@{
+    inline double P50(void) const {
+        return Percentile(0.50);
+    }
+    inline double P99(void) const {
+        return Percentile(0.99);
+    }
+    //@}
+
+    /*! Human readable text output */
+    void ToStream(std::ostream & outputStream) const override;
+
+    /*! Machine reabable text output */
+    void ToStreamRaw(std::ostream & outputStream, const char delimiter = ' ',
+                     bool headerOnly = false, const std::string & headerPrefix = "") const override;
+
+    /*! Serialize the content of the object without any extra
+      information, i.e. no class type nor format version. */
+    void SerializeRaw(std::ostream & outputStream) const override;
+
+    /*! De-serialize the content of the object without any extra
+      information, i.e. no class type nor format version. */
+    void DeSerializeRaw(std::istream & inputStream) override;
+
+protected:
+    /*! Bucket index for a value in microseconds. */
+    static size_t BucketIndex(const unsigned long long valueInMicroSeconds);
+
+    /*! Upper bound in microseconds of a bucket. */
+    static unsigned long long BucketUpperBound(const size_t index);
+
+    std::vector<unsigned int> mCounts;
+    unsigned long long mNumberOfSamples;
+    double mSum;
+    double mMin;
+    double mMax;
+};
+
+CMN_DECLARE_SERVICES_INSTANTIATION(mtsLatencyHistogram)
+
+#endif // _mtsLatencyHistogram_h
@@ -26,15 +26,59 @@ http://www.cisst.org/cisst/license.txt.
 #define _mtsMailBox_h
 
 #include <cisstMultiTask/mtsQueue.h>
+#include <cisstMultiTask/mtsQueueAtomic.h>
+#include <cisstMultiTask/mtsQueueMultipleProducers.h>
+
+#include <cisstOSAbstraction/osaMutex.h>
+
+#include <atomic>
+#include <unordered_map>
 
 // Always include last
 #include <cisstMultiTask/mtsExport.h>
 
 class mtsExecutionResult;
+class mtsCommandStatistics;
 
 class CISST_EXPORT mtsMailBox
 {
-    mtsQueue<mtsCommandBase *> CommandQueue;
+    /*! Element of the command queues.  The time the command was queued
+      is only set when statistics are collected, 0 otherwise. */
+    class QueueEntry {
+    public:
+        inline QueueEntry(mtsCommandBase * command = 0, const double queuedTime = 0.0):
+            Command(command),
+            QueuedTime(queuedTime)
+        {}
+        mtsCommandBase * Command;
+        double QueuedTime;
+    };
+
+    /*! Producer policy, determines which queue is used. */
+    mtsMailBoxProducerPolicy ProducerPolicy;
+
+    /*! Queue used with a single producer (default), i.e. one mailbox
+      per required interface.  Indices are atomic so that arguments
+      queued by the command before writing to the mailbox are visible
+      to the thread executing the command. */
+    mtsQueueAtomic<QueueEntry> CommandQueue;
+
+    /*! Entries removed from CommandQueue with GetN but not executed
+      yet, only used by the thread executing the commands.  Draining
+      the single producer queue in batches releases the slots to the
+      writer once per batch instead of once per command.  The number
+      of entries left is also stored in BatchAvailable so GetAvailable
+      and IsEmpty can be called by other threads. */
+    enum {BATCH_SIZE = 16};
+    QueueEntry Batch[BATCH_SIZE];
+    size_t BatchIndex;
+    size_t BatchCount;
+    std::atomic<size_t> BatchAvailable;
+
+    /*! Queue used when the mailbox is shared between multiple
+      producers, i.e. all required interfaces connected to the same
+      provided interface. */
+    mtsQueueMultipleProducers<QueueEntry> CommandQueueMultipleProducers;
 
     /*! Name provided for logs */
     std::string Name;
@@ -57,8 +101,56 @@ class CISST_EXPORT mtsMailBox
       to provide an event handler that is not queued. */
     mtsCommandVoid * PostCommandReturnDequeuedCommand;
 
+    /*! Commands executed after a command is de-queued when the mailbox
+      is shared by multiple end-user interfaces.  Each end-user
+      interface has its own blocking events so these are indexed by
+      queued command.  The map is protected by
+      PostCommandDequeuedMutex since end-user interfaces can be added
+      or removed while the mailbox is processed. */
+    typedef std::pair<mtsCommandVoid *, mtsCommandVoid *> PostCommandDequeuedPairType;
+    typedef std::unordered_map<const mtsCommandBase *, PostCommandDequeuedPairType> PostCommandDequeuedMapType;
+    PostCommandDequeuedMapType PostCommandDequeuedMap;
+    osaMutex PostCommandDequeuedMutex;
+
+    /*! Statistics updated by ExecuteNext, 0 if disabled.  The object
+      is owned by the provided interface and might be shared between
+      mailboxes processed by the same thread. */
+    std::atomic<mtsCommandStatistics *> Statistics;
+
+    /*! Cache of the command indices in Statistics to avoid looking up
+      commands by name.  Only used by the thread executing commands. */
+    std::unordered_map<const mtsCommandBase *, size_t> StatisticsIndices;
+
+    /*! Get the oldest command queued without removing it from the
+      queue, returns 0 if the mailbox is empty. */
+    inline const QueueEntry * PeekCommand(void) {
+        if (ProducerPolicy == MTS_MAILBOX_MULTIPLE_PRODUCERS) {
+            return CommandQueueMultipleProducers.Peek();
+        }
+        if (BatchIndex == BatchCount) {
+            BatchIndex = 0;
+            BatchCount = CommandQueue.GetN(Batch, BATCH_SIZE);
+            BatchAvailable.store(BatchCount, std::memory_order_relaxed);
+            if (BatchCount == 0) {
+                return 0;
+            }
+        }
+        return &(Batch[BatchIndex]);
+    }
+
+    /*! Remove the oldest command from the queue. */
+    inline void RemoveCommand(void) {
+        if (ProducerPolicy == MTS_MAILBOX_MULTIPLE_PRODUCERS) {
+            CommandQueueMultipleProducers.Get();
+        } else {
+            BatchIndex++;
+            BatchAvailable.store(BatchCount - BatchIndex, std::memory_order_relaxed);
+        }
+    }
+
     /*! Method to determine which post queued command needs to be triggered. */
-    void TriggerPostQueuedCommandIfNeeded(bool isBlocking, bool isBlockingReturn);
+    void TriggerPostQueuedCommandIfNeeded(const mtsCommandBase * command,
+                                          bool isBlocking, bool isBlockingReturn);
 
     /*! Method to genereate finished event, if needed. This will eventually replace
       the TriggerPostQueuedCommandIfNeeded method. */
@@ -66,15 +158,25 @@ class CISST_EXPORT mtsMailBox
                                       mtsGenericObject *resultPointer, const mtsExecutionResult &result) const;
 
 public:
+    /*! Constructor.  By default the mailbox assumes a single
+      producer, i.e. only one thread can call Write.  When the
+      producer policy is MTS_MAILBOX_MULTIPLE_PRODUCERS, the mailbox
+      uses a lock-free queue and Write can be called concurrently from
+      multiple threads.  In both cases, ExecuteNext should only be
+      called by the thread owning the mailbox. */
     mtsMailBox(const std::string & name,
                size_t size,
-               mtsCallableVoidBase * postCommandQueuedCallable = 0);
+               mtsCallableVoidBase * postCommandQueuedCallable = 0,
+               mtsMailBoxProducerPolicy producerPolicy = MTS_MAILBOX_SINGLE_PRODUCER);
 
     ~mtsMailBox(void);
 
     /*! Get the mailbox's name */
     const std::string & GetName(void) const;
 
+    /*! Get the producer policy, set by constructor. */
+    mtsMailBoxProducerPolicy GetProducerPolicy(void) const;
+
     /*! Write a command to the mailbox.  If a post command queued
       command has been provided, the command is executed. */
     bool Write(mtsCommandBase * command);
@@ -88,6 +190,9 @@ public:
       methods deletes whatever command has been queued. */
     void SetSize(size_t size);
 
+    /*! Get the size of the mailbox, i.e. the underlying queue. */
+    size_t GetSize(void) const;
+
     /*! Returns true if mailbox is empty. */
     bool IsEmpty(void) const;
 
@@ -112,6 +217,34 @@ public:
     void SetPostCommandReturnDequeuedCommand(mtsCommandVoid * command);
     mtsCommandVoid *GetPostCommandReturnDequeuedCommand(void) const;
 
+    /*! Set the commands to be called after a given queued command is
+      de-queued and executed.  This is used instead of
+      SetPostCommandDequeuedCommand and
+      SetPostCommandReturnDequeuedCommand when the mailbox is shared
+      by multiple end-user interfaces, each with its own blocking
+      events. */
+    void SetPostCommandDequeuedCommands(const mtsCommandBase * queuedCommand,
+                                        mtsCommandVoid * command,
+                                        mtsCommandVoid * commandReturn);
+
+    /*! Remove the commands set by SetPostCommandDequeuedCommands for a
+      queued command.  This must be called by the thread processing
+      the mailbox before the queued command is deleted. */
+    void RemovePostCommandDequeuedCommands(const mtsCommandBase * queuedCommand);
+
+    /*! Set the object used to collect statistics for all commands
+      executed from this mailbox: time spent in the queue, execution
+      time and queue depth.  Statistics are collected only if the
+      pointer is not null, otherwise the cost is a single test when a
+      command is queued and when it is executed.  The statistics
+      object must only be accessed by the thread calling
+      ExecuteNext. */
+    void SetStatistics(mtsCommandStatistics * statistics);
+    mtsCommandStatistics * GetStatistics(void) const;
+
+    /*! Time base used to timestamp queued commands, in seconds.  This
+      uses a monotonic clock. */
+    static double GetTime(void);
 };
 
 
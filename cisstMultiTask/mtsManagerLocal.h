@@ -65,6 +65,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstMultiTask/mtsManagerGlobalInterface.h>
 
 #include <stack>
+#include <map>
 
 #include <cisstMultiTask/mtsExport.h>
 
@@ -149,6 +150,21 @@ private:
     /*! Mutex to use ComponentMap safely */
     osaMutex ComponentMapChange;
 
+    /*! Parallel startup settings, see SetParallelStartup */
+    bool ParallelStartup;
+    size_t ParallelStartupNumberOfThreads;
+
+    /*! Time spent in Configure, Create and Start (including the wait
+      for the state change) by each component during the last
+      parallel startup, in seconds. */
+    struct StartupTimesType {
+        double Configure;
+        double Create;
+        double Start;
+    };
+    typedef std::map<std::string, StartupTimesType> StartupTimesMapType;
+    StartupTimesMapType StartupTimes;
+
     /*! Mutex for thread-safe transition of configuration from standalone mode to
         networked mode */
     static osaMutex ConfigurationChange;
@@ -255,6 +271,33 @@ protected:
     bool RegisterInterfaces(mtsComponent * component);
     bool RegisterInterfaces(const std::string & componentName);
 
+    /*! For each component, get the indices of the components providing
+      the interfaces its required interfaces are connected to, i.e. the
+      components it depends on.  Used for parallel startup. */
+    void GetStartupDependencies(const std::vector<mtsComponent *> & components,
+                                std::vector<std::vector<size_t> > & dependencies) const;
+
+    /*! Parallel implementations of CreateAll and StartAll, wait for
+      each component to reach the state READY or ACTIVE before
+      processing the components depending on it.  See
+      SetParallelStartup. */
+    //@{
+    bool CreateAllParallel(double timeoutInSeconds);
+    bool StartAllParallel(double timeoutInSeconds);
+    //@}
+
+#if CISST_HAS_JSON
+    /*! Steps of ConfigureComponentJSON: create the component, call its
+      Configure method and add it to the manager if needed. */
+    //@{
+    mtsComponent * CreateComponentJSON(const Json::Value & componentConfiguration);
+    void ConfigureCreatedComponentJSON(mtsComponent * component,
+                                       const Json::Value & componentConfiguration,
+                                       const cmnPath & configPath);
+    bool AddCreatedComponentJSON(mtsComponent * component);
+    //@}
+#endif
+
     // PK: following two methods were part of Connect method
     ConnectionIDType ConnectSetup(const std::string & clientComponentName, const std::string & clientInterfaceRequiredName,
                                   const std::string & serverComponentName, const std::string & serverInterfaceProvidedName);
@@ -315,7 +358,8 @@ public:
       methods ConfigureComponentJSON and ConfigureConnectionJSON for
       each element found.  The path is used to locate extra
       configuration files potentially used by Configure methods for
-      newly created components. */
+      newly created components.  See SetParallelStartup for the order
+      used when parallel startup is enabled. */
     bool ConfigureJSON(const Json::Value & configuration, const cmnPath & configPath);
 
     /*! Create, configure and add component based on Json::Value.
@@ -393,6 +437,40 @@ public:
     /*! Call KillAll method followed by WaitForStateAll. */
     bool KillAllAndWait(double timeoutInSeconds);
 
+    /*! Enable or disable parallel startup, disabled by default.  When
+      enabled, ConfigureJSON calls the Configure methods, CreateAll
+      creates and StartAll starts components concurrently using a
+      pool of numberOfThreads threads (0 to use one thread per
+      processor, at least 4).  The order follows the connections: a
+      component is processed only after the components providing the
+      interfaces its required interfaces are connected to have been
+      processed, i.e. reached the state READY for CreateAll and ACTIVE
+      for StartAll.  Components connected in a cycle are processed
+      concurrently.  Tasks using the calling thread are still created
+      and started from the calling thread.  CreateAll and StartAll
+      block until all components have reached the expected state (or
+      3 minutes) and the time spent for each component can be
+      displayed using StartupTimesToStream.
+
+      Parallel startup changes the order used by ConfigureJSON.  When
+      disabled, each component is created, configured and added to
+      the component manager before the next one is created.  When
+      enabled, all components are created first (sequentially), then
+      configured concurrently and finally added in the order of the
+      configuration file.  Constructors and Configure methods can't
+      rely on the components listed before them being in the
+      component manager and must not add their own component to the
+      component manager. */
+    void SetParallelStartup(const bool parallel, const size_t numberOfThreads = 0);
+
+    /*! Check if parallel startup is enabled, see SetParallelStartup. */
+    bool GetParallelStartup(void) const;
+
+    /*! Print the time spent by each component in Configure, Create
+      and Start during the last parallel startup, slowest components
+      first. */
+    void StartupTimesToStream(std::ostream & outputStream) const;
+
     /*! \brief Cleanup.  Since a local component manager is a singleton, the
                destructor will be called when the program exits but a library
                user is not capable of handling the timing. Thus, for safe
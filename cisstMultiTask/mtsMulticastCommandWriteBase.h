@@ -28,7 +28,9 @@ http://www.cisst.org/cisst/license.txt.
 #define _mtsMulticastCommandWriteBase_h
 
 
+#include <cisstMultiTask/mtsForwardDeclarations.h>
 #include <cisstMultiTask/mtsCommandWriteBase.h>
+#include <cisstMultiTask/mtsSharedArgument.h>
 #include <vector>
 
 // Always include last
@@ -39,6 +41,11 @@ http://www.cisst.org/cisst/license.txt.
 
   This class contains a vector of two or more command objects.
   The primary use of this class is to send events to all observers.
+
+  When two or more observers use queued commands, the event argument
+  is copied once in a reference counted mtsSharedArgument and all the
+  queued commands refer to it instead of copying the argument in
+  their own queue.  See SetUseSharedArguments.
  */
 class CISST_EXPORT mtsMulticastCommandWriteBase: public mtsCommandWriteBase
 {
@@ -49,10 +56,27 @@ public:
 protected:
     VectorType Commands;
 
+    /*! Same size as Commands, queued commands or 0 if the command is
+      not queued. */
+    std::vector<mtsCommandQueuedWriteBase *> QueuedCommands;
+    size_t NumberOfQueuedCommands;
+
+    bool UseSharedArguments;
+    mtsSharedArgumentPool SharedArguments;
+
+    /*! Execute all the commands, sharing the argument between queued
+      commands if possible. */
+    void ExecuteAll(const mtsGenericObject & argument);
+
+    /*! Update QueuedCommands after a command is added. */
+    void AddQueuedCommand(BaseType * command);
+
 public:
     /*! Default constructor. Does nothing. */
     mtsMulticastCommandWriteBase(const std::string & name):
-        BaseType(name)
+        BaseType(name),
+        NumberOfQueuedCommands(0),
+        UseSharedArguments(true)
     {}
 
     /*! Default destructor. Does nothing. */
@@ -68,6 +92,23 @@ public:
     virtual mtsExecutionResult Execute(const mtsGenericObject & argument,
                                        mtsBlockingType blocking) = 0;
 
+    /*! Enable or disable shared arguments for queued commands,
+      enabled by default.  When disabled, each queued command copies
+      the argument in its own queue. */
+    inline void SetUseSharedArguments(const bool useShared) {
+        UseSharedArguments = useShared;
+    }
+
+    inline bool GetUseSharedArguments(void) const {
+        return UseSharedArguments;
+    }
+
+    /*! Pool of shared arguments, can be used to retrieve the number
+      of copies and allocations. */
+    inline const mtsSharedArgumentPool & GetSharedArguments(void) const {
+        return SharedArguments;
+    }
+
     /* documented in base class */
     virtual void ToStream(std::ostream & outputStream) const;
 };
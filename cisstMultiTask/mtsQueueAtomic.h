@@ -0,0 +1,282 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Defines mtsQueueAtomic
+*/
+
+
+#ifndef _mtsQueueAtomic_h
+#define _mtsQueueAtomic_h
+
+#include <cisstCommon/cmnPortability.h>
+#include <cisstMultiTask/mtsGenericObjectProxy.h>
+
+#include <atomic>
+
+/*!
+  \ingroup cisstMultiTask
+
+  Defines a queue that can be accessed in a thread-safe manner,
+  assuming that there is only one reader and one writer.  This is a
+  variant of mtsQueue that doesn't rely on pointer updates being
+  atomic and implicitly ordered.  The head (modified by the writer)
+  and tail (modified by the reader) are stored as std::atomic indices
+  and updated with release semantic, then read with acquire semantic
+  by the other thread.  This guarantees that an element is fully
+  copied before the reader can see it and that a slot is no longer
+  used by the reader before the writer overwrites it.
+
+  The head and tail are on different cache lines and each thread
+  keeps a cached copy of the other thread's index so the shared cache
+  line is only read when the queue looks full (writer) or empty
+  (reader).
+
+  As for mtsQueue, a queue of size \c n can hold \c n - 1 elements.
+  PutN and GetN can be used to transfer multiple elements while
+  updating the shared indices only once.
+*/
+template <class _elementType>
+class mtsQueueAtomic
+{
+public:
+    typedef _elementType value_type;
+    typedef value_type * pointer;
+    typedef const value_type * const_pointer;
+    typedef value_type & reference;
+    typedef const value_type & const_reference;
+    typedef size_t size_type;
+    typedef size_t index_type;
+    typedef typename mtsGenericTypesUnwrap<value_type>::BaseType put_type;
+
+protected:
+    pointer Data;
+    size_type Size;
+
+    char PaddingHead[CMN_CACHE_LINE_SIZE];
+    /*! Writer's data, next slot to be written and last known tail */
+    std::atomic<index_type> Head;
+    index_type TailCache;
+    char PaddingTail[CMN_CACHE_LINE_SIZE - sizeof(std::atomic<index_type>) - sizeof(index_type)];
+    /*! Reader's data, next slot to be read and last known head */
+    std::atomic<index_type> Tail;
+    mutable index_type HeadCache;
+    char PaddingEnd[CMN_CACHE_LINE_SIZE - sizeof(std::atomic<index_type>) - sizeof(index_type)];
+
+    void Allocate(size_type size, const_reference value) {
+        this->Size = size;
+        if (this->Size > 0) {
+            this->Data = new value_type[this->Size];
+            index_type index;
+            for (index = 0; index < this->Size; index++) {
+                this->Data[index] = value;
+            }
+        } else {
+            this->Data = 0;
+        }
+        // head == tail implies empty queue
+        this->TailCache = 0;
+        this->HeadCache = 0;
+        this->Head.store(0, std::memory_order_relaxed);
+        this->Tail.store(0, std::memory_order_release);
+    }
+
+    inline index_type Next(index_type index) const {
+        index++;
+        return (index >= this->Size) ? 0 : index;
+    }
+
+private:
+    /*! Private copy constructor to prevent copies */
+    mtsQueueAtomic(const mtsQueueAtomic & CMN_UNUSED(other));
+
+public:
+
+    inline mtsQueueAtomic(void):
+        Data(0),
+        Size(0),
+        TailCache(0),
+        HeadCache(0)
+    {
+        this->Head.store(0, std::memory_order_relaxed);
+        this->Tail.store(0, std::memory_order_relaxed);
+    }
+
+
+    inline mtsQueueAtomic(size_type size, const_reference value) {
+        Allocate(size, value);
+    }
+
+
+    inline ~mtsQueueAtomic() {
+        delete [] Data;
+    }
+
+
+    /*! Sets the size of the queue (destructive, i.e. won't preserve
+      previously queued elements).  This method is not thread safe. */
+    inline void SetSize(size_type size, const_reference value) {
+        delete [] Data;
+        this->Allocate(size, value);
+    }
+
+
+    /*! Returns size of queue. */
+    inline size_type GetSize(void) const {
+        return Size;
+    }
+
+
+    /*! Returns number of elements available in queue, i.e. the number
+      of slots used. */
+    inline size_type GetAvailable(void) const {
+        const index_type head = this->Head.load(std::memory_order_acquire);
+        const index_type tail = this->Tail.load(std::memory_order_acquire);
+        return (head >= tail) ? (head - tail) : (head + this->Size - tail);
+    }
+
+
+    /*! Returns true if queue is full. */
+    inline bool IsFull(void) const {
+        if (this->Size == 0) {
+            return true;
+        }
+        return (this->Next(this->Head.load(std::memory_order_acquire))
+                == this->Tail.load(std::memory_order_acquire));
+    }
+
+
+    /*! Returns true if queue is empty. */
+    inline bool IsEmpty(void) const {
+        return (this->Head.load(std::memory_order_acquire)
+                == this->Tail.load(std::memory_order_acquire));
+    }
+
+
+    /*! Copy an object to the queue.  Only the writer thread should
+      call this method.
+      \param newObject reference to the object to be copied
+      \result Pointer to element in queue, 0 if the queue is full
+    */
+    inline const_pointer Put(const put_type & newObject) {
+        if (this->Size == 0) {
+            return 0;
+        }
+        const index_type head = this->Head.load(std::memory_order_relaxed);
+        const index_type newHead = this->Next(head);
+        if (newHead == this->TailCache) {
+            // looks full, refresh our copy of the reader's index
+            this->TailCache = this->Tail.load(std::memory_order_acquire);
+            if (newHead == this->TailCache) {
+                return 0; // queue full
+            }
+        }
+        this->Data[head] = newObject;
+        this->Head.store(newHead, std::memory_order_release);
+        return &(this->Data[head]);
+    }
+
+
+    /*! Copy up to \c count objects to the queue.  The head is only
+      published once, after all objects have been copied.  Only the
+      writer thread should call this method.
+      \result Number of objects actually queued
+    */
+    inline size_type PutN(const value_type * newObjects, size_type count) {
+        if (this->Size == 0) {
+            return 0;
+        }
+        index_type head = this->Head.load(std::memory_order_relaxed);
+        this->TailCache = this->Tail.load(std::memory_order_acquire);
+        size_type done = 0;
+        index_type newHead = this->Next(head);
+        while ((done < count) && (newHead != this->TailCache)) {
+            this->Data[head] = newObjects[done];
+            head = newHead;
+            newHead = this->Next(head);
+            done++;
+        }
+        if (done > 0) {
+            this->Head.store(head, std::memory_order_release);
+        }
+        return done;
+    }
+
+
+    /*! Get a pointer to the next object to be read, but do not
+        remove the item from the queue.  Only the reader thread should
+        call this method.
+        \result Pointer to top element in queue, 0 if empty
+     */
+    inline pointer Peek(void) const {
+        const index_type tail = this->Tail.load(std::memory_order_relaxed);
+        if (tail == this->HeadCache) {
+            this->HeadCache = this->Head.load(std::memory_order_acquire);
+            if (tail == this->HeadCache) {
+                return 0;
+            }
+        }
+        return &(this->Data[tail]);
+    }
+
+
+    /*! Pop the next object to be read from the queue.  Only the
+        reader thread should call this method.  The slot is released
+        to the writer so the pointer returned should be used before
+        the next Put.
+        \result Pointer to element just popped, 0 if empty
+     */
+    inline pointer Get(void) {
+        pointer result = this->Peek();
+        if (!result) {
+            return 0;
+        }
+        const index_type tail = this->Tail.load(std::memory_order_relaxed);
+        this->Tail.store(this->Next(tail), std::memory_order_release);
+        return result;
+    }
+
+
+    /*! Copy up to \c maxCount objects from the queue to \c objects
+      and remove them from the queue.  The tail is only published
+      once, after all objects have been copied.  Only the reader
+      thread should call this method.
+      \result Number of objects actually retrieved
+    */
+    inline size_type GetN(value_type * objects, size_type maxCount) {
+        index_type tail = this->Tail.load(std::memory_order_relaxed);
+        this->HeadCache = this->Head.load(std::memory_order_acquire);
+        size_type done = 0;
+        while ((done < maxCount) && (tail != this->HeadCache)) {
+            objects[done] = this->Data[tail];
+            tail = this->Next(tail);
+            done++;
+        }
+        if (done > 0) {
+            this->Tail.store(tail, std::memory_order_release);
+        }
+        return done;
+    }
+
+};
+
+
+#endif // _mtsQueueAtomic_h
@@ -0,0 +1,245 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Defines mtsQueueMultipleProducers
+*/
+
+
+#ifndef _mtsQueueMultipleProducers_h
+#define _mtsQueueMultipleProducers_h
+
+#include <cisstCommon/cmnPortability.h>
+
+#include <atomic>
+#include <cstddef>
+
+/*!
+  \ingroup cisstMultiTask
+
+  Defines a bounded, lock-free queue that can be accessed by multiple
+  writers (producers) and a single reader (consumer).  Each slot
+  carries a sequence number so producers can reserve a slot with a
+  single compare-and-swap on the enqueue position, copy their element
+  and then publish it.  The consumer only reads a slot once it has
+  been published so it never sees a partially written element.
+
+  The enqueue and dequeue positions are placed on separate cache lines
+  to avoid false sharing between producers and the consumer.
+
+  Contrary to mtsQueue, a queue of size \c n can hold \c n elements.
+  The API mimics mtsQueue (Put, Peek, Get) so it can be used as a
+  drop-in replacement for the mailbox command queue.  Peek and Get
+  must only be called by the consumer thread.
+
+  \sa mtsQueue, mtsMailBox
+*/
+template <class _elementType>
+class mtsQueueMultipleProducers
+{
+public:
+    typedef _elementType value_type;
+    typedef value_type * pointer;
+    typedef const value_type * const_pointer;
+    typedef value_type & reference;
+    typedef const value_type & const_reference;
+    typedef size_t size_type;
+    typedef size_t index_type;
+
+protected:
+    /*! Slot in the circular buffer.  The sequence number indicates
+      whether the slot is free for the producer at a given position
+      (sequence == position) or ready for the consumer (sequence ==
+      position + 1). */
+    class CellType {
+    public:
+        std::atomic<size_type> Sequence;
+        value_type Value;
+    };
+
+    CellType * Cells;
+    size_type Size;
+
+    char PaddingEnqueue[CMN_CACHE_LINE_SIZE];
+    std::atomic<size_type> EnqueuePosition;
+    char PaddingDequeue[CMN_CACHE_LINE_SIZE - sizeof(std::atomic<size_type>)];
+    std::atomic<size_type> DequeuePosition;
+    char PaddingEnd[CMN_CACHE_LINE_SIZE - sizeof(std::atomic<size_type>)];
+
+    void Allocate(size_type size, const_reference value) {
+        this->Size = size;
+        if (this->Size > 0) {
+            this->Cells = new CellType[this->Size];
+            for (index_type index = 0; index < this->Size; ++index) {
+                this->Cells[index].Sequence.store(index, std::memory_order_relaxed);
+                this->Cells[index].Value = value;
+            }
+        } else {
+            this->Cells = 0;
+        }
+        this->EnqueuePosition.store(0, std::memory_order_relaxed);
+        this->DequeuePosition.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+private:
+    /*! Private copy constructor to prevent copies */
+    mtsQueueMultipleProducers(const mtsQueueMultipleProducers & CMN_UNUSED(other));
+
+public:
+
+    inline mtsQueueMultipleProducers(void):
+        Cells(0),
+        Size(0)
+    {
+        this->EnqueuePosition.store(0, std::memory_order_relaxed);
+        this->DequeuePosition.store(0, std::memory_order_relaxed);
+    }
+
+
+    inline mtsQueueMultipleProducers(size_type size, const_reference value) {
+        Allocate(size, value);
+    }
+
+
+    inline ~mtsQueueMultipleProducers() {
+        delete [] Cells;
+    }
+
+
+    /*! Sets the size of the queue (destructive, i.e. won't preserve
+      previously queued elements).  This method is not thread safe. */
+    inline void SetSize(size_type size, const_reference value) {
+        delete [] Cells;
+        this->Allocate(size, value);
+    }
+
+
+    /*! Returns size of queue. */
+    inline size_type GetSize(void) const {
+        return Size;
+    }
+
+
+    /*! Returns number of elements available in queue, i.e. the number
+      of slots used.  When producers are active, this includes slots
+      that have been reserved but not yet published so the consumer
+      should still rely on Peek to find out if an element is ready. */
+    inline size_type GetAvailable(void) const {
+        const size_type dequeue = this->DequeuePosition.load(std::memory_order_acquire);
+        const size_type enqueue = this->EnqueuePosition.load(std::memory_order_acquire);
+        if (enqueue <= dequeue) {
+            return 0;
+        }
+        const size_type available = enqueue - dequeue;
+        return (available > this->Size) ? this->Size : available;
+    }
+
+
+    /*! Returns true if queue is full. */
+    inline bool IsFull(void) const {
+        return (GetAvailable() >= this->Size);
+    }
+
+
+    /*! Returns true if queue is empty. */
+    inline bool IsEmpty(void) const {
+        return (GetAvailable() == 0);
+    }
+
+
+    /*! Copy an object to the queue.  This method can be called
+      concurrently by multiple threads.
+      \param newObject reference to the object to be copied
+      \result Pointer to element in queue, 0 if the queue is full
+    */
+    inline const_pointer Put(const_reference newObject) {
+        if (this->Size == 0) {
+            return 0;
+        }
+        CellType * cell;
+        size_type position = this->EnqueuePosition.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &(this->Cells[position % this->Size]);
+            const size_type sequence = cell->Sequence.load(std::memory_order_acquire);
+            const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(position);
+            if (difference == 0) {
+                // slot is free, try to reserve it
+                if (this->EnqueuePosition.compare_exchange_weak(position, position + 1,
+                                                                std::memory_order_relaxed)) {
+                    break;
+                }
+                // compare_exchange_weak updated position, try again
+            } else if (difference < 0) {
+                return 0; // queue full
+            } else {
+                // another producer got this slot first
+                position = this->EnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        cell->Value = newObject;
+        // publish, consumer will see both the value and the sequence
+        cell->Sequence.store(position + 1, std::memory_order_release);
+        return &(cell->Value);
+    }
+
+
+    /*! Get a pointer to the next object to be read, but do not
+        remove the item from the queue.  Only the consumer thread
+        should call this method.
+        \result Pointer to top element in queue, 0 if no element has been published
+     */
+    inline pointer Peek(void) const {
+        if (this->Size == 0) {
+            return 0;
+        }
+        const size_type position = this->DequeuePosition.load(std::memory_order_relaxed);
+        CellType * cell = &(this->Cells[position % this->Size]);
+        if (cell->Sequence.load(std::memory_order_acquire) != (position + 1)) {
+            return 0;
+        }
+        return &(cell->Value);
+    }
+
+
+    /*! Pop the next object to be read from the queue.  Only the
+        consumer thread should call this method.  The slot is released
+        to the producers so the pointer returned should be used
+        immediately.
+        \result Pointer to element just popped, 0 if the queue is empty
+     */
+    inline pointer Get(void) {
+        pointer result = this->Peek();
+        if (!result) {
+            return 0;
+        }
+        const size_type position = this->DequeuePosition.load(std::memory_order_relaxed);
+        CellType * cell = &(this->Cells[position % this->Size]);
+        this->DequeuePosition.store(position + 1, std::memory_order_release);
+        // mark slot as free for the producer that will wrap around
+        cell->Sequence.store(position + this->Size, std::memory_order_release);
+        return result;
+    }
+
+};
+
+
+#endif // _mtsQueueMultipleProducers_h
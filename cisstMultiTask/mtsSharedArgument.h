@@ -0,0 +1,127 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Reference counted arguments shared by queued commands
+*/
+
+#ifndef _mtsSharedArgument_h
+#define _mtsSharedArgument_h
+
+#include <cisstMultiTask/mtsGenericObject.h>
+
+#include <atomic>
+#include <vector>
+
+// Always include last
+#include <cisstMultiTask/mtsExport.h>
+
+/*!
+  \ingroup cisstMultiTask
+
+  Immutable copy of a command argument referenced by multiple queued
+  commands.  This is used by mtsMulticastCommandWrite so an event
+  payload is copied once and all the queued event handlers refer to
+  the same copy instead of copying it in their own argument queue.
+
+  Each queued command holding the argument owns one reference and
+  releases it once the command has been executed.  The argument can
+  be re-used by its mtsSharedArgumentPool when the count drops to 0.
+ */
+class CISST_EXPORT mtsSharedArgument
+{
+    friend class mtsSharedArgumentPool;
+
+protected:
+    mtsGenericObject * Argument;
+    std::atomic<unsigned int> ReferenceCount;
+
+    mtsSharedArgument(mtsGenericObject * argument):
+        Argument(argument),
+        ReferenceCount(0)
+    {}
+
+    ~mtsSharedArgument() {
+        delete Argument;
+    }
+
+public:
+    inline const mtsGenericObject * GetArgument(void) const {
+        return Argument;
+    }
+
+    inline void AddReference(void) {
+        ReferenceCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /*! Release a reference, the argument must not be used after this. */
+    inline void Release(void) {
+        ReferenceCount.fetch_sub(1, std::memory_order_release);
+    }
+
+    inline unsigned int GetReferenceCount(void) const {
+        return ReferenceCount.load(std::memory_order_acquire);
+    }
+};
+
+
+/*!
+  \ingroup cisstMultiTask
+
+  Pool of shared arguments owned by a multicast command.  Arguments
+  are allocated on demand and re-used once all the commands referring
+  to them have been executed, so once the pool has grown to the
+  number of events in flight no memory is allocated.
+
+  As for the argument queues of queued commands, Acquire should only
+  be called by a single thread, i.e. the thread generating the event.
+ */
+class CISST_EXPORT mtsSharedArgumentPool
+{
+protected:
+    std::vector<mtsSharedArgument *> Arguments;
+    size_t Next;
+    unsigned long long NumberOfCopies;
+
+public:
+    mtsSharedArgumentPool(void);
+
+    /*! Delete all arguments.  Arguments still referenced by queued
+      commands are not deleted. */
+    ~mtsSharedArgumentPool();
+
+    /*! Copy the argument in an unused shared argument.  The result
+      has one reference owned by the caller, which must be released
+      after the argument has been queued. */
+    mtsSharedArgument * Acquire(const mtsGenericObject & argument);
+
+    /*! Number of shared arguments allocated so far. */
+    inline size_t GetSize(void) const {
+        return Arguments.size();
+    }
+
+    /*! Number of arguments copied, i.e. number of calls to Acquire. */
+    inline unsigned long long GetNumberOfCopies(void) const {
+        return NumberOfCopies;
+    }
+};
+
+#endif // _mtsSharedArgument_h
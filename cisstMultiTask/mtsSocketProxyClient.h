@@ -44,12 +44,14 @@ public:
     std::string Name;
     std::string IP;
     short Port;
+    bool SharedMemory;
 
-    mtsSocketProxyClientConstructorArg() : mtsGenericObject() {}
-    mtsSocketProxyClientConstructorArg(const std::string &name, const std::string &ip, short port) :
-        mtsGenericObject(), Name(name), IP(ip), Port(port) {}
+    mtsSocketProxyClientConstructorArg() : mtsGenericObject(), SharedMemory(false) {}
+    mtsSocketProxyClientConstructorArg(const std::string &name, const std::string &ip, short port,
+                                       bool sharedMemory = false) :
+        mtsGenericObject(), Name(name), IP(ip), Port(port), SharedMemory(sharedMemory) {}
     mtsSocketProxyClientConstructorArg(const mtsSocketProxyClientConstructorArg &other) : mtsGenericObject(),
-        Name(other.Name), IP(other.IP), Port(other.Port) {}
+        Name(other.Name), IP(other.IP), Port(other.Port), SharedMemory(other.SharedMemory) {}
     ~mtsSocketProxyClientConstructorArg() {}
 
     void SerializeRaw(std::ostream & outputStream) const override;
@@ -75,8 +77,14 @@ class CISST_EXPORT mtsSocketProxyClient : public mtsTaskContinuous
  protected:
 
     osaSocket Socket;
+    /*! Coalesces the commands sent during a Run cycle and fragments large
+        arguments, see mtsSocketProxyTransport */
+    mtsSocketProxyTransport Transport;
     mtsProxySerializer *Serializer;
 
+    /*! Buffer used to receive events, kept between calls to avoid memory allocations */
+    std::string InputArgString;
+
     mtsSocketProxyInitData ServerData;
 
     // For memory cleanup
@@ -94,6 +102,9 @@ class CISST_EXPORT mtsSocketProxyClient : public mtsTaskContinuous
       \return True if success, false otherwise */
     bool CreateClientProxy(const std::string & providedInterfaceName);
 
+    /*! Add the "Statistics" provided interface with the GetStatistics command */
+    void CreateStatisticsInterface(void);
+
     // For use by MulticastCommandVoidProxy and MulticastCommandWriteProxy
     mtsCommandWriteBase *EventEnableCommand;
     mtsCommandWriteBase *EventDisableCommand;
@@ -101,6 +112,7 @@ class CISST_EXPORT mtsSocketProxyClient : public mtsTaskContinuous
     void EventDisable(const std::string &eventName, const char *handle);
 
     void CheckForEvents(double timeoutInSec);
+    void ProcessMessage(std::string & inputArgString);
 
     friend class CommandWrapperBase;
     friend class MulticastCommandVoidProxy;
@@ -111,8 +123,12 @@ class CISST_EXPORT mtsSocketProxyClient : public mtsTaskContinuous
         \param name Name of the client proxy component
         \param ip IP address for corresponding server proxy
         \param port Port for corresponding server proxy (UDP socket)
+        \param sharedMemory Use a shared memory socket (osaSocket::SHARED_MEMORY) instead
+               of UDP, the server proxy must run on the same host and use shared memory
+               as well; ip is ignored
     */
-    mtsSocketProxyClient(const std::string &name, const std::string &ip, short port);
+    mtsSocketProxyClient(const std::string &name, const std::string &ip, short port,
+                         bool sharedMemory = false);
 
     mtsSocketProxyClient(const mtsSocketProxyClientConstructorArg &arg);
 
@@ -133,6 +149,9 @@ class CISST_EXPORT mtsSocketProxyClient : public mtsTaskContinuous
     bool Serialize(const mtsGenericObject & originalObject, std::string & serializedObject);
     bool DeSerialize(const std::string & serializedObject, mtsGenericObject & originalObject);
     mtsGenericObject * DeSerialize(const std::string & serializedObject);
+
+    /*! Get the number of packets, bytes and messages sent and received */
+    void GetStatistics(mtsSocketProxyStatistics & statistics) const;
 };
 
 CMN_DECLARE_SERVICES_INSTANTIATION(mtsSocketProxyClient)
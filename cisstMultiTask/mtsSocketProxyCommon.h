@@ -27,7 +27,11 @@ http://www.cisst.org/cisst/license.txt.
 #define _mtsSocketProxyCommon_h
 
 #include <string>
+#include <map>
+#include <vector>
 
+#include <cisstOSAbstraction/osaSocket.h>
+#include <cisstOSAbstraction/osaMutex.h>
 #include <cisstMultiTask/mtsGenericObject.h>
 
 #include <cisstMultiTask/mtsExport.h>
@@ -38,8 +42,9 @@ class mtsFunctionQualifiedRead;
 
 namespace mtsSocketProxy {
 
-    const unsigned int SOCKET_PROXY_VERSION = 0;
-    const unsigned int SOCKET_PROXY_PACKET_SIZE = 512;
+    const unsigned int SOCKET_PROXY_VERSION = 1;
+    // Maximum size of a datagram, small enough to fit in an Ethernet frame
+    const unsigned int SOCKET_PROXY_PACKET_SIZE = 1400;
 
 };
 
@@ -127,4 +132,188 @@ public:
 
 CMN_DECLARE_SERVICES_INSTANTIATION(mtsSocketProxyInitData);
 
+/*! Counters maintained by mtsSocketProxyTransport, available from the
+  client and server proxies with GetStatistics.  Messages are complete
+  commands, replies or events; packets are the datagrams sent or
+  received on the socket. */
+class CISST_EXPORT mtsSocketProxyStatistics : public mtsGenericObject
+{
+    CMN_DECLARE_SERVICES(CMN_DYNAMIC_CREATION, CMN_LOG_ALLOW_DEFAULT);
+public:
+    unsigned long long int PacketsSent;
+    unsigned long long int PacketsReceived;
+    unsigned long long int BytesSent;
+    unsigned long long int BytesReceived;
+    unsigned long long int MessagesSent;
+    unsigned long long int MessagesReceived;
+    /*! Number of datagrams sent again after a failed send */
+    unsigned long long int Retransmits;
+    /*! Messages that could not be sent and received messages that were
+      incomplete (missing fragments) or invalid */
+    unsigned long long int MessagesDropped;
+
+    mtsSocketProxyStatistics();
+    ~mtsSocketProxyStatistics() {}
+
+    void SerializeRaw(std::ostream & outputStream) const override;
+    void DeSerializeRaw(std::istream & inputStream) override;
+
+    void ToStream(std::ostream & outputStream) const override;
+
+    /*! Raw text output to stream */
+    void ToStreamRaw(std::ostream & outputStream, const char delimiter = ' ',
+                     bool headerOnly = false, const std::string & headerPrefix = "") const override;
+};
+
+CMN_DECLARE_SERVICES_INSTANTIATION(mtsSocketProxyStatistics);
+
+/*! Message layer used by mtsSocketProxyClient and mtsSocketProxyServer
+  on top of a UDP or shared memory osaSocket.
+
+  Each datagram starts with a header (HEADER_SIZE bytes) followed
+  either by a batch of messages, each preceded by its size, or by a
+  fragment of a single message too large to fit in one datagram.
+  Messages sent to the same destination are coalesced until Flush is
+  called (the proxies flush once per Run) or the datagram is full.
+
+  Fragments carry a message id, their index and the message size so
+  the receiver can reassemble them per sender.  On UDP, the sender
+  pauses after each FRAGMENT_WINDOW fragments so the receiver can keep
+  up.  When fragments are missing after NACK_TIMEOUT, the receiver
+  sends a negative acknowledgment with the missing ranges and the
+  sender retransmits them from the last MAX_SENT_MESSAGES fragmented
+  messages it keeps.  The receiver gives up after MAX_NACKS requests
+  without progress and a message still incomplete is dropped when the
+  next one from the same sender starts.
+
+  Send and Flush can be called from multiple threads, Receive should
+  only be called from one thread at a time. */
+class CISST_EXPORT mtsSocketProxyTransport
+{
+public:
+    enum {
+        HEADER_SIZE = 16,
+        RECORD_HEADER_SIZE = sizeof(unsigned int),
+        MAX_RETRANSMITS = 2,
+        FRAGMENT_WINDOW = 32,
+        MAX_SENT_MESSAGES = 8,
+        MAX_NACKS = 20,
+        DEFAULT_MAX_MESSAGE_SIZE = 64 * 1024 * 1024
+    };
+
+    /*! Time waited for the next fragment before asking for the missing ones */
+    static const double NACK_TIMEOUT;
+
+    mtsSocketProxyTransport(osaSocket & socket,
+                            unsigned int packetSize = mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE);
+    ~mtsSocketProxyTransport() {}
+
+    /*! Queue a message for the current destination of the socket, used
+      by clients which always send to the same server.  Messages larger
+      than a datagram are sent immediately as fragments.  Returns false
+      if a datagram could not be sent. */
+    bool Send(const char * message, size_t size);
+    bool Send(const std::string & message) {
+        return Send(message.data(), message.size());
+    }
+
+    /*! Queue a message for the given destination, used by servers.  The
+      pending datagram is flushed if the destination changes. */
+    bool Send(const osaIPandPort & destination, const char * message, size_t size);
+    bool Send(const osaIPandPort & destination, const std::string & message) {
+        return Send(destination, message.data(), message.size());
+    }
+
+    /*! Send the pending datagram, if any */
+    bool Flush(void);
+
+    /*! Get the next message, either from the last datagram received or
+      from the socket.  Waits up to timeoutStartSec for the first
+      datagram and timeoutNextSec for the missing fragments of a message.
+      Retransmission requests from the peers are also handled here.
+      \return Size of the message, 0 if none was received or -1 on error */
+    int Receive(std::string & message, osaIPandPort & sender,
+                double timeoutStartSec, double timeoutNextSec);
+
+    /*! True if the last datagram received contains more messages */
+    bool HasPendingMessage(void) const {
+        return (ReceivedOffset < ReceivedBatch.size());
+    }
+
+    void GetStatistics(mtsSocketProxyStatistics & statistics) const;
+
+    /*! Largest message accepted from fragments, larger messages are
+      dropped without allocating memory for them.  Default is
+      DEFAULT_MAX_MESSAGE_SIZE. */
+    void SetMaxMessageSize(size_t maxMessageSize) {
+        MaxMessageSize = maxMessageSize;
+    }
+    size_t GetMaxMessageSize(void) const {
+        return MaxMessageSize;
+    }
+
+protected:
+    osaSocket & Socket;
+    unsigned int PacketSize;
+    size_t MaxMessageSize;
+
+    // Protects sending state and counters
+    mutable osaMutex Mutex;
+    mtsSocketProxyStatistics Statistics;
+    unsigned int NextMessageId;
+
+    // Datagram being coalesced
+    std::vector<char> Pending;
+    size_t PendingSize;
+    size_t PendingMessages;
+    bool PendingUsesDestination;
+    osaIPandPort PendingDestination;
+
+    // Buffer for fragments and control packets
+    std::vector<char> Packet;
+
+    // Last fragmented messages sent, kept for retransmissions
+    struct SentMessage {
+        unsigned int Id;
+        std::string Data;
+        SentMessage(void) : Id(0) {}
+    };
+    std::vector<SentMessage> SentMessages;
+    size_t NextSentMessage;
+
+    // Last batch received and position of the next message in it
+    std::vector<char> ReceiveBuffer;
+    std::string ReceivedBatch;
+    size_t ReceivedOffset;
+    osaIPandPort ReceivedFrom;
+
+    // Messages being reassembled, one per sender
+    struct Reassembly {
+        unsigned int Id;
+        size_t Received;
+        std::vector<bool> Fragments;
+        std::string Data;
+        // time of the last fragment or request and number of requests since
+        unsigned int Nacks;
+        double LastUpdate;
+        Reassembly(void) : Id(0), Received(0), Nacks(0), LastUpdate(0.0) {}
+    };
+    typedef std::map<osaIPandPort, Reassembly> ReassemblyMapType;
+    ReassemblyMapType Reassemblies;
+
+    bool Queue(bool useDestination, const osaIPandPort & destination, const char * message, size_t size);
+    bool FlushLocked(void);
+    bool SendFragments(const char * message, size_t size);
+    bool SendFragment(unsigned int id, const char * message, size_t size, unsigned int index);
+    bool SendPacket(const char * packet, size_t size);
+    void PauseAfterFragments(size_t numberOfFragments) const;
+    bool NextBatchMessage(std::string & message);
+    bool AddFragment(const char * packet, size_t size, const osaIPandPort & sender,
+                     std::string & message);
+    bool SendNacks(void);
+    void SendNack(const osaIPandPort & sender, const Reassembly & entry);
+    void Retransmit(const osaIPandPort & sender, const char * packet, size_t size);
+    void CountDropped(void);
+};
+
 #endif // _mtsSocketProxyCommon_h
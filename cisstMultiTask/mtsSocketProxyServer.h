@@ -29,6 +29,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstOSAbstraction/osaSocket.h>
 #include <cisstMultiTask/mtsTaskContinuous.h>
 
+#include <cisstMultiTask/mtsSocketProxyCommon.h>
 #include <cisstMultiTask/mtsForwardDeclarations.h>
 
 class FunctionVoidProxy;
@@ -52,13 +53,17 @@ public:
     std::string ComponentName;
     std::string ProvidedInterfaceName;
     unsigned short Port;
+    bool SharedMemory;
 
-    mtsSocketProxyServerConstructorArg() : mtsGenericObject() {}
+    mtsSocketProxyServerConstructorArg() : mtsGenericObject(), SharedMemory(false) {}
     mtsSocketProxyServerConstructorArg(const std::string &name, const std::string &componentName,
-                                       const std::string &providedInterfaceName, unsigned short port) :
-        mtsGenericObject(), Name(name), ComponentName(componentName), ProvidedInterfaceName(providedInterfaceName), Port(port) {}
+                                       const std::string &providedInterfaceName, unsigned short port,
+                                       bool sharedMemory = false) :
+        mtsGenericObject(), Name(name), ComponentName(componentName), ProvidedInterfaceName(providedInterfaceName), Port(port),
+        SharedMemory(sharedMemory) {}
     mtsSocketProxyServerConstructorArg(const mtsSocketProxyServerConstructorArg &other) : mtsGenericObject(),
-        Name(other.Name), ComponentName(other.ComponentName), ProvidedInterfaceName(other.ProvidedInterfaceName), Port(other.Port) {}
+        Name(other.Name), ComponentName(other.ComponentName), ProvidedInterfaceName(other.ProvidedInterfaceName), Port(other.Port),
+        SharedMemory(other.SharedMemory) {}
     ~mtsSocketProxyServerConstructorArg() {}
 
     void SerializeRaw(std::ostream & outputStream) const override;
@@ -84,8 +89,14 @@ class CISST_EXPORT mtsSocketProxyServer : public mtsTaskContinuous
  protected:
 
     osaSocket Socket;
+    /*! Coalesces the replies and events sent during a Run cycle and fragments
+        large arguments, see mtsSocketProxyTransport */
+    mtsSocketProxyTransport Transport;
     mtsInterfaceProvidedDescription InterfaceDescription;
 
+    /*! Client that sent the message being processed */
+    osaIPandPort CurrentClient;
+
     /*! Typedef for client connections. The current design of the cisst serializer
         only sends the class services the first time an instance of the class is
         serialized; thus we need a separate serializer for each client. */
@@ -117,15 +128,25 @@ class CISST_EXPORT mtsSocketProxyServer : public mtsTaskContinuous
 
     FinishedEventList *FinishedEvents;
 
+    /*! Buffers used by Run to receive commands and send replies, kept
+        between calls to avoid memory allocations */
+    std::string InputArgString;
+    std::string OutputArgString;
+
     // For memory cleanup
     std::vector<mtsCommandBase *> SpecialCommands;
 
     bool Init(const std::string &componentName, const std::string &providedInterfaceName);
 
+    void ProcessMessage(std::string & inputArgString);
+
     /*! \brief Create server proxy
         \return True if success, false otherwise */
     bool CreateServerProxy(const std::string & requiredInterfaceName, size_t providedMailboxSize);
 
+    /*! Add the "Statistics" provided interface with the GetStatistics command */
+    void CreateStatisticsInterface(void);
+
     bool GetInterfaceDescription(mtsInterfaceProvidedDescription &desc) const;
     bool GetHandleVoid(const std::string &commandName, std::string &handleString) const;
     bool GetHandleRead(const std::string &commandName, std::string &handleString) const;
@@ -145,9 +166,13 @@ class CISST_EXPORT mtsSocketProxyServer : public mtsTaskContinuous
         \param componentName Name of the component for which proxy is being created
         \param providedInterfaceName Name of the provided interface (from componentName) for which proxy is being created
         \param port Port to use for socket (UDP)
+        \param sharedMemory Use a shared memory socket (osaSocket::SHARED_MEMORY) instead
+               of UDP, only clients running on the same host and using shared memory
+               can connect
     */
     mtsSocketProxyServer(const std::string & name, const std::string & componentName,
-                         const std::string & providedInterfaceName, unsigned short port);
+                         const std::string & providedInterfaceName, unsigned short port,
+                         bool sharedMemory = false);
 
     mtsSocketProxyServer(const mtsSocketProxyServerConstructorArg & arg);
 
@@ -175,6 +200,9 @@ class CISST_EXPORT mtsSocketProxyServer : public mtsTaskContinuous
 
     mtsCommandWriteBase *AllocateFinishedEvent(const std::string &eventHandle);
 
+    /*! Get the number of packets, bytes and messages sent and received */
+    void GetStatistics(mtsSocketProxyStatistics & statistics) const;
+
 };
 
 CMN_DECLARE_SERVICES_INSTANTIATION(mtsSocketProxyServer)
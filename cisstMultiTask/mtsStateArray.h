@@ -30,6 +30,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstCommon/cmnClassRegister.h>
 #include <cisstMultiTask/mtsGenericObjectProxy.h>
 #include <cisstMultiTask/mtsStateArrayBase.h>
+#include <cisstMultiTask/mtsStateArrayColumnar.h>
 
 #include <vector>
 #include <typeinfo>
@@ -127,6 +128,30 @@ public:
 	bool Get(index_type index, mtsGenericObject & object) const;
 	bool Set(index_type index, const mtsGenericObject & object);
     //@}
+
+    /*! Raw access, see mtsStateArrayBase.  Only available for types
+      supported by mtsStateArrayColumnarTraits. */
+    //@{
+    bool GetRawLayout(size_type & elementSize, char & scalarKind, size_type & scalarSize) const override {
+        typedef mtsStateArrayColumnarTraits<value_type> TraitsType;
+        if (!TraitsType::IS_SUPPORTED || this->Data.empty()) {
+            return false;
+        }
+        elementSize = TraitsType::PayloadSize(this->Data[0]);
+        scalarKind = mtsStateArrayScalarKind<typename TraitsType::ScalarType>();
+        scalarSize = sizeof(typename TraitsType::ScalarType);
+        return true;
+    }
+
+    bool GetRawElement(index_type index, void * destination, size_type size) const override {
+        typedef mtsStateArrayColumnarTraits<value_type> TraitsType;
+        if (!TraitsType::IS_SUPPORTED || (TraitsType::PayloadSize(this->Data[index]) != size)) {
+            return false;
+        }
+        memcpy(destination, TraitsType::Payload(this->Data[index]), size);
+        return true;
+    }
+    //@}
 };
 
 
@@ -27,6 +27,7 @@ http://www.cisst.org/cisst/license.txt.
 #ifndef _mtsStateArrayBase_h
 #define _mtsStateArrayBase_h
 
+#include <cisstCommon/cmnSerializer.h>
 #include <cisstMultiTask/mtsGenericObject.h>
 
 /*!
@@ -38,7 +39,7 @@ http://www.cisst.org/cisst/license.txt.
   in an homogenous container of pointers on different types of state
   arrays.
 
-  \sa mtsStateArray */
+  \sa mtsStateArray, mtsStateArrayColumnar */
 class mtsStateArrayBase {
 protected:
     /*! Protected constructor. Does nothing. */
@@ -74,6 +75,56 @@ public:
 
     virtual bool SetDataSize(const size_t size) = 0;
 
+    /*! Copy the current value of the state data element to the given
+      index.  This is used by mtsStateTable::Advance for arrays that
+      keep a pointer on the state data element (see
+      mtsStateArrayColumnar) to avoid the type checks performed by
+      Set.  Returns false if not supported, the caller should then
+      use Set.  Errors are reported by the array itself. */
+    virtual bool SetFromCurrent(index_type CMN_UNUSED(index)) {
+        return false;
+    }
+
+    /*! Layout of the raw payload of the elements, used to save the
+      state table history without serialization (see
+      mtsCollectorBase::COLLECTOR_FILE_FORMAT_COLUMNAR).  The element
+      size is in bytes and the payload is made of scalars of the given
+      kind (see mtsCollectorColumnarFormat::ScalarKind) and size.
+      Returns false if the elements don't have a contiguous payload. */
+    virtual bool GetRawLayout(size_type & CMN_UNUSED(elementSize),
+                              char & CMN_UNUSED(scalarKind),
+                              size_type & CMN_UNUSED(scalarSize)) const {
+        return false;
+    }
+
+    /*! Copy the raw payload of the element at index, \c size must
+      match the element size (see GetRawLayout). */
+    virtual bool GetRawElement(index_type CMN_UNUSED(index),
+                               void * CMN_UNUSED(destination),
+                               size_type CMN_UNUSED(size)) const {
+        return false;
+    }
+
+    /*! Stream, stream raw and serialize the element at index.  By
+      default these use the subscript operator.  Arrays that don't
+      store the elements as objects (see mtsStateArrayColumnar)
+      override them so readers don't have to share a temporary
+      object. */
+    //@{
+    virtual void ElementToStream(index_type index, std::ostream & outputStream) const {
+        (*this)[index].ToStream(outputStream);
+    }
+
+    virtual void ElementToStreamRaw(index_type index, std::ostream & outputStream, const char delimiter = ' ',
+                                    bool headerOnly = false, const std::string & headerPrefix = "") const {
+        (*this)[index].ToStreamRaw(outputStream, delimiter, headerOnly, headerPrefix);
+    }
+
+    virtual void ElementSerialize(index_type index, cmnSerializer & serializer) const {
+        serializer.Serialize((*this)[index]);
+    }
+    //@}
+
     bool SetSize(const size_t size){
         return SetDataSize(size);
     }
@@ -0,0 +1,521 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Defines a columnar state data array used in a state table.
+*/
+
+#ifndef _mtsStateArrayColumnar_h
+#define _mtsStateArrayColumnar_h
+
+#include <cisstCommon/cmnLogger.h>
+#include <cisstMultiTask/mtsGenericObjectProxy.h>
+#include <cisstMultiTask/mtsStateArrayBase.h>
+
+#include <cstring>
+#include <vector>
+#include <typeinfo>
+#include <type_traits>
+
+// forward declarations, specializations below only need the complete type when used
+template <class _elementType> class mtsVector;
+template <class _elementType, vct::size_type _size> class mtsFixedSizeVector;
+
+/*!
+  \ingroup cisstMultiTask
+
+  Traits used to decide if a state table element type can be stored
+  in a mtsStateArrayColumnar and to access its payload as raw memory.
+  _elementType is the final type stored in the state table (see
+  mtsGenericTypes).  By default, types are not supported and the
+  methods below are never called.  Specializations are provided for
+  proxies of arithmetic types (e.g. mtsDouble, mtsInt, mtsBool),
+  proxies and mts wrappers of fixed size vectors of arithmetic types
+  and mtsVector of arithmetic types.  IS_FIXED_SIZE is set for the
+  types whose payload is stored in the object itself, i.e. assigning
+  an element never reallocates memory (all but mtsVector).
+
+  For all supported types, the payload is a contiguous block of memory
+  that can be copied with memcpy.  ToStreamRaw and SerializeRaw write
+  the payload in the same format as the element's own methods, after
+  the mtsGenericObject fields.  The methods take an
+  mtsGenericObject since the element in the state table might be
+  either the final type or the reference type used when the user
+  registered a non mtsGenericObject (e.g. double instead of
+  mtsDouble).
+*/
+template <class _elementType>
+class mtsStateArrayColumnarTraits {
+public:
+    enum {IS_SUPPORTED = false, IS_FIXED_SIZE = false};
+    typedef char ScalarType;
+    inline static size_t PayloadSize(const mtsGenericObject & CMN_UNUSED(object)) {
+        return 0;
+    }
+    inline static const void * Payload(const mtsGenericObject & CMN_UNUSED(object)) {
+        return 0;
+    }
+    inline static void * Payload(mtsGenericObject & CMN_UNUSED(object), size_t CMN_UNUSED(size)) {
+        return 0;
+    }
+    inline static void ToStreamRaw(std::ostream & CMN_UNUSED(outputStream), const void * CMN_UNUSED(payload),
+                                   size_t CMN_UNUSED(size), const char CMN_UNUSED(delimiter),
+                                   bool CMN_UNUSED(headerOnly), const std::string & CMN_UNUSED(headerPrefix)) {
+    }
+    inline static void SerializeRaw(std::ostream & CMN_UNUSED(outputStream), const void * CMN_UNUSED(payload),
+                                    size_t CMN_UNUSED(size)) {
+    }
+};
+
+// proxies for arithmetic types, i.e. mtsDouble, mtsInt, mtsBool...
+template <class _elementType>
+class mtsStateArrayColumnarTraits<mtsGenericObjectProxy<_elementType> > {
+public:
+    enum {IS_SUPPORTED = std::is_arithmetic<_elementType>::value,
+          IS_FIXED_SIZE = IS_SUPPORTED};
+    typedef _elementType ScalarType;
+    typedef mtsGenericObjectProxyBase<_elementType> BaseType;
+    inline static size_t PayloadSize(const mtsGenericObject & CMN_UNUSED(object)) {
+        return sizeof(_elementType);
+    }
+    inline static const void * Payload(const mtsGenericObject & object) {
+        return &(static_cast<const BaseType &>(object).GetData());
+    }
+    inline static void * Payload(mtsGenericObject & object, size_t CMN_UNUSED(size)) {
+        return &(static_cast<BaseType &>(object).GetData());
+    }
+    inline static void ToStreamRaw(std::ostream & outputStream, const void * payload, size_t CMN_UNUSED(size),
+                                   const char delimiter, bool headerOnly, const std::string & headerPrefix) {
+        if (headerOnly) {
+            outputStream << delimiter << headerPrefix << "-data";
+        } else {
+            _elementType data;
+            memcpy(&data, payload, sizeof(_elementType));
+            outputStream << delimiter;
+            cmnDataProxy<_elementType, cmnData<_elementType>::IS_SPECIALIZED>::ToStreamRaw(outputStream, delimiter, data);
+        }
+    }
+    inline static void SerializeRaw(std::ostream & outputStream, const void * payload, size_t CMN_UNUSED(size)) {
+        _elementType data;
+        memcpy(&data, payload, sizeof(_elementType));
+        cmnSerializeRaw(outputStream, data);
+    }
+};
+
+// proxies for fixed size vectors, e.g. vct3
+template <class _elementType, vct::size_type _size>
+class mtsStateArrayColumnarTraits<mtsGenericObjectProxy<vctFixedSizeVector<_elementType, _size> > > {
+public:
+    enum {IS_SUPPORTED = std::is_arithmetic<_elementType>::value,
+          IS_FIXED_SIZE = IS_SUPPORTED};
+    typedef _elementType ScalarType;
+    typedef mtsGenericObjectProxyBase<vctFixedSizeVector<_elementType, _size> > BaseType;
+    inline static size_t PayloadSize(const mtsGenericObject & CMN_UNUSED(object)) {
+        return _size * sizeof(_elementType);
+    }
+    inline static const void * Payload(const mtsGenericObject & object) {
+        return static_cast<const BaseType &>(object).GetData().Pointer();
+    }
+    inline static void * Payload(mtsGenericObject & object, size_t CMN_UNUSED(size)) {
+        return static_cast<BaseType &>(object).GetData().Pointer();
+    }
+    inline static void ToStreamRaw(std::ostream & outputStream, const void * payload, size_t size,
+                                   const char delimiter, bool headerOnly, const std::string & headerPrefix) {
+        if (headerOnly) {
+            outputStream << delimiter << headerPrefix << "-data";
+        } else {
+            vctFixedSizeVector<_elementType, _size> data;
+            memcpy(data.Pointer(), payload, size);
+            outputStream << delimiter;
+            cmnDataProxy<vctFixedSizeVector<_elementType, _size>,
+                         cmnData<vctFixedSizeVector<_elementType, _size> >::IS_SPECIALIZED>::ToStreamRaw(outputStream, delimiter, data);
+        }
+    }
+    inline static void SerializeRaw(std::ostream & outputStream, const void * payload, size_t size) {
+        vctFixedSizeVector<_elementType, _size> data;
+        memcpy(data.Pointer(), payload, size);
+        cmnSerializeRaw(outputStream, data);
+    }
+};
+
+// mts fixed size vectors, e.g. mtsDouble3
+template <class _elementType, vct::size_type _size>
+class mtsStateArrayColumnarTraits<mtsFixedSizeVector<_elementType, _size> > {
+public:
+    enum {IS_SUPPORTED = std::is_arithmetic<_elementType>::value,
+          IS_FIXED_SIZE = IS_SUPPORTED};
+    typedef _elementType ScalarType;
+    typedef mtsFixedSizeVector<_elementType, _size> BaseType;
+    inline static size_t PayloadSize(const mtsGenericObject & CMN_UNUSED(object)) {
+        return _size * sizeof(_elementType);
+    }
+    inline static const void * Payload(const mtsGenericObject & object) {
+        return static_cast<const BaseType &>(object).Pointer();
+    }
+    inline static void * Payload(mtsGenericObject & object, size_t CMN_UNUSED(size)) {
+        return static_cast<BaseType &>(object).Pointer();
+    }
+    inline static void ToStreamRaw(std::ostream & outputStream, const void * payload, size_t size,
+                                   const char delimiter, bool headerOnly, const std::string & headerPrefix) {
+        vctFixedSizeVector<_elementType, _size> data;
+        memcpy(data.Pointer(), payload, size);
+        outputStream << delimiter;
+        data.ToStreamRaw(outputStream, delimiter, headerOnly, headerPrefix);
+    }
+    inline static void SerializeRaw(std::ostream & outputStream, const void * payload, size_t size) {
+        vctFixedSizeVector<_elementType, _size> data;
+        memcpy(data.Pointer(), payload, size);
+        data.SerializeRaw(outputStream);
+    }
+};
+
+// mts dynamic vectors, e.g. mtsDoubleVec.  The size used for the
+// columns is the size of the vector when the element is added to
+// the state table and can't change afterwards.
+template <class _elementType>
+class mtsStateArrayColumnarTraits<mtsVector<_elementType> > {
+public:
+    enum {IS_SUPPORTED = std::is_arithmetic<_elementType>::value,
+          IS_FIXED_SIZE = false};
+    typedef _elementType ScalarType;
+    typedef mtsVector<_elementType> BaseType;
+    inline static size_t PayloadSize(const mtsGenericObject & object) {
+        return static_cast<const BaseType &>(object).size() * sizeof(_elementType);
+    }
+    inline static const void * Payload(const mtsGenericObject & object) {
+        return static_cast<const BaseType &>(object).Pointer();
+    }
+    inline static void * Payload(mtsGenericObject & object, size_t size) {
+        BaseType & vector = static_cast<BaseType &>(object);
+        vector.SetSize(size / sizeof(_elementType));
+        return vector.Pointer();
+    }
+    inline static void ToStreamRaw(std::ostream & outputStream, const void * payload, size_t size,
+                                   const char delimiter, bool headerOnly, const std::string & headerPrefix) {
+        const vctDynamicConstVectorRef<_elementType> data(size / sizeof(_elementType),
+                                                          static_cast<const _elementType *>(payload));
+        outputStream << delimiter;
+        data.ToStreamRaw(outputStream, delimiter, headerOnly, headerPrefix);
+    }
+    inline static void SerializeRaw(std::ostream & outputStream, const void * payload, size_t size) {
+        const vctDynamicConstVectorRef<_elementType> data(size / sizeof(_elementType),
+                                                          static_cast<const _elementType *>(payload));
+        data.SerializeRaw(outputStream);
+    }
+};
+
+
+/*!
+  \ingroup cisstMultiTask
+
+  Kind of scalar, stored in files so readers can interpret the raw
+  payload of elements.  See mtsCollectorColumnarFormat::ScalarKind.
+*/
+template <class _scalarType>
+inline char mtsStateArrayScalarKind(void) {
+    if (std::is_same<_scalarType, bool>::value) {
+        return 'b';
+    }
+    if (std::is_floating_point<_scalarType>::value) {
+        return 'f';
+    }
+    if (std::is_integral<_scalarType>::value) {
+        return std::is_signed<_scalarType>::value ? 'i' : 'u';
+    }
+    return 0;
+}
+
+
+/*!
+  \ingroup cisstMultiTask
+
+  Columnar alternative to mtsStateArray.  Instead of storing a vector
+  of _elementType (each with its own virtual table, timestamp and
+  valid flag), the payloads are stored back to back in a single
+  contiguous buffer along with a column of timestamps and a column of
+  valid flags.  Writing the current value of the state data element
+  (see SetFromCurrent) and copying rows are done with memcpy and
+  scanning the history streams through memory.
+
+  This is only available for types supported by
+  mtsStateArrayColumnarTraits and is enabled per state table using
+  mtsStateTable::SetColumnarStorage.
+
+  Since the elements are not stored as objects, the subscript
+  operators return a reference to a per thread object updated from the
+  columns on each call.  The returned reference is only valid until
+  the next call from the same thread and modifying it doesn't modify
+  the history.  Readers using mtsStateTable::Accessor copy the data
+  directly in the caller's object with GetElement and
+  mtsCollectorState uses ElementToStreamRaw and ElementSerialize which
+  read the columns directly.
+*/
+template <class _elementType>
+class mtsStateArrayColumnar: public mtsStateArrayBase
+{
+public:
+    typedef _elementType value_type;
+    typedef mtsStateArrayColumnarTraits<value_type> TraitsType;
+    typedef typename mtsGenericTypesUnwrap<value_type>::RefType RefType;
+
+protected:
+    /*! Size of the payload for one element, in bytes. */
+    size_type ElementSize;
+
+    /*! Number of elements in the columns. */
+    size_type Length;
+
+    /*! Payloads, stored back to back. */
+    std::vector<char> Payloads;
+
+    /*! Timestamps. */
+    std::vector<double> Timestamps;
+
+    /*! Valid flags, not using std::vector<bool> to avoid bit operations. */
+    std::vector<char> ValidFlags;
+
+    /*! Current value of the state data element, i.e. the object
+      updated by the component, used by SetFromCurrent. */
+    const mtsGenericObject * Current;
+
+    /*! Set after a size mismatch has been logged so the error is not
+      repeated for every row, cleared once the size matches again. */
+    bool SizeMismatch;
+
+    /*! Object used to return mtsGenericObject references, one per
+      thread, see operator []. */
+    inline static value_type & Scratch(void) {
+        static thread_local value_type scratch;
+        return scratch;
+    }
+
+    inline char * PayloadPointer(index_type index) {
+        return &(this->Payloads[index * this->ElementSize]);
+    }
+
+    inline const char * PayloadPointer(index_type index) const {
+        return &(this->Payloads[index * this->ElementSize]);
+    }
+
+    /*! Copy the object to a given index without type checking. */
+    inline bool SetUnchecked(index_type index, const mtsGenericObject & object) {
+        if (TraitsType::PayloadSize(object) != this->ElementSize) {
+            if (!this->SizeMismatch) {
+                CMN_LOG_RUN_ERROR << "mtsStateArrayColumnar::Set -- size mismatch, expected "
+                                  << this->ElementSize << " bytes, received "
+                                  << TraitsType::PayloadSize(object) << " bytes for "
+                                  << typeid(value_type).name() << ", further errors not logged" << std::endl;
+                this->SizeMismatch = true;
+            }
+            return false;
+        }
+        this->SizeMismatch = false;
+        memcpy(this->PayloadPointer(index), TraitsType::Payload(object), this->ElementSize);
+        this->Timestamps[index] = object.Timestamp();
+        this->ValidFlags[index] = object.Valid();
+        return true;
+    }
+
+    /*! Copy from the columns to an object without type checking. */
+    inline void GetUnchecked(index_type index, mtsGenericObject & object) const {
+        memcpy(TraitsType::Payload(object, this->ElementSize), this->PayloadPointer(index), this->ElementSize);
+        object.SetTimestamp(this->Timestamps[index]);
+        object.SetValid(this->ValidFlags[index] != 0);
+    }
+
+public:
+    /*! Constructor.  The object example is used to determine the size
+      of the payload.  The current object is the state data element
+      added to the state table. */
+    inline mtsStateArrayColumnar(const value_type & objectExample,
+                                 size_type size,
+                                 const mtsGenericObject * current):
+        ElementSize(TraitsType::PayloadSize(objectExample)),
+        Length(0),
+        Current(current),
+        SizeMismatch(false)
+    {
+        this->SetDataSize(size);
+        for (index_type index = 0; index < size; ++index) {
+            this->SetUnchecked(index, objectExample);
+        }
+    }
+
+    /*! Default destructor. */
+    virtual ~mtsStateArrayColumnar() {}
+
+    bool SetDataSize(const size_t size) {
+        this->Payloads.resize(size * this->ElementSize);
+        this->Timestamps.resize(size, 0.0);
+        this->ValidFlags.resize(size, 0);
+        // initialize new elements with the last known value
+        for (index_type index = this->Length; (this->Length > 0) && (index < size); ++index) {
+            memcpy(this->PayloadPointer(index), this->PayloadPointer(this->Length - 1), this->ElementSize);
+        }
+        this->Length = size;
+        return true;
+    }
+
+    /*! Size of the payload for a single element, in bytes. */
+    inline size_type GetElementSize(void) const {
+        return this->ElementSize;
+    }
+
+    /*! Raw access to the columns, mostly for tools that need to scan
+      the history.  Payloads are stored back to back,
+      GetElementSize() bytes each. */
+    //@{
+    inline const void * GetPayloadColumn(void) const {
+        return this->Payloads.empty() ? 0 : &(this->Payloads[0]);
+    }
+    inline const double * GetTimestampColumn(void) const {
+        return this->Timestamps.empty() ? 0 : &(this->Timestamps[0]);
+    }
+    //@}
+
+    /*! Copy element at index to an existing object of the final type. */
+    inline void GetElement(index_type index, value_type & data) const {
+        this->GetUnchecked(index, data);
+    }
+
+    /*! Overloaded [] operator.  See class documentation, the returned
+      object is updated on each call. */
+    //@{
+    inline mtsGenericObject & operator[](index_type index) {
+        value_type & scratch = Scratch();
+        this->GetUnchecked(index, scratch);
+        return scratch;
+    }
+    inline const mtsGenericObject & operator[](index_type index) const {
+        value_type & scratch = Scratch();
+        this->GetUnchecked(index, scratch);
+        return scratch;
+    }
+    //@}
+
+    /*! Stream using a temporary object, see mtsStateArrayBase. */
+    void ElementToStream(index_type index, std::ostream & outputStream) const override {
+        value_type element;
+        this->GetUnchecked(index, element);
+        element.ToStream(outputStream);
+    }
+
+    /*! Stream raw and serialize from the columns, used by
+      mtsCollectorState for every row.  The output is the same as the
+      element's ToStreamRaw and Serialize.  The automatic timestamp
+      flag is not stored in the columns and is written with its
+      default value. */
+    //@{
+    void ElementToStreamRaw(index_type index, std::ostream & outputStream, const char delimiter = ' ',
+                            bool headerOnly = false, const std::string & headerPrefix = "") const override {
+        if (headerOnly) {
+            outputStream << headerPrefix << "-timestamp" << delimiter
+                         << headerPrefix << "-automatic-timestamp" << delimiter
+                         << headerPrefix << "-valid";
+        } else {
+            outputStream << this->Timestamps[index] << delimiter
+                         << true << delimiter
+                         << (this->ValidFlags[index] != 0);
+        }
+        TraitsType::ToStreamRaw(outputStream, this->PayloadPointer(index), this->ElementSize,
+                                delimiter, headerOnly, headerPrefix);
+    }
+
+    void ElementSerialize(index_type index, cmnSerializer & serializer) const override {
+        // class services and type identifier only, object is not serialized
+        serializer.Serialize(Scratch(), false);
+        std::ostream & outputStream = serializer.GetOutputStream();
+        const bool automaticTimestamp = true;
+        const bool valid = (this->ValidFlags[index] != 0);
+        cmnSerializeRaw(outputStream, this->Timestamps[index]);
+        cmnSerializeRaw(outputStream, automaticTimestamp);
+        cmnSerializeRaw(outputStream, valid);
+        TraitsType::SerializeRaw(outputStream, this->PayloadPointer(index), this->ElementSize);
+    }
+    //@}
+
+    /* Create the array of data.  This is currently unused and not
+       supported for columnar arrays. */
+    inline mtsStateArrayBase * Create(const mtsGenericObject * CMN_UNUSED(objectExample),
+                                      size_type CMN_UNUSED(size)) {
+        CMN_LOG_INIT_ERROR << "mtsStateArrayColumnar: Create is not supported" << std::endl;
+        return 0;
+    }
+
+    /*! Copy data from one index to another within the same array. */
+    inline void Copy(index_type indexTo, index_type indexFrom) {
+        memcpy(this->PayloadPointer(indexTo), this->PayloadPointer(indexFrom), this->ElementSize);
+        this->Timestamps[indexTo] = this->Timestamps[indexFrom];
+        this->ValidFlags[indexTo] = this->ValidFlags[indexFrom];
+    }
+
+    /*! Get and Set data from array, see mtsStateArray. */
+    //@{
+    bool Get(index_type index, mtsGenericObject & object) const {
+        if (dynamic_cast<value_type *>(&object) || dynamic_cast<RefType *>(&object)) {
+            this->GetUnchecked(index, object);
+            return true;
+        }
+        CMN_LOG_RUN_ERROR << "mtsStateArrayColumnar::Get -- type mismatch, expected " << typeid(value_type).name() << std::endl;
+        return false;
+    }
+
+    bool Set(index_type index, const mtsGenericObject & object) {
+        if (dynamic_cast<const value_type *>(&object) || dynamic_cast<const RefType *>(&object)) {
+            return this->SetUnchecked(index, object);
+        }
+        CMN_LOG_RUN_ERROR << "mtsStateArrayColumnar::Set -- type mismatch, expected " << typeid(value_type).name() << std::endl;
+        return false;
+    }
+    //@}
+
+    /*! Raw access, see mtsStateArrayBase. */
+    //@{
+    bool GetRawLayout(size_type & elementSize, char & scalarKind, size_type & scalarSize) const override {
+        elementSize = this->ElementSize;
+        scalarKind = mtsStateArrayScalarKind<typename TraitsType::ScalarType>();
+        scalarSize = sizeof(typename TraitsType::ScalarType);
+        return TraitsType::IS_SUPPORTED;
+    }
+
+    bool GetRawElement(index_type index, void * destination, size_type size) const override {
+        if (size != this->ElementSize) {
+            return false;
+        }
+        memcpy(destination, this->PayloadPointer(index), size);
+        return true;
+    }
+    //@}
+
+    /*! Copy the current value of the state data element, type was
+      checked when the array was created.  A size mismatch is logged
+      once by SetUnchecked, there is no need for the caller to try Set
+      so this returns true as long as there is a current element. */
+    bool SetFromCurrent(index_type index) override {
+        if (!this->Current) {
+            return false;
+        }
+        this->SetUnchecked(index, *(this->Current));
+        return true;
+    }
+};
+
+#endif // _mtsStateArrayColumnar_h
@@ -30,6 +30,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstMultiTask/mtsForwardDeclarations.h>
 #include <cisstMultiTask/mtsStateArrayBase.h>
 #include <cisstMultiTask/mtsStateArray.h>
+#include <cisstMultiTask/mtsStateArrayColumnar.h>
 #include <cisstMultiTask/mtsStateIndex.h>
 #include <cisstMultiTask/mtsFunctionVoid.h>
 #include <cisstMultiTask/mtsFunctionRead.h>
@@ -39,6 +40,7 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <vector>
 #include <iostream>
+#include <atomic>
 
 // Always include last
 #include <cisstMultiTask/mtsExport.h>
@@ -170,30 +172,117 @@ public:
         typedef typename mtsGenericTypes<_elementType>::FinalType value_type;
         typedef typename mtsGenericTypes<_elementType>::FinalRefType value_ref_type;
         typedef typename mtsStateTable::Accessor<_elementType> ThisType;
-        const mtsStateArray<value_type> & History;
+        // only one of History or Columns is used, see mtsStateTable::SetColumnarStorage
+        const mtsStateArray<value_type> * History;
+        const mtsStateArrayColumnar<value_type> * Columns;
         value_ref_type * Current;
 
     public:
         Accessor(const mtsStateTable & table, mtsStateDataId id,
-                 const mtsStateArray<value_type> * history, value_ref_type * data):
-            AccessorBase(table, id), History(*history), Current(data) {}
+                 const mtsStateArrayBase * history, value_ref_type * data):
+            AccessorBase(table, id),
+            History(dynamic_cast<const mtsStateArray<value_type> *>(history)),
+            Columns(dynamic_cast<const mtsStateArrayColumnar<value_type> *>(history)),
+            Current(data) {}
 
         void ToStream(std::ostream & outputStream, const mtsStateIndex & when) const {
-            History.Element(when.Index()).ToStream(outputStream);
+            if (History) {
+                History->Element(when.Index()).ToStream(outputStream);
+            } else {
+                Columns->ElementToStream(when.Index(), outputStream);
+            }
         }
 
         bool Get(const mtsStateIndex & when, value_type & data) const {
-            data = History.Element(when.Index());
+            if (History) {
+                data = History->Element(when.Index());
+            } else {
+                Columns->GetElement(when.Index(), data);
+            }
             return Table.ValidateReadIndex(when);
         }
 
         //This should be used with caution because
         //the state table mechanism could override the data that the pointer is pointing to.
+        //Returns 0 and logs an error when the element uses columnar storage, use Get instead.
         const value_type * GetPointer(const mtsStateIndex & when) const {
+            if (!History) {
+                CMN_LOG_RUN_ERROR << "mtsStateTable::Accessor::GetPointer: element uses columnar storage in state table \""
+                                  << Table.GetName() << "\", use Get instead" << std::endl;
+                return 0;
+            }
             if (!Table.ValidateReadIndex(when))
                 return 0;
             else
-                return  &(History.Element(when.Index()));
+                return  &(History->Element(when.Index()));
+        }
+
+        /*! Returns true if GetPointer can be used, i.e. the element
+          doesn't use columnar storage.  See also SupportsZeroCopyRead. */
+        bool SupportsPointers(void) const {
+            return (History != 0);
+        }
+
+        /*! Returns true if BeginRead and ReadLatest can be used, i.e.
+          the element doesn't use columnar storage and has a fixed size
+          (see mtsStateArrayColumnarTraits::IS_FIXED_SIZE). */
+        bool SupportsZeroCopyRead(void) const {
+            return (History != 0) && mtsStateArrayColumnarTraits<value_type>::IS_FIXED_SIZE;
+        }
+
+        /*! Zero-copy read of the latest row, seqlock style.  Returns a
+          pointer on the element stored in the history and sets \c
+          when to the corresponding state index, no data is copied.
+          The element is only guaranteed to be consistent if
+          EndRead(when) returns true once the caller is done reading
+          it, otherwise Advance has overwritten the row in the meantime
+          and whatever was read should be discarded (and the read
+          retried).  The row is overwritten after HistoryLength - 1
+          calls to Advance.
+
+          The seqlock check only protects the content of the element,
+          not its memory, so this is limited to fixed size elements.
+          For types such as mtsVector or strings, Advance could
+          reallocate the element while it is being read.  Returns 0 if
+          the element has a variable size or is stored in columnar
+          storage (see SupportsZeroCopyRead and SetColumnarStorage). */
+        const value_type * BeginRead(mtsStateIndex & when) const {
+            if (!SupportsZeroCopyRead()) {
+                CMN_LOG_RUN_ERROR << "mtsStateTable::Accessor::BeginRead: element uses columnar storage or doesn't have a fixed size in state table \""
+                                  << Table.GetName() << "\", use Get instead" << std::endl;
+                return 0;
+            }
+            when = Table.GetIndexReader();
+            return &(History->Element(when.Index()));
+        }
+
+        /*! Ends a zero-copy read started with BeginRead.  Returns
+          false if the row has been overwritten since BeginRead. */
+        bool EndRead(const mtsStateIndex & when) const {
+            return Table.ValidateReadIndex(when);
+        }
+
+        /*! Zero-copy read of the latest row using a callable object
+          with the signature void(const value_type &), e.g. a lambda.
+          The callable object is called again if the row was
+          overwritten while it was used, so it shouldn't have side
+          effects other than computing its result.  Returns false if
+          no consistent read was possible after \c maxAttempts or if
+          BeginRead is not supported. */
+        template <class _readerType>
+        bool ReadLatest(_readerType && reader, size_t maxAttempts = 3) const {
+            mtsStateIndex when;
+            for (size_t attempt = 0; attempt < maxAttempts; ++attempt) {
+                const value_type * data = BeginRead(when);
+                if (!data) {
+                    return false;
+                }
+                reader(*data);
+                if (EndRead(when)) {
+                    return true;
+                }
+            }
+            return false;
         }
 
         bool Get(const mtsStateIndex & when, mtsGenericObject & data) const {
@@ -257,6 +346,9 @@ public:
       default. */
     bool AutomaticAdvanceFlag;
 
+    /*! Columnar storage flag, see SetColumnarStorage. */
+    bool ColumnarStorageFlag;
+
     /*! The vector contains pointers to individual columns. */
     std::vector<mtsStateArrayBase *> StateVector;
 
@@ -343,9 +435,15 @@ public:
     /*! Set delay in number of rows. */
     size_t SetDelay(size_t newDelay);
 
-    /*! Verifies if the data is valid. */
+    /*! Verifies if the data is valid.  This can be used after
+      reading a row to make sure the row hasn't been overwritten in
+      the meantime.  The acquire fence prevents the reads of the row
+      from being moved after the check (see Advance for the matching
+      release fence). */
     inline bool ValidateReadIndex(const mtsStateIndex &timeIndex) const {
-        return (Ticks[timeIndex.Index()] == timeIndex.Ticks());
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const volatile mtsStateIndex::TimeTicksType & ticks = Ticks[timeIndex.Index()];
+        return (ticks == timeIndex.Ticks());
     }
 
     /*! Get method for auto advance flag. See AutomaticAdvanceFlag */
@@ -358,6 +456,24 @@ public:
         this->AutomaticAdvanceFlag = automaticAdvance;
     }
 
+    /*! Use columnar storage for elements added after this call (false
+      by default).  With columnar storage, the history of supported
+      types (see mtsStateArrayColumnarTraits) is stored in contiguous
+      typed arrays with separate columns for timestamps and valid
+      flags.  Advance then copies each element with a memcpy and
+      history scans (e.g. mtsCollectorState) stream through memory.
+      Other types keep using mtsStateArray.  For dynamic vectors, the
+      size can't change after the element is added.  Tic, Toc and
+      Period are added by the constructor so they are not affected. */
+    inline void SetColumnarStorage(bool columnarStorage) {
+        this->ColumnarStorageFlag = columnarStorage;
+    }
+
+    /*! Get method for columnar storage flag, see SetColumnarStorage. */
+    inline bool ColumnarStorage(void) const {
+        return this->ColumnarStorageFlag;
+    }
+
     /*! Check if the signal has been registered. */
     int GetStateVectorID(const std::string & dataName) const;
 
@@ -534,10 +650,14 @@ template <class _elementType>
 mtsStateDataId mtsStateTable::NewElement(const std::string & name, _elementType * element) {
     typedef typename mtsGenericTypes<_elementType>::FinalType FinalType;
     typedef typename mtsGenericTypes<_elementType>::FinalRefType FinalRefType;
-    mtsStateArray<FinalType> * elementHistory =
-        new mtsStateArray<FinalType>(*element, HistoryLength);
-    StateVector.push_back(elementHistory);
     FinalRefType *pdata = mtsGenericTypes<_elementType>::ConditionalWrap(*element);
+    mtsStateArrayBase * elementHistory;
+    if (ColumnarStorageFlag && mtsStateArrayColumnarTraits<FinalType>::IS_SUPPORTED) {
+        elementHistory = new mtsStateArrayColumnar<FinalType>(*element, HistoryLength, pdata);
+    } else {
+        elementHistory = new mtsStateArray<FinalType>(*element, HistoryLength);
+    }
+    StateVector.push_back(elementHistory);
     StateVectorElements.push_back(pdata);
 
     StateVectorDataNames.push_back(name);
@@ -43,6 +43,7 @@ class CISST_EXPORT mtsTaskContinuous: public mtsTask
     CMN_DECLARE_SERVICES(CMN_NO_DYNAMIC_CREATION, CMN_LOG_ALLOW_DEFAULT);
 
     friend class mtsComponentManager;
+    friend class mtsManagerLocal;
 
 public:
     typedef mtsTask BaseType;
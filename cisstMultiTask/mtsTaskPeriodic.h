@@ -28,6 +28,9 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstMultiTask/mtsTaskContinuous.h>
 #include <cisstOSAbstraction/osaThreadBuddy.h>
 #include <cisstOSAbstraction/osaTimeServer.h>
+#include <cisstOSAbstraction/osaCPUAffinity.h>
+#include <cisstMultiTask/mtsFunctionWrite.h>
+#include <cisstMultiTask/mtsLatencyHistogram.h>
 
 // Always include last
 #include <cisstMultiTask/mtsExport.h>
@@ -64,6 +67,37 @@ class CISST_EXPORT mtsTaskPeriodic : public mtsTaskContinuous
       time systems. */
     bool IsHardRealTime;
 
+    /*! Deadline scheduling, see SetDeadlineScheduling. */
+    //@{
+    bool UseDeadlines;
+    int RealTimePriority;
+    osaCPUMask CPUMask;
+    //@}
+
+    /*! Timing statistics, only updated when deadline scheduling is
+      used.  These are accessed using queued commands so they are
+      only modified and read by the task's thread. */
+    //@{
+    mtsLatencyHistogram WakeUpLatency;
+    mtsLatencyHistogram ExecutionTime;
+    unsigned int NumberOfOverruns;
+    mtsFunctionWrite OverrunEvent;
+    //@}
+
+    /*! Report heap allocations, see SetHeapAllocationCheck. */
+    bool CheckHeapAllocations;
+
+    /*! Wait for next deadline and update timing statistics. */
+    void WaitForDeadline(const bool active);
+
+    /*! Methods used for the "Timing" provided interface. */
+    //@{
+    void GetWakeUpLatency(mtsLatencyHistogram & histogram);
+    void GetExecutionTime(mtsLatencyHistogram & histogram);
+    void GetNumberOfOverruns(mtsUInt & overruns);
+    void ResetTimingStatistics(void);
+    //@}
+
     /********************* Methods that call user methods *****************/
 
     /*! The member function that is passed as 'start routine' argument for
@@ -130,6 +164,54 @@ class CISST_EXPORT mtsTaskPeriodic : public mtsTaskContinuous
       the thread was created with a period > 0. */
     bool IsPeriodic(void) const override;
 
+    /*! Use absolute deadlines instead of sleeping for the remainder
+      of the period (see osaThreadBuddy::WaitForDeadline).  The period
+      no longer drifts, missed deadlines are counted as overruns and
+      the task collects histograms of its wake up latency (time
+      between deadline and actual wake up) and execution time.
+
+      This also adds a provided interface "Timing" with the commands
+      "GetWakeUpLatency" and "GetExecutionTime" (void with result,
+      mtsLatencyHistogram), "GetNumberOfOverruns" (void with result,
+      mtsUInt), "ResetTimingStatistics" (void) and the event
+      "Overrun" (write, mtsUInt number of deadlines missed).  Since
+      the commands are queued, the user's Run method must call
+      ProcessQueuedCommands.
+
+      \param priority If greater than 0, the task's thread uses the
+      SCHED_FIFO policy with the given priority.  This usually
+      requires root privileges or CAP_SYS_NICE and a warning is
+      logged if it fails.
+
+      \param cpuMask CPU(s) the task's thread is pinned to, see
+      osaCPUSetAffinity.
+
+      This method must be called before the task is created. */
+    void SetDeadlineScheduling(const bool enable,
+                               const int priority = 0,
+                               const osaCPUMask cpuMask = OSA_CPUANY);
+
+    /*! Check if the task uses deadline scheduling. */
+    inline bool GetDeadlineScheduling(void) const {
+        return UseDeadlines;
+    }
+
+    /*! Report objects created on the heap by the class services
+      (e.g. copies of queued command arguments, deserialized objects)
+      while the task is running, i.e. after Startup.  The first heap
+      allocation for each class is logged as a warning and all of
+      them are counted, see
+      cmnClassServicesBase::GetNumberOfCheckedHeapAllocations.
+      Allocations can be avoided with a pool, see
+      cmnClassServicesBase::CreatePool.  This method must be called
+      before the task is created. */
+    void SetHeapAllocationCheck(const bool enable);
+
+    /*! Check if heap allocations are reported. */
+    inline bool GetHeapAllocationCheck(void) const {
+        return CheckHeapAllocations;
+    }
+
 };
 
 
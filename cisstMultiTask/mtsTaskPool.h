@@ -0,0 +1,132 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Defines mtsTaskPool
+*/
+
+#ifndef _mtsTaskPool_h
+#define _mtsTaskPool_h
+
+#include <cisstOSAbstraction/osaThread.h>
+#include <cisstMultiTask/mtsForwardDeclarations.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Always include last
+#include <cisstMultiTask/mtsExport.h>
+
+/*!
+  \ingroup cisstMultiTask
+
+  Small pool of worker threads shared by many mtsTaskPooled
+  components.  A pooled task is scheduled when one of its mailboxes
+  receives a command or an event and one worker executes it (one call
+  to Run after processing queued commands and events).
+
+  Each worker has its own queue.  A task scheduled from a worker
+  thread (e.g. component A sends a command to component B) is added
+  to the worker's own queue, tasks scheduled from other threads are
+  distributed in round robin.  Idle workers steal from the back of
+  other workers' queues before going to sleep.
+
+  A task is never executed by two workers at the same time, but
+  consecutive executions can happen on different threads.
+*/
+class CISST_EXPORT mtsTaskPool
+{
+    friend class mtsTaskPooled;
+
+public:
+    /*! Create the pool and start its threads.  If numberOfThreads is
+      0, use one thread per CPU (at least 2). */
+    mtsTaskPool(const std::string & name, size_t numberOfThreads = 0);
+
+    /*! Stop all threads.  All tasks using this pool should have been
+      killed and deleted before. */
+    ~mtsTaskPool();
+
+    /*! Pool used by default by mtsTaskPooled. */
+    static mtsTaskPool * GetDefault(void);
+
+    inline const std::string & GetName(void) const {
+        return this->Name;
+    }
+
+    inline size_t GetNumberOfThreads(void) const {
+        return this->Workers.size();
+    }
+
+    /*! Counters, can be read from any thread. */
+    //@{
+    inline unsigned long long GetNumberOfExecutions(void) const {
+        return this->NumberOfExecutions.load(std::memory_order_relaxed);
+    }
+    inline unsigned long long GetNumberOfSteals(void) const {
+        return this->NumberOfSteals.load(std::memory_order_relaxed);
+    }
+    //@}
+
+protected:
+    class WorkerType {
+    public:
+        mtsTaskPool * Pool;
+        size_t Index;
+        std::mutex Mutex;
+        std::deque<mtsTaskPooled *> Queue;
+        osaThread Thread;
+        void * Run(void * argument);
+    };
+
+    std::string Name;
+    std::vector<WorkerType *> Workers;
+
+    /*! Number of tasks in all queues. */
+    std::atomic<size_t> NumberOfPending;
+    std::atomic<size_t> NextWorker;
+    std::atomic<bool> Stopping;
+
+    /*! Idle workers wait on this condition, osaThreadSignal can't be
+      used since it doesn't remember signals raised before Wait. */
+    //@{
+    std::mutex IdleMutex;
+    std::condition_variable IdleCondition;
+    std::atomic<size_t> NumberOfIdle;
+    //@}
+
+    std::atomic<unsigned long long> NumberOfExecutions;
+    std::atomic<unsigned long long> NumberOfSteals;
+
+    /*! Add a task to one of the queues and wake up a worker if
+      needed.  Only called by mtsTaskPooled::Schedule. */
+    void Push(mtsTaskPooled * task);
+
+    /*! Get next task for a given worker, from its own queue or stolen
+      from another worker. */
+    mtsTaskPooled * Pop(WorkerType * worker);
+};
+
+#endif // _mtsTaskPool_h
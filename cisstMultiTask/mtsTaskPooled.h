@@ -0,0 +1,145 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Defines a task executed by a shared thread pool
+*/
+
+#ifndef _mtsTaskPooled_h
+#define _mtsTaskPooled_h
+
+#include <cisstMultiTask/mtsTask.h>
+#include <cisstMultiTask/mtsTaskPool.h>
+
+#include <atomic>
+
+// Always include last
+#include <cisstMultiTask/mtsExport.h>
+
+/*!
+  \ingroup cisstMultiTask
+
+  Task with a Run method triggered by signals (any queued command or
+  event), like mtsTaskFromSignal, but without a dedicated thread.
+  Instead, the task is executed by one of the threads of an
+  mtsTaskPool when its mailboxes receive work.  This is meant for
+  processes with many low rate event driven components (GUI bridges,
+  loggers, watchdogs...) which would otherwise each own a thread
+  sleeping most of the time.  High rate periodic tasks should keep
+  using mtsTaskPeriodic.
+
+  Startup, Run and Cleanup are never called concurrently but can be
+  called from different threads.  The Run method should not block
+  since it would prevent the pool thread from executing other tasks;
+  in particular, Sleep and WaitForWakeup should not be used.
+*/
+class CISST_EXPORT mtsTaskPooled: public mtsTask
+{
+    CMN_DECLARE_SERVICES(CMN_NO_DYNAMIC_CREATION, CMN_LOG_ALLOW_DEFAULT);
+
+    friend class mtsTaskPool;
+
+ protected:
+    typedef mtsTask BaseType;
+
+    /*! Pool executing this task. */
+    mtsTaskPool * Pool;
+
+    /*! Scheduling state, used to make sure the task is queued at most
+      once and executed by one thread at a time. */
+    enum {
+        SCHEDULE_IDLE,
+        SCHEDULE_QUEUED,
+        SCHEDULE_RUNNING,
+        SCHEDULE_RUNNING_AND_REQUESTED,
+        SCHEDULE_DETACHED
+    };
+    std::atomic<int> ScheduleState;
+
+    /*! Shared code for constructors. */
+    void Init(void);
+
+    /*! Add the task to its pool's queues unless it is already queued.
+      If the task is running, it will be queued again once done. */
+    void Schedule(void);
+
+    /*! Called by one of the pool's threads. */
+    void Execute(void);
+
+    /*! Execute one step based on the current state: startup, run or
+      cleanup. */
+    void * RunInternal(void * argument) override;
+
+    /*! Method used by the callable PostCommandQueuedCallable to
+      schedule the task when any queued command or event is sent. */
+    void PostCommandQueuedMethod(void);
+
+    /*! Same for the internal provided interface used by the manager,
+      processes the mailbox directly if the task is not active. */
+    void ManagerCommandQueuedMethod(void);
+
+    /*! Callables created around the methods above. */
+    mtsCallableVoidBase * PostCommandQueuedCallable;
+    mtsCallableVoidBase * ManagerCommandQueuedCallable;
+
+ public:
+    /*! Create a task with name 'name' and set the state table size.
+      \param name The name of the task
+      \param sizeStateTable The history size of the state table
+      \param pool Pool used to execute the task, if 0 use
+      mtsTaskPool::GetDefault()
+      \sa mtsTask, mtsTaskFromSignal
+    */
+    mtsTaskPooled(const std::string & name,
+                  unsigned int sizeStateTable = 256,
+                  mtsTaskPool * pool = 0);
+
+    mtsTaskPooled(const mtsTaskConstructorArg & arg);
+
+    /*! Destructor, kills the task and makes sure the pool no longer
+      uses it. */
+    virtual ~mtsTaskPooled();
+
+    inline mtsTaskPool * GetPool(void) const {
+        return this->Pool;
+    }
+
+    /* documented in base class */
+    void Create(void * data) override;
+    void Start(void) override;
+    void Suspend(void) override;
+    void Kill(void) override;
+
+    /*! Schedule the task, same as sending a queued command. */
+    void Wakeup(void) override;
+
+    /* documented in base class */
+    mtsInterfaceRequired * AddInterfaceRequiredWithoutSystemEventHandlers(const std::string & interfaceRequiredName,
+                                                                          mtsRequiredType required = MTS_REQUIRED) override;
+    /* documented in base class */
+    mtsInterfaceProvided * AddInterfaceProvidedWithoutSystemEvents(const std::string & newInterfaceName,
+                                                                   mtsInterfaceQueueingPolicy queueingPolicy = MTS_COMPONENT_POLICY,
+                                                                   bool isProxy = false) override;
+};
+
+CMN_DECLARE_SERVICES_INSTANTIATION(mtsTaskPooled)
+
+#endif // _mtsTaskPooled_h
@@ -20,9 +20,16 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <cisstMultiTask/mtsManagerLocal.h>
 #include <cisstMultiTask/mtsCollectorState.h>
+#include <cisstMultiTask/mtsCollectorColumnarWriter.h>
+#include <cisstMultiTask/mtsCollectorColumnarReader.h>
+#include <cisstMultiTask/mtsCollectorAsyncWriter.h>
+#include <cisstOSAbstraction/osaSleep.h>
 
 #include "mtsTestComponents.h"
 
+#include <cstring>
+#include <sstream>
+
 
 mtsCollectorStateTest::mtsCollectorStateTest()
 {
@@ -283,4 +290,191 @@ void mtsCollectorStateTest::TestFromSignal_int(void) {
     mtsCollectorStateTest::TestFromSignal<int>();
 }
 
+
+void mtsCollectorStateTest::TestColumnarCompression(void)
+{
+    typedef mtsCollectorColumnarFormat FormatType;
+    // slowly changing data, should compress
+    std::vector<char> source(10000);
+    size_t index;
+    for (index = 0; index < source.size(); ++index) {
+        source[index] = static_cast<char>((index / 64) % 7);
+    }
+    std::vector<char> compressed(FormatType::CompressBound(source.size()));
+    const size_t compressedSize = FormatType::Compress(&(source[0]), source.size(),
+                                                       &(compressed[0]), compressed.size());
+    CPPUNIT_ASSERT(compressedSize > 0);
+    CPPUNIT_ASSERT(compressedSize < source.size());
+    std::vector<char> result(source.size());
+    CPPUNIT_ASSERT(FormatType::Decompress(&(compressed[0]), compressedSize,
+                                          &(result[0]), result.size()));
+    CPPUNIT_ASSERT(source == result);
+    // wrong size or corrupted data
+    CPPUNIT_ASSERT(!FormatType::Decompress(&(compressed[0]), compressedSize,
+                                           &(result[0]), result.size() - 1));
+    CPPUNIT_ASSERT(!FormatType::Decompress(&(compressed[0]), compressedSize / 2,
+                                           &(result[0]), result.size()));
+
+    // random data, should not compress
+    unsigned int seed = 1234;
+    for (index = 0; index < source.size(); ++index) {
+        seed = seed * 1103515245 + 12345;
+        source[index] = static_cast<char>(seed >> 16);
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0),
+                         FormatType::Compress(&(source[0]), source.size(),
+                                              &(compressed[0]), compressed.size()));
+}
+
+
+void mtsCollectorStateTest::TestColumnarWriterReader(void)
+{
+    typedef mtsCollectorColumnarFormat FormatType;
+    const std::string filename = "ColumnarUnitTest.ccol";
+    const size_t numberOfRows = 1000;
+    const size_t rowsPerChunk = 64;
+
+    for (int compression = 0; compression < 2; ++compression) {
+        mtsCollectorColumnarWriter writer;
+        CPPUNIT_ASSERT(writer.Open(filename, rowsPerChunk, compression != 0, 4096));
+
+        FormatType::ColumnDescription column;
+        column.Name = "Position";
+        column.Fields = "Position[0],Position[1],Position[2]";
+        column.ElementSize = 3 * sizeof(double);
+        column.ScalarSize = sizeof(double);
+        column.Kind = FormatType::SCALAR_FLOAT;
+        CPPUNIT_ASSERT(writer.AddColumn(column));
+        column.Name = "Counter";
+        column.Fields = "Counter";
+        column.ElementSize = sizeof(int);
+        column.ScalarSize = sizeof(int);
+        column.Kind = FormatType::SCALAR_SIGNED;
+        CPPUNIT_ASSERT(writer.AddColumn(column));
+
+        size_t row;
+        for (row = 0; row < numberOfRows; ++row) {
+            CPPUNIT_ASSERT(writer.AddRow(row, row * 0.001));
+            double position[3] = {1.0 * row, 2.0 * row, -1.0 * row};
+            memcpy(writer.GetCell(0), position, sizeof(position));
+            int counter = -static_cast<int>(row);
+            memcpy(writer.GetCell(1), &counter, sizeof(counter));
+        }
+        // columns can't be added once rows have been written
+        CPPUNIT_ASSERT(!writer.AddColumn(column));
+        CPPUNIT_ASSERT(writer.Close());
+
+        mtsCollectorColumnarReader reader;
+        CPPUNIT_ASSERT(reader.Open(filename));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), reader.GetNumberOfColumns());
+        CPPUNIT_ASSERT_EQUAL(1, reader.FindColumn("Counter"));
+        CPPUNIT_ASSERT_EQUAL(-1, reader.FindColumn("Unknown"));
+        CPPUNIT_ASSERT_EQUAL(static_cast<unsigned long long>(numberOfRows), reader.GetNumberOfRows());
+        CPPUNIT_ASSERT_EQUAL((numberOfRows + rowsPerChunk - 1) / rowsPerChunk, reader.GetNumberOfChunks());
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, reader.GetStartTime(), 1e-12);
+        CPPUNIT_ASSERT_DOUBLES_EQUAL((numberOfRows - 1) * 0.001, reader.GetEndTime(), 1e-12);
+
+        // time range spanning multiple chunks
+        mtsCollectorColumnarReader::Rows rows;
+        CPPUNIT_ASSERT(reader.ReadTimeRange(0.1, 0.2, rows));
+        CPPUNIT_ASSERT(rows.size() >= 100);
+        CPPUNIT_ASSERT(rows.size() <= 101);
+        for (row = 0; row < rows.size(); ++row) {
+            const unsigned long long ticks = rows.Ticks[row];
+            CPPUNIT_ASSERT(rows.Times[row] >= 0.1);
+            CPPUNIT_ASSERT(rows.Times[row] <= 0.2);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0 * ticks, reader.GetScalar(rows, 0, row, 1), 1e-12);
+            CPPUNIT_ASSERT_DOUBLES_EQUAL(-1.0 * ticks, reader.GetScalar(rows, 1, row, 0), 1e-12);
+        }
+
+        // whole file
+        CPPUNIT_ASSERT(reader.ReadTimeRange(-1.0, 10.0, rows));
+        CPPUNIT_ASSERT_EQUAL(numberOfRows, rows.size());
+        CPPUNIT_ASSERT_EQUAL(static_cast<unsigned long long>(numberOfRows - 1), rows.Ticks.back());
+
+        // empty range
+        CPPUNIT_ASSERT(reader.ReadTimeRange(20.0, 30.0, rows));
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), rows.size());
+        reader.Close();
+    }
+}
+
+
+namespace {
+    // output stream buffer slow enough to force the asynchronous writer to drop samples
+    class mtsCollectorStateTestSlowBuffer: public std::stringbuf {
+    protected:
+        std::streamsize xsputn(const char * data, std::streamsize count) override {
+            osaSleep(20.0 * cmn_ms);
+            return std::stringbuf::xsputn(data, count);
+        }
+    };
+
+    // check that all samples written are complete and in order, returns the number of samples
+    size_t mtsCollectorStateTestCheckSamples(const std::string & content)
+    {
+        std::istringstream input(content);
+        std::string line;
+        size_t count = 0;
+        int previous = -1;
+        while (std::getline(input, line)) {
+            int index;
+            char separator;
+            std::istringstream sample(line);
+            sample >> index >> separator;
+            CPPUNIT_ASSERT(!sample.fail());
+            CPPUNIT_ASSERT_EQUAL(',', separator);
+            CPPUNIT_ASSERT(index > previous);
+            CPPUNIT_ASSERT_EQUAL(std::string(40, 'x'), line.substr(line.size() - 40));
+            previous = index;
+            count++;
+        }
+        return count;
+    }
+}
+
+void mtsCollectorStateTest::TestAsyncWriter(void)
+{
+    const unsigned int numberOfSamples = 2000;
+    mtsCollectorAsyncWriter writer;
+    unsigned int index;
+
+    // fast output, nothing should be dropped
+    std::ostringstream output;
+    CPPUNIT_ASSERT(writer.Start(output, 1024));
+    CPPUNIT_ASSERT(writer.IsRunning());
+    CPPUNIT_ASSERT(!writer.Start(output, 1024));
+    for (index = 0; index < numberOfSamples; ++index) {
+        writer.GetStream() << index << ',' << std::string(40, 'x') << '\n';
+        writer.EndSample();
+        if ((index % 10) == 0) {
+            osaSleep(0.1 * cmn_ms);
+        }
+    }
+    writer.Flush();
+    writer.Stop();
+    CPPUNIT_ASSERT(!writer.IsRunning());
+    CPPUNIT_ASSERT_EQUAL(numberOfSamples, writer.GetNumberOfSamples());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(numberOfSamples - writer.GetNumberOfDroppedSamples()),
+                         mtsCollectorStateTestCheckSamples(output.str()));
+
+    // slow output, samples are dropped but the output remains consistent
+    writer.ResetCounters();
+    CPPUNIT_ASSERT_EQUAL(0u, writer.GetNumberOfSamples());
+    mtsCollectorStateTestSlowBuffer slowBuffer;
+    std::ostream slowOutput(&slowBuffer);
+    CPPUNIT_ASSERT(writer.Start(slowOutput, 1024));
+    for (index = 0; index < numberOfSamples; ++index) {
+        writer.GetStream() << index << ',' << std::string(40, 'x') << '\n';
+        writer.EndSample();
+    }
+    writer.Stop();
+    CPPUNIT_ASSERT_EQUAL(numberOfSamples, writer.GetNumberOfSamples());
+    CPPUNIT_ASSERT(writer.GetNumberOfDroppedSamples() > 0);
+    CPPUNIT_ASSERT(writer.GetNumberOfOverflows() > 0);
+    CPPUNIT_ASSERT(writer.GetNumberOfOverflows() <= writer.GetNumberOfDroppedSamples());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(numberOfSamples - writer.GetNumberOfDroppedSamples()),
+                         mtsCollectorStateTestCheckSamples(slowBuffer.str()));
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(mtsCollectorStateTest);
@@ -38,6 +38,9 @@ private:
         CPPUNIT_TEST(TestFromCallback_int);
         CPPUNIT_TEST(TestFromSignal_mtsInt);
         CPPUNIT_TEST(TestFromSignal_int);
+        CPPUNIT_TEST(TestColumnarCompression);
+        CPPUNIT_TEST(TestColumnarWriterReader);
+        CPPUNIT_TEST(TestAsyncWriter);
     }
     CPPUNIT_TEST_SUITE_END();
 
@@ -69,4 +72,9 @@ public:
     template <class _elementType> void TestFromSignal(void);
     void TestFromSignal_mtsInt(void);
     void TestFromSignal_int(void);
+
+    void TestColumnarCompression(void);
+    void TestColumnarWriterReader(void);
+
+    void TestAsyncWriter(void);
 };
@@ -20,6 +20,10 @@ http://www.cisst.org/cisst/license.txt.
 #include "mtsCommandAndEventLocalTest.h"
 
 #include <cisstMultiTask/mtsManagerLocal.h>
+#include <cisstMultiTask/mtsMailBox.h>
+#include <cisstMultiTask/mtsCommandWrite.h>
+#include <cisstMultiTask/mtsCommandQueuedWrite.h>
+#include <cisstMultiTask/mtsMulticastCommandWrite.h>
 
 #include "mtsTestComponents.h"
 
@@ -617,4 +621,88 @@ void mtsCommandAndEventLocalTest::TestArgumentPrototypes_int(void) {
 }
 
 
+
+// receiver used to test multicast commands without components
+class mtsCommandAndEventLocalTestReceiver {
+public:
+    std::vector<double> Values;
+    void Handler(const mtsDouble & value) {
+        Values.push_back(value.Data);
+    }
+};
+
+void mtsCommandAndEventLocalTest::TestMulticastSharedArguments(void)
+{
+    typedef mtsCommandAndEventLocalTestReceiver ReceiverType;
+    typedef mtsCommandWrite<ReceiverType, mtsDouble> CommandType;
+    const size_t numberOfReceivers = 3;
+    const size_t queueSize = 32;
+    const size_t numberOfEvents = 10;
+
+    mtsMulticastCommandWriteGeneric multicast("Event", mtsDouble());
+    CPPUNIT_ASSERT(multicast.GetUseSharedArguments());
+    std::vector<ReceiverType> receivers(numberOfReceivers);
+    std::vector<mtsMailBox *> mailBoxes(numberOfReceivers);
+    std::vector<CommandType *> commands(numberOfReceivers);
+    std::vector<mtsCommandQueuedWriteGeneric *> queuedCommands(numberOfReceivers);
+    size_t index;
+    for (index = 0; index < numberOfReceivers; ++index) {
+        std::stringstream name;
+        name << "MailBox" << index;
+        mailBoxes[index] = new mtsMailBox(name.str(), queueSize);
+        commands[index] = new CommandType(&ReceiverType::Handler, &(receivers[index]), "Event", mtsDouble());
+        queuedCommands[index] = new mtsCommandQueuedWriteGeneric(mailBoxes[index], commands[index], queueSize);
+        CPPUNIT_ASSERT(multicast.AddCommand(queuedCommands[index]));
+    }
+    // observer not queued, executed immediately
+    ReceiverType direct;
+    CommandType directCommand(&ReceiverType::Handler, &direct, "Event", mtsDouble());
+    CPPUNIT_ASSERT(multicast.AddCommand(&directCommand));
+
+    // each event is copied once for all queued observers
+    size_t event;
+    for (event = 0; event < numberOfEvents; ++event) {
+        CPPUNIT_ASSERT(multicast.Execute(mtsDouble(event), MTS_NOT_BLOCKING).IsOK());
+    }
+    CPPUNIT_ASSERT_EQUAL(numberOfEvents, direct.Values.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<unsigned long long>(numberOfEvents), multicast.GetSharedArguments().GetNumberOfCopies());
+    CPPUNIT_ASSERT_EQUAL(numberOfEvents, multicast.GetSharedArguments().GetSize());
+    for (index = 0; index < numberOfReceivers; ++index) {
+        while (mailBoxes[index]->ExecuteNext()) {}
+        CPPUNIT_ASSERT_EQUAL(numberOfEvents, receivers[index].Values.size());
+    }
+
+    // shared arguments are now released and re-used
+    for (event = numberOfEvents; event < 2 * numberOfEvents; ++event) {
+        CPPUNIT_ASSERT(multicast.Execute(mtsDouble(event), MTS_NOT_BLOCKING).IsOK());
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<unsigned long long>(2 * numberOfEvents), multicast.GetSharedArguments().GetNumberOfCopies());
+    CPPUNIT_ASSERT_EQUAL(numberOfEvents, multicast.GetSharedArguments().GetSize());
+
+    // mix with copied arguments
+    multicast.SetUseSharedArguments(false);
+    for (event = 2 * numberOfEvents; event < 3 * numberOfEvents; ++event) {
+        CPPUNIT_ASSERT(multicast.Execute(mtsDouble(event), MTS_NOT_BLOCKING).IsOK());
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<unsigned long long>(2 * numberOfEvents), multicast.GetSharedArguments().GetNumberOfCopies());
+
+    // all observers received all events in order
+    for (index = 0; index < numberOfReceivers; ++index) {
+        while (mailBoxes[index]->ExecuteNext()) {}
+        CPPUNIT_ASSERT_EQUAL(3 * numberOfEvents, receivers[index].Values.size());
+        for (event = 0; event < 3 * numberOfEvents; ++event) {
+            CPPUNIT_ASSERT_EQUAL(static_cast<double>(event), receivers[index].Values[event]);
+        }
+    }
+
+    for (index = 0; index < numberOfReceivers; ++index) {
+        CPPUNIT_ASSERT(multicast.RemoveCommand(queuedCommands[index]));
+        delete queuedCommands[index];
+        delete commands[index];
+        delete mailBoxes[index];
+    }
+    CPPUNIT_ASSERT(multicast.RemoveCommand(&directCommand));
+}
+
+
 CPPUNIT_TEST_SUITE_REGISTRATION(mtsCommandAndEventLocalTest);
@@ -57,6 +57,8 @@ private:
 
         CPPUNIT_TEST(TestArgumentPrototypes_mtsInt);
         CPPUNIT_TEST(TestArgumentPrototypes_int);
+
+        CPPUNIT_TEST(TestMulticastSharedArguments);
     }
     CPPUNIT_TEST_SUITE_END();
 
@@ -110,4 +112,6 @@ public:
     template <class _elementType> void TestArgumentPrototypes(void);
     void TestArgumentPrototypes_mtsInt(void);
     void TestArgumentPrototypes_int(void);
+
+    void TestMulticastSharedArguments(void);
 };
@@ -427,6 +427,79 @@ void mtsManagerLocalTest::TestConnectLocally(void)
     CPPUNIT_ASSERT_EQUAL(clientPtr->GetName(), mtsInterfaceProvided::GenerateEndUserInterfaceName(serverPtr, "r1"));
 }
 
+// component recording if its server was active when started
+class mtsManagerLocalTestStartup: public mtsComponent
+{
+public:
+    const mtsComponent * Server;
+    bool ServerActiveAtStartup;
+
+    mtsManagerLocalTestStartup(const std::string & name, const mtsComponent * server = 0):
+        mtsComponent(name),
+        Server(server),
+        ServerActiveAtStartup(false)
+    {
+        AddInterfaceProvided("p1");
+        AddInterfaceRequired("r1", MTS_OPTIONAL);
+    }
+
+    void Startup(void) {
+        ServerActiveAtStartup = !Server || (Server->GetState() == mtsComponentState::ACTIVE);
+        osaSleep(20.0 * cmn_ms);
+    }
+};
+
+void mtsManagerLocalTest::TestParallelStartup(void)
+{
+    mtsManagerLocal * localManager = mtsManagerLocal::GetInstance();
+    localManager->RemoveAllUserComponents();  // Clean up from previous tests
+
+    // sequential startup would start A, B and C in alphabetical order
+    mtsManagerLocalTestStartup * c = new mtsManagerLocalTestStartup("C");
+    mtsManagerLocalTestStartup * b = new mtsManagerLocalTestStartup("B", c);
+    mtsManagerLocalTestStartup * a = new mtsManagerLocalTestStartup("A", b);
+    // D and E depend on each other
+    mtsManagerLocalTestStartup * d = new mtsManagerLocalTestStartup("D");
+    mtsManagerLocalTestStartup * e = new mtsManagerLocalTestStartup("E");
+    mtsManagerLocalTestStartup * components[] = {a, b, c, d, e};
+    for (size_t index = 0; index < 5; ++index) {
+        CPPUNIT_ASSERT(localManager->AddComponent(components[index]));
+    }
+    CPPUNIT_ASSERT(localManager->Connect("A", "r1", "B", "p1"));
+    CPPUNIT_ASSERT(localManager->Connect("B", "r1", "C", "p1"));
+    CPPUNIT_ASSERT(localManager->Connect("D", "r1", "E", "p1"));
+    CPPUNIT_ASSERT(localManager->Connect("E", "r1", "D", "p1"));
+
+    CPPUNIT_ASSERT(!localManager->GetParallelStartup());
+    localManager->SetParallelStartup(true, 2);
+    CPPUNIT_ASSERT(localManager->GetParallelStartup());
+    CPPUNIT_ASSERT(localManager->CreateAllAndWait(5.0 * cmn_s));
+    CPPUNIT_ASSERT(localManager->StartAllAndWait(5.0 * cmn_s));
+    for (size_t index = 0; index < 5; ++index) {
+        CPPUNIT_ASSERT(components[index]->GetState() == mtsComponentState::ACTIVE);
+        CPPUNIT_ASSERT(components[index]->ServerActiveAtStartup);
+    }
+
+    // startup times, slowest first
+    std::stringstream times;
+    localManager->StartupTimesToStream(times);
+    CPPUNIT_ASSERT(times.str().find("component") == 0);
+    CPPUNIT_ASSERT(times.str().find("\nA ") != std::string::npos);
+    CPPUNIT_ASSERT(times.str().find("\nE ") != std::string::npos);
+
+    localManager->SetParallelStartup(false);
+    localManager->KillAll();
+    CPPUNIT_ASSERT(localManager->WaitForStateAll(mtsComponentState::FINISHED, 5.0 * cmn_s));
+    CPPUNIT_ASSERT(localManager->Disconnect("A", "r1", "B", "p1"));
+    CPPUNIT_ASSERT(localManager->Disconnect("B", "r1", "C", "p1"));
+    CPPUNIT_ASSERT(localManager->Disconnect("D", "r1", "E", "p1"));
+    CPPUNIT_ASSERT(localManager->Disconnect("E", "r1", "D", "p1"));
+    for (size_t index = 0; index < 5; ++index) {
+        CPPUNIT_ASSERT(localManager->RemoveComponent(components[index]));
+        delete components[index];
+    }
+}
+
 #if CISST_MTS_HAS_ICE
 void mtsManagerLocalTest::TestGetIPAddressList(void)
 {
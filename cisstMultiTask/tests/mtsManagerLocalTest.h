@@ -47,6 +47,8 @@ private:
         CPPUNIT_TEST(TestConnectLocally);
         CPPUNIT_TEST(TestConnectDisconnect);
 
+        CPPUNIT_TEST(TestParallelStartup);
+
 #if CISST_MTS_HAS_ICE
         CPPUNIT_TEST(TestGetIPAddressList);
         CPPUNIT_TEST(TestGetName);
@@ -85,6 +87,8 @@ public:
     void TestConnectLocally(void);
     void TestConnectDisconnect(void);
 
+    void TestParallelStartup(void);
+
 #if CISST_MTS_HAS_ICE
     void TestGetIPAddressList(void);
     void TestGetName(void);
@@ -147,3 +147,147 @@ void mtsQueueTest::TestConstructorDestructorCalls(void)
     CPPUNIT_ASSERT_EQUAL(mtsMacrosTestClassB::CopyConstructorCalls, static_cast<size_t>(0));
     CPPUNIT_ASSERT_EQUAL(mtsMacrosTestClassB::DestructorCalls, 2 * size + 1);
 }
+
+
+void mtsQueueTest::TestQueueMultipleProducers(void)
+{
+    // test default constructor
+    mtsQueueMultipleProducers<int> queue;
+    CPPUNIT_ASSERT_EQUAL(queue.GetSize(), static_cast<size_t>(0));
+    CPPUNIT_ASSERT_EQUAL(queue.GetAvailable(), static_cast<size_t>(0));
+    CPPUNIT_ASSERT(queue.IsEmpty());
+    CPPUNIT_ASSERT(queue.IsFull());
+    CPPUNIT_ASSERT(!queue.Put(1));
+    CPPUNIT_ASSERT(!queue.Peek());
+    CPPUNIT_ASSERT(!queue.Get());
+
+    // test resize, all slots can be used
+    const size_t size = 10;
+    queue.SetSize(size, 0);
+    CPPUNIT_ASSERT_EQUAL(queue.GetSize(), size);
+    CPPUNIT_ASSERT(queue.IsEmpty());
+    CPPUNIT_ASSERT(!queue.IsFull());
+
+    // one element at a time, go around the circular buffer a few times
+    size_t index;
+    int * retrieved;
+    for (index = 0; index < 3 * size + 1; index++) {
+        CPPUNIT_ASSERT(queue.Put(static_cast<int>(index)));
+        CPPUNIT_ASSERT_EQUAL(queue.GetAvailable(), static_cast<size_t>(1));
+        retrieved = queue.Peek();
+        CPPUNIT_ASSERT(retrieved);
+        CPPUNIT_ASSERT_EQUAL(*retrieved, static_cast<int>(index));
+        retrieved = queue.Get();
+        CPPUNIT_ASSERT(retrieved);
+        CPPUNIT_ASSERT_EQUAL(*retrieved, static_cast<int>(index));
+        CPPUNIT_ASSERT(queue.IsEmpty());
+    }
+
+    // fill it up
+    for (index = 0; index < size; index++) {
+        CPPUNIT_ASSERT(queue.Put(static_cast<int>(index)));
+        CPPUNIT_ASSERT_EQUAL(queue.GetAvailable(), index + 1);
+    }
+    CPPUNIT_ASSERT(queue.IsFull());
+    CPPUNIT_ASSERT(!queue.Put(-1));
+
+    // empty it, order should be preserved
+    for (index = 0; index < size; index++) {
+        retrieved = queue.Get();
+        CPPUNIT_ASSERT(retrieved);
+        CPPUNIT_ASSERT_EQUAL(*retrieved, static_cast<int>(index));
+        CPPUNIT_ASSERT_EQUAL(queue.GetAvailable(), size - index - 1);
+    }
+    CPPUNIT_ASSERT(queue.IsEmpty());
+    CPPUNIT_ASSERT(!queue.Get());
+}
+
+
+void mtsQueueTest::TestQueueAtomic(void)
+{
+    // test default constructor
+    mtsQueueAtomic<mtsDouble> queue;
+    CPPUNIT_ASSERT_EQUAL(queue.GetSize(), static_cast<size_t>(0));
+    CPPUNIT_ASSERT_EQUAL(queue.GetAvailable(), static_cast<size_t>(0));
+    CPPUNIT_ASSERT(queue.IsEmpty());
+    CPPUNIT_ASSERT(queue.IsFull());
+
+    // test resize, same semantic as mtsQueue, one slot is never used
+    const mtsDouble original = 1.2345;
+    const size_t size = 100;
+    queue.SetSize(size, original);
+    CPPUNIT_ASSERT_EQUAL(queue.GetSize(), size);
+    CPPUNIT_ASSERT(queue.IsEmpty());
+    CPPUNIT_ASSERT(!queue.IsFull());
+
+    mtsDouble element;
+    mtsDouble * retrieved;
+    size_t index;
+    for (index = 0; index < 3 * queue.GetSize(); index++) {
+        element = static_cast<double>(index);
+        CPPUNIT_ASSERT(queue.Put(element));
+        CPPUNIT_ASSERT_EQUAL(queue.GetAvailable(), static_cast<size_t>(1));
+        retrieved = queue.Peek();
+        CPPUNIT_ASSERT(retrieved);
+        CPPUNIT_ASSERT_EQUAL(retrieved->Data, static_cast<double>(index));
+        retrieved = queue.Get();
+        CPPUNIT_ASSERT(retrieved);
+        CPPUNIT_ASSERT_EQUAL(retrieved->Data, static_cast<double>(index));
+        CPPUNIT_ASSERT_EQUAL(queue.GetAvailable(), static_cast<size_t>(0));
+    }
+
+    // fill it up
+    for (index = 0; index < size - 1; index++) {
+        element = static_cast<double>(index);
+        CPPUNIT_ASSERT(queue.Put(element));
+        CPPUNIT_ASSERT_EQUAL(queue.GetAvailable(), index + 1);
+    }
+    CPPUNIT_ASSERT(queue.IsFull());
+    CPPUNIT_ASSERT(!queue.Put(element));
+
+    for (index = 0; index < size - 1; index++) {
+        retrieved = queue.Get();
+        CPPUNIT_ASSERT(retrieved);
+        CPPUNIT_ASSERT_EQUAL(retrieved->Data, static_cast<double>(index));
+    }
+    CPPUNIT_ASSERT(queue.IsEmpty());
+    CPPUNIT_ASSERT(!queue.Get());
+}
+
+
+void mtsQueueTest::TestQueueAtomicBatch(void)
+{
+    const size_t size = 10;
+    mtsQueueAtomic<int> queue(size, 0);
+    int input[2 * size];
+    int output[2 * size];
+    size_t index;
+    for (index = 0; index < 2 * size; index++) {
+        input[index] = static_cast<int>(index);
+        output[index] = -1;
+    }
+
+    // can only put size - 1 elements
+    CPPUNIT_ASSERT_EQUAL(queue.PutN(input, 2 * size), size - 1);
+    CPPUNIT_ASSERT(queue.IsFull());
+    CPPUNIT_ASSERT_EQUAL(queue.PutN(input, 1), static_cast<size_t>(0));
+
+    // partial get
+    CPPUNIT_ASSERT_EQUAL(queue.GetN(output, 4), static_cast<size_t>(4));
+    CPPUNIT_ASSERT_EQUAL(queue.GetAvailable(), size - 5);
+    for (index = 0; index < 4; index++) {
+        CPPUNIT_ASSERT_EQUAL(output[index], static_cast<int>(index));
+    }
+
+    // put more, wraps around circular buffer
+    CPPUNIT_ASSERT_EQUAL(queue.PutN(input + size - 1, 4), static_cast<size_t>(4));
+    CPPUNIT_ASSERT(queue.IsFull());
+
+    // get everything, order should be preserved
+    CPPUNIT_ASSERT_EQUAL(queue.GetN(output + 4, 2 * size), size - 1);
+    for (index = 0; index < size + 3; index++) {
+        CPPUNIT_ASSERT_EQUAL(output[index], static_cast<int>(index));
+    }
+    CPPUNIT_ASSERT(queue.IsEmpty());
+    CPPUNIT_ASSERT_EQUAL(queue.GetN(output, size), static_cast<size_t>(0));
+}
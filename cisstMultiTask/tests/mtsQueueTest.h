@@ -22,6 +22,8 @@ http://www.cisst.org/cisst/license.txt.
 #include <cppunit/extensions/HelperMacros.h>
 
 #include <cisstMultiTask/mtsQueue.h>
+#include <cisstMultiTask/mtsQueueMultipleProducers.h>
+#include <cisstMultiTask/mtsQueueAtomic.h>
 #include <cisstMultiTask/mtsGenericObjectProxy.h>
 
 
@@ -31,6 +33,9 @@ class mtsQueueTest: public CppUnit::TestFixture
 
     CPPUNIT_TEST(TestQueue_mtsDouble);
     CPPUNIT_TEST(TestConstructorDestructorCalls);
+    CPPUNIT_TEST(TestQueueMultipleProducers);
+    CPPUNIT_TEST(TestQueueAtomic);
+    CPPUNIT_TEST(TestQueueAtomicBatch);
 
     CPPUNIT_TEST_SUITE_END();
     
@@ -44,6 +49,15 @@ public:
 
     /*! Tests calls to constructors and detructors */
     void TestConstructorDestructorCalls(void);
+
+    /*! Test lock-free queue for multiple producers, single thread */
+    void TestQueueMultipleProducers(void);
+
+    /*! Test queue with atomic indices */
+    void TestQueueAtomic(void);
+
+    /*! Test PutN and GetN */
+    void TestQueueAtomicBatch(void);
 };
 
 
@@ -47,3 +47,63 @@ void mtsSocketProxyTest::TestCommandHandle(void)
     CPPUNIT_ASSERT(handle == testHandle);
 }
 
+
+void mtsSocketProxyTest::TestTransport(void)
+{
+    const unsigned short port = 12399;
+    osaSocket serverSocket(osaSocket::UDP);
+    CPPUNIT_ASSERT(serverSocket.AssignPort(port));
+    osaSocket clientSocket(osaSocket::UDP);
+    clientSocket.SetDestination("127.0.0.1", port);
+    mtsSocketProxyTransport server(serverSocket);
+    mtsSocketProxyTransport client(clientSocket);
+
+    // small messages are sent in a single datagram
+    const size_t numberOfMessages = 10;
+    size_t index;
+    for (index = 0; index < numberOfMessages; ++index) {
+        std::stringstream message;
+        message << "message " << index;
+        CPPUNIT_ASSERT(client.Send(message.str()));
+    }
+    CPPUNIT_ASSERT(client.Flush());
+    mtsSocketProxyStatistics statistics;
+    client.GetStatistics(statistics);
+    CPPUNIT_ASSERT_EQUAL(1ULL, statistics.PacketsSent);
+    CPPUNIT_ASSERT_EQUAL(static_cast<unsigned long long>(numberOfMessages), statistics.MessagesSent);
+
+    std::string received;
+    osaIPandPort sender;
+    for (index = 0; index < numberOfMessages; ++index) {
+        CPPUNIT_ASSERT(server.Receive(received, sender, 1.0, 1.0) > 0);
+        std::stringstream message;
+        message << "message " << index;
+        CPPUNIT_ASSERT_EQUAL(message.str(), received);
+        CPPUNIT_ASSERT_EQUAL(index + 1 < numberOfMessages, server.HasPendingMessage());
+    }
+
+    // large messages are fragmented, the reply goes back to the sender
+    std::string large(20 * mtsSocketProxy::SOCKET_PROXY_PACKET_SIZE, ' ');
+    for (index = 0; index < large.size(); ++index) {
+        large[index] = static_cast<char>(index % 251);
+    }
+    const osaIPandPort clientAddress = sender;
+    CPPUNIT_ASSERT(server.Send(clientAddress, large));
+    CPPUNIT_ASSERT(client.Receive(received, sender, 1.0, 1.0) > 0);
+    CPPUNIT_ASSERT(large == received);
+    server.GetStatistics(statistics);
+    CPPUNIT_ASSERT(statistics.PacketsSent > 20);
+    CPPUNIT_ASSERT_EQUAL(1ULL, statistics.MessagesSent);
+    CPPUNIT_ASSERT_EQUAL(static_cast<unsigned long long>(numberOfMessages), statistics.MessagesReceived);
+    CPPUNIT_ASSERT_EQUAL(0ULL, statistics.MessagesDropped);
+
+    // messages larger than the maximum message size are dropped
+    client.SetMaxMessageSize(large.size() - 1);
+    CPPUNIT_ASSERT(server.Send(clientAddress, large));
+    CPPUNIT_ASSERT(client.Receive(received, sender, 1.0, 0.2) <= 0);
+    client.GetStatistics(statistics);
+    CPPUNIT_ASSERT(statistics.MessagesDropped > 0);
+
+    serverSocket.Close();
+    clientSocket.Close();
+}
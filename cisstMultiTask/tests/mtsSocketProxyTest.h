@@ -25,6 +25,7 @@ class mtsSocketProxyTest: public CppUnit::TestFixture
     CPPUNIT_TEST_SUITE(mtsSocketProxyTest);
 
     CPPUNIT_TEST(TestCommandHandle);
+    CPPUNIT_TEST(TestTransport);
 
     CPPUNIT_TEST_SUITE_END();
     
@@ -35,6 +36,9 @@ public:
     
     void TestCommandHandle(void);
 
+    /*! Coalesce small messages and fragment a large one over UDP */
+    void TestTransport(void);
+
 };
 
 
@@ -18,10 +18,13 @@ http://www.cisst.org/cisst/license.txt.
 --- end cisst license ---
 */
 
+#include <cisstCommon/cmnSerializer.h>
 #include <cisstMultiTask/mtsStateTable.h>
+#include <cisstMultiTask/mtsVector.h>
 
 #include "mtsStateTableTest.h"
 
+#include <sstream>
 #include <string>
 
 void mtsStateTableTest::setUp(void)
@@ -64,4 +67,179 @@ void mtsStateTableTest::TestGetStateVectorID(void)
     }
 }
 
+
+void mtsStateTableTest::TestColumnarStorage(void)
+{
+    mtsStateTable StateTable(10, "Columnar");
+    CPPUNIT_ASSERT(!StateTable.ColumnarStorage());
+    StateTable.SetColumnarStorage(true);
+    CPPUNIT_ASSERT(StateTable.ColumnarStorage());
+
+    double scalar = 0.0;
+    vct3 fixedVector(0.0);
+    mtsDoubleVec dynamicVector(4);
+    dynamicVector.SetAll(0.0);
+    std::string name("none");
+    StateTable.AddData(scalar, "Scalar");
+    StateTable.AddData(fixedVector, "FixedVector");
+    StateTable.AddData(dynamicVector, "DynamicVector");
+    StateTable.AddData(name, "Name");
+
+    // supported types use columnar arrays, others fall back on mtsStateArray
+    const size_t firstId = StateTable.GetNumberOfElements() - 4;
+    CPPUNIT_ASSERT(dynamic_cast<mtsStateArrayColumnar<mtsDouble> *>(StateTable.StateVector[firstId]));
+    CPPUNIT_ASSERT(dynamic_cast<mtsStateArrayColumnar<mtsGenericObjectProxy<vct3> > *>(StateTable.StateVector[firstId + 1]));
+    CPPUNIT_ASSERT(dynamic_cast<mtsStateArrayColumnar<mtsDoubleVec> *>(StateTable.StateVector[firstId + 2]));
+    CPPUNIT_ASSERT(dynamic_cast<mtsStateArray<mtsStdString> *>(StateTable.StateVector[firstId + 3]));
+
+    mtsStateTable::Accessor<double> * scalarAccessor =
+        dynamic_cast<mtsStateTable::Accessor<double> *>(StateTable.GetAccessorByName("Scalar"));
+    mtsStateTable::Accessor<vct3> * fixedVectorAccessor =
+        dynamic_cast<mtsStateTable::Accessor<vct3> *>(StateTable.GetAccessorByName("FixedVector"));
+    mtsStateTable::Accessor<mtsDoubleVec> * dynamicVectorAccessor =
+        dynamic_cast<mtsStateTable::Accessor<mtsDoubleVec> *>(StateTable.GetAccessorByName("DynamicVector"));
+    mtsStateTable::Accessor<std::string> * nameAccessor =
+        dynamic_cast<mtsStateTable::Accessor<std::string> *>(StateTable.GetAccessorByName("Name"));
+    CPPUNIT_ASSERT(scalarAccessor);
+    CPPUNIT_ASSERT(fixedVectorAccessor);
+    CPPUNIT_ASSERT(dynamicVectorAccessor);
+    CPPUNIT_ASSERT(nameAccessor);
+
+    // write more rows than the history length to test wrap around
+    std::vector<mtsStateIndex> indices;
+    for (size_t row = 0; row < 15; ++row) {
+        const double value = static_cast<double>(row);
+        scalar = value;
+        fixedVector.SetAll(value + 0.5);
+        dynamicVector.SetAll(value + 0.25);
+        name = (row % 2) ? "odd" : "even";
+        StateTable.Start();
+        indices.push_back(StateTable.GetIndexWriter());
+        StateTable.Advance();
+    }
+
+    mtsDouble scalarRead;
+    mtsGenericObjectProxy<vct3> fixedVectorRead;
+    mtsDoubleVec dynamicVectorRead;
+    mtsStdString nameRead;
+    CPPUNIT_ASSERT(scalarAccessor->GetLatest(scalarRead));
+    CPPUNIT_ASSERT_EQUAL(14.0, scalarRead.Data);
+    CPPUNIT_ASSERT(scalarRead.Valid());
+    CPPUNIT_ASSERT(fixedVectorAccessor->GetLatest(fixedVectorRead));
+    CPPUNIT_ASSERT(fixedVectorRead.Data.Equal(vct3(14.5)));
+    CPPUNIT_ASSERT(dynamicVectorAccessor->GetLatest(dynamicVectorRead));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), dynamicVectorRead.size());
+    CPPUNIT_ASSERT(dynamicVectorRead.Equal(vctDoubleVec(4, 14.25)));
+    CPPUNIT_ASSERT(nameAccessor->GetLatest(nameRead));
+    CPPUNIT_ASSERT_EQUAL(std::string("even"), nameRead.Data);
+
+    // older rows still in the history
+    for (size_t row = 6; row < 15; ++row) {
+        CPPUNIT_ASSERT(scalarAccessor->Get(indices[row], scalarRead));
+        CPPUNIT_ASSERT_EQUAL(static_cast<double>(row), scalarRead.Data);
+        CPPUNIT_ASSERT(dynamicVectorAccessor->Get(indices[row], dynamicVectorRead));
+        CPPUNIT_ASSERT(dynamicVectorRead.Equal(vctDoubleVec(4, row + 0.25)));
+        const mtsGenericObject & element = (*StateTable.StateVector[firstId + 1])[indices[row].Index()];
+        CPPUNIT_ASSERT(dynamic_cast<const mtsGenericObjectProxy<vct3> &>(element).Data.Equal(vct3(row + 0.5)));
+        // used by mtsCollectorState, same output as the elements
+        CPPUNIT_ASSERT(fixedVectorAccessor->Get(indices[row], fixedVectorRead));
+        const mtsGenericObject * elements[3] = {&scalarRead, &fixedVectorRead, &dynamicVectorRead};
+        for (size_t id = 0; id < 3; ++id) {
+            std::stringstream expected, streamed;
+            elements[id]->ToStreamRaw(expected, ',');
+            StateTable.StateVector[firstId + id]->ElementToStreamRaw(indices[row].Index(), streamed, ',');
+            CPPUNIT_ASSERT_EQUAL(expected.str(), streamed.str());
+            expected.str("");
+            streamed.str("");
+            elements[id]->ToStreamRaw(expected, ',', true, "h");
+            StateTable.StateVector[firstId + id]->ElementToStreamRaw(indices[row].Index(), streamed, ',', true, "h");
+            CPPUNIT_ASSERT_EQUAL(expected.str(), streamed.str());
+            std::stringstream expectedBinary, serializedBinary;
+            cmnSerializer expectedSerializer(expectedBinary);
+            expectedSerializer.Serialize(*(elements[id]));
+            cmnSerializer serializer(serializedBinary);
+            StateTable.StateVector[firstId + id]->ElementSerialize(indices[row].Index(), serializer);
+            CPPUNIT_ASSERT(expectedBinary.str() == serializedBinary.str());
+        }
+    }
+    // overwritten rows
+    CPPUNIT_ASSERT(!scalarAccessor->Get(indices[0], scalarRead));
+
+    // no pointer access to columnar data
+    CPPUNIT_ASSERT(!scalarAccessor->SupportsPointers());
+    CPPUNIT_ASSERT(!scalarAccessor->GetPointer(StateTable.GetIndexReader()));
+    CPPUNIT_ASSERT(nameAccessor->SupportsPointers());
+    CPPUNIT_ASSERT(nameAccessor->GetPointer(StateTable.GetIndexReader()));
+
+    // dynamic vectors can't change size once added, the row is left unchanged
+    dynamicVector.SetSize(5);
+    dynamicVector.SetAll(-1.0);
+    CPPUNIT_ASSERT(StateTable.StateVector[firstId + 2]->SetFromCurrent(indices[14].Index()));
+    CPPUNIT_ASSERT(!StateTable.StateVector[firstId + 2]->Set(indices[14].Index(), dynamicVector));
+    CPPUNIT_ASSERT(dynamicVectorAccessor->Get(indices[14], dynamicVectorRead));
+    CPPUNIT_ASSERT(dynamicVectorRead.Equal(vctDoubleVec(4, 14.25)));
+}
+
+void mtsStateTableTest::TestZeroCopyRead(void)
+{
+    const size_t historyLength = 5;
+    mtsStateTable StateTable(historyLength, "ZeroCopy");
+    vct6 forces(1.0);
+    StateTable.AddData(forces, "Forces");
+    typedef mtsGenericObjectProxy<vct6> ForcesType;
+    mtsStateTable::Accessor<vct6> * accessor =
+        dynamic_cast<mtsStateTable::Accessor<vct6> *>(StateTable.GetAccessorByName("Forces"));
+    CPPUNIT_ASSERT(accessor);
+    CPPUNIT_ASSERT(accessor->SupportsZeroCopyRead());
+
+    StateTable.Start();
+    StateTable.Advance();
+
+    // pointer on the history, no copy
+    mtsStateIndex when;
+    const ForcesType * latest = accessor->BeginRead(when);
+    CPPUNIT_ASSERT(latest);
+    CPPUNIT_ASSERT_EQUAL(6.0, latest->Data.SumOfElements());
+    CPPUNIT_ASSERT(accessor->EndRead(when));
+
+    // still valid after a few advances, not after the row is reused
+    forces.SetAll(2.0);
+    for (size_t row = 0; row < historyLength - 2; ++row) {
+        StateTable.Start();
+        StateTable.Advance();
+    }
+    CPPUNIT_ASSERT(accessor->EndRead(when));
+    StateTable.Start();
+    StateTable.Advance();
+    CPPUNIT_ASSERT(!accessor->EndRead(when));
+
+    // using a callable object
+    double sum = 0.0;
+    CPPUNIT_ASSERT(accessor->ReadLatest([&sum](const ForcesType & data) {
+                sum = data.Data.SumOfElements();
+            }));
+    CPPUNIT_ASSERT_EQUAL(12.0, sum);
+
+    // not available for variable size elements, Advance could reallocate them
+    mtsStateTable dynamicTable(historyLength, "Dynamic");
+    mtsDoubleVec torques(1000);
+    torques.SetAll(1.0);
+    dynamicTable.AddData(torques, "Torques");
+    mtsStateTable::Accessor<mtsDoubleVec> * dynamicAccessor =
+        dynamic_cast<mtsStateTable::Accessor<mtsDoubleVec> *>(dynamicTable.GetAccessorByName("Torques"));
+    CPPUNIT_ASSERT(dynamicAccessor);
+    CPPUNIT_ASSERT(dynamicAccessor->SupportsPointers());
+    CPPUNIT_ASSERT(!dynamicAccessor->SupportsZeroCopyRead());
+    CPPUNIT_ASSERT(!dynamicAccessor->BeginRead(when));
+
+    // not available for columnar storage
+    mtsStateTable columnarTable(historyLength, "Columnar");
+    columnarTable.SetColumnarStorage(true);
+    columnarTable.AddData(forces, "Forces");
+    accessor = dynamic_cast<mtsStateTable::Accessor<vct6> *>(columnarTable.GetAccessorByName("Forces"));
+    CPPUNIT_ASSERT(accessor);
+    CPPUNIT_ASSERT(!accessor->SupportsZeroCopyRead());
+    CPPUNIT_ASSERT(!accessor->BeginRead(when));
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(mtsStateTableTest);
@@ -30,6 +30,8 @@ class mtsStateTableTest: public CppUnit::TestFixture
     CPPUNIT_TEST_SUITE(mtsStateTableTest);
     {
         CPPUNIT_TEST(TestGetStateVectorID);
+        CPPUNIT_TEST(TestColumnarStorage);
+        CPPUNIT_TEST(TestZeroCopyRead);
     }
     CPPUNIT_TEST_SUITE_END();
 
@@ -39,4 +41,8 @@ public:
     void tearDown(void);
 
     void TestGetStateVectorID(void);
+
+    void TestColumnarStorage(void);
+
+    void TestZeroCopyRead(void);
 };
@@ -20,12 +20,21 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <cisstCommon/cmnUnits.h>
 #include <cisstMultiTask/mtsStateTable.h>
+#include <cisstMultiTask/mtsManagerLocal.h>
+#include <cisstMultiTask/mtsInterfaceProvided.h>
+#include <cisstMultiTask/mtsInterfaceRequired.h>
+#include <cisstMultiTask/mtsFunctionVoid.h>
+#include <cisstMultiTask/mtsFunctionRead.h>
+#include <cisstOSAbstraction/osaSleep.h>
 
 #include "mtsTaskTest.h"
 
 #include <string>
+#include <sstream>
+#include <vector>
 
 CMN_IMPLEMENT_SERVICES(mtsTaskTestTask);
+CMN_IMPLEMENT_SERVICES(mtsTaskTestPooled);
 
 mtsTaskTestTask::mtsTaskTestTask(const std::string & name, 
                                  double period) :
@@ -45,10 +54,252 @@ void mtsTaskTestTask::TestGetStateVectorID(void)
 	CPPUNIT_ASSERT(total_column_count == StateTable.GetNumberOfElements());
 }
 
+void mtsTaskTestTask::TestTimingStatistics(const size_t minimumSamples, const size_t maximumSamples)
+{
+    CPPUNIT_ASSERT(WakeUpLatency.NumberOfSamples() >= minimumSamples);
+    CPPUNIT_ASSERT(WakeUpLatency.NumberOfSamples() <= maximumSamples);
+    CPPUNIT_ASSERT_EQUAL(WakeUpLatency.NumberOfSamples(), ExecutionTime.NumberOfSamples());
+    CPPUNIT_ASSERT(WakeUpLatency.P50() <= WakeUpLatency.P99());
+    CPPUNIT_ASSERT(WakeUpLatency.P99() <= WakeUpLatency.Max());
+    CPPUNIT_ASSERT(ExecutionTime.Max() < GetPeriodicity());
+}
+
 void mtsTaskTest::TestGetStateVectorID(void)
 {
     mtsTaskTestTask task("testingTask", 10 * cmn_ms);
     task.TestGetStateVectorID();
 }
 
+void mtsTaskTest::TestLatencyHistogram(void)
+{
+    mtsLatencyHistogram histogram;
+    CPPUNIT_ASSERT_EQUAL(0ULL, histogram.NumberOfSamples());
+    CPPUNIT_ASSERT_EQUAL(0.0, histogram.P50());
+
+    // 1 to 1000 us
+    for (size_t index = 1; index <= 1000; ++index) {
+        histogram.Add(index * cmn_us);
+    }
+    CPPUNIT_ASSERT_EQUAL(1000ULL, histogram.NumberOfSamples());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0 * cmn_us, histogram.Min(), 1.0e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1000.0 * cmn_us, histogram.Max(), 1.0e-12);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(500.5 * cmn_us, histogram.Mean(), 1.0e-9);
+    // buckets are at most 1/16 wide
+    CPPUNIT_ASSERT(histogram.P50() >= 500.0 * cmn_us);
+    CPPUNIT_ASSERT(histogram.P50() <= 500.0 * cmn_us * (1.0 + 1.0 / 16.0));
+    CPPUNIT_ASSERT(histogram.P99() >= 990.0 * cmn_us);
+    CPPUNIT_ASSERT(histogram.P99() <= histogram.Max());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(histogram.Max(), histogram.Percentile(1.0), 1.0e-12);
+
+    // outliers
+    histogram.Add(-1.0);
+    CPPUNIT_ASSERT_EQUAL(0.0, histogram.Min());
+    histogram.Add(1000.0);
+    CPPUNIT_ASSERT_EQUAL(1000.0, histogram.Max());
+    CPPUNIT_ASSERT(histogram.P99() < 1.0 * cmn_ms);
+
+    // serialization
+    std::stringstream stream;
+    histogram.SerializeRaw(stream);
+    mtsLatencyHistogram copy;
+    copy.DeSerializeRaw(stream);
+    CPPUNIT_ASSERT_EQUAL(histogram.NumberOfSamples(), copy.NumberOfSamples());
+    CPPUNIT_ASSERT_EQUAL(histogram.P50(), copy.P50());
+    CPPUNIT_ASSERT_EQUAL(histogram.Max(), copy.Max());
+
+    histogram.Reset();
+    CPPUNIT_ASSERT_EQUAL(0ULL, histogram.NumberOfSamples());
+    CPPUNIT_ASSERT_EQUAL(0.0, histogram.Max());
+}
+
+void mtsTaskTest::TestDeadlineScheduling(void)
+{
+    mtsManagerLocal * manager = mtsManagerLocal::GetInstance();
+    const double period = 5.0 * cmn_ms;
+    mtsTaskTestTask * task = new mtsTaskTestTask("deadlineTask", period);
+    task->SetDeadlineScheduling(true);
+    CPPUNIT_ASSERT(task->GetDeadlineScheduling());
+    CPPUNIT_ASSERT(task->GetInterfaceProvided("Timing"));
+    CPPUNIT_ASSERT(manager->AddComponent(task));
+
+    CPPUNIT_ASSERT(task->CreateAndWait(5.0 * cmn_s));
+    CPPUNIT_ASSERT(task->StartAndWait(5.0 * cmn_s));
+    osaSleep(100.0 * period);
+    CPPUNIT_ASSERT(task->KillAndWait(5.0 * cmn_s));
+
+    // deadlines don't drift, allow for a loaded machine
+    task->TestTimingStatistics(50, 110);
+
+    // can't change once created
+    task->SetDeadlineScheduling(false);
+    CPPUNIT_ASSERT(task->GetDeadlineScheduling());
+
+    CPPUNIT_ASSERT(manager->RemoveComponent(task));
+    delete task;
+}
+
+mtsTaskTestPooled::mtsTaskTestPooled(const std::string & name,
+                                     mtsTaskPool * pool):
+    mtsTaskPooled(name, 50, pool),
+    Counter(0)
+{
+    mtsInterfaceProvided * interfaceProvided = AddInterfaceProvided("Counter");
+    if (interfaceProvided) {
+        interfaceProvided->AddCommandVoid(&mtsTaskTestPooled::Increment, this, "Increment");
+    }
+}
+
+void mtsTaskTestPooled::Run(void)
+{
+    ProcessQueuedCommands();
+}
+
+void mtsTaskTestPooled::Increment(void)
+{
+    Counter++;
+}
+
+void mtsTaskTest::TestTaskPooled(void)
+{
+    mtsManagerLocal * manager = mtsManagerLocal::GetInstance();
+    mtsTaskPool * pool = new mtsTaskPool("test", 2);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), pool->GetNumberOfThreads());
+
+    // more tasks than threads, all driven from the main thread
+    const size_t numberOfTasks = 8;
+    const int numberOfCalls = 50;
+    mtsComponent * client = new mtsComponent("pooledClient");
+    std::vector<mtsTaskTestPooled *> tasks(numberOfTasks);
+    std::vector<mtsFunctionVoid> functions(numberOfTasks);
+    CPPUNIT_ASSERT(manager->AddComponent(client));
+    size_t index;
+    for (index = 0; index < numberOfTasks; ++index) {
+        std::stringstream name;
+        name << "pooledTask" << index;
+        tasks[index] = new mtsTaskTestPooled(name.str(), pool);
+        CPPUNIT_ASSERT(tasks[index]->GetPool() == pool);
+        CPPUNIT_ASSERT(manager->AddComponent(tasks[index]));
+        mtsInterfaceRequired * interfaceRequired = client->AddInterfaceRequired(name.str());
+        CPPUNIT_ASSERT(interfaceRequired);
+        CPPUNIT_ASSERT(interfaceRequired->AddFunction("Increment", functions[index]));
+        CPPUNIT_ASSERT(manager->Connect("pooledClient", name.str(), name.str(), "Counter"));
+    }
+    CPPUNIT_ASSERT(client->CreateAndWait(5.0 * cmn_s));
+    CPPUNIT_ASSERT(client->StartAndWait(5.0 * cmn_s));
+    for (index = 0; index < numberOfTasks; ++index) {
+        CPPUNIT_ASSERT(tasks[index]->CreateAndWait(5.0 * cmn_s));
+        CPPUNIT_ASSERT(tasks[index]->StartAndWait(5.0 * cmn_s));
+    }
+
+    for (int call = 0; call < numberOfCalls; ++call) {
+        for (index = 0; index < numberOfTasks; ++index) {
+            CPPUNIT_ASSERT(functions[index]().IsOK());
+        }
+    }
+    // blocking call is processed after all queued ones
+    for (index = 0; index < numberOfTasks; ++index) {
+        CPPUNIT_ASSERT(functions[index].ExecuteBlocking().IsOK());
+        CPPUNIT_ASSERT_EQUAL(numberOfCalls + 1, tasks[index]->Counter);
+    }
+    CPPUNIT_ASSERT(pool->GetNumberOfExecutions() >= 2 * numberOfTasks);
+
+    for (index = 0; index < numberOfTasks; ++index) {
+        CPPUNIT_ASSERT(tasks[index]->KillAndWait(5.0 * cmn_s));
+        CPPUNIT_ASSERT(tasks[index]->IsTerminated());
+    }
+    CPPUNIT_ASSERT(client->KillAndWait(5.0 * cmn_s));
+    for (index = 0; index < numberOfTasks; ++index) {
+        std::stringstream name;
+        name << "pooledTask" << index;
+        CPPUNIT_ASSERT(manager->Disconnect("pooledClient", name.str(), name.str(), "Counter"));
+        CPPUNIT_ASSERT(manager->RemoveComponent(tasks[index]));
+        delete tasks[index];
+    }
+    CPPUNIT_ASSERT(manager->RemoveComponent(client));
+    delete client;
+    delete pool;
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(mtsTaskTest);
+
+void mtsTaskTest::TestCommandStatistics(void)
+{
+    mtsManagerLocal * manager = mtsManagerLocal::GetInstance();
+    mtsTaskPool * pool = new mtsTaskPool("statistics", 1);
+    mtsTaskTestPooled * task = new mtsTaskTestPooled("statisticsTask", pool);
+    mtsInterfaceProvided * interfaceProvided = task->GetInterfaceProvided("Counter");
+    CPPUNIT_ASSERT(interfaceProvided);
+    CPPUNIT_ASSERT(interfaceProvided->EnableCommandStatistics());
+    CPPUNIT_ASSERT(task->GetStateTable("CounterCommandStatistics"));
+    CPPUNIT_ASSERT(manager->AddComponent(task));
+
+    // statistics can't be collected if commands are not queued
+    mtsComponent * client = new mtsComponent("statisticsClient");
+    mtsInterfaceProvided * notQueued = client->AddInterfaceProvided("NotQueued");
+    CPPUNIT_ASSERT(notQueued);
+    CPPUNIT_ASSERT(!notQueued->EnableCommandStatistics());
+
+    mtsFunctionVoid increment;
+    mtsFunctionRead getStatistics;
+    mtsFunctionVoid resetStatistics;
+    mtsInterfaceRequired * interfaceRequired = client->AddInterfaceRequired("Counter");
+    CPPUNIT_ASSERT(interfaceRequired);
+    CPPUNIT_ASSERT(interfaceRequired->AddFunction("Increment", increment));
+    CPPUNIT_ASSERT(interfaceRequired->AddFunction("GetCommandStatistics", getStatistics));
+    CPPUNIT_ASSERT(interfaceRequired->AddFunction("ResetCommandStatistics", resetStatistics));
+    CPPUNIT_ASSERT(manager->AddComponent(client));
+    CPPUNIT_ASSERT(manager->Connect("statisticsClient", "Counter", "statisticsTask", "Counter"));
+    CPPUNIT_ASSERT(client->CreateAndWait(5.0 * cmn_s));
+    CPPUNIT_ASSERT(client->StartAndWait(5.0 * cmn_s));
+    CPPUNIT_ASSERT(task->CreateAndWait(5.0 * cmn_s));
+    CPPUNIT_ASSERT(task->StartAndWait(5.0 * cmn_s));
+
+    const int numberOfCalls = 20;
+    for (int call = 0; call < numberOfCalls; ++call) {
+        CPPUNIT_ASSERT(increment().IsOK());
+    }
+    increment.ExecuteBlocking();
+    CPPUNIT_ASSERT_EQUAL(numberOfCalls + 1, task->Counter);
+
+    // state table is advanced after the commands are processed
+    mtsCommandStatistics statistics;
+    size_t index = 0;
+    for (size_t attempt = 0; attempt < 100; ++attempt) {
+        CPPUNIT_ASSERT(getStatistics(statistics).IsOK());
+        if ((statistics.size() > 0)
+            && (statistics.QueueLatency(0).NumberOfSamples() == static_cast<unsigned long long>(numberOfCalls + 1))) {
+            break;
+        }
+        osaSleep(10.0 * cmn_ms);
+    }
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), statistics.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("Increment"), statistics.Name(index));
+    CPPUNIT_ASSERT_EQUAL(static_cast<unsigned long long>(numberOfCalls + 1),
+                         statistics.ExecutionTime(index).NumberOfSamples());
+    CPPUNIT_ASSERT(statistics.QueueLatency(index).Max() >= statistics.QueueLatency(index).Min());
+    CPPUNIT_ASSERT(statistics.MaxQueueDepth(index) < static_cast<size_t>(numberOfCalls + 1));
+
+    // serialization
+    std::stringstream stream;
+    statistics.SerializeRaw(stream);
+    mtsCommandStatistics copy;
+    copy.DeSerializeRaw(stream);
+    CPPUNIT_ASSERT_EQUAL(statistics.size(), copy.size());
+    CPPUNIT_ASSERT_EQUAL(statistics.Name(index), copy.Name(index));
+    CPPUNIT_ASSERT_EQUAL(statistics.MaxQueueDepth(index), copy.MaxQueueDepth(index));
+
+    // reset is queued, only the reset command itself should be counted after
+    resetStatistics.ExecuteBlocking();
+    osaSleep(50.0 * cmn_ms);
+    CPPUNIT_ASSERT(getStatistics(statistics).IsOK());
+    CPPUNIT_ASSERT_EQUAL(0ULL, statistics.QueueLatency(index).NumberOfSamples());
+
+    CPPUNIT_ASSERT(task->KillAndWait(5.0 * cmn_s));
+    CPPUNIT_ASSERT(client->KillAndWait(5.0 * cmn_s));
+    CPPUNIT_ASSERT(manager->Disconnect("statisticsClient", "Counter", "statisticsTask", "Counter"));
+    CPPUNIT_ASSERT(manager->RemoveComponent(task));
+    CPPUNIT_ASSERT(manager->RemoveComponent(client));
+    delete task;
+    delete client;
+    delete pool;
+}
@@ -19,6 +19,9 @@ http://www.cisst.org/cisst/license.txt.
 #include <cppunit/TestCase.h>
 #include <cppunit/extensions/HelperMacros.h>
 #include <cisstMultiTask/mtsTaskPeriodic.h>
+#include <cisstMultiTask/mtsLatencyHistogram.h>
+#include <cisstMultiTask/mtsTaskPooled.h>
+#include <cisstMultiTask/mtsCommandStatistics.h>
 
 #include <string>
 
@@ -37,16 +40,41 @@ public:
     void Run(void) override {}
     void Cleanup(void) override {}
     void TestGetStateVectorID(void);
+    void TestTimingStatistics(const size_t minimumSamples, const size_t maximumSamples);
 };
 
 CMN_DECLARE_SERVICES_INSTANTIATION(mtsTaskTestTask);
 
 
+class mtsTaskTestPooled : public mtsTaskPooled {
+    CMN_DECLARE_SERVICES(CMN_NO_DYNAMIC_CREATION, 5);
+
+public:
+    mtsTaskTestPooled(const std::string & name,
+                      mtsTaskPool * pool);
+    virtual ~mtsTaskTestPooled() {}
+
+    void Configure(const std::string &) override {}
+    void Startup(void) override {}
+    void Run(void) override;
+    void Cleanup(void) override {}
+
+    void Increment(void);
+    int Counter;
+};
+
+CMN_DECLARE_SERVICES_INSTANTIATION(mtsTaskTestPooled);
+
+
 class mtsTaskTest: public CppUnit::TestFixture
 {
     CPPUNIT_TEST_SUITE(mtsTaskTest);
     {
         CPPUNIT_TEST(TestGetStateVectorID);
+        CPPUNIT_TEST(TestLatencyHistogram);
+        CPPUNIT_TEST(TestDeadlineScheduling);
+        CPPUNIT_TEST(TestTaskPooled);
+        CPPUNIT_TEST(TestCommandStatistics);
     }
     CPPUNIT_TEST_SUITE_END();
 
@@ -56,4 +84,8 @@ public:
     void tearDown(void) {}
 
     void TestGetStateVectorID(void);
+    void TestLatencyHistogram(void);
+    void TestDeadlineScheduling(void);
+    void TestTaskPooled(void);
+    void TestCommandStatistics(void);
 };
@@ -0,0 +1,433 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstOSAbstraction/osaSharedMemoryQueue.h>
+#include <cisstCommon/cmnLogger.h>
+
+#include <atomic>
+#include <string.h>
+
+#if (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX_XENOMAI)
+#define OSA_SHARED_MEMORY_QUEUE_FUTEX
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sched.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    const unsigned int MAGIC = 0x63534d51; // "cSMQ"
+    const unsigned int SPIN_COUNT = 2000;
+}
+
+// Layout at the beginning of the shared segment, each field modified
+// concurrently is on its own cache line.  Atomics are lock free and
+// address free so they can be shared between processes.
+struct osaSharedMemoryQueueHeader {
+    std::atomic<unsigned int> Magic;
+    unsigned int NumberOfSlots;
+    unsigned int SlotSize;
+    unsigned int SlotStride;
+    int OwnerPID;
+    std::atomic<unsigned int> Closed;
+    alignas(64) std::atomic<unsigned int> EnqueuePosition;
+    alignas(64) std::atomic<unsigned int> DequeuePosition;
+    // futex word, incremented after each push
+    alignas(64) std::atomic<unsigned int> Pushed;
+    std::atomic<unsigned int> NumberOfWaiters;
+};
+
+// Header of each slot, followed by the message
+struct osaSharedMemoryQueueSlot {
+    std::atomic<unsigned int> Sequence;
+    unsigned int Length;
+    unsigned short SenderPort;
+    char SenderHost[osaSharedMemoryQueue::SENDER_HOST_SIZE];
+};
+
+
+#ifdef OSA_SHARED_MEMORY_QUEUE_FUTEX
+static double osaSharedMemoryQueueNow(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<double>(now.tv_sec) + static_cast<double>(now.tv_nsec) * 1.0e-9;
+}
+
+static void osaSharedMemoryQueueRelax(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+// spinning only helps if the sender can run at the same time
+static unsigned int osaSharedMemoryQueueSpinCount(void)
+{
+    static const unsigned int spinCount = (sysconf(_SC_NPROCESSORS_ONLN) > 1) ? SPIN_COUNT : 0;
+    return spinCount;
+}
+#endif
+
+
+osaSharedMemoryQueue::osaSharedMemoryQueue(void):
+    Owner(false),
+    Header(0),
+    MappedSize(0)
+{
+}
+
+
+osaSharedMemoryQueue::~osaSharedMemoryQueue()
+{
+    Close();
+}
+
+
+bool osaSharedMemoryQueue::IsSupported(void)
+{
+#ifdef OSA_SHARED_MEMORY_QUEUE_FUTEX
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+bool osaSharedMemoryQueue::Create(const std::string & name,
+                                  unsigned int numberOfSlots,
+                                  unsigned int slotSize)
+{
+#ifdef OSA_SHARED_MEMORY_QUEUE_FUTEX
+    Close();
+    if ((numberOfSlots == 0) || (slotSize == 0)) {
+        CMN_LOG_RUN_ERROR << "osaSharedMemoryQueue::Create: invalid size for \"" << name << "\"" << std::endl;
+        return false;
+    }
+    // power of 2 so positions can wrap around
+    unsigned int slots = 2;
+    while (slots < numberOfSlots) {
+        slots *= 2;
+    }
+    const unsigned int stride = ((sizeof(osaSharedMemoryQueueSlot) + slotSize + 63) / 64) * 64;
+    const size_t size = sizeof(osaSharedMemoryQueueHeader) + static_cast<size_t>(slots) * stride;
+
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if ((fd == -1) && (errno == EEXIST)) {
+        // left over by a process which didn't close it?
+        osaSharedMemoryQueue existing;
+        if (existing.Open(name)
+            && (kill(existing.Header->OwnerPID, 0) == 0)) {
+            CMN_LOG_RUN_ERROR << "osaSharedMemoryQueue::Create: \"" << name
+                              << "\" is already used by process " << existing.Header->OwnerPID << std::endl;
+            return false;
+        }
+        existing.Close();
+        CMN_LOG_RUN_WARNING << "osaSharedMemoryQueue::Create: replacing stale queue \"" << name << "\"" << std::endl;
+        shm_unlink(name.c_str());
+        fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    }
+    if (fd == -1) {
+        CMN_LOG_RUN_ERROR << "osaSharedMemoryQueue::Create: shm_open failed for \"" << name
+                          << "\", error " << errno << std::endl;
+        return false;
+    }
+    if (ftruncate(fd, size) != 0) {
+        CMN_LOG_RUN_ERROR << "osaSharedMemoryQueue::Create: failed to resize \"" << name
+                          << "\" to " << size << " bytes, error " << errno << std::endl;
+        close(fd);
+        shm_unlink(name.c_str());
+        return false;
+    }
+    void * memory = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) {
+        CMN_LOG_RUN_ERROR << "osaSharedMemoryQueue::Create: mmap failed for \"" << name
+                          << "\", error " << errno << std::endl;
+        shm_unlink(name.c_str());
+        return false;
+    }
+
+    // segment is zero filled by ftruncate
+    Header = reinterpret_cast<osaSharedMemoryQueueHeader *>(memory);
+    MappedSize = size;
+    Name = name;
+    Owner = true;
+    Header->NumberOfSlots = slots;
+    Header->SlotSize = slotSize;
+    Header->SlotStride = stride;
+    Header->OwnerPID = static_cast<int>(getpid());
+    Header->Closed.store(0);
+    Header->EnqueuePosition.store(0);
+    Header->DequeuePosition.store(0);
+    Header->Pushed.store(0);
+    Header->NumberOfWaiters.store(0);
+    for (unsigned int index = 0; index < slots; ++index) {
+        reinterpret_cast<osaSharedMemoryQueueSlot *>(GetSlot(index))->Sequence.store(index, std::memory_order_relaxed);
+    }
+    // set last, Open checks it
+    Header->Magic.store(MAGIC, std::memory_order_release);
+    CMN_LOG_RUN_VERBOSE << "osaSharedMemoryQueue::Create: created \"" << name << "\" with "
+                        << slots << " slots of " << slotSize << " bytes" << std::endl;
+    return true;
+#else
+    CMN_LOG_RUN_ERROR << "osaSharedMemoryQueue::Create: not supported on this operating system, can't create \""
+                      << name << "\"" << std::endl;
+    return false;
+#endif
+}
+
+
+bool osaSharedMemoryQueue::Open(const std::string & name)
+{
+#ifdef OSA_SHARED_MEMORY_QUEUE_FUTEX
+    Close();
+    int fd = shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd == -1) {
+        CMN_LOG_RUN_DEBUG << "osaSharedMemoryQueue::Open: shm_open failed for \"" << name
+                          << "\", error " << errno << std::endl;
+        return false;
+    }
+    struct stat status;
+    if ((fstat(fd, &status) != 0)
+        || (static_cast<size_t>(status.st_size) < sizeof(osaSharedMemoryQueueHeader))) {
+        // owner might still be initializing it
+        close(fd);
+        return false;
+    }
+    const size_t size = static_cast<size_t>(status.st_size);
+    void * memory = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) {
+        CMN_LOG_RUN_ERROR << "osaSharedMemoryQueue::Open: mmap failed for \"" << name
+                          << "\", error " << errno << std::endl;
+        return false;
+    }
+    osaSharedMemoryQueueHeader * header = reinterpret_cast<osaSharedMemoryQueueHeader *>(memory);
+    if ((header->Magic.load(std::memory_order_acquire) != MAGIC)
+        || (sizeof(osaSharedMemoryQueueHeader) + static_cast<size_t>(header->NumberOfSlots) * header->SlotStride > size)) {
+        CMN_LOG_RUN_DEBUG << "osaSharedMemoryQueue::Open: \"" << name << "\" is not initialized" << std::endl;
+        munmap(memory, size);
+        return false;
+    }
+    Header = header;
+    MappedSize = size;
+    Name = name;
+    Owner = false;
+    return true;
+#else
+    CMN_LOG_RUN_ERROR << "osaSharedMemoryQueue::Open: not supported on this operating system, can't open \""
+                      << name << "\"" << std::endl;
+    return false;
+#endif
+}
+
+
+void osaSharedMemoryQueue::Close(void)
+{
+#ifdef OSA_SHARED_MEMORY_QUEUE_FUTEX
+    if (!Header) {
+        return;
+    }
+    if (Owner) {
+        Header->Closed.store(1);
+        shm_unlink(Name.c_str());
+    }
+    munmap(Header, MappedSize);
+    Header = 0;
+    MappedSize = 0;
+    Owner = false;
+#endif
+}
+
+
+bool osaSharedMemoryQueue::IsClosed(void) const
+{
+    return Header && (Header->Closed.load(std::memory_order_relaxed) != 0);
+}
+
+
+unsigned int osaSharedMemoryQueue::GetSlotSize(void) const
+{
+    return Header ? Header->SlotSize : 0;
+}
+
+
+char * osaSharedMemoryQueue::GetSlot(unsigned int position) const
+{
+    return reinterpret_cast<char *>(Header) + sizeof(osaSharedMemoryQueueHeader)
+        + static_cast<size_t>(position & (Header->NumberOfSlots - 1)) * Header->SlotStride;
+}
+
+
+int osaSharedMemoryQueue::Push(const char * data, unsigned int length,
+                               const std::string & senderHost, unsigned short senderPort,
+                               double timeoutSec)
+{
+#ifdef OSA_SHARED_MEMORY_QUEUE_FUTEX
+    if (!Header) {
+        CMN_LOG_RUN_ERROR << "osaSharedMemoryQueue::Push: queue is not open" << std::endl;
+        return -2;
+    }
+    if (length > Header->SlotSize) {
+        CMN_LOG_RUN_ERROR << "osaSharedMemoryQueue::Push: message of " << length
+                          << " bytes is larger than slot size " << Header->SlotSize
+                          << " for \"" << Name << "\"" << std::endl;
+        return -2;
+    }
+    if (senderHost.size() >= SENDER_HOST_SIZE) {
+        CMN_LOG_RUN_ERROR << "osaSharedMemoryQueue::Push: sender \"" << senderHost << "\" is too long" << std::endl;
+        return -2;
+    }
+
+    // reserve a slot, see bounded MPMC queue from D. Vyukov
+    osaSharedMemoryQueueSlot * slot;
+    unsigned int position = Header->EnqueuePosition.load(std::memory_order_relaxed);
+    double deadline = -1.0;
+    while (true) {
+        slot = reinterpret_cast<osaSharedMemoryQueueSlot *>(GetSlot(position));
+        const unsigned int sequence = slot->Sequence.load(std::memory_order_acquire);
+        const int difference = static_cast<int>(sequence - position);
+        if (difference == 0) {
+            if (Header->EnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            // full, wait for the receiver
+            const double now = osaSharedMemoryQueueNow();
+            if (deadline < 0.0) {
+                deadline = now + timeoutSec;
+            }
+            if (now >= deadline) {
+                return -1;
+            }
+            sched_yield();
+            position = Header->EnqueuePosition.load(std::memory_order_relaxed);
+        } else {
+            position = Header->EnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->Length = length;
+    slot->SenderPort = senderPort;
+    memcpy(slot->SenderHost, senderHost.c_str(), senderHost.size() + 1);
+    memcpy(reinterpret_cast<char *>(slot) + sizeof(osaSharedMemoryQueueSlot), data, length);
+    slot->Sequence.store(position + 1, std::memory_order_release);
+
+    // the receiver increments the number of waiters before reading
+    // Pushed, so either it sees the new value or we see the waiter
+    Header->Pushed.fetch_add(1);
+    if (Header->NumberOfWaiters.load() != 0) {
+        syscall(SYS_futex, reinterpret_cast<int *>(&(Header->Pushed)), FUTEX_WAKE, 1, 0, 0, 0);
+    }
+    return static_cast<int>(length);
+#else
+    return -2;
+#endif
+}
+
+
+int osaSharedMemoryQueue::TryPop(char * data, unsigned int maxLength,
+                                 std::string & senderHost, unsigned short & senderPort)
+{
+    osaSharedMemoryQueueSlot * slot;
+    unsigned int position = Header->DequeuePosition.load(std::memory_order_relaxed);
+    while (true) {
+        slot = reinterpret_cast<osaSharedMemoryQueueSlot *>(GetSlot(position));
+        const unsigned int sequence = slot->Sequence.load(std::memory_order_acquire);
+        const int difference = static_cast<int>(sequence - (position + 1));
+        if (difference == 0) {
+            if (Header->DequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            // empty
+            return -1;
+        } else {
+            position = Header->DequeuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    const unsigned int length = (slot->Length < maxLength) ? slot->Length : maxLength;
+    memcpy(data, reinterpret_cast<const char *>(slot) + sizeof(osaSharedMemoryQueueSlot), length);
+    senderPort = slot->SenderPort;
+    senderHost.assign(slot->SenderHost);
+    // release the slot for the next round
+    slot->Sequence.store(position + Header->NumberOfSlots, std::memory_order_release);
+    return static_cast<int>(length);
+}
+
+
+int osaSharedMemoryQueue::Pop(char * data, unsigned int maxLength,
+                              std::string & senderHost, unsigned short & senderPort,
+                              double timeoutSec)
+{
+#ifdef OSA_SHARED_MEMORY_QUEUE_FUTEX
+    if (!Header) {
+        CMN_LOG_RUN_ERROR << "osaSharedMemoryQueue::Pop: queue is not open" << std::endl;
+        return -2;
+    }
+    int result = TryPop(data, maxLength, senderHost, senderPort);
+    if ((result >= 0) || (timeoutSec <= 0.0)) {
+        return result;
+    }
+
+    // spin first, round trips on the same host are often shorter than
+    // the cost of sleeping and waking up
+    const unsigned int spinCount = osaSharedMemoryQueueSpinCount();
+    for (unsigned int spin = 0; spin < spinCount; ++spin) {
+        osaSharedMemoryQueueRelax();
+        result = TryPop(data, maxLength, senderHost, senderPort);
+        if (result >= 0) {
+            return result;
+        }
+    }
+
+    const double deadline = osaSharedMemoryQueueNow() + timeoutSec;
+    while (true) {
+        Header->NumberOfWaiters.fetch_add(1);
+        const unsigned int pushed = Header->Pushed.load();
+        result = TryPop(data, maxLength, senderHost, senderPort);
+        if (result >= 0) {
+            Header->NumberOfWaiters.fetch_sub(1);
+            return result;
+        }
+        const double remaining = deadline - osaSharedMemoryQueueNow();
+        if (remaining <= 0.0) {
+            Header->NumberOfWaiters.fetch_sub(1);
+            return -1;
+        }
+        struct timespec timeout;
+        timeout.tv_sec = static_cast<time_t>(remaining);
+        timeout.tv_nsec = static_cast<long>((remaining - static_cast<double>(timeout.tv_sec)) * 1.0e9);
+        // returns right away if a message was pushed since we read the counter
+        syscall(SYS_futex, reinterpret_cast<int *>(&(Header->Pushed)), FUTEX_WAIT, pushed, &timeout, 0, 0);
+        Header->NumberOfWaiters.fetch_sub(1);
+    }
+#else
+    return -2;
+#endif
+}
@@ -18,6 +18,12 @@ http://www.cisst.org/cisst/license.txt.
 */
 
 #include <cisstOSAbstraction/osaSocket.h>
+#include <cisstOSAbstraction/osaSharedMemoryQueue.h>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <sstream>
 
 #if (CISST_OS == CISST_WINDOWS)
 #define WIN32_LEAN_AND_MEAN
@@ -70,6 +76,91 @@ struct osaSocketInternals {
 #define SERVER_ADDR (reinterpret_cast<struct osaSocketInternals *>(Internals)->ServerAddr)
 
 
+// State of SHARED_MEMORY sockets.  Addresses are the same as for UDP
+// sockets (host and port) so they can be used by code written for
+// UDP.  A socket bound with AssignPort receives on a queue named
+// after its port and sends with its host set to "localhost".  Other
+// sockets receive on an anonymous queue and send with the queue name
+// as host and 0 as port.
+struct osaSocketSharedMemory {
+    osaSharedMemoryQueue Local;
+    std::string LocalHost;
+    unsigned short LocalPort;
+    std::string DestinationHost;
+    unsigned short DestinationPort;
+    // queues opened to send, indexed by name
+    typedef std::map<std::string, osaSharedMemoryQueue *> QueueMapType;
+    QueueMapType Destinations;
+    // protects all the above, Local.Pop is called without the lock
+    std::mutex Mutex;
+
+    osaSocketSharedMemory(void):
+        LocalPort(0),
+        DestinationPort(0)
+    {}
+
+    ~osaSocketSharedMemory() {
+        Close();
+    }
+
+    static std::string QueueName(const std::string & host, unsigned short port) {
+        if (port == 0) {
+            return host;
+        }
+        std::stringstream name;
+        name << "/cisst-osaSocket-" << port;
+        return name.str();
+    }
+
+    // create an anonymous queue if AssignPort hasn't been used
+    bool CreateLocal(void) {
+        if (Local.IsValid()) {
+            return true;
+        }
+        static std::atomic<unsigned int> counter(0);
+        std::stringstream name;
+#if (CISST_OS == CISST_WINDOWS)
+        const int processId = 0; // shared memory queues are not supported
+#else
+        const int processId = static_cast<int>(getpid());
+#endif
+        name << "/cisst-osaSocket-" << processId << "-" << counter.fetch_add(1);
+        LocalHost = name.str();
+        LocalPort = 0;
+        return Local.Create(LocalHost);
+    }
+
+    osaSharedMemoryQueue * GetDestination(void) {
+        const std::string name = QueueName(DestinationHost, DestinationPort);
+        QueueMapType::iterator found = Destinations.find(name);
+        if (found != Destinations.end()) {
+            if (!found->second->IsClosed()) {
+                return found->second;
+            }
+            // receiver has been restarted, open the new queue
+            delete found->second;
+            Destinations.erase(found);
+        }
+        osaSharedMemoryQueue * queue = new osaSharedMemoryQueue;
+        if (!queue->Open(name)) {
+            delete queue;
+            return 0;
+        }
+        Destinations[name] = queue;
+        return queue;
+    }
+
+    void Close(void) {
+        Local.Close();
+        QueueMapType::iterator iter;
+        for (iter = Destinations.begin(); iter != Destinations.end(); ++iter) {
+            delete iter->second;
+        }
+        Destinations.clear();
+    }
+};
+
+
 unsigned int osaSocket::SizeOfInternals(void)
 {
     return sizeof(osaSocketInternals);
@@ -97,6 +188,17 @@ Streambuf(this)
 #endif
 
     SocketType = type;
+    SharedMemory = 0;
+    if (type == SHARED_MEMORY) {
+        SocketFD = INVALID_SOCKET;
+        if (!osaSharedMemoryQueue::IsSupported()) {
+            CMN_LOG_CLASS_INIT_ERROR << "osaSocket: shared memory sockets are not supported on this operating system" << std::endl;
+            return;
+        }
+        SharedMemory = new osaSocketSharedMemory;
+        CMN_LOG_CLASS_RUN_VERBOSE << "osaSocket: created shared memory socket" << std::endl;
+        return;
+    }
     SocketFD = socket(PF_INET, (type == UDP) ? SOCK_DGRAM : SOCK_STREAM, 0);
     if (SocketFD == INVALID_SOCKET) {
         CMN_LOG_CLASS_RUN_ERROR << "osaSocket: failed to create a socket" << std::endl;
@@ -125,6 +227,7 @@ Streambuf(this)
 #endif
 
     SocketType = TCP;
+    SharedMemory = 0;
     SocketFD = *(reinterpret_cast<SOCKET *> (socketFDPtr));
     if (SocketFD == INVALID_SOCKET) {
         CMN_LOG_CLASS_RUN_ERROR << "osaSocket: failed to create a socket" << std::endl;
@@ -136,6 +239,7 @@ Streambuf(this)
 osaSocket::~osaSocket(void)
 {
     Close();
+    delete SharedMemory;
 #if (CISST_OS == CISST_WINDOWS)
     WSACleanup();
 #endif
@@ -309,6 +413,21 @@ int osaSocket::GetLocalhostIP(std::vector<std::string> & IPaddress)
 
 bool osaSocket::AssignPort(unsigned short port)
 {
+    if (SocketType == SHARED_MEMORY) {
+        if (!SharedMemory) {
+            CMN_LOG_CLASS_RUN_ERROR << "AssignPort: failed to create shared memory queue for port " << port << std::endl;
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(SharedMemory->Mutex);
+        if (!SharedMemory->Local.Create(osaSocketSharedMemory::QueueName("", port))) {
+            CMN_LOG_CLASS_RUN_ERROR << "AssignPort: failed to create shared memory queue for port " << port << std::endl;
+            return false;
+        }
+        SharedMemory->LocalHost = "localhost";
+        SharedMemory->LocalPort = port;
+        return true;
+    }
+
     struct sockaddr_in serverAddr;
     serverAddr.sin_family = AF_INET;
     serverAddr.sin_port = htons(port);
@@ -326,6 +445,12 @@ bool osaSocket::AssignPort(unsigned short port)
 
 void osaSocket::SetDestination(const std::string & host, unsigned short port)
 {
+    if (SharedMemory) {
+        std::lock_guard<std::mutex> lock(SharedMemory->Mutex);
+        SharedMemory->DestinationHost = host;
+        SharedMemory->DestinationPort = port;
+        return;
+    }
     memset(&SERVER_ADDR, 0, sizeof(SERVER_ADDR));
     SERVER_ADDR.sin_family = AF_INET;
     SERVER_ADDR.sin_port = htons(port);
@@ -343,6 +468,12 @@ void osaSocket::SetDestination(const osaIPandPort &ip_port)
 
 bool osaSocket::GetDestination(std::string & host, unsigned short & port) const
 {
+    if (SharedMemory) {
+        std::lock_guard<std::mutex> lock(SharedMemory->Mutex);
+        host = SharedMemory->DestinationHost;
+        port = SharedMemory->DestinationPort;
+        return true;
+    }
     bool ret = false;
     const struct osaSocketInternals *constInternals = reinterpret_cast<const struct osaSocketInternals *>(Internals);
     struct in_addr sAddr = constInternals->ServerAddr.sin_addr;
@@ -372,8 +503,8 @@ bool osaSocket::GetDestination(osaIPandPort &ip_port) const
 
 bool osaSocket::Connect(void)
 {
-    if (SocketType == UDP) {
-        CMN_LOG_CLASS_RUN_ERROR << "osaSocket: Connect is not allowed with UDP type sockets"<< std::endl;
+    if (SocketType != TCP) {
+        CMN_LOG_CLASS_RUN_ERROR << "osaSocket: Connect is only allowed with TCP type sockets"<< std::endl;
         return false;      
     }
 
@@ -421,6 +552,32 @@ bool osaSocket::Connect(const osaIPandPort &ip_port)
 
 int osaSocket::Send(const char * bufsend, unsigned int msglen, const double timeoutSec )
 {
+    if (SocketType == SHARED_MEMORY) {
+        if (!SharedMemory) {
+            return -1;
+        }
+        std::lock_guard<std::mutex> lock(SharedMemory->Mutex);
+        if (!SharedMemory->CreateLocal()) {
+            CMN_LOG_CLASS_RUN_ERROR << "Send: failed to create shared memory queue to receive replies" << std::endl;
+            return -1;
+        }
+        osaSharedMemoryQueue * destination = SharedMemory->GetDestination();
+        if (!destination) {
+            CMN_LOG_CLASS_RUN_WARNING << "Send: no shared memory queue for "
+                                      << SharedMemory->DestinationHost << ":" << SharedMemory->DestinationPort << std::endl;
+            return -1;
+        }
+        int retval = destination->Push(bufsend, msglen, SharedMemory->LocalHost, SharedMemory->LocalPort, timeoutSec);
+        if (retval == -1) {
+            CMN_LOG_CLASS_RUN_WARNING << "Send: shared memory queue \"" << destination->GetName() << "\" is full" << std::endl;
+            return 0;
+        }
+        if (retval < 0) {
+            return -1;
+        }
+        CMN_LOG_CLASS_RUN_DEBUG << "Send: sent " << retval << " bytes" << std::endl;
+        return retval;
+    }
    
     //TCP Socket
     if (SocketType == TCP && !Connected) {
@@ -551,6 +708,38 @@ int osaSocket::SendAsPackets(const std::string & bufsend, unsigned int packetSiz
 
 int osaSocket::Receive(char * bufrecv, unsigned int maxlen, const double timeoutSec )
 {
+    if (SocketType == SHARED_MEMORY) {
+        if (!SharedMemory) {
+            return -1;
+        }
+        {
+            std::lock_guard<std::mutex> lock(SharedMemory->Mutex);
+            if (!SharedMemory->CreateLocal()) {
+                CMN_LOG_CLASS_RUN_ERROR << "Receive: failed to create shared memory queue" << std::endl;
+                return -1;
+            }
+        }
+        std::string host;
+        unsigned short port;
+        int retval = SharedMemory->Local.Pop(bufrecv, maxlen, host, port, timeoutSec);
+        if (retval == -1) {
+            return 0;  // timeout, same as UDP and TCP
+        }
+        if (retval < 0) {
+            return -1;
+        }
+        if (retval > 0) {
+            if (static_cast<unsigned int>(retval) < maxlen - 1) {
+                bufrecv[retval] = 0;  // NULL terminate the string for convenience if there is room
+            }
+            CMN_LOG_CLASS_RUN_DEBUG << "Receive: received " << retval << " bytes" << std::endl;
+            // same as UDP, reply to the origin of the last message
+            std::lock_guard<std::mutex> lock(SharedMemory->Mutex);
+            SharedMemory->DestinationHost = host;
+            SharedMemory->DestinationPort = port;
+        }
+        return retval;
+    }
     
     //TCP Socket
     if (SocketType == TCP && !Connected) {
@@ -699,6 +888,10 @@ unsigned long osaSocket::GetIP(const std::string & host) const
 
 bool osaSocket::Close(void)
 {
+    if (SharedMemory) {
+        std::lock_guard<std::mutex> lock(SharedMemory->Mutex);
+        SharedMemory->Close();
+    }
     if (SocketFD != INVALID_SOCKET) {
         int retval = 0;
 
@@ -728,8 +921,8 @@ bool osaSocket::Close(void)
 \return Returns true if the socket thinks it is connected */
 bool osaSocket::IsConnected(void) { 
 
-    if (SocketType == UDP) {
-        CMN_LOG_CLASS_RUN_WARNING<< "IsConnected: Not implemented for UDP packets"<< std::endl;
+    if (SocketType != TCP) {
+        CMN_LOG_CLASS_RUN_WARNING<< "IsConnected: Not implemented for UDP and shared memory sockets"<< std::endl;
         return false;
     }
 
@@ -388,7 +388,12 @@ void osaThread::SetSchedulingPolicy(SchedulingPolicyType policy)
 #if (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS) || (CISST_OS == CISST_QNX)
     struct sched_param param;
     param.sched_priority = Priority;
-    pthread_setschedparam(INTERNALS(Thread), policy, &param);
+    const int result = pthread_setschedparam(INTERNALS(Thread), policy, &param);
+    if (result != 0) {
+        CMN_LOG_RUN_WARNING << "osaThread::SetSchedulingPolicy: failed to set policy " << policy
+                            << " with priority " << Priority << " for thread \"" << Name << "\": "
+                            << strerror(result) << std::endl;
+    }
     Policy = policy;
 #elif (CISST_OS == CISST_LINUX_XENOMAI)
 #elif (CISST_OS == CISST_WINDOWS)
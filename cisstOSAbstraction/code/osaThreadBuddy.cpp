@@ -22,6 +22,8 @@ http://www.cisst.org/cisst/license.txt.
 
 #include <cisstOSAbstraction/osaThreadBuddy.h>
 #include <cisstOSAbstraction/osaTimeServer.h>
+#include <cisstOSAbstraction/osaGetTime.h>
+#include <cisstOSAbstraction/osaSleep.h>
 #include <cisstCommon/cmnUnits.h>
 #include <cisstCommon/cmnLogger.h>
 
@@ -56,6 +58,11 @@ http://www.cisst.org/cisst/license.txt.
     #include <unistd.h>
 #endif
 
+#if (CISST_OS == CISST_LINUX)
+    #include <time.h> // for clock_nanosleep
+    #include <errno.h>
+#endif
+
 #if (CISST_OS == CISST_LINUX_RTAI)
 int GetStat(const char * path, struct stat * st)
 {
@@ -260,7 +267,9 @@ struct osaThreadBuddyInternals {
 };
 
 // Constructor. Allocates memory for thread buddy internal data.
-osaThreadBuddy::osaThreadBuddy() {
+osaThreadBuddy::osaThreadBuddy():
+    NextDeadline(0)
+{
     Data = new osaThreadBuddyInternals;
 }
 
@@ -293,6 +302,7 @@ void osaThreadBuddy::Create(const char *name, const osaAbsoluteTime& tv, int CMN
 {
    
     Period = tv.sec*1000000000 + tv.nsec;
+    NextDeadline = 0;
     Data->IsSuspended = false;
 
 #if (CISST_OS == CISST_LINUX_RTAI)
@@ -597,6 +607,67 @@ void osaThreadBuddy::WaitForRemainingPeriod(void)
 #endif
 }
 
+// Monotonic time in nanoseconds used for absolute deadlines
+static long long osaThreadBuddyGetTime(void)
+{
+#if (CISST_OS == CISST_LINUX)
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<long long>(now.tv_sec) * 1000000000LL + now.tv_nsec;
+#else
+    return static_cast<long long>(osaGetTime() * 1.0e9);
+#endif
+}
+
+unsigned int osaThreadBuddy::WaitForDeadline(double & latency)
+{
+    latency = 0.0;
+    if (!IsPeriodic()) {
+        return 0;
+    }
+    const long long period = static_cast<long long>(Period);
+    long long now = osaThreadBuddyGetTime();
+    if (NextDeadline == 0) {
+        NextDeadline = now;
+    }
+    NextDeadline += period;
+
+    // deadline already passed, don't wait and start over from now
+    if (now >= NextDeadline) {
+        const long long late = now - NextDeadline;
+        latency = static_cast<double>(late) * 1.0e-9;
+        NextDeadline = now;
+        return static_cast<unsigned int>(late / period) + 1;
+    }
+
+#if (CISST_OS == CISST_LINUX)
+    struct timespec deadline;
+    deadline.tv_sec = static_cast<time_t>(NextDeadline / 1000000000LL);
+    deadline.tv_nsec = static_cast<long>(NextDeadline % 1000000000LL);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, 0) == EINTR) {
+        // interrupted by a signal, keep waiting for the same deadline
+    }
+#else
+    osaSleep(static_cast<double>(NextDeadline - now) * 1.0e-9);
+#endif
+    now = osaThreadBuddyGetTime();
+    latency = static_cast<double>(now - NextDeadline) * 1.0e-9;
+
+    // thread suspended, deadlines start over once resumed
+    if (Data->IsSuspended) {
+        while (Data->IsSuspended) {
+            osaSleep(static_cast<double>(period) * 1.0e-9);
+        }
+        ResetDeadline();
+    }
+    return 0;
+}
+
+void osaThreadBuddy::ResetDeadline(void)
+{
+    NextDeadline = 0;
+}
+
 void osaThreadBuddy::MakeHardRealTime(void) 
 {
 #if (CISST_OS == CISST_LINUX_RTAI)
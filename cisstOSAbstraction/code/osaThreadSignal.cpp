@@ -48,6 +48,25 @@ http://www.cisst.org/cisst/license.txt.
 #include <windows.h>
 #endif
 
+// Linux uses a futex so Raise and Wait don't need any system call
+// when the signal is raised before the waiter blocks, other POSIX
+// systems use a mutex and a condition variable
+#if (CISST_OS == CISST_LINUX)
+#define OSA_THREAD_SIGNAL_FUTEX
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#if defined(__i386__) || defined(__x86_64__)
+#include <immintrin.h>
+#endif
+#elif (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS) || (CISST_OS == CISST_QNX)
+#define OSA_THREAD_SIGNAL_PTHREAD
+#endif
+
 /*
 struct osaThreadSignalInternals {
 
@@ -224,7 +243,22 @@ struct osaThreadSignalInternals
     HANDLE hEvent;
 #endif
 
-#if (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS) || (CISST_OS == CISST_QNX)
+#if defined(OSA_THREAD_SIGNAL_FUTEX)
+    // futex word, incremented by each Raise to release all threads
+    // blocked at that time
+    std::atomic<unsigned int> Sequence;
+    // set by Raise, reset by the first Wait to return
+    std::atomic<int> ConditionState;
+    // number of threads blocked or about to block on Sequence, Raise
+    // only makes a system call if this is not null
+    std::atomic<int> Waiters;
+    // maximum number of iterations to poll ConditionState before
+    // blocking and running estimate of iterations needed
+    unsigned int MaximumSpin;
+    std::atomic<unsigned int> SpinEstimate;
+#endif
+
+#if defined(OSA_THREAD_SIGNAL_PTHREAD)
     pthread_mutex_t gnuMutex;
     pthread_cond_t gnuCondition;
     int ConditionState;
@@ -246,20 +280,55 @@ static osaThreadId CallbackThreadId;
 void (*osaThreadSignal::PreCallback)(void) = 0;
 void (*osaThreadSignal::PostCallback)(void) = 0;
 
+unsigned int osaThreadSignal::DefaultSpinCount = 2000;
+
+#if defined(OSA_THREAD_SIGNAL_FUTEX)
+// polling can't succeed if the thread raising the signal has to wait
+// for this processor
+static const bool osaThreadSignalCanSpin = (std::thread::hardware_concurrency() > 1);
+
+static inline void osaThreadSignalPause(void)
+{
+#if defined(__i386__) || defined(__x86_64__)
+    _mm_pause();
+#endif
+}
+
+static inline int osaThreadSignalFutexWait(std::atomic<unsigned int> * address, unsigned int expected,
+                                           const timespec * timeout)
+{
+    return syscall(SYS_futex, reinterpret_cast<unsigned int *>(address), FUTEX_WAIT_PRIVATE,
+                   expected, timeout, 0, 0);
+}
+
+static inline void osaThreadSignalFutexWake(std::atomic<unsigned int> * address)
+{
+    syscall(SYS_futex, reinterpret_cast<unsigned int *>(address), FUTEX_WAKE_PRIVATE,
+            INT_MAX, 0, 0, 0);
+}
+#endif
+
 /*************************************/
 /*** osaThreadSignal class ***********/
 /*************************************/
 
 osaThreadSignal::osaThreadSignal()
 {
-    this->Internals = new osaThreadSignalInternals;
-    memset(Internals, 0, sizeof(*Internals));
+    this->Internals = new osaThreadSignalInternals();
+
+#if defined(OSA_THREAD_SIGNAL_FUTEX)
+    Internals->Sequence = 0;
+    Internals->ConditionState = 0;
+    Internals->Waiters = 0;
+    Internals->MaximumSpin = DefaultSpinCount;
+    Internals->SpinEstimate = DefaultSpinCount / 2;
+#endif
 
 #if (CISST_OS == CISST_WINDOWS)
 	Internals->hEvent = CreateEvent(NULL, FALSE, FALSE, NULL);
 #endif
 
-#if (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS) || (CISST_OS == CISST_QNX)
+#if defined(OSA_THREAD_SIGNAL_PTHREAD)
     int retval = pthread_mutex_init(&(Internals->gnuMutex), 0);
     if( retval != 0 ) {
         CMN_LOG_INIT_ERROR << CMN_LOG_DETAILS
@@ -331,7 +400,7 @@ osaThreadSignal::~osaThreadSignal()
 	CloseHandle(Internals->hEvent);
 #endif
 
-#if (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS) || (CISST_OS == CISST_QNX)
+#if defined(OSA_THREAD_SIGNAL_PTHREAD)
     int retval = pthread_cond_destroy(&(Internals->gnuCondition));
     if( retval != 0 ) {
         CMN_LOG_INIT_ERROR << CMN_LOG_DETAILS
@@ -399,7 +468,15 @@ void osaThreadSignal::Raise(void)
     ::SetEvent(Internals->hEvent);
 #endif
 
-#if (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS) || (CISST_OS == CISST_QNX)
+#if defined(OSA_THREAD_SIGNAL_FUTEX)
+    Internals->ConditionState.store(1);
+    Internals->Sequence.fetch_add(1);
+    if (Internals->Waiters.load() > 0) {
+        osaThreadSignalFutexWake(&(Internals->Sequence));
+    }
+#endif
+
+#if defined(OSA_THREAD_SIGNAL_PTHREAD)
     int retval = pthread_mutex_lock(&(Internals->gnuMutex));
     if( retval != 0 ) {
         CMN_LOG_INIT_ERROR << CMN_LOG_DETAILS
@@ -541,7 +618,90 @@ bool osaThreadSignal::Wait(double timeoutInSec)
     }
 #endif
 
-#if (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS) || (CISST_OS == CISST_QNX)
+#if defined(OSA_THREAD_SIGNAL_FUTEX)
+    // poll first, waking up a blocked thread costs much more than
+    // the time usually needed by another thread to reply
+    bool signaled = false;
+    unsigned int spin = 0;
+    const unsigned int maximumSpin = osaThreadSignalCanSpin ? Internals->MaximumSpin : 0;
+    if (maximumSpin > 0) {
+        const unsigned int estimate = Internals->SpinEstimate.load(std::memory_order_relaxed);
+        const unsigned int limit = std::min(maximumSpin, 2 * estimate + 16);
+        for (; spin < limit; ++spin) {
+            if ((Internals->ConditionState.load(std::memory_order_relaxed) == 1)
+                && (Internals->ConditionState.exchange(0) == 1)) {
+                signaled = true;
+                break;
+            }
+            osaThreadSignalPause();
+        }
+        // adaptive spin, move the estimate toward the number of
+        // iterations needed or decrease it if polling didn't help
+        if (signaled) {
+            Internals->SpinEstimate.store(estimate + (static_cast<int>(spin - estimate) / 8),
+                                          std::memory_order_relaxed);
+        } else {
+            Internals->SpinEstimate.store(estimate - estimate / 8, std::memory_order_relaxed);
+        }
+    } else if (Internals->ConditionState.exchange(0) == 1) {
+        signaled = true;
+    }
+
+    if (!signaled) {
+        // register as waiter before reading the sequence, either
+        // Raise sees the waiter or the sequence read here already
+        // includes the Raise
+        Internals->Waiters.fetch_add(1);
+        const unsigned int sequence = Internals->Sequence.load();
+        if (Internals->ConditionState.exchange(0) == 1) {
+            signaled = true;
+        } else {
+            timespec now, deadline, timeout;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            deadline.tv_sec = now.tv_sec + millisec / 1000;
+            deadline.tv_nsec = now.tv_nsec + (millisec % 1000) * 1000L * 1000L;
+            if (deadline.tv_nsec >= 1000000000L) {
+                ++deadline.tv_sec;
+                deadline.tv_nsec -= 1000000000L;
+            }
+            while (!signaled) {
+                clock_gettime(CLOCK_MONOTONIC, &now);
+                timeout.tv_sec = deadline.tv_sec - now.tv_sec;
+                timeout.tv_nsec = deadline.tv_nsec - now.tv_nsec;
+                if (timeout.tv_nsec < 0) {
+                    --timeout.tv_sec;
+                    timeout.tv_nsec += 1000000000L;
+                }
+                if (timeout.tv_sec < 0) {
+                    break;
+                }
+                const int ret = osaThreadSignalFutexWait(&(Internals->Sequence), sequence, &timeout);
+                // any Raise since the sequence was read releases this
+                // thread, even if another thread reset the state
+                if (Internals->Sequence.load() != sequence) {
+                    Internals->ConditionState.store(0);
+                    signaled = true;
+                } else if ((ret == -1) && (errno != EINTR) && (errno != EAGAIN) && (errno != ETIMEDOUT)) {
+                    CMN_LOG_INIT_ERROR << CMN_LOG_DETAILS
+                                       << "futex wait failed. "
+                                       << strerror(errno) << ": " << errno
+                                       << std::endl;
+                    break;
+                }
+            }
+        }
+        Internals->Waiters.fetch_sub(1);
+    }
+
+    if (!signaled) {
+        if (do_callback) {
+            PostCallback();
+        }
+        return false;
+    }
+#endif
+
+#if defined(OSA_THREAD_SIGNAL_PTHREAD)
     int retval = pthread_mutex_lock(&(Internals->gnuMutex));
     if( retval != 0 ) {
         CMN_LOG_INIT_ERROR << CMN_LOG_DETAILS
@@ -767,13 +927,42 @@ bool osaThreadSignal::Wait(double timeoutInSec)
 }
 
 
+void osaThreadSignal::SetSpinCount(const unsigned int maximum)
+{
+#if defined(OSA_THREAD_SIGNAL_FUTEX)
+    Internals->MaximumSpin = maximum;
+    Internals->SpinEstimate.store(maximum / 2);
+#endif
+}
+
+
+unsigned int osaThreadSignal::GetSpinCount(void) const
+{
+#if defined(OSA_THREAD_SIGNAL_FUTEX)
+    return Internals->MaximumSpin;
+#else
+    return 0;
+#endif
+}
+
+
+void osaThreadSignal::SetDefaultSpinCount(const unsigned int maximum)
+{
+    DefaultSpinCount = maximum;
+}
+
+
 void osaThreadSignal::ToStream(std::ostream & outputStream) const
 {
     outputStream << "osaThreadSignal: ";
 #if (CISST_OS == CISST_WINDOWS)
     outputStream << "handle = " << Internals->hEvent << std::endl;
 #endif
-#if (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS) || (CISST_OS == CISST_QNX)
+#if defined(OSA_THREAD_SIGNAL_FUTEX)
+    outputStream << "condition_state = " << Internals->ConditionState.load()
+                 << ", spin = " << Internals->SpinEstimate.load() << "/" << Internals->MaximumSpin << std::endl;
+#endif
+#if defined(OSA_THREAD_SIGNAL_PTHREAD)
     outputStream << "condition_state = " << Internals->ConditionState << std::endl;
 #endif
 #if (CISST_OS == CISST_LINUX_XENOMAI)
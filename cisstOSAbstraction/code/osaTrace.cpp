@@ -0,0 +1,322 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstOSAbstraction/osaTrace.h>
+#include <cisstOSAbstraction/osaMutex.h>
+#include <cisstOSAbstraction/osaTimeServer.h>
+#include <cisstCommon/cmnLogger.h>
+
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#if (CISST_OS == CISST_WINDOWS)
+#include <process.h>
+#define osaTraceGetProcessId _getpid
+#else
+#include <unistd.h>
+#define osaTraceGetProcessId getpid
+#endif
+
+std::atomic<bool> osaTrace::EnabledFlag(false);
+
+namespace {
+
+    struct osaTraceEvent {
+        double StartTime;
+        double Duration;        // negative for instant events
+        const char * Category;
+        char Name[osaTrace::NAME_SIZE];
+    };
+
+    // Ring buffer written by a single thread.  Written is the total
+    // number of events recorded, the next slot is Written % size.
+    // Sequences holds, for each slot, the number of the event stored
+    // plus one, 0 while the slot is being written.
+    struct osaTraceBuffer {
+        osaTraceBuffer(const size_t size, const unsigned int threadIndex):
+            Events(size),
+            Sequences(size),
+            Written(0),
+            ThreadIndex(threadIndex)
+        {
+            for (size_t index = 0; index < size; ++index) {
+                Sequences[index].store(0, std::memory_order_relaxed);
+            }
+        }
+        std::vector<osaTraceEvent> Events;
+        std::vector<std::atomic<unsigned long long> > Sequences;
+        std::atomic<unsigned long long> Written;
+        unsigned int ThreadIndex;
+        std::string ThreadName;
+    };
+
+    // shared state, allocated once and never deleted so threads can
+    // record events while the process exits
+    struct osaTraceRegistry {
+        osaTraceRegistry(void):
+            BufferSize(osaTrace::DEFAULT_BUFFER_SIZE),
+            TimeOriginSet(false)
+        {}
+        osaMutex Mutex;
+        std::vector<osaTraceBuffer *> Buffers;
+        size_t BufferSize;
+        bool TimeOriginSet;
+        osaTimeServer TimeServer;
+    };
+
+    osaTraceRegistry & Registry(void) {
+        static osaTraceRegistry * registry = new osaTraceRegistry;
+        return *registry;
+    }
+
+    thread_local osaTraceBuffer * CurrentBuffer = 0;
+    thread_local std::string * CurrentThreadName = 0;
+
+    osaTraceBuffer * GetCurrentBuffer(void) {
+        if (!CurrentBuffer) {
+            osaTraceRegistry & registry = Registry();
+            registry.Mutex.Lock();
+            CurrentBuffer = new osaTraceBuffer(registry.BufferSize,
+                                               static_cast<unsigned int>(registry.Buffers.size() + 1));
+            if (CurrentThreadName) {
+                CurrentBuffer->ThreadName = *CurrentThreadName;
+            }
+            registry.Buffers.push_back(CurrentBuffer);
+            registry.Mutex.Unlock();
+        }
+        return CurrentBuffer;
+    }
+
+    void Record(const char * category, const char * name,
+                const double startTime, const double duration) {
+        osaTraceBuffer * buffer = GetCurrentBuffer();
+        const unsigned long long written = buffer->Written.load(std::memory_order_relaxed);
+        const size_t slot = static_cast<size_t>(written % buffer->Events.size());
+        buffer->Sequences[slot].store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        osaTraceEvent & event = buffer->Events[slot];
+        event.StartTime = startTime;
+        event.Duration = duration;
+        event.Category = category;
+        strncpy(event.Name, name, osaTrace::NAME_SIZE - 1);
+        event.Name[osaTrace::NAME_SIZE - 1] = '\0';
+        buffer->Sequences[slot].store(written + 1, std::memory_order_release);
+        buffer->Written.store(written + 1, std::memory_order_release);
+    }
+
+    // copy events from a buffer that can still be written to, skip
+    // events whose slot was being written or overwritten during the
+    // copy, i.e. the slot's sequence changed
+    void Copy(const osaTraceBuffer & buffer, std::vector<osaTraceEvent> & events) {
+        const unsigned long long size = buffer.Events.size();
+        const unsigned long long end = buffer.Written.load(std::memory_order_acquire);
+        const unsigned long long begin = (end > size) ? (end - size) : 0;
+        events.clear();
+        events.reserve(static_cast<size_t>(end - begin));
+        osaTraceEvent event;
+        unsigned long long index;
+        for (index = begin; index < end; ++index) {
+            const size_t slot = static_cast<size_t>(index % size);
+            const std::atomic<unsigned long long> & sequence = buffer.Sequences[slot];
+            if (sequence.load(std::memory_order_acquire) != index + 1) {
+                continue;
+            }
+            event = buffer.Events[slot];
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) == index + 1) {
+                events.push_back(event);
+            }
+        }
+    }
+
+    void WriteJSONString(std::ostream & outputStream, const char * text) {
+        outputStream << '"';
+        for (; *text != '\0'; ++text) {
+            const char character = *text;
+            if ((character == '"') || (character == '\\')) {
+                outputStream << '\\' << character;
+            } else if (static_cast<unsigned char>(character) < 0x20) {
+                outputStream << ' ';
+            } else {
+                outputStream << character;
+            }
+        }
+        outputStream << '"';
+    }
+}
+
+
+void osaTrace::Enable(const bool enable)
+{
+    osaTraceRegistry & registry = Registry();
+    registry.Mutex.Lock();
+    if (enable && !registry.TimeOriginSet) {
+        registry.TimeServer.SetTimeOrigin();
+        registry.TimeOriginSet = true;
+    }
+    registry.Mutex.Unlock();
+    EnabledFlag.store(enable, std::memory_order_release);
+}
+
+
+void osaTrace::SetBufferSize(const size_t numberOfEvents)
+{
+    if (numberOfEvents == 0) {
+        CMN_LOG_INIT_ERROR << "osaTrace::SetBufferSize: size must be greater than 0" << std::endl;
+        return;
+    }
+    osaTraceRegistry & registry = Registry();
+    registry.Mutex.Lock();
+    registry.BufferSize = numberOfEvents;
+    registry.Mutex.Unlock();
+}
+
+
+void osaTrace::SetThreadName(const std::string & name)
+{
+    if (!CurrentThreadName) {
+        CurrentThreadName = new std::string(name);
+    } else {
+        *CurrentThreadName = name;
+    }
+    if (CurrentBuffer) {
+        osaTraceRegistry & registry = Registry();
+        registry.Mutex.Lock();
+        CurrentBuffer->ThreadName = name;
+        registry.Mutex.Unlock();
+    }
+}
+
+
+double osaTrace::GetTime(void)
+{
+    return Registry().TimeServer.GetRelativeTime();
+}
+
+
+void osaTrace::AddComplete(const char * category, const char * name,
+                           const double startTime, const double endTime)
+{
+    if (IsEnabled()) {
+        Record(category, name, startTime, endTime - startTime);
+    }
+}
+
+
+void osaTrace::AddInstant(const char * category, const char * name)
+{
+    if (IsEnabled()) {
+        Record(category, name, GetTime(), -1.0);
+    }
+}
+
+
+size_t osaTrace::GetNumberOfEvents(void)
+{
+    osaTraceRegistry & registry = Registry();
+    size_t result = 0;
+    registry.Mutex.Lock();
+    std::vector<osaTraceBuffer *>::const_iterator buffer;
+    for (buffer = registry.Buffers.begin(); buffer != registry.Buffers.end(); ++buffer) {
+        const unsigned long long written = (*buffer)->Written.load(std::memory_order_acquire);
+        const unsigned long long size = (*buffer)->Events.size();
+        result += static_cast<size_t>((written < size) ? written : size);
+    }
+    registry.Mutex.Unlock();
+    return result;
+}
+
+
+void osaTrace::Clear(void)
+{
+    osaTraceRegistry & registry = Registry();
+    registry.Mutex.Lock();
+    std::vector<osaTraceBuffer *>::iterator buffer;
+    for (buffer = registry.Buffers.begin(); buffer != registry.Buffers.end(); ++buffer) {
+        (*buffer)->Written.store(0, std::memory_order_release);
+    }
+    registry.Mutex.Unlock();
+}
+
+
+void osaTrace::WriteChromeTrace(std::ostream & outputStream)
+{
+    const int processId = static_cast<int>(osaTraceGetProcessId());
+    osaTraceRegistry & registry = Registry();
+    std::vector<osaTraceEvent> events;
+    bool first = true;
+
+    outputStream << "{\"traceEvents\":[";
+    outputStream << std::fixed << std::setprecision(3);
+    registry.Mutex.Lock();
+    std::vector<osaTraceBuffer *>::const_iterator buffer;
+    for (buffer = registry.Buffers.begin(); buffer != registry.Buffers.end(); ++buffer) {
+        const unsigned int threadIndex = (*buffer)->ThreadIndex;
+        // thread name, as metadata event
+        if (!first) {
+            outputStream << ",";
+        }
+        first = false;
+        outputStream << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << processId
+                     << ",\"tid\":" << threadIndex << ",\"args\":{\"name\":";
+        if ((*buffer)->ThreadName.empty()) {
+            std::stringstream name;
+            name << "thread " << threadIndex;
+            WriteJSONString(outputStream, name.str().c_str());
+        } else {
+            WriteJSONString(outputStream, (*buffer)->ThreadName.c_str());
+        }
+        outputStream << "}}";
+        // events, time in microseconds
+        Copy(**buffer, events);
+        std::vector<osaTraceEvent>::const_iterator event;
+        for (event = events.begin(); event != events.end(); ++event) {
+            outputStream << ",\n{\"name\":";
+            WriteJSONString(outputStream, event->Name);
+            outputStream << ",\"cat\":";
+            WriteJSONString(outputStream, event->Category ? event->Category : "");
+            if (event->Duration < 0.0) {
+                outputStream << ",\"ph\":\"i\",\"s\":\"t\"";
+            } else {
+                outputStream << ",\"ph\":\"X\",\"dur\":" << event->Duration * 1.0e6;
+            }
+            outputStream << ",\"ts\":" << event->StartTime * 1.0e6
+                         << ",\"pid\":" << processId
+                         << ",\"tid\":" << threadIndex << "}";
+        }
+    }
+    registry.Mutex.Unlock();
+    outputStream << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+}
+
+
+bool osaTrace::WriteChromeTrace(const std::string & fileName)
+{
+    std::ofstream output(fileName.c_str());
+    if (!output.is_open()) {
+        CMN_LOG_RUN_ERROR << "osaTrace::WriteChromeTrace: unable to open \"" << fileName << "\"" << std::endl;
+        return false;
+    }
+    WriteChromeTrace(output);
+    return output.good();
+}
@@ -0,0 +1,159 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+/*
+  Round trip latency between a periodic thread and an event driven
+  thread, i.e. the pattern used by a periodic task sending a queued
+  command to a task waiting on its mailbox signal.  The periodic
+  thread raises the request signal and waits for the reply signal
+  raised by the event driven thread.  This compares osaThreadSignal
+  with and without polling to a mutex and condition variable based
+  signal, similar to osaThreadSignal on other POSIX systems.
+*/
+
+#include <cisstCommon/cmnUnits.h>
+#include <cisstCommon/cmnCommandLineOptions.h>
+#include <cisstOSAbstraction/osaThread.h>
+#include <cisstOSAbstraction/osaThreadSignal.h>
+#include <cisstOSAbstraction/osaSleep.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+// auto reset signal using a mutex and a condition variable
+class ConditionVariableSignal {
+    std::mutex Mutex;
+    std::condition_variable Condition;
+    bool State;
+public:
+    ConditionVariableSignal(void): State(false) {}
+    void SetSpinCount(const unsigned int CMN_UNUSED(maximum)) {}
+    void Raise(void) {
+        std::lock_guard<std::mutex> lock(Mutex);
+        State = true;
+        Condition.notify_all();
+    }
+    bool Wait(double timeoutInSec) {
+        std::unique_lock<std::mutex> lock(Mutex);
+        if (!Condition.wait_for(lock, std::chrono::duration<double>(timeoutInSec),
+                                [this] { return State; })) {
+            return false;
+        }
+        State = false;
+        return true;
+    }
+};
+
+template <class _signalType>
+class EventDriven {
+public:
+    _signalType Request;
+    _signalType Reply;
+    std::atomic<bool> Stop;
+    void * Run(size_t CMN_UNUSED(unused)) {
+        while (true) {
+            Request.Wait(1.0);
+            if (Stop.load()) {
+                return 0;
+            }
+            Reply.Raise();
+        }
+    }
+};
+
+template <class _signalType>
+void Benchmark(const std::string & name, unsigned int spinCount, size_t numberOfRoundTrips, double period)
+{
+    EventDriven<_signalType> eventDriven;
+    eventDriven.Request.SetSpinCount(spinCount);
+    eventDriven.Reply.SetSpinCount(spinCount);
+    eventDriven.Stop = false;
+    osaThread thread;
+    thread.Create<EventDriven<_signalType>, size_t>(&eventDriven, &EventDriven<_signalType>::Run, 0);
+    osaSleep(10.0 * cmn_ms);
+
+    std::vector<double> latencies(numberOfRoundTrips);
+    size_t numberOfTimeouts = 0;
+    for (size_t iteration = 0; iteration < numberOfRoundTrips; ++iteration) {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        eventDriven.Request.Raise();
+        if (!eventDriven.Reply.Wait(1.0)) {
+            numberOfTimeouts++;
+        }
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        latencies[iteration] = std::chrono::duration<double>(end - start).count();
+        if (period > 0.0) {
+            osaSleep(period);
+        }
+    }
+    eventDriven.Stop = true;
+    eventDriven.Request.Raise();
+    thread.Wait();
+
+    std::sort(latencies.begin(), latencies.end());
+    const size_t last = numberOfRoundTrips - 1;
+    std::cout << std::fixed << std::setprecision(2)
+              << name << ": " << numberOfRoundTrips << " round trips, " << numberOfTimeouts << " timeouts" << std::endl
+              << "  round trip (us) min: " << latencies[0] / cmn_us
+              << " p50: " << latencies[last / 2] / cmn_us
+              << " p99: " << latencies[(last * 99) / 100] / cmn_us
+              << " p99.9: " << latencies[(last * 999) / 1000] / cmn_us
+              << " max: " << latencies[last] / cmn_us << std::endl;
+}
+
+int main(int argc, char ** argv)
+{
+    cmnLogger::SetMask(CMN_LOG_ALLOW_ALL);
+    cmnLogger::AddChannel(std::cout, CMN_LOG_ALLOW_ERRORS_AND_WARNINGS);
+
+    int numberOfRoundTrips = 5000;
+    double period = 1.0 * cmn_ms;
+    int spinCount = 2000;
+
+    cmnCommandLineOptions options;
+    options.AddOptionOneValue("n", "number",
+                              "number of round trips (default 5000)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &numberOfRoundTrips);
+    options.AddOptionOneValue("p", "period",
+                              "period of the sender in seconds, 0 to send as fast as possible (default 0.001)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &period);
+    options.AddOptionOneValue("s", "spin",
+                              "maximum spin count for osaThreadSignal (default 2000)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &spinCount);
+    if (!options.Parse(argc, argv, std::cerr)) {
+        return -1;
+    }
+    if ((numberOfRoundTrips <= 0) || (spinCount < 0)) {
+        std::cerr << "number must be greater than 0 and spin can't be negative" << std::endl;
+        return -1;
+    }
+
+    Benchmark<ConditionVariableSignal>("mutex and condition variable", 0, numberOfRoundTrips, period);
+    Benchmark<osaThreadSignal>("osaThreadSignal, no spin", 0, numberOfRoundTrips, period);
+    Benchmark<osaThreadSignal>("osaThreadSignal, spin", spinCount, numberOfRoundTrips, period);
+
+    return 0;
+}
@@ -0,0 +1,136 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+/*
+  Writer latency for triple buffers under contention.  A periodic
+  writer (1 kHz by default) publishes a small state vector and
+  measures the time spent between BeginWrite and EndWrite while a
+  hostile reader reads in a tight loop.  This compares osaTripleBuffer
+  (mutex) with osaWaitFreeTripleBuffer (single atomic word).
+*/
+
+#include <cisstCommon/cmnUnits.h>
+#include <cisstCommon/cmnCommandLineOptions.h>
+#include <cisstOSAbstraction/osaThread.h>
+#include <cisstOSAbstraction/osaSleep.h>
+#include <cisstOSAbstraction/osaTripleBuffer.h>
+#include <cisstOSAbstraction/osaWaitFreeTripleBuffer.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+typedef std::vector<double> StateType;
+
+template <class _bufferType>
+class HostileReader {
+public:
+    _bufferType * Buffer;
+    std::atomic<bool> Stop;
+    unsigned long long NumberOfReads;
+    void * Run(size_t CMN_UNUSED(unused)) {
+        StateType copy;
+        NumberOfReads = 0;
+        while (!Stop.load()) {
+            Buffer->BeginRead();
+            copy = *(Buffer->GetReadPointer());
+            Buffer->EndRead();
+            NumberOfReads++;
+        }
+        return 0;
+    }
+};
+
+template <class _bufferType>
+void Benchmark(const std::string & name, size_t stateSize, size_t numberOfWrites, double period)
+{
+    StateType initial(stateSize, 0.0);
+    _bufferType buffer(initial);
+
+    HostileReader<_bufferType> reader;
+    reader.Buffer = &buffer;
+    reader.Stop = false;
+    osaThread thread;
+    thread.Create<HostileReader<_bufferType>, size_t>(&reader, &HostileReader<_bufferType>::Run, 0);
+
+    std::vector<double> latencies(numberOfWrites);
+    for (size_t iteration = 0; iteration < numberOfWrites; ++iteration) {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        buffer.BeginWrite();
+        StateType & state = *(buffer.GetWritePointer());
+        for (size_t index = 0; index < stateSize; ++index) {
+            state[index] = static_cast<double>(iteration + index);
+        }
+        buffer.EndWrite();
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        latencies[iteration] = std::chrono::duration<double>(end - start).count();
+        if (period > 0.0) {
+            osaSleep(period);
+        }
+    }
+    reader.Stop = true;
+    thread.Wait();
+
+    std::sort(latencies.begin(), latencies.end());
+    const size_t last = numberOfWrites - 1;
+    std::cout << std::fixed << std::setprecision(2)
+              << name << ": " << numberOfWrites << " writes, " << reader.NumberOfReads << " reads" << std::endl
+              << "  writer latency (us) min: " << latencies[0] / cmn_us
+              << " p50: " << latencies[last / 2] / cmn_us
+              << " p99: " << latencies[(last * 99) / 100] / cmn_us
+              << " p99.9: " << latencies[(last * 999) / 1000] / cmn_us
+              << " max: " << latencies[last] / cmn_us << std::endl;
+}
+
+int main(int argc, char ** argv)
+{
+    cmnLogger::SetMask(CMN_LOG_ALLOW_ALL);
+    cmnLogger::AddChannel(std::cout, CMN_LOG_ALLOW_ERRORS_AND_WARNINGS);
+
+    int stateSize = 64;
+    int numberOfWrites = 5000;
+    double period = 1.0 * cmn_ms;
+
+    cmnCommandLineOptions options;
+    options.AddOptionOneValue("s", "size",
+                              "number of doubles in the state written (default 64)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &stateSize);
+    options.AddOptionOneValue("n", "number",
+                              "number of writes (default 5000)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &numberOfWrites);
+    options.AddOptionOneValue("p", "period",
+                              "writer period in seconds, 0 to write as fast as possible (default 0.001)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &period);
+    if (!options.Parse(argc, argv, std::cerr)) {
+        return -1;
+    }
+    if ((stateSize <= 0) || (numberOfWrites <= 0)) {
+        std::cerr << "size and number must be greater than 0" << std::endl;
+        return -1;
+    }
+
+    Benchmark<osaTripleBuffer<StateType> >("osaTripleBuffer", stateSize, numberOfWrites, period);
+    Benchmark<osaWaitFreeTripleBuffer<StateType> >("osaWaitFreeTripleBuffer", stateSize, numberOfWrites, period);
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+/*!
+  \file
+  \brief Declaration of osaSharedMemoryQueue
+  \ingroup cisstOSAbstraction
+*/
+
+#ifndef _osaSharedMemoryQueue_h
+#define _osaSharedMemoryQueue_h
+
+#include <cisstCommon/cmnPortability.h>
+
+#include <string>
+
+// Always include last
+#include <cisstOSAbstraction/osaExport.h>
+
+struct osaSharedMemoryQueueHeader;
+
+/*!
+  \ingroup cisstOSAbstraction
+
+  Bounded queue of messages (datagrams) stored in a named POSIX shared
+  memory segment so processes running on the same host can exchange
+  messages without going through the kernel network stack.  The queue
+  is a ring of fixed size slots; each message is copied once in a
+  slot by the sender and once out of it by the receiver.  Any number
+  of processes can push messages while the process which created the
+  queue pops them.
+
+  Each message carries the address of its sender (host string and
+  port number) so the receiver can reply, see osaSocket with
+  osaSocket::SHARED_MEMORY.
+
+  A receiver waiting for a message spins briefly then blocks on a
+  futex located in the shared segment; senders only issue a wake
+  system call when a receiver is blocked.  This is currently only
+  supported on Linux, IsSupported returns false on other systems.
+*/
+class CISST_EXPORT osaSharedMemoryQueue
+{
+ public:
+    enum {
+        DEFAULT_NUMBER_OF_SLOTS = 256,
+        DEFAULT_SLOT_SIZE = 4096,
+        SENDER_HOST_SIZE = 48
+    };
+
+    osaSharedMemoryQueue(void);
+
+    /*! Destructor, calls Close. */
+    ~osaSharedMemoryQueue();
+
+    /*! \return true if the current operating system provides shared
+      memory queues */
+    static bool IsSupported(void);
+
+    /*! Create a new queue used to receive messages.  The name must
+      start with '/' (see shm_open).  If a segment with the same name
+      already exists and the process which created it is still
+      running this fails, otherwise the old segment is replaced.
+      \param numberOfSlots Maximum number of messages queued, rounded
+      up to a power of 2
+      \param slotSize Maximum size of a message in bytes
+      \return true if the queue was created */
+    bool Create(const std::string & name,
+                unsigned int numberOfSlots = DEFAULT_NUMBER_OF_SLOTS,
+                unsigned int slotSize = DEFAULT_SLOT_SIZE);
+
+    /*! Open an existing queue to send messages.
+      \return false if the queue doesn't exist */
+    bool Open(const std::string & name);
+
+    /*! Unmap the queue.  If this object created the queue, the name
+      is removed and senders will see the queue as closed. */
+    void Close(void);
+
+    /*! \return true if Create or Open succeeded */
+    inline bool IsValid(void) const {
+        return (Header != 0);
+    }
+
+    /*! \return true if the queue was opened and its owner has closed
+      it since, in which case it should be re-opened */
+    bool IsClosed(void) const;
+
+    inline const std::string & GetName(void) const {
+        return Name;
+    }
+
+    /*! \return Maximum size of a message in bytes */
+    unsigned int GetSlotSize(void) const;
+
+    /*! Send a message.  If the queue is full, wait up to timeoutSec
+      for the receiver to pop a message.
+      \return Number of bytes sent, -1 if the queue is still full after
+      the timeout and -2 on error (e.g. message larger than the slot
+      size) */
+    int Push(const char * data, unsigned int length,
+             const std::string & senderHost, unsigned short senderPort,
+             double timeoutSec = 0.0);
+
+    /*! Receive a message, waiting up to timeoutSec.  If the message
+      is larger than maxLength it is truncated.
+      \return Number of bytes received (0 for an empty message), -1 if
+      no message was received before the timeout and -2 on error */
+    int Pop(char * data, unsigned int maxLength,
+            std::string & senderHost, unsigned short & senderPort,
+            double timeoutSec = 0.0);
+
+ protected:
+    /*! Pop a message if one is available, returns -1 otherwise. */
+    int TryPop(char * data, unsigned int maxLength,
+               std::string & senderHost, unsigned short & senderPort);
+
+    /*! Address of the slot used for a given position */
+    char * GetSlot(unsigned int position) const;
+
+    std::string Name;
+    bool Owner;
+    osaSharedMemoryQueueHeader * Header;
+    size_t MappedSize;
+
+ private:
+    // not copyable
+    osaSharedMemoryQueue(const osaSharedMemoryQueue &);
+    osaSharedMemoryQueue & operator = (const osaSharedMemoryQueue &);
+};
+
+#endif // _osaSharedMemoryQueue_h
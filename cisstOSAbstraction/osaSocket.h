@@ -46,6 +46,13 @@ http://www.cisst.org/cisst/license.txt.
   The TCP server is defined using osaSocketServer, which calls an overloaded
   osaSocket constructor upon accepting a connection (see osaSocketServer class).
 
+  For processes running on the same host, SHARED_MEMORY sockets provide the same
+  datagram semantic as UDP sockets but messages are exchanged using shared memory
+  queues (see osaSharedMemoryQueue) instead of the kernel network stack.  The
+  server uses AssignPort and clients use SetDestination with the server's port,
+  the host name is ignored.  Each client creates its own queue to receive replies
+  the first time it sends or receives a message.
+
   \note Please refer to osAbstractionTutorial/sockets for usage examples.
   \note Disconnection is detected when a socket attempts to write to another socket and does not received an ACK.
 
@@ -71,6 +78,8 @@ http://www.cisst.org/cisst/license.txt.
 
 //#define OSA_SOCKET_WITH_STREAM
 
+struct osaSocketSharedMemory;
+
 #ifdef OSA_SOCKET_WITH_STREAM
 // forward declaration
 class osaSocket;
@@ -187,7 +196,7 @@ class CISST_EXPORT osaSocket : public cmnGenericObject
 #endif // OSA_SOCKET_WITH_STREAM
 
  public:
-    enum SocketTypes { UDP, TCP };
+    enum SocketTypes { UDP, TCP, SHARED_MEMORY };
 
     /*! \brief Default constructor */
     osaSocket(SocketTypes type = TCP);
@@ -200,6 +209,11 @@ class CISST_EXPORT osaSocket : public cmnGenericObject
         return SocketFD;
     };
 
+    /*! \return Type of socket (UDP, TCP or SHARED_MEMORY) */
+    SocketTypes GetType(void) const {
+        return SocketType;
+    }
+
     /*! \return The first IP address of the localhost as a string */
     static std::string GetLocalhostIP(void);
 
@@ -209,7 +223,7 @@ class CISST_EXPORT osaSocket : public cmnGenericObject
         \return Number of IP address retrieved with IPaddresses filled */
     static int GetLocalhostIP(std::vector<std::string> & IPaddress);
 
-    /*! \brief Sets the port of a UDP server */
+    /*! \brief Sets the port of a UDP or SHARED_MEMORY server */
     bool AssignPort(unsigned short port);
 
     /*! \brief Set the destination address for UDP or TCP socket
@@ -354,6 +368,9 @@ class CISST_EXPORT osaSocket : public cmnGenericObject
     int SocketFD;
     bool Connected;
 
+    /*! Queues used by SHARED_MEMORY sockets, 0 otherwise */
+    osaSocketSharedMemory * SharedMemory;
+
     friend class osaSocketServer;
 };
 
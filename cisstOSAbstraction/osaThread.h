@@ -39,7 +39,7 @@ http://www.cisst.org/cisst/license.txt.
 #define SCHED_FIFO 0   /*! No Scheduling Policy available in Windows */
 #endif
 
-#if (CISST_OS == CISST_DARWIN) // SCHED_FIFO is not defined otherwise
+#if (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_LINUX) // SCHED_FIFO is not defined otherwise
 #include <pthread.h>
 #endif
 
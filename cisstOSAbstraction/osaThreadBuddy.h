@@ -67,6 +67,10 @@ class CISST_EXPORT osaThreadBuddy {
     /*! Thread period (if > 0) */
     double Period;
 
+    /*! Next absolute deadline in nanoseconds, 0 if deadlines have
+      not been started yet.  See WaitForDeadline. */
+    long long NextDeadline;
+
 public:
     /*! Constructor. Allocates internal data. */
     osaThreadBuddy();
@@ -100,6 +104,27 @@ public:
     /*! Suspend the execution of the real time thread for the
       remainder of the current period. */
     void WaitForRemainingPeriod(void);
+
+    /*! Suspend the execution of the thread until the next absolute
+      deadline, i.e. the previous deadline plus the period.  Contrary
+      to WaitForRemainingPeriod, the time spent between two calls
+      doesn't make the period drift.  On Linux, this relies on
+      clock_nanosleep with TIMER_ABSTIME on the monotonic clock.
+
+      \param latency Wake up latency in seconds, i.e. time elapsed
+      between the deadline and the actual wake up (or return time if
+      the deadline has already passed).
+
+      \return Number of deadlines missed since the previous call, 0
+      if the thread was on time.  When deadlines are missed, the
+      method returns immediately and the following deadlines are
+      re-aligned on the current time instead of trying to catch
+      up. */
+    unsigned int WaitForDeadline(double & latency);
+
+    /*! Restart the absolute deadlines from the current time, the next
+      call to WaitForDeadline will wait for a full period. */
+    void ResetDeadline(void);
     
     /*! Make a thread hard real time. */
     void MakeHardRealTime(void);
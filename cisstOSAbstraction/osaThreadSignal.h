@@ -49,6 +49,23 @@ public:
 
     static void SetWaitCallbacks(const osaThreadId &threadId, void (*pre)(void), void (*post)(void));
 
+    /*! Maximum number of iterations Wait polls the signal before
+      blocking the calling thread.  Polling avoids the cost of
+      blocking and waking up the thread when the signal is raised
+      shortly after Wait is called, e.g. for a reply to a command sent
+      to another thread.  The number of iterations actually used
+      adapts to how long previous waits took and no polling is done
+      on single processor systems.  Set to 0 to block immediately.
+      Only used on Linux, ignored on other operating systems. */
+    //@{
+    void SetSpinCount(const unsigned int maximum);
+    unsigned int GetSpinCount(void) const;
+    //@}
+
+    /*! Spin count used by signals created after this call, defaults
+      to 2000. */
+    static void SetDefaultSpinCount(const unsigned int maximum);
+
     /*! Print to stream */
     void ToStream(std::ostream & outputStream) const;
 
@@ -58,6 +75,8 @@ private:
 
     static void (*PreCallback)(void);
     static void (*PostCallback)(void);
+
+    static unsigned int DefaultSpinCount;
 };
 
 /*! Stream operator for a thread Id, see osaThreadId. */
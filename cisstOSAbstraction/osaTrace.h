@@ -0,0 +1,172 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+
+/*!
+  \file
+  \brief Process wide timeline of tasks, commands and events
+*/
+
+#ifndef _osaTrace_h
+#define _osaTrace_h
+
+#include <cisstCommon/cmnPortability.h>
+
+#include <atomic>
+#include <iostream>
+#include <string>
+
+// Always include last
+#include <cisstOSAbstraction/osaExport.h>
+
+/*!
+  \ingroup cisstOSAbstraction
+
+  Lightweight tracer used to build a timeline of what ran when in a
+  process, e.g. to find which component causes missed deadlines.
+  Each thread records events in its own ring buffer so recording
+  doesn't require any lock: the thread owning the buffer is the only
+  writer and the buffer index is published with an atomic store.
+  When a buffer is full, the oldest events are overwritten.
+
+  Tracing is disabled by default.  When disabled, the cost of a trace
+  point is a single relaxed atomic load.  Timestamps are relative to
+  the time origin of an osaTimeServer set when tracing is first
+  enabled.
+
+  The events collected can be saved using the Chrome trace event
+  format (JSON), which can be loaded in chrome://tracing or
+  https://ui.perfetto.dev.  Writing the trace while other threads are
+  still recording is safe but events overwritten during the copy are
+  skipped.
+
+  Most users will use the osaTraceScope helper:
+  \code
+  void myClass::Compute(void) {
+      osaTraceScope trace("compute", this->Name);
+      ...
+  }
+  \endcode
+
+  \note The category must be a string with static storage (e.g. a
+  literal), only the pointer is stored.  The event name is copied and
+  truncated to NAME_SIZE - 1 characters.
+*/
+class CISST_EXPORT osaTrace
+{
+public:
+    enum {NAME_SIZE = 48, DEFAULT_BUFFER_SIZE = 16384};
+
+    /*! Start or stop recording events.  The time origin is set the
+      first time tracing is enabled. */
+    static void Enable(const bool enable = true);
+
+    /*! Check if events are being recorded. */
+    inline static bool IsEnabled(void) {
+        return EnabledFlag.load(std::memory_order_relaxed);
+    }
+
+    /*! Set the number of events kept per thread.  This only affects
+      buffers created afterwards, i.e. threads that haven't recorded
+      any event yet. */
+    static void SetBufferSize(const size_t numberOfEvents);
+
+    /*! Set the name used for the current thread in the trace.  This
+      doesn't allocate a buffer if the thread never records events. */
+    static void SetThreadName(const std::string & name);
+
+    /*! Time used for all events, in seconds since the time origin. */
+    static double GetTime(void);
+
+    /*! Record an event that started and ended at given times (see
+      GetTime).  This is ignored if tracing is disabled. */
+    static void AddComplete(const char * category, const char * name,
+                            const double startTime, const double endTime);
+
+    /*! Record an event without duration.  This is ignored if tracing
+      is disabled. */
+    static void AddInstant(const char * category, const char * name);
+
+    /*! Number of events currently stored, for all threads. */
+    static size_t GetNumberOfEvents(void);
+
+    /*! Remove all events.  This should only be used while tracing is
+      disabled. */
+    static void Clear(void);
+
+    /*! Write all events using the Chrome trace event format (JSON
+      object with a "traceEvents" array).  Threads are identified by
+      the name provided with SetThreadName. */
+    //@{
+    static void WriteChromeTrace(std::ostream & outputStream);
+    static bool WriteChromeTrace(const std::string & fileName);
+    //@}
+
+private:
+    static std::atomic<bool> EnabledFlag;
+};
+
+
+/*!
+  \ingroup cisstOSAbstraction
+
+  Record the duration of a scope in the trace, see osaTrace.  Nothing
+  is recorded if tracing was disabled when the scope started.  The
+  name is only accessed when the scope ends so it must remain valid
+  until then.
+*/
+class osaTraceScope
+{
+    const char * Category;
+    const char * Name;
+    double StartTime;
+
+public:
+    inline osaTraceScope(const char * category, const char * name):
+        Category(0)
+    {
+        if (osaTrace::IsEnabled()) {
+            Category = category;
+            Name = name;
+            StartTime = osaTrace::GetTime();
+        }
+    }
+
+    inline osaTraceScope(const char * category, const std::string & name):
+        Category(0)
+    {
+        if (osaTrace::IsEnabled()) {
+            Category = category;
+            Name = name.c_str();
+            StartTime = osaTrace::GetTime();
+        }
+    }
+
+    inline ~osaTraceScope() {
+        if (Category) {
+            osaTrace::AddComplete(Category, Name, StartTime, osaTrace::GetTime());
+        }
+    }
+
+private:
+    osaTraceScope(const osaTraceScope &);
+    osaTraceScope & operator = (const osaTraceScope &);
+};
+
+#endif // _osaTrace_h
@@ -0,0 +1,214 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#ifndef _osaWaitFreeTripleBuffer_h
+#define _osaWaitFreeTripleBuffer_h
+
+#include <cisstCommon/cmnAssert.h>
+
+#include <atomic>
+#include <iostream>
+
+/*!  Wait free triple buffer for a single reader and a single writer,
+  e.g. to publish the latest state of a high rate control loop to a
+  slower thread.
+
+  The API is the same as osaTripleBuffer.  The reader must call
+  BeginRead, GetReadPointer and finally EndRead.  The writer must call
+  BeginWrite, GetWritePointer and EndWrite.  The reader always gets
+  the last value fully written.  Do not cache the results of
+  GetReadPointer and GetWritePointer.
+
+  Unlike osaTripleBuffer, no mutex is used.  Each thread owns one of
+  the three slots and the third one is exchanged using a single atomic
+  word.  This word stores the index of the shared slot and a flag set
+  by EndWrite to indicate that the shared slot contains data the
+  reader hasn't seen yet.  EndWrite and BeginRead (if new data is
+  available) perform a single atomic exchange, all other methods only
+  use memory local to the thread.  Neither the writer nor the reader
+  can be delayed by the other one, whatever the time spent between
+  the Begin and End calls.
+ */
+template <class _elementType>
+class osaWaitFreeTripleBuffer
+{
+    friend class osaWaitFreeTripleBufferTest;
+
+public:
+    typedef _elementType value_type;
+    typedef osaWaitFreeTripleBuffer<value_type> ThisType;
+
+    typedef value_type * pointer;
+    typedef const value_type * const_pointer;
+    typedef value_type & reference;
+    typedef const value_type & const_reference;
+
+private:
+    enum {INDEX_MASK = 0x3, NEW_DATA = 0x4};
+
+    // did the buffer allocate memory or used existing pointers
+    bool OwnMemory;
+    pointer Memory;
+    pointer Slots[3];
+
+    // slots owned by the writer and reader respectively, each on its
+    // own cache line to avoid false sharing between the two threads
+    alignas(64) unsigned int WriteIndex;
+    alignas(64) unsigned int ReadIndex;
+
+    // index of the shared slot and NEW_DATA flag
+    alignas(64) std::atomic<unsigned int> State;
+
+    osaWaitFreeTripleBuffer(const ThisType & other);
+    ThisType & operator = (const ThisType & other);
+
+public:
+    /*! Constructor that allocates memory for the triple buffer using
+      the default constructor for each element. */
+    inline osaWaitFreeTripleBuffer(void):
+        OwnMemory(true)
+    {
+        this->Memory = new value_type[3];
+        SetupSlots(this->Memory,
+                   this->Memory + 1,
+                   this->Memory + 2);
+    }
+
+    /*! Constructor that allocates memory for the triple buffer using
+      the copy constructor for each element.  User has to provide an
+      value which will be used to initialize the buffer elements. */
+    inline osaWaitFreeTripleBuffer(const_reference initialValue):
+        OwnMemory(true),
+        Memory(0)
+    {
+        SetupSlots(new value_type(initialValue),
+                   new value_type(initialValue),
+                   new value_type(initialValue));
+    }
+
+    /*! Constructor that doesn't allocate any memory, user has to
+      provide 3 valid pointers on 3 different pre-allocated
+      objects. */
+    inline osaWaitFreeTripleBuffer(pointer pointer1, pointer pointer2, pointer pointer3):
+        OwnMemory(false),
+        Memory(0)
+    {
+        SetupSlots(pointer1, pointer2, pointer3);
+    }
+
+    /*! Destructor.  If the memory is owned, it will delete the 3
+      objects allocated. */
+    inline ~osaWaitFreeTripleBuffer() {
+        if (this->OwnMemory) {
+            if (this->Memory) {
+                delete[] this->Memory;
+            } else {
+                delete this->Slots[0];
+                delete this->Slots[1];
+                delete this->Slots[2];
+            }
+        }
+    }
+
+    /*! Calls BeginRead, assign the last written value using the
+      operator = and then calls EndRead. */
+    inline void Read(reference placeHolder) {
+        this->BeginRead();
+        placeHolder = *(this->GetReadPointer());
+        this->EndRead();
+    }
+
+    /*! Calls BeginWrite, assign the new value to the current write
+      location using the operator = and then calls EndWrite. */
+    inline void Write(const_reference newValue) {
+        this->BeginWrite();
+        *(this->GetWritePointer()) = newValue;
+        this->EndWrite();
+    }
+
+    /*! Function to access the memory to read safely.  This method
+      call must be preceeded by a call to BeginRead and followed by
+      a call to EndRead. */
+    inline const_pointer GetReadPointer(void) const {
+        return this->Slots[this->ReadIndex];
+    }
+
+    /*! Function to access the memory to write safely.  This method
+      call must be preceeded by a call to BeginWrite and followed by
+      a call to EndWrite. */
+    inline pointer GetWritePointer(void) const {
+        return this->Slots[this->WriteIndex];
+    }
+
+    /*! Get the last value written.  If the writer published a new
+      value since the last call, the reader's slot is exchanged with
+      the shared slot. */
+    inline void BeginRead(void) {
+        if (this->State.load(std::memory_order_relaxed) & NEW_DATA) {
+            const unsigned int previous = this->State.exchange(this->ReadIndex, std::memory_order_acq_rel);
+            this->ReadIndex = previous & INDEX_MASK;
+        }
+    }
+
+    /*! Release the read slot.  Nothing to do, provided to keep the
+      same API as osaTripleBuffer. */
+    inline void EndRead(void) {
+    }
+
+    /*! Start writing in the writer's slot.  Nothing to do, provided to
+      keep the same API as osaTripleBuffer. */
+    inline void BeginWrite(void) {
+    }
+
+    /*! Publish the writer's slot and get the previous shared slot to
+      write next time. */
+    inline void EndWrite(void) {
+        const unsigned int previous = this->State.exchange(this->WriteIndex | NEW_DATA, std::memory_order_acq_rel);
+        this->WriteIndex = previous & INDEX_MASK;
+    }
+
+    /*! Method to display current state of triple buffer */
+    void ToStream(std::ostream & outputStream) const {
+        const unsigned int state = this->State.load();
+        outputStream << "Slots: "
+                     << this->Slots[0] << " "
+                     << this->Slots[1] << " "
+                     << this->Slots[2] << std::endl
+                     << "Read index: " << this->ReadIndex
+                     << ", write index: " << this->WriteIndex
+                     << ", shared index: " << (state & INDEX_MASK)
+                     << ((state & NEW_DATA) ? " (new data)" : "") << std::endl;
+    }
+
+private:
+    inline void SetupSlots(pointer pointer1, pointer pointer2, pointer pointer3) {
+        CMN_ASSERT(pointer1);
+        CMN_ASSERT(pointer2);
+        CMN_ASSERT(pointer3);
+        this->Slots[0] = pointer1;
+        this->Slots[1] = pointer2;
+        this->Slots[2] = pointer3;
+        this->ReadIndex = 0;
+        this->WriteIndex = 1;
+        this->State.store(2);
+    }
+};
+
+#endif // _osaWaitFreeTripleBuffer_h
@@ -126,4 +126,80 @@ void osaThreadSignalTest::TestWaitBlocks(void) {
 }
 
 
+void osaThreadSignalTest::TestWaitTimeout(void) {
+    osaThreadSignal threadSignal;
+    osaStopwatch timer;
+
+    // raised before waiting, wait doesn't block and resets the signal
+    threadSignal.Raise();
+    timer.Reset();
+    timer.Start();
+    CPPUNIT_ASSERT(threadSignal.Wait(1.0));
+    timer.Stop();
+    CPPUNIT_ASSERT(timer.GetElapsedTime() < 0.5);
+
+    // not raised anymore, wait should time out
+    timer.Reset();
+    timer.Start();
+    CPPUNIT_ASSERT(!threadSignal.Wait(50.0 * cmn_ms));
+    timer.Stop();
+    CPPUNIT_ASSERT(timer.GetElapsedTime() >= 40.0 * cmn_ms);
+    CPPUNIT_ASSERT(timer.GetElapsedTime() < 1.0);
+
+    // same without polling
+    threadSignal.SetSpinCount(0);
+    CPPUNIT_ASSERT_EQUAL(0u, threadSignal.GetSpinCount());
+    threadSignal.Raise();
+    CPPUNIT_ASSERT(threadSignal.Wait(1.0));
+    CPPUNIT_ASSERT(!threadSignal.Wait(10.0 * cmn_ms));
+}
+
+
+class ThreadSignalRoundTrip {
+public:
+    osaThreadSignal Request;
+    osaThreadSignal Reply;
+    unsigned int NumberOfIterations;
+    unsigned int NumberOfReplies;
+    void * Run(unsigned int CMN_UNUSED(unused)) {
+        NumberOfReplies = 0;
+        for (unsigned int index = 0; index < NumberOfIterations; ++index) {
+            if (!Request.Wait(5.0)) {
+                return 0;
+            }
+            ++NumberOfReplies;
+            Reply.Raise();
+        }
+        return 0;
+    }
+};
+
+
+void osaThreadSignalTest::TestRoundTrip(void) {
+    const unsigned int spinCounts[2] = {0, 2000};
+    for (size_t spinIndex = 0; spinIndex < 2; ++spinIndex) {
+        ThreadSignalRoundTrip roundTrip;
+        roundTrip.Request.SetSpinCount(spinCounts[spinIndex]);
+        roundTrip.Reply.SetSpinCount(spinCounts[spinIndex]);
+        roundTrip.NumberOfIterations = 2000;
+        osaThread thread;
+        thread.Create<ThreadSignalRoundTrip, unsigned int>(&roundTrip, &ThreadSignalRoundTrip::Run, 0);
+        unsigned int numberOfReplies = 0;
+        for (unsigned int index = 0; index < roundTrip.NumberOfIterations; ++index) {
+            roundTrip.Request.Raise();
+            if (roundTrip.Reply.Wait(5.0)) {
+                ++numberOfReplies;
+            }
+            // sometimes let the other thread block
+            if ((index % 100) == 0) {
+                osaSleep(1.0 * cmn_ms);
+            }
+        }
+        thread.Wait();
+        CPPUNIT_ASSERT_EQUAL(roundTrip.NumberOfIterations, numberOfReplies);
+        CPPUNIT_ASSERT_EQUAL(roundTrip.NumberOfIterations, roundTrip.NumberOfReplies);
+    }
+}
+
+
 CPPUNIT_TEST_SUITE_REGISTRATION(osaThreadSignalTest);
@@ -26,6 +26,8 @@ class osaThreadSignalTest: public CppUnit::TestFixture
     CPPUNIT_TEST_SUITE(osaThreadSignalTest);
     {
         CPPUNIT_TEST(TestWaitBlocks);
+        CPPUNIT_TEST(TestWaitTimeout);
+        CPPUNIT_TEST(TestRoundTrip);
     }
     CPPUNIT_TEST_SUITE_END();
 
@@ -38,4 +40,10 @@ public:
 
     /*! Check that waits do block */
     void TestWaitBlocks(void);
+
+    /*! Check that a raise is remembered and that waits time out */
+    void TestWaitTimeout(void);
+
+    /*! Check round trips between two threads, with and without spin */
+    void TestRoundTrip(void);
 };
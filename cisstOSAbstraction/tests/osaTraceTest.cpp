@@ -0,0 +1,117 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include "osaTraceTest.h"
+
+#include <cisstOSAbstraction/osaTrace.h>
+#include <cisstOSAbstraction/osaThread.h>
+
+#include <sstream>
+
+
+void osaTraceTest::setUp(void)
+{
+    osaTrace::Enable(false);
+    osaTrace::Clear();
+}
+
+
+void osaTraceTest::tearDown(void)
+{
+    osaTrace::Enable(false);
+    osaTrace::Clear();
+}
+
+
+void osaTraceTest::TestDisabled(void)
+{
+    {
+        osaTraceScope trace("test", "disabled");
+    }
+    osaTrace::AddInstant("test", "disabled");
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), osaTrace::GetNumberOfEvents());
+}
+
+
+void osaTraceTest::TestScopes(void)
+{
+    osaTrace::SetThreadName("osaTraceTest");
+    osaTrace::Enable();
+    {
+        osaTraceScope outer("test", std::string("outer"));
+        {
+            osaTraceScope inner("test", "inner \"quoted\"");
+        }
+        osaTrace::AddInstant("test", "instant");
+    }
+    osaTrace::Enable(false);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), osaTrace::GetNumberOfEvents());
+
+    std::stringstream json;
+    osaTrace::WriteChromeTrace(json);
+    const std::string output = json.str();
+    CPPUNIT_ASSERT(output.find("{\"traceEvents\":[") == 0);
+    CPPUNIT_ASSERT(output.find("\"osaTraceTest\"") != std::string::npos);
+    CPPUNIT_ASSERT(output.find("\"name\":\"outer\",\"cat\":\"test\",\"ph\":\"X\"") != std::string::npos);
+    CPPUNIT_ASSERT(output.find("\"name\":\"inner \\\"quoted\\\"\"") != std::string::npos);
+    CPPUNIT_ASSERT(output.find("\"name\":\"instant\",\"cat\":\"test\",\"ph\":\"i\"") != std::string::npos);
+
+    // inner scope ends first
+    CPPUNIT_ASSERT(output.find("\"inner") < output.find("\"outer\""));
+
+    osaTrace::Clear();
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), osaTrace::GetNumberOfEvents());
+}
+
+
+namespace {
+    void * osaTraceTestRecord(size_t numberOfEvents) {
+        osaTrace::SetThreadName("osaTraceTestThread");
+        for (size_t index = 0; index < numberOfEvents; ++index) {
+            std::stringstream name;
+            name << "event " << index;
+            osaTrace::AddInstant("test", name.str().c_str());
+        }
+        return 0;
+    }
+}
+
+
+void osaTraceTest::TestOverwrite(void)
+{
+    // buffer size only applies to threads without a buffer yet
+    osaTrace::SetBufferSize(10);
+    osaTrace::Enable();
+    osaThread thread;
+    thread.Create<size_t>(&osaTraceTestRecord, 25);
+    thread.Wait();
+    osaTrace::Enable(false);
+    osaTrace::SetBufferSize(osaTrace::DEFAULT_BUFFER_SIZE);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(10), osaTrace::GetNumberOfEvents());
+    std::stringstream json;
+    osaTrace::WriteChromeTrace(json);
+    const std::string output = json.str();
+    CPPUNIT_ASSERT(output.find("\"osaTraceTestThread\"") != std::string::npos);
+    CPPUNIT_ASSERT(output.find("\"event 14\"") == std::string::npos);
+    CPPUNIT_ASSERT(output.find("\"event 15\"") != std::string::npos);
+    CPPUNIT_ASSERT(output.find("\"event 24\"") != std::string::npos);
+}
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(osaTraceTest);
@@ -0,0 +1,46 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+class osaTraceTest: public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(osaTraceTest);
+    {
+        CPPUNIT_TEST(TestDisabled);
+        CPPUNIT_TEST(TestScopes);
+        CPPUNIT_TEST(TestOverwrite);
+    }
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void setUp(void);
+    void tearDown(void);
+
+    /*! Check that nothing is recorded when tracing is disabled */
+    void TestDisabled(void);
+
+    /*! Check events recorded with scopes and the JSON output */
+    void TestScopes(void);
+
+    /*! Check that the oldest events are overwritten when a buffer is
+      full */
+    void TestOverwrite(void);
+};
@@ -0,0 +1,163 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#include <cisstOSAbstraction/osaWaitFreeTripleBuffer.h>
+#include <cisstOSAbstraction/osaThread.h>
+
+#include "osaWaitFreeTripleBufferTest.h"
+
+#include <atomic>
+#include <vector>
+
+namespace {
+    typedef std::vector<size_t> ValueType;
+    typedef osaWaitFreeTripleBuffer<ValueType> BufferType;
+
+    const size_t TestVectorSize = 1000;
+    const size_t NumberOfIterations = 100000;
+
+    std::atomic<bool> ErrorFoundInRead;
+
+    void * osaWaitFreeTripleBufferTestWriteThread(BufferType * buffer)
+    {
+        for (size_t iteration = 1;
+             (iteration <= NumberOfIterations) && !ErrorFoundInRead;
+             ++iteration) {
+            buffer->BeginWrite();
+            {
+                ValueType & currentVector = *(buffer->GetWritePointer());
+                for (size_t i = 0; i < TestVectorSize; i++) {
+                    currentVector[i] = iteration + i;
+                }
+            }
+            buffer->EndWrite();
+        }
+        return 0;
+    }
+
+    void * osaWaitFreeTripleBufferTestReadThread(BufferType * buffer)
+    {
+        size_t firstElement = 0;
+        while ((firstElement != NumberOfIterations) && !ErrorFoundInRead) {
+            buffer->BeginRead();
+            {
+                const ValueType & currentVector = *(buffer->GetReadPointer());
+                const size_t newFirstElement = currentVector[0];
+                if (newFirstElement < firstElement) {
+                    std::cerr << "osaWaitFreeTripleBufferTestReadThread: unexpected first element "
+                              << newFirstElement << ", should be higher than " << firstElement << std::endl;
+                    ErrorFoundInRead = true;
+                }
+                firstElement = newFirstElement;
+                for (size_t i = 0; (i < TestVectorSize) && !ErrorFoundInRead; i++) {
+                    if (currentVector[i] != (firstElement + i)) {
+                        std::cerr << "osaWaitFreeTripleBufferTestReadThread: error while reading iteration "
+                                  << firstElement << " at element " << i << ", expected " << firstElement + i
+                                  << ", got " << currentVector[i] << std::endl;
+                        ErrorFoundInRead = true;
+                    }
+                }
+            }
+            buffer->EndRead();
+        }
+        return 0;
+    }
+}
+
+
+void osaWaitFreeTripleBufferTest::TestMultiThreading(void)
+{
+    ValueType referenceVector(TestVectorSize);
+    for (size_t i = 0; i < TestVectorSize; i++) {
+        referenceVector[i] = i;
+    }
+    BufferType tripleBuffer(referenceVector);
+
+    ErrorFoundInRead = false;
+    osaThread readThread;
+    readThread.Create(osaWaitFreeTripleBufferTestReadThread, &tripleBuffer);
+    osaThread writeThread;
+    writeThread.Create(osaWaitFreeTripleBufferTestWriteThread, &tripleBuffer);
+    writeThread.Wait();
+    readThread.Wait();
+
+    if (ErrorFoundInRead) {
+        tripleBuffer.ToStream(std::cerr);
+    }
+    CPPUNIT_ASSERT(!ErrorFoundInRead);
+}
+
+
+void osaWaitFreeTripleBufferTest::TestLogic(void)
+{
+    int value1 = 0;
+    int value2 = 0;
+    int value3 = 0;
+    osaWaitFreeTripleBuffer<int> tripleBuffer(&value1, &value2, &value3);
+
+    // reader and writer never use the same slot
+    CPPUNIT_ASSERT(tripleBuffer.GetReadPointer() != tripleBuffer.GetWritePointer());
+
+    // write while nobody's reading
+    tripleBuffer.BeginWrite(); {
+        *(tripleBuffer.GetWritePointer()) = 1;
+    } tripleBuffer.EndWrite();
+    tripleBuffer.BeginRead(); {
+        CPPUNIT_ASSERT_EQUAL(1, *(tripleBuffer.GetReadPointer()));
+    } tripleBuffer.EndRead();
+
+    // reading again without new data keeps the same value
+    tripleBuffer.BeginRead(); {
+        CPPUNIT_ASSERT_EQUAL(1, *(tripleBuffer.GetReadPointer()));
+    } tripleBuffer.EndRead();
+
+    // very long write, value doesn't change until EndWrite
+    tripleBuffer.BeginWrite(); {
+        tripleBuffer.BeginRead(); {
+            CPPUNIT_ASSERT_EQUAL(1, *(tripleBuffer.GetReadPointer()));
+        } tripleBuffer.EndRead();
+        *(tripleBuffer.GetWritePointer()) = 2;
+        tripleBuffer.BeginRead(); {
+            CPPUNIT_ASSERT_EQUAL(1, *(tripleBuffer.GetReadPointer()));
+        } tripleBuffer.EndRead();
+    } tripleBuffer.EndWrite();
+    tripleBuffer.BeginRead(); {
+        CPPUNIT_ASSERT_EQUAL(2, *(tripleBuffer.GetReadPointer()));
+    } tripleBuffer.EndRead();
+
+    // very long read, multiple writes don't modify the value read
+    tripleBuffer.BeginRead(); {
+        CPPUNIT_ASSERT_EQUAL(2, *(tripleBuffer.GetReadPointer()));
+        tripleBuffer.Write(3);
+        CPPUNIT_ASSERT_EQUAL(2, *(tripleBuffer.GetReadPointer()));
+        tripleBuffer.Write(4);
+        CPPUNIT_ASSERT_EQUAL(2, *(tripleBuffer.GetReadPointer()));
+        tripleBuffer.Write(5);
+        CPPUNIT_ASSERT_EQUAL(2, *(tripleBuffer.GetReadPointer()));
+        CPPUNIT_ASSERT(tripleBuffer.GetReadPointer() != tripleBuffer.GetWritePointer());
+    } tripleBuffer.EndRead();
+
+    // final read gets the last value
+    int result = 0;
+    tripleBuffer.Read(result);
+    CPPUNIT_ASSERT_EQUAL(5, result);
+}
+
+
+CPPUNIT_TEST_SUITE_REGISTRATION(osaWaitFreeTripleBufferTest);
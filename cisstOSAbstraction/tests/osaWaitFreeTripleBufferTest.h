@@ -0,0 +1,44 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+*/
+
+#ifndef _osaWaitFreeTripleBufferTest_h
+#define _osaWaitFreeTripleBufferTest_h
+
+#include <cppunit/TestCase.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+class osaWaitFreeTripleBufferTest : public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(osaWaitFreeTripleBufferTest);
+    {
+        CPPUNIT_TEST(TestLogic);
+        CPPUNIT_TEST(TestMultiThreading);
+    }
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    /*! Test logic */
+    void TestLogic(void);
+
+    /*! Test multi threading, the reader checks that it always gets a
+      complete value and that values never go back in time */
+    void TestMultiThreading(void);
+};
+
+#endif // _osaWaitFreeTripleBufferTest_h
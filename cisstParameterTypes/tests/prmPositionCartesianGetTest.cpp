@@ -74,6 +74,37 @@ void prmPositionCartesianGetTest::TestBinarySerializationStream(void)
 }
 
 
+void prmPositionCartesianGetTest::TestBinarySerializationBuffer(void)
+{
+    cmnDataFormat local, remote;
+    prmPositionCartesianGet p1, p2, pReference;
+    vctRandom(pReference.Position().Translation(), -10.0, 10.0);
+    vctRandom(pReference.Position().Rotation());
+    pReference.Timestamp() = 3.14;
+    pReference.MovingFrame() = "tool";
+    pReference.ReferenceFrame() = "base";
+    p1 = pReference;
+    const size_t byteSize = cmnData<prmPositionCartesianGet>::SerializeBinaryByteSize(p1);
+    CPPUNIT_ASSERT(byteSize > 0);
+    CPPUNIT_ASSERT_EQUAL(byteSize, p1.SerializeBinaryByteSize());
+    std::vector<char> buffer(byteSize);
+    // buffer too small
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0),
+                         cmnData<prmPositionCartesianGet>::SerializeBinary(p1, &(buffer[0]), byteSize - 1));
+    CPPUNIT_ASSERT_EQUAL(byteSize, cmnData<prmPositionCartesianGet>::SerializeBinary(p1, &(buffer[0]), byteSize));
+    p1.Position() = p1.Position().Identity();
+    // truncated buffer
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0),
+                         cmnData<prmPositionCartesianGet>::DeSerializeBinary(p2, &(buffer[0]), byteSize - 1, local, remote));
+    CPPUNIT_ASSERT_EQUAL(byteSize,
+                         cmnData<prmPositionCartesianGet>::DeSerializeBinary(p2, &(buffer[0]), byteSize, local, remote));
+    CPPUNIT_ASSERT(pReference.Position().Equal(p2.Position()));
+    CPPUNIT_ASSERT_EQUAL(pReference.Timestamp(), p2.Timestamp());
+    CPPUNIT_ASSERT_EQUAL(pReference.MovingFrame(), p2.MovingFrame());
+    CPPUNIT_ASSERT_EQUAL(pReference.ReferenceFrame(), p2.ReferenceFrame());
+}
+
+
 void prmPositionCartesianGetTest::TestTextSerializationStream(void)
 {
     cmnDataFormat local, remote;
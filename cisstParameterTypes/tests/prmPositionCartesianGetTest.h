@@ -28,6 +28,7 @@ class prmPositionCartesianGetTest: public CppUnit::TestFixture
         CPPUNIT_TEST(TestConstructors);
         CPPUNIT_TEST(TestSerialize);
         CPPUNIT_TEST(TestBinarySerializationStream);
+        CPPUNIT_TEST(TestBinarySerializationBuffer);
         CPPUNIT_TEST(TestTextSerializationStream);
         CPPUNIT_TEST(TestScalars);
     }
@@ -41,6 +42,7 @@ public:
     void TestConstructors(void);
     void TestSerialize(void);
     void TestBinarySerializationStream(void);
+    void TestBinarySerializationBuffer(void);
     void TestTextSerializationStream(void);
     void TestScalars(void);
 };
@@ -20,28 +20,31 @@ http://www.cisst.org/cisst/license.txt.
 */
 
 #include <cisstStereoVision/svlBufferSample.h>
+#include <cisstStereoVision/svlSamplePool.h>
 
 
 /*********************************/
 /*** svlBufferSample class *******/
 /*********************************/
 
-svlBufferSample::svlBufferSample(svlStreamType type)
+svlBufferSample::svlBufferSample(svlStreamType type) :
+    Pool(0)
 {
-    Buffer[0] = svlSample::GetNewFromType(type);
-    Buffer[1] = svlSample::GetNewFromType(type);
-    Buffer[2] = svlSample::GetNewFromType(type);
+    Buffer[0] = OwnedItems[0] = svlSample::GetNewFromType(type);
+    Buffer[1] = OwnedItems[1] = svlSample::GetNewFromType(type);
+    Buffer[2] = OwnedItems[2] = svlSample::GetNewFromType(type);
 
     Latest = 0;
     Next = 1;
     Locked = 2;
 }
 
-svlBufferSample::svlBufferSample(const svlSample &sample)
+svlBufferSample::svlBufferSample(const svlSample &sample) :
+    Pool(0)
 {
-    Buffer[0] = svlSample::GetNewFromType(sample.GetType());
-    Buffer[1] = svlSample::GetNewFromType(sample.GetType());
-    Buffer[2] = svlSample::GetNewFromType(sample.GetType());
+    Buffer[0] = OwnedItems[0] = svlSample::GetNewFromType(sample.GetType());
+    Buffer[1] = OwnedItems[1] = svlSample::GetNewFromType(sample.GetType());
+    Buffer[2] = OwnedItems[2] = svlSample::GetNewFromType(sample.GetType());
 
     Buffer[0]->SetSize(sample);
     Buffer[1]->SetSize(sample);
@@ -54,9 +57,11 @@ svlBufferSample::svlBufferSample(const svlSample &sample)
 
 svlBufferSample::~svlBufferSample()
 {
-    delete Buffer[0];
-    delete Buffer[1];
-    delete Buffer[2];
+    // Samples buffered by reference belong to the pool
+    SetPool(0);
+    delete OwnedItems[0];
+    delete OwnedItems[1];
+    delete OwnedItems[2];
 }
 
 svlStreamType svlBufferSample::GetType() const
@@ -64,9 +69,39 @@ svlStreamType svlBufferSample::GetType() const
     return Buffer[0]->GetType();
 }
 
+void svlBufferSample::SetPool(svlSamplePool* pool)
+{
+    if (Pool && Pool != pool) {
+        ReleaseShared(0);
+        ReleaseShared(1);
+        ReleaseShared(2);
+    }
+    Pool = pool;
+}
+
+svlSample* svlBufferSample::ReleaseShared(unsigned int index)
+{
+    // Slots holding a reference to a pool sample get their own sample back
+    if (Buffer[index] != OwnedItems[index]) {
+        if (Pool) Pool->Release(Buffer[index]);
+        Buffer[index] = OwnedItems[index];
+    }
+    return Buffer[index];
+}
+
 int svlBufferSample::Push(const svlSample* sample)
 {
-    int ret = Buffer[Next]->CopyOf(sample);
+    int ret = SVL_OK;
+
+    // Only the pushing thread accesses the Next slot
+    if (Pool && Pool->AddReference(sample)) {
+        ReleaseShared(Next);
+        Buffer[Next] = const_cast<svlSample*>(sample);
+    }
+    else {
+        ret = ReleaseShared(Next)->CopyOf(sample);
+        if (Pool) Pool->AddCopy(sample);
+    }
 
     // Atomic exchange of values
 #if (CISST_OS == CISST_WINDOWS)
@@ -110,7 +145,7 @@ svlSample* svlBufferSample::Pull(bool waitfornew, double timeout)
 
 svlSample* svlBufferSample::GetPushBuffer()
 {
-    return Buffer[Next];
+    return ReleaseShared(Next);
 }
 
 void svlBufferSample::Push()
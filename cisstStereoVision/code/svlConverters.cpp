@@ -20,6 +20,7 @@ http://www.cisst.org/cisst/license.txt.
 */
 
 #include <cisstStereoVision/svlConverters.h>
+#include "svlConvertersSIMD.h"
 
 #define ACCURATE_COLOR_TO_GRAYSCALE     false
 
@@ -331,9 +332,12 @@ void svlConverter::Gray16toRGBA32(unsigned short* input, unsigned char* output,
 
 void svlConverter::Gray16toGray8(unsigned short* input, unsigned char* output, const unsigned int pixelcount, const unsigned int shiftdown)
 {
+    const unsigned int done = svlConverterSIMD::Gray16toGray8(input, output, pixelcount, shiftdown);
+    input += done; output += done;
+
     unsigned short shval;
     unsigned char chval;
-    for (unsigned int i = 0; i < pixelcount; i ++) {
+    for (unsigned int i = done; i < pixelcount; i ++) {
         shval = (*input) >> shiftdown;
         if (shval < 256) chval = static_cast<unsigned char>(shval);
         else chval = 255;
@@ -660,7 +664,10 @@ void svlConverter::RGB16toRGB24(unsigned char* input, unsigned char* output, con
 
 void svlConverter::RGB24toRGBA32(unsigned char* input, unsigned char* output, const unsigned int pixelcount)
 {
-    for (unsigned int i = 0; i < pixelcount; i ++) {
+    const unsigned int done = svlConverterSIMD::RGB24toRGBA32(input, output, pixelcount);
+    input += done * 3; output += done * 4;
+
+    for (unsigned int i = done; i < pixelcount; i ++) {
         *output = *input; output ++; input ++;
         *output = *input; output ++; input ++;
         *output = *input; output ++; input ++;
@@ -670,10 +677,13 @@ void svlConverter::RGB24toRGBA32(unsigned char* input, unsigned char* output, co
 
 void svlConverter::RGB24toGray8(unsigned char* input, unsigned char* output, const unsigned int pixelcount, bool accurate, bool bgr)
 {
+    const unsigned int done = svlConverterSIMD::RGB24toGray8(input, output, pixelcount, accurate, bgr);
+    input += done * 3; output += done;
+
     unsigned int i, sum;
     if (accurate) {
         if (bgr) {
-            for (i = 0; i < pixelcount; i ++) {
+            for (i = done; i < pixelcount; i ++) {
                 sum  = 28  * (*input); input ++;
                 sum += 150 * (*input); input ++;
                 sum += 77  * (*input); input ++;
@@ -681,7 +691,7 @@ void svlConverter::RGB24toGray8(unsigned char* input, unsigned char* output, con
             }
         }
         else {
-            for (i = 0; i < pixelcount; i ++) {
+            for (i = done; i < pixelcount; i ++) {
                 sum  = 77  * (*input); input ++;
                 sum += 150 * (*input); input ++;
                 sum += 28  * (*input); input ++;
@@ -690,7 +700,7 @@ void svlConverter::RGB24toGray8(unsigned char* input, unsigned char* output, con
         }
     }
     else {
-        for (i = 0; i < pixelcount; i ++) {
+        for (i = done; i < pixelcount; i ++) {
             sum  = *input; input ++;
             sum += *input; input ++;
             sum += *input; input ++;
@@ -826,10 +836,13 @@ void svlConverter::RGB24toYUV444P(unsigned char* input, unsigned char* output, c
 
 void svlConverter::BGR24toYUV422(unsigned char* input, unsigned char* output, const unsigned int pixelcount, bool ch1, bool ch2, bool ch3)
 {
+    const unsigned int done = svlConverterSIMD::RGB24toYUV422(input, output, pixelcount, true, ch1, ch2, ch3);
+    input += done * 3; output += done * 2;
+
     int r, g, b, y1, y2, u1, u2, v1, v2;
     const unsigned int pixelcounthalf = pixelcount >> 1;
 
-    for (unsigned int i = 0; i < pixelcounthalf; i ++) {
+    for (unsigned int i = done >> 1; i < pixelcounthalf; i ++) {
         b = *input; input ++;
         g = *input; input ++;
         r = *input; input ++;
@@ -877,10 +890,13 @@ void svlConverter::BGR24toYUV422(unsigned char* input, unsigned char* output, co
 
 void svlConverter::RGB24toYUV422(unsigned char* input, unsigned char* output, const unsigned int pixelcount, bool ch1, bool ch2, bool ch3)
 {
+    const unsigned int done = svlConverterSIMD::RGB24toYUV422(input, output, pixelcount, false, ch1, ch2, ch3);
+    input += done * 3; output += done * 2;
+
     int r, g, b, y1, y2, u1, u2, v1, v2;
     const unsigned int pixelcounthalf = pixelcount >> 1;
 
-    for (unsigned int i = 0; i < pixelcounthalf; i ++) {
+    for (unsigned int i = done >> 1; i < pixelcounthalf; i ++) {
         r = *input; input ++;
         g = *input; input ++;
         b = *input; input ++;
@@ -984,11 +1000,14 @@ void svlConverter::RGB24toYUV422P(unsigned char* input, unsigned char* output, c
 
 void svlConverter::RGB24toHSV24(unsigned char* input, unsigned char* output, const unsigned int pixelcount, bool ch1, bool ch2, bool ch3)
 {
+    const unsigned int done = svlConverterSIMD::RGB24toHSV24(input, output, pixelcount, ch1, ch2, ch3);
+    input += done * 3; output += done * 3;
+
     int max, min, delta;
     int r, g, b, h, s, v;
     unsigned int i;
 
-    for (i = 0; i < pixelcount; i ++) {
+    for (i = done; i < pixelcount; i ++) {
         r = *input; input ++;
         g = *input; input ++;
         b = *input; input ++;
@@ -1166,7 +1185,10 @@ void svlConverter::RGB24toHSL24P(unsigned char* input, unsigned char* output, co
 
 void svlConverter::RGBA32toRGB24(unsigned char* input, unsigned char* output, const unsigned int pixelcount)
 {
-    for (unsigned int i = 0; i < pixelcount; i ++) {
+    const unsigned int done = svlConverterSIMD::RGBA32toRGB24(input, output, pixelcount);
+    input += done * 4; output += done * 3;
+
+    for (unsigned int i = done; i < pixelcount; i ++) {
         *output = *input; output ++; input ++;
         *output = *input; output ++; input ++;
         *output = *input; output ++; input += 2;
@@ -1175,10 +1197,13 @@ void svlConverter::RGBA32toRGB24(unsigned char* input, unsigned char* output, co
 
 void svlConverter::RGBA32toGray8(unsigned char* input, unsigned char* output, const unsigned int pixelcount, bool accurate, bool bgr)
 {
+    const unsigned int done = svlConverterSIMD::RGBA32toGray8(input, output, pixelcount, accurate, bgr);
+    input += done * 4; output += done;
+
     unsigned int i, sum;
     if (accurate) {
         if (bgr) {
-            for (i = 0; i < pixelcount; i ++) {
+            for (i = done; i < pixelcount; i ++) {
                 sum  = 28  * (*input); input ++;
                 sum += 150 * (*input); input ++;
                 sum += 77  * (*input); input += 2;
@@ -1186,7 +1211,7 @@ void svlConverter::RGBA32toGray8(unsigned char* input, unsigned char* output, co
             }
         }
         else {
-            for (i = 0; i < pixelcount; i ++) {
+            for (i = done; i < pixelcount; i ++) {
                 sum  = 77  * (*input); input ++;
                 sum += 150 * (*input); input ++;
                 sum += 28  * (*input); input += 2;
@@ -1195,7 +1220,7 @@ void svlConverter::RGBA32toGray8(unsigned char* input, unsigned char* output, co
         }
     }
     else {
-        for (i = 0; i < pixelcount; i ++) {
+        for (i = done; i < pixelcount; i ++) {
             sum  = *input; input ++;
             sum += *input; input ++;
             sum += *input; input += 2;
@@ -0,0 +1,563 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include "svlConvertersSIMD.h"
+#include "svlSIMD.h"
+
+
+/*************************************/
+/*** Instruction set selection *******/
+/*************************************/
+
+namespace {
+    svlConverter::InstructionSet DetectInstructionSet(void)
+    {
+#if SVL_SIMD_X86
+    #if defined(__GNUC__) || defined(__clang__)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return svlConverter::INSTRUCTIONS_AVX2;
+        if (__builtin_cpu_supports("sse4.1")) return svlConverter::INSTRUCTIONS_SSE41;
+    #elif defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        const int maxleaf = info[0];
+        __cpuid(info, 1);
+        const bool sse41 = (info[2] & (1 << 19)) != 0;
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        if (sse41 && osxsave && (maxleaf >= 7) && ((_xgetbv(0) & 6) == 6)) {
+            __cpuidex(info, 7, 0);
+            if (info[1] & (1 << 5)) return svlConverter::INSTRUCTIONS_AVX2;
+        }
+        if (sse41) return svlConverter::INSTRUCTIONS_SSE41;
+    #endif
+#endif
+        return svlConverter::INSTRUCTIONS_SCALAR;
+    }
+
+    svlConverter::InstructionSet & SelectedInstructionSet(void)
+    {
+        static svlConverter::InstructionSet selected = svlConverter::GetSupportedInstructionSet();
+        return selected;
+    }
+}
+
+svlConverter::InstructionSet svlConverter::GetSupportedInstructionSet(void)
+{
+    static const InstructionSet supported = DetectInstructionSet();
+    return supported;
+}
+
+svlConverter::InstructionSet svlConverter::GetInstructionSet(void)
+{
+    return SelectedInstructionSet();
+}
+
+svlConverter::InstructionSet svlConverter::SetInstructionSet(const InstructionSet instructionset)
+{
+    const InstructionSet supported = GetSupportedInstructionSet();
+    SelectedInstructionSet() = (instructionset > supported) ? supported : instructionset;
+    return SelectedInstructionSet();
+}
+
+
+#if SVL_SIMD_X86
+
+/*************************************/
+/*** Shuffle helpers *****************/
+/*************************************/
+
+namespace {
+    // Shuffle mask moving byte source[i] of a block of bytes to byte i.
+    // Only the source bytes located in the 16 byte register 'reg' of
+    // the block are selected, others are set to zero.
+    SVL_TARGET_SSE41 inline __m128i BlockMask(const int* source, const int reg)
+    {
+        char mask[16];
+        for (int i = 0; i < 16; i ++) {
+            const int local = source[i] - 16 * reg;
+            if ((source[i] >= 0) && (local >= 0) && (local < 16)) mask[i] = static_cast<char>(local);
+            else mask[i] = static_cast<char>(0x80);
+        }
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask));
+    }
+
+    // Masks to extract each channel of 16 interleaved pixels, stored in
+    // masks[channel * channels + reg]
+    SVL_TARGET_SSE41 inline void DeinterleaveMasks(const int channels, __m128i* masks)
+    {
+        int source[16];
+        for (int c = 0; c < channels; c ++) {
+            for (int i = 0; i < 16; i ++) source[i] = channels * i + c;
+            for (int reg = 0; reg < channels; reg ++) masks[c * channels + reg] = BlockMask(source, reg);
+        }
+    }
+
+    // Masks to interleave 3 planes of 16 pixels, stored in masks[reg * 3 + channel]
+    SVL_TARGET_SSE41 inline void InterleaveMasks3(__m128i* masks)
+    {
+        int source[16];
+        for (int reg = 0; reg < 3; reg ++) {
+            for (int c = 0; c < 3; c ++) {
+                for (int i = 0; i < 16; i ++) {
+                    const int p = 16 * reg + i;
+                    source[i] = (p % 3 == c) ? p / 3 : -1;
+                }
+                masks[reg * 3 + c] = BlockMask(source, 0);
+            }
+        }
+    }
+
+    SVL_TARGET_SSE41 inline __m128i Gather(const __m128i* in, const __m128i* masks, const int count)
+    {
+        __m128i result = _mm_shuffle_epi8(in[0], masks[0]);
+        for (int k = 1; k < count; k ++) result = _mm_or_si128(result, _mm_shuffle_epi8(in[k], masks[k]));
+        return result;
+    }
+
+    SVL_TARGET_AVX2 inline __m256i Gather(const __m256i* in, const __m256i* masks, const int count)
+    {
+        __m256i result = _mm256_shuffle_epi8(in[0], masks[0]);
+        for (int k = 1; k < count; k ++) result = _mm256_or_si256(result, _mm256_shuffle_epi8(in[k], masks[k]));
+        return result;
+    }
+
+    // Load 16 bytes in each lane, 'lanebytes' apart, so 128 bit shuffle
+    // masks can be used on both lanes
+    SVL_TARGET_AVX2 inline __m256i LoadLanes(const unsigned char* input, const int reg, const int lanebytes)
+    {
+        const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 16 * reg));
+        const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + lanebytes + 16 * reg));
+        return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    }
+
+
+/*************************************/
+/*** Color to grayscale **************/
+/*************************************/
+
+    // Same as scalar: (77 * r + 150 * g + 28 * b) >> 8 or (r + g + b) / 3,
+    // the division by 3 is exact for sums up to 765 using 21846 / 65536
+    SVL_TARGET_SSE41 inline __m128i Gray16(const __m128i r, const __m128i g, const __m128i b, const bool accurate)
+    {
+        if (accurate) {
+            const __m128i sum = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(77)),
+                                                            _mm_mullo_epi16(g, _mm_set1_epi16(150))),
+                                              _mm_mullo_epi16(b, _mm_set1_epi16(28)));
+            return _mm_srli_epi16(sum, 8);
+        }
+        return _mm_mulhi_epu16(_mm_add_epi16(_mm_add_epi16(r, g), b), _mm_set1_epi16(21846));
+    }
+
+    SVL_TARGET_SSE41 inline __m128i Gray8(const __m128i r, const __m128i g, const __m128i b, const bool accurate)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i lo = Gray16(_mm_unpacklo_epi8(r, zero), _mm_unpacklo_epi8(g, zero), _mm_unpacklo_epi8(b, zero), accurate);
+        const __m128i hi = Gray16(_mm_unpackhi_epi8(r, zero), _mm_unpackhi_epi8(g, zero), _mm_unpackhi_epi8(b, zero), accurate);
+        return _mm_packus_epi16(lo, hi);
+    }
+
+    SVL_TARGET_AVX2 inline __m256i Gray16(const __m256i r, const __m256i g, const __m256i b, const bool accurate)
+    {
+        if (accurate) {
+            const __m256i sum = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(r, _mm256_set1_epi16(77)),
+                                                                  _mm256_mullo_epi16(g, _mm256_set1_epi16(150))),
+                                                 _mm256_mullo_epi16(b, _mm256_set1_epi16(28)));
+            return _mm256_srli_epi16(sum, 8);
+        }
+        return _mm256_mulhi_epu16(_mm256_add_epi16(_mm256_add_epi16(r, g), b), _mm256_set1_epi16(21846));
+    }
+
+    // lanes are processed independently, i.e. each lane holds 16 consecutive pixels
+    SVL_TARGET_AVX2 inline __m256i Gray8(const __m256i r, const __m256i g, const __m256i b, const bool accurate)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i lo = Gray16(_mm256_unpacklo_epi8(r, zero), _mm256_unpacklo_epi8(g, zero), _mm256_unpacklo_epi8(b, zero), accurate);
+        const __m256i hi = Gray16(_mm256_unpackhi_epi8(r, zero), _mm256_unpackhi_epi8(g, zero), _mm256_unpackhi_epi8(b, zero), accurate);
+        return _mm256_packus_epi16(lo, hi);
+    }
+
+    // 'channels' is 3 for RGB24 and 4 for RGBA32, template parameters
+    // let the compiler unroll the shuffles
+    template <int channels, bool accurate>
+    SVL_TARGET_SSE41 unsigned int ColorToGray8SSE41(const unsigned char* input, unsigned char* output, const unsigned int pixelcount, bool bgr)
+    {
+        __m128i masks[16], in[4];
+        DeinterleaveMasks(channels, masks);
+        const __m128i* maskr = masks + (bgr ? 2 : 0) * channels;
+        const __m128i* maskg = masks + channels;
+        const __m128i* maskb = masks + (bgr ? 0 : 2) * channels;
+        const unsigned int count = pixelcount & ~15u;
+        for (unsigned int i = 0; i < count; i += 16) {
+            for (int k = 0; k < channels; k ++) in[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 16 * k));
+            const __m128i r = Gather(in, maskr, channels);
+            const __m128i g = Gather(in, maskg, channels);
+            const __m128i b = Gather(in, maskb, channels);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), Gray8(r, g, b, accurate));
+            input += 16 * channels;
+            output += 16;
+        }
+        return count;
+    }
+
+    template <int channels, bool accurate>
+    SVL_TARGET_AVX2 unsigned int ColorToGray8AVX2(const unsigned char* input, unsigned char* output, const unsigned int pixelcount, bool bgr)
+    {
+        __m128i masks128[16];
+        __m256i masks[16], in[4];
+        DeinterleaveMasks(channels, masks128);
+        for (int k = 0; k < channels * channels; k ++) masks[k] = _mm256_broadcastsi128_si256(masks128[k]);
+        const __m256i* maskr = masks + (bgr ? 2 : 0) * channels;
+        const __m256i* maskg = masks + channels;
+        const __m256i* maskb = masks + (bgr ? 0 : 2) * channels;
+        const unsigned int count = pixelcount & ~31u;
+        for (unsigned int i = 0; i < count; i += 32) {
+            for (int k = 0; k < channels; k ++) in[k] = LoadLanes(input, k, 16 * channels);
+            const __m256i r = Gather(in, maskr, channels);
+            const __m256i g = Gather(in, maskg, channels);
+            const __m256i b = Gather(in, maskb, channels);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), Gray8(r, g, b, accurate));
+            input += 32 * channels;
+            output += 32;
+        }
+        return count;
+    }
+
+    SVL_TARGET_SSE41 unsigned int Gray16toGray8SSE41(const unsigned short* input, unsigned char* output, const unsigned int pixelcount,
+                                                     const unsigned int shiftdown)
+    {
+        const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(shiftdown));
+        const __m128i maximum = _mm_set1_epi16(255);
+        const unsigned int count = pixelcount & ~15u;
+        for (unsigned int i = 0; i < count; i += 16) {
+            __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+            __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 8));
+            lo = _mm_min_epu16(_mm_srl_epi16(lo, shift), maximum);
+            hi = _mm_min_epu16(_mm_srl_epi16(hi, shift), maximum);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_packus_epi16(lo, hi));
+            input += 16;
+            output += 16;
+        }
+        return count;
+    }
+
+    SVL_TARGET_AVX2 unsigned int Gray16toGray8AVX2(const unsigned short* input, unsigned char* output, const unsigned int pixelcount,
+                                                   const unsigned int shiftdown)
+    {
+        const __m128i shift = _mm_cvtsi32_si128(static_cast<int>(shiftdown));
+        const __m256i maximum = _mm256_set1_epi16(255);
+        const unsigned int count = pixelcount & ~31u;
+        for (unsigned int i = 0; i < count; i += 32) {
+            __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input));
+            __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + 16));
+            lo = _mm256_min_epu16(_mm256_srl_epi16(lo, shift), maximum);
+            hi = _mm256_min_epu16(_mm256_srl_epi16(hi, shift), maximum);
+            // packing works per lane, restore pixel order
+            const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), 0xD8);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), packed);
+            input += 32;
+            output += 32;
+        }
+        return count;
+    }
+
+
+/*************************************/
+/*** RGB24 <-> RGBA32 ****************/
+/*************************************/
+
+    SVL_TARGET_SSE41 unsigned int RGB24toRGBA32SSE41(const unsigned char* input, unsigned char* output, const unsigned int pixelcount)
+    {
+        __m128i masks[12], in[3];
+        int source[16];
+        for (int reg = 0; reg < 4; reg ++) {
+            for (int i = 0; i < 16; i ++) {
+                source[i] = ((i & 3) == 3) ? -1 : 3 * (4 * reg + i / 4) + (i & 3);
+            }
+            for (int k = 0; k < 3; k ++) masks[reg * 3 + k] = BlockMask(source, k);
+        }
+        const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000));
+        const unsigned int count = pixelcount & ~15u;
+        for (unsigned int i = 0; i < count; i += 16) {
+            for (int k = 0; k < 3; k ++) in[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 16 * k));
+            for (int reg = 0; reg < 4; reg ++) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 16 * reg),
+                                 _mm_or_si128(Gather(in, masks + reg * 3, 3), alpha));
+            }
+            input += 48;
+            output += 64;
+        }
+        return count;
+    }
+
+    SVL_TARGET_SSE41 unsigned int RGBA32toRGB24SSE41(const unsigned char* input, unsigned char* output, const unsigned int pixelcount)
+    {
+        __m128i masks[12], in[4];
+        int source[16];
+        for (int reg = 0; reg < 3; reg ++) {
+            for (int i = 0; i < 16; i ++) {
+                const int p = 16 * reg + i;
+                source[i] = 4 * (p / 3) + p % 3;
+            }
+            for (int k = 0; k < 4; k ++) masks[reg * 4 + k] = BlockMask(source, k);
+        }
+        const unsigned int count = pixelcount & ~15u;
+        for (unsigned int i = 0; i < count; i += 16) {
+            for (int k = 0; k < 4; k ++) in[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 16 * k));
+            for (int reg = 0; reg < 3; reg ++) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 16 * reg), Gather(in, masks + reg * 4, 4));
+            }
+            input += 64;
+            output += 48;
+        }
+        return count;
+    }
+
+
+/*************************************/
+/*** RGB24 to YUV422 *****************/
+/*************************************/
+
+    // Same as scalar: abs(cr * r + cg * g + cb * b + offset) >> 13, saturated.
+    // 'rg' holds 16 bit red and green values interleaved and 'b0' blue
+    // values interleaved with 0 so products are summed in pairs.
+    SVL_TARGET_SSE41 inline __m128i YUVComponent(const __m128i rg, const __m128i b0,
+                                                 const short cr, const short cg, const short cb, const int offset, const int maximum)
+    {
+        const __m128i crg = _mm_setr_epi16(cr, cg, cr, cg, cr, cg, cr, cg);
+        const __m128i cb0 = _mm_setr_epi16(cb, 0, cb, 0, cb, 0, cb, 0);
+        __m128i value = _mm_add_epi32(_mm_add_epi32(_mm_madd_epi16(rg, crg), _mm_madd_epi16(b0, cb0)),
+                                      _mm_set1_epi32(offset));
+        value = _mm_srli_epi32(_mm_abs_epi32(value), 13);
+        return _mm_min_epi32(value, _mm_set1_epi32(maximum));
+    }
+
+    SVL_TARGET_SSE41 inline __m128i Widen(const __m128i bytes, const int quarter)
+    {
+        switch (quarter) {
+            case 0:  return _mm_cvtepu8_epi32(bytes);
+            case 1:  return _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 4));
+            case 2:  return _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 8));
+            default: return _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 12));
+        }
+    }
+
+    SVL_TARGET_SSE41 inline __m128i ChannelMask(const bool enabled)
+    {
+        return enabled ? _mm_set1_epi8(static_cast<char>(0xFF)) : _mm_setzero_si128();
+    }
+
+    SVL_TARGET_SSE41 unsigned int RGB24toYUV422SSE41(const unsigned char* input, unsigned char* output, const unsigned int pixelcount,
+                                                     bool bgr, bool ch1, bool ch2, bool ch3)
+    {
+        __m128i masks[9], in[3], y[4], u[4], v[4];
+        DeinterleaveMasks(3, masks);
+        const int first = bgr ? 2 : 0;
+        const int last  = bgr ? 0 : 2;
+        const __m128i masky = ChannelMask(ch1);
+        const __m128i masku = ChannelMask(ch2);
+        const __m128i maskv = ChannelMask(ch3);
+        const __m128i zero = _mm_setzero_si128();
+        const unsigned int count = pixelcount & ~15u;
+        for (unsigned int i = 0; i < count; i += 16) {
+            for (int k = 0; k < 3; k ++) in[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 16 * k));
+            const __m128i r8 = Gather(in, masks + first * 3, 3);
+            const __m128i g8 = Gather(in, masks + 3, 3);
+            const __m128i b8 = Gather(in, masks + last * 3, 3);
+            const __m128i r16[2] = {_mm_unpacklo_epi8(r8, zero), _mm_unpackhi_epi8(r8, zero)};
+            const __m128i g16[2] = {_mm_unpacklo_epi8(g8, zero), _mm_unpackhi_epi8(g8, zero)};
+            const __m128i b16[2] = {_mm_unpacklo_epi8(b8, zero), _mm_unpackhi_epi8(b8, zero)};
+            for (int q = 0; q < 4; q ++) {
+                const int half = q >> 1;
+                const __m128i rg = (q & 1) ? _mm_unpackhi_epi16(r16[half], g16[half]) : _mm_unpacklo_epi16(r16[half], g16[half]);
+                const __m128i b0 = (q & 1) ? _mm_unpackhi_epi16(b16[half], zero) : _mm_unpacklo_epi16(b16[half], zero);
+                y[q] = YUVComponent(rg, b0,  2104,  4130,   802,  135168, 235);
+                u[q] = YUVComponent(rg, b0, -1214, -2384,  3598, 1052672, 240);
+                v[q] = YUVComponent(rg, b0,  3598, -3013,  -585, 1052672, 240);
+            }
+            // average chroma of pixel pairs
+            const __m128i ulo = _mm_srli_epi32(_mm_hadd_epi32(u[0], u[1]), 1);
+            const __m128i uhi = _mm_srli_epi32(_mm_hadd_epi32(u[2], u[3]), 1);
+            const __m128i vlo = _mm_srli_epi32(_mm_hadd_epi32(v[0], v[1]), 1);
+            const __m128i vhi = _mm_srli_epi32(_mm_hadd_epi32(v[2], v[3]), 1);
+            const __m128i y8 = _mm_and_si128(_mm_packus_epi16(_mm_packus_epi32(y[0], y[1]), _mm_packus_epi32(y[2], y[3])), masky);
+            const __m128i u8 = _mm_and_si128(_mm_packus_epi16(_mm_packus_epi32(ulo, uhi), zero), masku);
+            const __m128i v8 = _mm_and_si128(_mm_packus_epi16(_mm_packus_epi32(vlo, vhi), zero), maskv);
+            const __m128i uv = _mm_unpacklo_epi8(u8, v8);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_unpacklo_epi8(y8, uv));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 16), _mm_unpackhi_epi8(y8, uv));
+            input += 48;
+            output += 32;
+        }
+        return count;
+    }
+
+
+/*************************************/
+/*** RGB24 to HSV24 ******************/
+/*************************************/
+
+    // Integer divisions are computed in single precision, the quotients
+    // of numerators below 2^24 by denominators below 256 are truncated
+    // to the same values as the scalar integer divisions
+    SVL_TARGET_SSE41 inline __m128i Divide(const __m128i numerator, const __m128i denominator)
+    {
+        return _mm_cvttps_epi32(_mm_div_ps(_mm_cvtepi32_ps(numerator), _mm_cvtepi32_ps(denominator)));
+    }
+
+    SVL_TARGET_SSE41 unsigned int RGB24toHSV24SSE41(const unsigned char* input, unsigned char* output, const unsigned int pixelcount,
+                                                    bool ch1, bool ch2, bool ch3)
+    {
+        __m128i masks[9], outmasks[9], in[3], planes[3], s[4], h[4];
+        DeinterleaveMasks(3, masks);
+        InterleaveMasks3(outmasks);
+        const __m128i maskh = ChannelMask(ch1);
+        const __m128i masks8 = ChannelMask(ch2);
+        const __m128i maskv = ChannelMask(ch3);
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i one = _mm_set1_epi32(1);
+        const __m128i c42 = _mm_set1_epi32(42);
+        const __m128i lowbyte = _mm_set1_epi32(255);
+        const unsigned int count = pixelcount & ~15u;
+        for (unsigned int i = 0; i < count; i += 16) {
+            for (int k = 0; k < 3; k ++) in[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 16 * k));
+            const __m128i r8 = Gather(in, masks, 3);
+            const __m128i g8 = Gather(in, masks + 3, 3);
+            const __m128i b8 = Gather(in, masks + 6, 3);
+            const __m128i max8 = _mm_max_epu8(_mm_max_epu8(r8, g8), b8);
+            const __m128i delta8 = _mm_sub_epi8(max8, _mm_min_epu8(_mm_min_epu8(r8, g8), b8));
+            for (int q = 0; q < 4; q ++) {
+                const __m128i r = Widen(r8, q);
+                const __m128i g = Widen(g8, q);
+                const __m128i b = Widen(b8, q);
+                const __m128i max = Widen(max8, q);
+                const __m128i delta = Widen(delta8, q);
+                const __m128i nodelta = _mm_cmpeq_epi32(delta, zero);
+                // s = 255 * delta / max, 0 if delta is 0
+                s[q] = Divide(_mm_mullo_epi32(delta, _mm_set1_epi32(255)), _mm_max_epi32(max, one));
+                // hue depends on the channel with the maximum value, red first
+                const __m128i nr = _mm_mullo_epi32(c42, _mm_sub_epi32(g, b));
+                const __m128i ng = _mm_mullo_epi32(c42, _mm_add_epi32(_mm_set1_epi32(2), _mm_sub_epi32(b, r)));
+                const __m128i nb = _mm_mullo_epi32(c42, _mm_add_epi32(_mm_set1_epi32(4), _mm_sub_epi32(r, g)));
+                __m128i numerator = _mm_blendv_epi8(nb, ng, _mm_cmpeq_epi32(g, max));
+                numerator = _mm_blendv_epi8(numerator, nr, _mm_cmpeq_epi32(r, max));
+                // the scalar code stores the hue modulo 256, including
+                // the out of range values of the green and blue cases
+                const __m128i hue = _mm_and_si128(Divide(numerator, _mm_max_epi32(delta, one)), lowbyte);
+                h[q] = _mm_andnot_si128(nodelta, hue);
+            }
+            planes[0] = _mm_and_si128(max8, maskv);
+            planes[1] = _mm_and_si128(_mm_packus_epi16(_mm_packus_epi32(s[0], s[1]), _mm_packus_epi32(s[2], s[3])), masks8);
+            planes[2] = _mm_and_si128(_mm_packus_epi16(_mm_packus_epi32(h[0], h[1]), _mm_packus_epi32(h[2], h[3])), maskh);
+            for (int reg = 0; reg < 3; reg ++) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 16 * reg), Gather(planes, outmasks + reg * 3, 3));
+            }
+            input += 48;
+            output += 48;
+        }
+        return count;
+    }
+}
+
+#endif // SVL_SIMD_X86
+
+
+/*************************************/
+/*** Dispatch ************************/
+/*************************************/
+
+unsigned int svlConverterSIMD::RGB24toGray8(const unsigned char* input, unsigned char* output, const unsigned int pixelcount, bool accurate, bool bgr)
+{
+#if SVL_SIMD_X86
+    switch (svlConverter::GetInstructionSet()) {
+        case svlConverter::INSTRUCTIONS_AVX2:  return accurate ? ColorToGray8AVX2<3, true>(input, output, pixelcount, bgr)
+                                                      : ColorToGray8AVX2<3, false>(input, output, pixelcount, bgr);
+        case svlConverter::INSTRUCTIONS_SSE41: return accurate ? ColorToGray8SSE41<3, true>(input, output, pixelcount, bgr)
+                                                      : ColorToGray8SSE41<3, false>(input, output, pixelcount, bgr);
+        default: break;
+    }
+#endif
+    return 0;
+}
+
+unsigned int svlConverterSIMD::RGBA32toGray8(const unsigned char* input, unsigned char* output, const unsigned int pixelcount, bool accurate, bool bgr)
+{
+#if SVL_SIMD_X86
+    switch (svlConverter::GetInstructionSet()) {
+        case svlConverter::INSTRUCTIONS_AVX2:  return accurate ? ColorToGray8AVX2<4, true>(input, output, pixelcount, bgr)
+                                                      : ColorToGray8AVX2<4, false>(input, output, pixelcount, bgr);
+        case svlConverter::INSTRUCTIONS_SSE41: return accurate ? ColorToGray8SSE41<4, true>(input, output, pixelcount, bgr)
+                                                      : ColorToGray8SSE41<4, false>(input, output, pixelcount, bgr);
+        default: break;
+    }
+#endif
+    return 0;
+}
+
+unsigned int svlConverterSIMD::Gray16toGray8(const unsigned short* input, unsigned char* output, const unsigned int pixelcount, const unsigned int shiftdown)
+{
+#if SVL_SIMD_X86
+    switch (svlConverter::GetInstructionSet()) {
+        case svlConverter::INSTRUCTIONS_AVX2:  return Gray16toGray8AVX2(input, output, pixelcount, shiftdown);
+        case svlConverter::INSTRUCTIONS_SSE41: return Gray16toGray8SSE41(input, output, pixelcount, shiftdown);
+        default: break;
+    }
+#endif
+    return 0;
+}
+
+unsigned int svlConverterSIMD::RGB24toRGBA32(const unsigned char* input, unsigned char* output, const unsigned int pixelcount)
+{
+#if SVL_SIMD_X86
+    if (svlConverter::GetInstructionSet() >= svlConverter::INSTRUCTIONS_SSE41) {
+        return RGB24toRGBA32SSE41(input, output, pixelcount);
+    }
+#endif
+    return 0;
+}
+
+unsigned int svlConverterSIMD::RGBA32toRGB24(const unsigned char* input, unsigned char* output, const unsigned int pixelcount)
+{
+#if SVL_SIMD_X86
+    if (svlConverter::GetInstructionSet() >= svlConverter::INSTRUCTIONS_SSE41) {
+        return RGBA32toRGB24SSE41(input, output, pixelcount);
+    }
+#endif
+    return 0;
+}
+
+unsigned int svlConverterSIMD::RGB24toYUV422(const unsigned char* input, unsigned char* output, const unsigned int pixelcount, bool bgr, bool ch1, bool ch2, bool ch3)
+{
+#if SVL_SIMD_X86
+    if (svlConverter::GetInstructionSet() >= svlConverter::INSTRUCTIONS_SSE41) {
+        return RGB24toYUV422SSE41(input, output, pixelcount, bgr, ch1, ch2, ch3);
+    }
+#endif
+    return 0;
+}
+
+unsigned int svlConverterSIMD::RGB24toHSV24(const unsigned char* input, unsigned char* output, const unsigned int pixelcount, bool ch1, bool ch2, bool ch3)
+{
+#if SVL_SIMD_X86
+    if (svlConverter::GetInstructionSet() >= svlConverter::INSTRUCTIONS_SSE41) {
+        return RGB24toHSV24SSE41(input, output, pixelcount, ch1, ch2, ch3);
+    }
+#endif
+    return 0;
+}
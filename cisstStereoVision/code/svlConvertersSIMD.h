@@ -0,0 +1,44 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#ifndef _svlConvertersSIMD_h
+#define _svlConvertersSIMD_h
+
+#include <cisstStereoVision/svlConverters.h>
+
+
+// SIMD kernels used by svlConverter, selected using
+// svlConverter::GetInstructionSet.  Each function converts the first
+// pixels of the buffer with the same results as the scalar code and
+// returns the number of pixels converted, the caller converts the
+// remaining pixels.  Functions return 0 if no SIMD implementation is
+// available.
+namespace svlConverterSIMD
+{
+    unsigned int RGB24toGray8(const unsigned char* input, unsigned char* output, const unsigned int pixelcount, bool accurate, bool bgr);
+    unsigned int RGBA32toGray8(const unsigned char* input, unsigned char* output, const unsigned int pixelcount, bool accurate, bool bgr);
+    unsigned int Gray16toGray8(const unsigned short* input, unsigned char* output, const unsigned int pixelcount, const unsigned int shiftdown);
+    unsigned int RGB24toRGBA32(const unsigned char* input, unsigned char* output, const unsigned int pixelcount);
+    unsigned int RGBA32toRGB24(const unsigned char* input, unsigned char* output, const unsigned int pixelcount);
+    unsigned int RGB24toYUV422(const unsigned char* input, unsigned char* output, const unsigned int pixelcount, bool bgr, bool ch1, bool ch2, bool ch3);
+    unsigned int RGB24toHSV24(const unsigned char* input, unsigned char* output, const unsigned int pixelcount, bool ch1, bool ch2, bool ch3);
+}
+
+#endif // _svlConvertersSIMD_h
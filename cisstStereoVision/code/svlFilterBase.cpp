@@ -23,6 +23,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstStereoVision/svlStreamManager.h>
 #include <cisstStereoVision/svlFilterInput.h>
 #include <cisstStereoVision/svlFilterOutput.h>
+#include <cisstStereoVision/svlSamplePool.h>
 
 
 /*************************************/
@@ -40,7 +41,11 @@ svlFilterBase::svlFilterBase() :
     Initialized(false),
     Running(false),
     AutoType(false),
-    PrevInputTimestamp(-1.0)
+    PrevInputTimestamp(-1.0),
+    SamplePool(0),
+    ReadOnlyInput(false),
+    InputCopy(0),
+    ProcessInput(0)
 {
 }
 
@@ -268,3 +273,43 @@ bool svlFilterBase::IsNewSample(svlSample* sample)
     return (sample && sample->GetTimestamp() > PrevInputTimestamp) ? true : false;
 }
 
+svlSamplePool* svlFilterBase::GetSamplePool(void) const
+{
+    return SamplePool;
+}
+
+svlSample* svlFilterBase::AcquireSample(svlStreamType type)
+{
+    if (SamplePool) return SamplePool->Acquire(type);
+    return svlSample::GetNewFromType(type);
+}
+
+svlSample* svlFilterBase::GetWritableSample(svlSample* sample)
+{
+    if (SamplePool) return SamplePool->GetWritable(sample);
+    return sample;
+}
+
+void svlFilterBase::ReleaseSample(svlSample* sample)
+{
+    if (!sample) return;
+    if (!SamplePool || !SamplePool->Release(sample)) delete sample;
+}
+
+void svlFilterBase::SetReadOnlyInput(bool readonly)
+{
+    ReadOnlyInput = readonly;
+}
+
+svlSample* svlFilterBase::GetPrivateInput(svlSample* sample)
+{
+    if (!SamplePool || !SamplePool->IsShared(sample)) return sample;
+
+    // Copy on write, the copy is reused until it gets shared
+    if (InputCopy) InputCopy = SamplePool->GetWritable(InputCopy);
+    else InputCopy = SamplePool->Acquire(sample);
+    InputCopy->CopyOf(sample);
+    SamplePool->AddCopy(sample);
+
+    return InputCopy;
+}
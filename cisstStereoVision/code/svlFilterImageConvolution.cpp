@@ -96,13 +96,14 @@ int svlFilterImageConvolution::Process(svlProcInfo* procInfo, svlSample* syncInp
     unsigned int videochannels = img->GetVideoChannels();
     unsigned int idx;
 
-    _ParallelLoop(procInfo, idx, videochannels)
-    {
+    // Each thread processes a band of rows of each video channel, or
+    // whole video channels when the kernel can't be split
+    for (idx = 0; idx < videochannels; idx ++) {
         if (KernelSeparable) {
-            svlImageProcessing::Convolution(img, idx, OutputImage, idx, KernelHoriz, KernelVert, AbsoluteResults);
+            svlImageProcessing::Convolution(img, idx, OutputImage, idx, KernelHoriz, KernelVert, AbsoluteResults, procInfo);
         }
         else {
-            svlImageProcessing::Convolution(img, idx, OutputImage, idx, Kernel, AbsoluteResults);
+            svlImageProcessing::Convolution(img, idx, OutputImage, idx, Kernel, AbsoluteResults, procInfo);
         }
     }
 
@@ -39,21 +39,26 @@ svlFilterImageResizer::svlFilterImageResizer() :
 
     AddInput("input", true);
     AddInputType("input", svlTypeImageRGB);
+    AddInputType("input", svlTypeImageRGBA);
     AddInputType("input", svlTypeImageMono8);
+    AddInputType("input", svlTypeImageMono16);
     AddInputType("input", svlTypeImageRGBStereo);
+    AddInputType("input", svlTypeImageRGBAStereo);
     AddInputType("input", svlTypeImageMono8Stereo);
+    AddInputType("input", svlTypeImageMono16Stereo);
 //  TO DO:
-//    svlTypeImageMono16 and svlTypeImageMono16Stereo
 //    svlTypeImageMono32 and svlTypeImageMono32Stereo
 
     AddOutput("output", true);
     SetAutomaticOutputType(true);
+    SetReadOnlyInput(true);
 
     for (unsigned int i = 0; i < 2; i ++) {
         WidthRatio[i] = HeightRatio[i] = 1.0;
         Width[i] = Height[i] = 0;
     }
     InterpolationEnabled = false;
+    Interpolation = false;
 }
 
 svlFilterImageResizer::~svlFilterImageResizer()
@@ -115,15 +120,15 @@ int svlFilterImageResizer::Initialize(svlSample* syncInput, svlSample* &syncOutp
         switch (type) {
             case svlTypeImageRGB:
             case svlTypeImageRGBStereo:
+            case svlTypeImageRGBA:
+            case svlTypeImageRGBAStereo:
             case svlTypeImageMono8:
             case svlTypeImageMono8Stereo:
-                OutputImage = dynamic_cast<svlSampleImage*>(svlSample::GetNewFromType(type));
+            case svlTypeImageMono16:
+            case svlTypeImageMono16Stereo:
+                OutputImage = dynamic_cast<svlSampleImage*>(AcquireSample(type));
             break;
 
-            case svlTypeImageRGBA:          // To be added
-            case svlTypeImageRGBAStereo:    // To be added
-            case svlTypeImageMono16:        // To be added
-            case svlTypeImageMono16Stereo:  // To be added
             case svlTypeImageMono32:        // To be added
             case svlTypeImageMono32Stereo:  // To be added
 
@@ -193,20 +198,28 @@ int svlFilterImageResizer::Process(svlProcInfo* procInfo, svlSample* syncInput,
         return SVL_OK;
     }
 
-    syncOutput = OutputImage;
-
     if (IsDisabled()) {
         // Do not process; resend the last processed output sample
+        syncOutput = OutputImage;
         return SVL_OK;
     }
 
+    // All threads have to resample with the same settings into the same
+    // sample; the last output may still be referenced by a stream branch
+    _OnSingleThread(procInfo) {
+        Interpolation = InterpolationEnabled;
+        OutputImage = dynamic_cast<svlSampleImage*>(GetWritableSample(OutputImage));
+    }
+    _SynchronizeThreads(procInfo);
+
+    syncOutput = OutputImage;
+
     svlSampleImage* id = dynamic_cast<svlSampleImage*>(syncInput);
-    unsigned int videochannels = id->GetVideoChannels();
-    unsigned int idx;
+    const unsigned int videochannels = id->GetVideoChannels();
 
-    _ParallelLoop(procInfo, idx, videochannels)
-    {
-        svlImageProcessing::Resize(id, idx, OutputImage, idx, InterpolationEnabled, Internals[idx]);
+    // Each thread resamples a band of rows of every video channel
+    for (unsigned int idx = 0; idx < videochannels; idx ++) {
+        svlImageProcessing::Resize(id, idx, OutputImage, idx, Interpolation, Internals[idx], procInfo);
     }
 
     return SVL_OK;
@@ -215,7 +228,7 @@ int svlFilterImageResizer::Process(svlProcInfo* procInfo, svlSample* syncInput,
 int svlFilterImageResizer::Release()
 {
     if (OutputImage) {
-        delete OutputImage;
+        ReleaseSample(OutputImage);
         OutputImage = 0;
     }
     return SVL_OK;
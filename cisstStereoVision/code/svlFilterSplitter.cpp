@@ -22,6 +22,7 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstStereoVision/svlFilterSplitter.h>
 #include <cisstStereoVision/svlFilterInput.h>
 #include <cisstStereoVision/svlFilterOutput.h>
+#include <cisstStereoVision/svlSamplePool.h>
 #include <cisstMultiTask/mtsInterfaceProvided.h>
 
 
@@ -32,7 +33,8 @@ http://www.cisst.org/cisst/license.txt.
 CMN_IMPLEMENT_SERVICES_DERIVED(svlFilterSplitter, svlFilterBase)
 
 svlFilterSplitter::svlFilterSplitter() :
-    svlFilterBase()
+    svlFilterBase(),
+    SharedCopy(0)
 {
     CreateInterfaces();
 
@@ -77,6 +79,7 @@ svlFilterSplitter::svlFilterSplitter() :
     // Add the trunk output by default
     svlFilterBase::AddOutput("output", true);
     SetAutomaticOutputType(false);
+    SetReadOnlyInput(true);
 }
 
 int svlFilterSplitter::AddOutput(const std::string &name, const unsigned int threadcount, const unsigned int buffersize)
@@ -134,16 +137,38 @@ int svlFilterSplitter::Process(svlProcInfo* procInfo, svlSample* syncInput, svlS
     _SkipIfDisabled();
 
     _OnSingleThread(procInfo) {
-        // Non-trunk outputs copy the input sample into their buffers
         const unsigned int size = static_cast<unsigned int>(AsyncOutputs.size());
+        const svlSample* sample = syncInput;
+
+        // Stream branches share pooled samples, so a sample from outside of
+        // the pool gets copied only once for all of them
+        svlSamplePool* pool = GetSamplePool();
+        if (pool && size > 1 && !pool->Owns(syncInput)) {
+            if (SharedCopy) SharedCopy = pool->GetWritable(SharedCopy);
+            else SharedCopy = pool->Acquire(syncInput);
+            SharedCopy->CopyOf(syncInput);
+            pool->AddCopy(syncInput);
+            sample = SharedCopy;
+        }
+
+        // Non-trunk outputs push the sample into their buffers
         for (unsigned int i = 0; i < size; i ++) {
-            if (AsyncOutputs[i]) AsyncOutputs[i]->PushSample(syncInput);
+            if (AsyncOutputs[i]) AsyncOutputs[i]->PushSample(sample);
         }
     }
 
     return SVL_OK;
 }
 
+int svlFilterSplitter::Release()
+{
+    if (SharedCopy) {
+        ReleaseSample(SharedCopy);
+        SharedCopy = 0;
+    }
+    return SVL_OK;
+}
+
 void svlFilterSplitter::CreateInterfaces()
 {
     // Add NON-QUEUED provided interface for configuration management
@@ -46,6 +46,7 @@ svlFilterStereoImageJoiner::svlFilterStereoImageJoiner() :
 
     AddOutput("output", true);
     SetAutomaticOutputType(false);
+    SetReadOnlyInput(true);
 }
 
 svlFilterStereoImageJoiner::~svlFilterStereoImageJoiner()
@@ -99,11 +100,8 @@ int svlFilterStereoImageJoiner::Initialize(svlSample* syncInput, svlSample* &syn
             return SVL_FAIL;
     }
 
-    if      (GetInput()->GetType() == svlTypeImageRGBStereo)    OutputImage = new svlSampleImageRGB;
-    else if (GetInput()->GetType() == svlTypeImageMono8Stereo)  OutputImage = new svlSampleImageMono8;
-    else if (GetInput()->GetType() == svlTypeImageMono16Stereo) OutputImage = new svlSampleImageMono16;
-    else if (GetInput()->GetType() == svlTypeImageMono32Stereo) OutputImage = new svlSampleImageMono32;
-    else return SVL_FAIL;
+    OutputImage = dynamic_cast<svlSampleImage*>(AcquireSample(GetOutput()->GetType()));
+    if (!OutputImage) return SVL_FAIL;
     OutputImage->SetSize(width, height);
 
     syncOutput = OutputImage;
@@ -118,6 +116,9 @@ int svlFilterStereoImageJoiner::Process(svlProcInfo* procInfo, svlSample* syncIn
 
     _OnSingleThread(procInfo)
     {
+        // The last output may still be referenced by a stream branch
+        OutputImage = dynamic_cast<svlSampleImage*>(GetWritableSample(OutputImage));
+
         svlSampleImage* id    = dynamic_cast<svlSampleImage*>(syncInput);
         unsigned int stride   = id->GetWidth(SVL_LEFT) * id->GetBPP();
         unsigned int stride2  = stride << 1;
@@ -186,13 +187,16 @@ int svlFilterStereoImageJoiner::Process(svlProcInfo* procInfo, svlSample* syncIn
         }
     }
 
+    _SynchronizeThreads(procInfo);
+    syncOutput = OutputImage;
+
     return SVL_OK;
 }
 
 int svlFilterStereoImageJoiner::Release()
 {
     if (OutputImage) {
-        delete OutputImage;
+        ReleaseSample(OutputImage);
         OutputImage = 0;
     }
     return SVL_OK;
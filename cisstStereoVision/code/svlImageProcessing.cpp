@@ -20,7 +20,156 @@ http://www.cisst.org/cisst/license.txt.
 */
 
 #include <cisstStereoVision/svlImageProcessing.h>
+#include <cisstStereoVision/svlProcInfo.h>
+#include <cisstOSAbstraction/osaCriticalSection.h>
 #include "svlImageProcessingHelper.h"
+#include <cmath>
+#include <cstdlib>
+
+
+/*****************************************/
+/*** Separable convolution helpers *******/
+/*****************************************/
+
+namespace {
+    // Fixed point kernel with 10 fractional bits, rounded to nearest
+    void GetFixedPointKernel(const vctDynamicVector<double> & kernel, vctDynamicVector<int> & fp_kernel)
+    {
+        fp_kernel.SetSize(kernel.size());
+        for (unsigned int i = 0; i < kernel.size(); i ++) {
+            fp_kernel[i] = static_cast<int>(floor(kernel[i] * 1024.0 + 0.5));
+        }
+    }
+
+    // Checks if a kernel matrix is the outer product of two vectors
+    bool GetSeparableKernel(const vctDynamicMatrix<double> & kernel,
+                            vctDynamicVector<double> & kernel_horiz,
+                            vctDynamicVector<double> & kernel_vert)
+    {
+        const unsigned int rows = kernel.rows();
+        const unsigned int cols = kernel.cols();
+        unsigned int i, j, pivot_row = 0, pivot_col = 0;
+        double pivot = 0.0;
+        for (i = 0; i < rows; i ++) {
+            for (j = 0; j < cols; j ++) {
+                if (fabs(kernel.Element(i, j)) > fabs(pivot)) {
+                    pivot = kernel.Element(i, j);
+                    pivot_row = i;
+                    pivot_col = j;
+                }
+            }
+        }
+        if (pivot == 0.0) return false;
+
+        kernel_vert.SetSize(rows);
+        kernel_horiz.SetSize(cols);
+        for (i = 0; i < rows; i ++) kernel_vert[i] = kernel.Element(i, pivot_col);
+        for (j = 0; j < cols; j ++) kernel_horiz[j] = kernel.Element(pivot_row, j) / pivot;
+
+        const double tolerance = 1.0e-9 * fabs(pivot);
+        for (i = 0; i < rows; i ++) {
+            for (j = 0; j < cols; j ++) {
+                if (fabs(kernel.Element(i, j) - kernel_vert[i] * kernel_horiz[j]) > tolerance) return false;
+            }
+        }
+        return true;
+    }
+
+    // Runs the separable convolution on the band of rows of the calling thread
+    bool ConvolutionSeparable(svlSampleImage* src_img, unsigned int src_videoch,
+                              svlSampleImage* dst_img, unsigned int dst_videoch,
+                              const vctDynamicVector<double> & kernel_horiz,
+                              const vctDynamicVector<double> & kernel_vert,
+                              bool absres, svlProcInfo* procInfo)
+    {
+        const int width  = static_cast<int>(src_img->GetWidth(src_videoch));
+        const int height = static_cast<int>(src_img->GetHeight(src_videoch));
+        vctDynamicVector<int> fp_kernel_horiz, fp_kernel_vert;
+        GetFixedPointKernel(kernel_horiz, fp_kernel_horiz);
+        GetFixedPointKernel(kernel_vert, fp_kernel_vert);
+
+        unsigned int from = 0, to = static_cast<unsigned int>(height);
+        if (procInfo) {
+            _GetParallelSubRange(procInfo, static_cast<unsigned int>(height), from, to);
+        }
+        const int row_from = static_cast<int>(from);
+        const int row_to   = static_cast<int>(to);
+
+        switch (src_img->GetPixelType()) {
+            case svlPixelRGB:
+                return svlImageProcessingHelper::ConvolutionSeparable(src_img->GetUCharPointer(src_videoch),
+                                                                      dst_img->GetUCharPointer(dst_videoch),
+                                                                      width, height, 3,
+                                                                      fp_kernel_horiz, fp_kernel_vert, absres,
+                                                                      row_from, row_to);
+            case svlPixelRGBA:
+                return svlImageProcessingHelper::ConvolutionSeparable(src_img->GetUCharPointer(src_videoch),
+                                                                      dst_img->GetUCharPointer(dst_videoch),
+                                                                      width, height, 4,
+                                                                      fp_kernel_horiz, fp_kernel_vert, absres,
+                                                                      row_from, row_to);
+            case svlPixelMono8:
+                return svlImageProcessingHelper::ConvolutionSeparable(src_img->GetUCharPointer(src_videoch),
+                                                                      dst_img->GetUCharPointer(dst_videoch),
+                                                                      width, height, 1,
+                                                                      fp_kernel_horiz, fp_kernel_vert, absres,
+                                                                      row_from, row_to);
+            case svlPixelMono16:
+                return svlImageProcessingHelper::ConvolutionSeparable(reinterpret_cast<unsigned short*>(src_img->GetUCharPointer(src_videoch)),
+                                                                      reinterpret_cast<unsigned short*>(dst_img->GetUCharPointer(dst_videoch)),
+                                                                      width, height, 1,
+                                                                      fp_kernel_horiz, fp_kernel_vert, absres,
+                                                                      row_from, row_to);
+            default:
+                return false;
+        }
+    }
+
+    // Checks if the separable convolution can run, i.e. all the threads
+    // will take the same decision
+    bool CanUseSeparableConvolution(svlSampleImage* src_img, svlSampleImage* dst_img,
+                                    const vctDynamicVector<double> & kernel_horiz,
+                                    const vctDynamicVector<double> & kernel_vert)
+    {
+        const svlPixelType type = src_img->GetPixelType();
+        if (type != svlPixelRGB && type != svlPixelRGBA && type != svlPixelMono8 && type != svlPixelMono16) return false;
+        if (src_img == dst_img || kernel_horiz.size() < 1 || kernel_vert.size() < 1) return false;
+
+        // same limits as svlImageProcessingHelper::ConvolutionSeparable
+        vctDynamicVector<int> fp_kernel_horiz, fp_kernel_vert;
+        GetFixedPointKernel(kernel_horiz, fp_kernel_horiz);
+        GetFixedPointKernel(kernel_vert, fp_kernel_vert);
+        const long long maxvalue = (type == svlPixelMono16) ? 65535 : 255;
+        const long long limit = 0x7FFFFFFF;
+        long long sum_h = 0, sum_v = 0;
+        unsigned int i;
+        for (i = 0; i < fp_kernel_horiz.size(); i ++) sum_h += abs(fp_kernel_horiz[i]);
+        for (i = 0; i < fp_kernel_vert.size(); i ++) sum_v += abs(fp_kernel_vert[i]);
+        return (maxvalue * sum_h <= limit) && (((maxvalue * sum_h) >> 20) * sum_v <= limit);
+    }
+}
+
+
+/*****************************************/
+/*** Resampling helpers ******************/
+/*****************************************/
+
+namespace {
+    svlImageProcessingHelper::ResamplerInternals* GetResampler(svlImageProcessing::Internals& internals,
+                                                               const int src_width, const int src_height,
+                                                               const int dst_width, const int dst_height,
+                                                               const int channels, const int bytes, bool interpolation)
+    {
+        svlImageProcessingHelper::ResamplerInternals* resampler = dynamic_cast<svlImageProcessingHelper::ResamplerInternals*>(internals.Get());
+        if (!resampler) {
+            resampler = new svlImageProcessingHelper::ResamplerInternals;
+            internals.Set(resampler);
+        }
+        // Will not do anything if parameters have not changed
+        resampler->Setup(src_width, src_height, dst_width, dst_height, channels, bytes, interpolation);
+        return resampler;
+    }
+}
 
 
 /************************************/
@@ -31,7 +180,8 @@ int svlImageProcessing::Convolution(svlSampleImage* src_img, unsigned int src_vi
                                     svlSampleImage* dst_img, unsigned int dst_videoch,
                                     vctDynamicVector<double> kernel_horiz,
                                     vctDynamicVector<double> kernel_vert,
-                                    bool absres)
+                                    bool absres,
+                                    svlProcInfo* procInfo)
 {
     if (!src_img || src_img->GetVideoChannels() <= src_videoch ||
         !dst_img || dst_img->GetVideoChannels() <= dst_videoch) return SVL_FAIL;
@@ -44,6 +194,18 @@ int svlImageProcessing::Convolution(svlSampleImage* src_img, unsigned int src_vi
         width  < 1 || width  != static_cast<int>(dst_img->GetWidth(dst_videoch)) ||
         height < 1 || height != static_cast<int>(dst_img->GetHeight(dst_videoch))) return SVL_FAIL;
 
+    // With absres, each pass takes the absolute value of its own result
+    // so the two passes are kept separate
+    if (!absres && CanUseSeparableConvolution(src_img, dst_img, kernel_horiz, kernel_vert)) {
+        if (!ConvolutionSeparable(src_img, src_videoch, dst_img, dst_videoch,
+                                  kernel_horiz, kernel_vert, absres, procInfo)) return SVL_FAIL;
+        return SVL_OK;
+    }
+
+    // The two passes below use the whole image, video channels are
+    // distributed between threads instead
+    if (procInfo && (src_videoch % procInfo->count) != procInfo->ID) return SVL_OK;
+
     vctDynamicVector<int> fp_kernel_horiz, fp_kernel_vert;
     fp_kernel_horiz.SetSize(kernel_horiz.size());
     fp_kernel_vert.SetSize(kernel_vert.size());
@@ -120,7 +282,8 @@ int svlImageProcessing::Convolution(svlSampleImage* src_img, unsigned int src_vi
 int svlImageProcessing::Convolution(svlSampleImage* src_img, unsigned int src_videoch,
                                     svlSampleImage* dst_img, unsigned int dst_videoch,
                                     vctDynamicMatrix<double> kernel,
-                                    bool absres)
+                                    bool absres,
+                                    svlProcInfo* procInfo)
 {
     if (!src_img || src_img->GetVideoChannels() <= src_videoch ||
         !dst_img || dst_img->GetVideoChannels() <= dst_videoch) return SVL_FAIL;
@@ -133,6 +296,19 @@ int svlImageProcessing::Convolution(svlSampleImage* src_img, unsigned int src_vi
         width  < 1 || width  != static_cast<int>(dst_img->GetWidth(dst_videoch)) ||
         height < 1 || height != static_cast<int>(dst_img->GetHeight(dst_videoch))) return SVL_FAIL;
 
+    // Rank-1 kernels are applied in two passes
+    vctDynamicVector<double> kernel_horiz, kernel_vert;
+    if (GetSeparableKernel(kernel, kernel_horiz, kernel_vert) &&
+        CanUseSeparableConvolution(src_img, dst_img, kernel_horiz, kernel_vert)) {
+        if (!ConvolutionSeparable(src_img, src_videoch, dst_img, dst_videoch,
+                                  kernel_horiz, kernel_vert, absres, procInfo)) return SVL_FAIL;
+        return SVL_OK;
+    }
+
+    // The 2D convolution uses the whole image, video channels are
+    // distributed between threads instead
+    if (procInfo && (src_videoch % procInfo->count) != procInfo->ID) return SVL_OK;
+
     vctDynamicMatrix<int> fp_kernel;
     fp_kernel.SetSize(kernel.rows(), kernel.cols());
     fp_kernel.Assign(kernel.Multiply(1024));
@@ -460,6 +636,68 @@ int svlImageProcessing::Resize(svlSampleImage* src_img, unsigned int src_videoch
 }
 
 
+int svlImageProcessing::Resize(svlSampleImage* src_img, unsigned int src_videoch,
+                               svlSampleImage* dst_img, unsigned int dst_videoch,
+                               bool interpolation,
+                               svlImageProcessing::Internals& internals,
+                               svlProcInfo* procInfo)
+{
+    if (!src_img || !dst_img ||                               // source or destination is zero
+        src_img->GetVideoChannels() <= src_videoch ||         // source has no such video channel
+        dst_img->GetVideoChannels() <= dst_videoch ||         // destination has no such video channel
+        src_img->GetPixelType() != dst_img->GetPixelType()) { // image type mismatch
+        return SVL_FAIL;
+    }
+
+    const svlPixelType type = src_img->GetPixelType();
+    if (type != svlPixelRGB && type != svlPixelRGBA && type != svlPixelMono8 && type != svlPixelMono16) return SVL_FAIL;
+
+    const unsigned char* src_buf = src_img->GetUCharPointer(src_videoch);
+    unsigned char* dst_buf = dst_img->GetUCharPointer(dst_videoch);
+    const unsigned int src_width  = src_img->GetWidth(src_videoch);
+    const unsigned int src_height = src_img->GetHeight(src_videoch);
+    const unsigned int dst_width  = dst_img->GetWidth(dst_videoch);
+    const unsigned int dst_height = dst_img->GetHeight(dst_videoch);
+    if (src_buf == dst_buf || src_width < 1 || src_height < 1 || dst_width < 1 || dst_height < 1) return SVL_FAIL;
+
+    unsigned int from = 0, to = dst_height;
+    if (procInfo) {
+        _GetParallelSubRange(procInfo, dst_height, from, to);
+    }
+
+    if (src_width == dst_width && src_height == dst_height) {
+        if (from < to) {
+            const unsigned int stride = src_width * src_img->GetBPP();
+            memcpy(dst_buf + from * stride, src_buf + from * stride, (to - from) * stride);
+        }
+        return SVL_OK;
+    }
+
+    const int channels = (type == svlPixelMono16) ? 1 : static_cast<int>(src_img->GetBPP());
+    const int bytes    = (type == svlPixelMono16) ? 2 : 1;
+    svlImageProcessingHelper::ResamplerInternals* resampler = 0;
+
+    // Tables are shared by the threads, the first thread creates or updates them
+    if (procInfo) {
+        _CriticalSection(procInfo) {
+            resampler = GetResampler(internals, src_width, src_height, dst_width, dst_height, channels, bytes, interpolation);
+        }
+    }
+    else {
+        resampler = GetResampler(internals, src_width, src_height, dst_width, dst_height, channels, bytes, interpolation);
+    }
+
+    if (type == svlPixelMono16) {
+        resampler->Resample(reinterpret_cast<const unsigned short*>(src_buf), reinterpret_cast<unsigned short*>(dst_buf), from, to);
+    }
+    else {
+        resampler->Resample(src_buf, dst_buf, from, to);
+    }
+
+    return SVL_OK;
+}
+
+
 int svlImageProcessing::Deinterlace(svlSampleImage* image, unsigned int videoch, svlImageProcessing::DI_Algorithm algorithm)
 {
     if (!image || image->GetVideoChannels() <= videoch || image->GetBPP() != 3) return SVL_FAIL;
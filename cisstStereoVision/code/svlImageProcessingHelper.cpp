@@ -20,9 +20,13 @@ http://www.cisst.org/cisst/license.txt.
 */
 
 #include "svlImageProcessingHelper.h"
+#include "svlImageProcessingSIMD.h"
 #include "cisstCommon/cmnPortability.h"
 #include <fstream>
 #include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <vector>
 
 
 /*****************************************/
@@ -1127,6 +1131,144 @@ void svlImageProcessingHelper::ConvolutionMono32(unsigned int* input, unsigned i
     }
 }
 
+namespace {
+    // Rows convolved horizontally by the calling thread, see ConvolutionSeparable
+    thread_local std::vector<int> ConvolutionRowBuffer;
+    thread_local std::vector<const int*> ConvolutionRowPointers;
+
+    // Horizontal pass of one row, the kernel is truncated at the borders
+    // the same way as in the 2D convolution
+    template <class _ValueType>
+    void ConvolutionSeparableRow(const _ValueType* input, int* output, const int width, const int channels,
+                                 const int* kernel, const int kernel_size, const int shift)
+    {
+        const int kernel_rad = kernel_size / 2;
+        // pixels for which the kernel is entirely inside the row
+        const int interior_from = std::min(kernel_rad, width);
+        const int interior_to = std::max(interior_from, width - kernel_size + kernel_rad + 1);
+
+        const int count = (interior_to - interior_from) * channels;
+        const _ValueType* interior_input = input + (interior_from - kernel_rad) * channels;
+        int* interior_output = output + interior_from * channels;
+        const int done = svlImageProcessingSIMD::ConvolutionRow(interior_input, interior_output, count, channels,
+                                                                kernel, kernel_size, shift);
+        int i, k, c, sum;
+        for (i = done; i < count; i ++) {
+            const _ValueType* input2 = interior_input + i;
+            sum = 0;
+            for (k = 0; k < kernel_size; k ++) {
+                sum += kernel[k] * (*input2);
+                input2 += channels;
+            }
+            interior_output[i] = sum >> shift;
+        }
+
+        for (i = 0; i < width; i ++) {
+            if (i == interior_from) {
+                i = interior_to;
+                if (i >= width) break;
+            }
+            const int k_from = std::max(i - kernel_rad, 0);
+            const int k_to   = std::min(i - kernel_rad + kernel_size, width);
+            const int* kernelptr = kernel + (k_from - (i - kernel_rad));
+            for (c = 0; c < channels; c ++) {
+                sum = 0;
+                for (k = k_from; k < k_to; k ++) {
+                    sum += kernelptr[k - k_from] * input[k * channels + c];
+                }
+                output[i * channels + c] = sum >> shift;
+            }
+        }
+    }
+
+    template <class _ValueType>
+    bool ConvolutionSeparable(const _ValueType* input, _ValueType* output, const int width, const int height, const int channels,
+                              const vctDynamicVector<int> & kernel_horiz, const vctDynamicVector<int> & kernel_vert,
+                              const int maxvalue, bool absres, const int row_from, const int row_to)
+    {
+        if (!input || !output || width < 1 || height < 1 || kernel_horiz.size() < 1 || kernel_vert.size() < 1) return false;
+
+        const int kernel_width  = static_cast<int>(kernel_horiz.size());
+        const int kernel_height = static_cast<int>(kernel_vert.size());
+        const int kernel_v_rad  = kernel_height / 2;
+        const int rowstride = width * channels;
+        long long sum_h = 0, sum_v = 0;
+        int i, l;
+        for (i = 0; i < kernel_width;  i ++) sum_h += std::abs(kernel_horiz[i]);
+        for (i = 0; i < kernel_height; i ++) sum_v += std::abs(kernel_vert[i]);
+
+        // Horizontal results are shifted down as little as possible to
+        // keep the vertical sums within 32 bits
+        const long long limit = 0x7FFFFFFF;
+        if (maxvalue * sum_h > limit) return false;
+        int shift_h = 0;
+        while (((maxvalue * sum_h) >> shift_h) * sum_v > limit) shift_h ++;
+        if (shift_h > 20) return false;
+        const int shift_v = 20 - shift_h;
+
+        ConvolutionRowBuffer.resize(static_cast<size_t>(kernel_height) * rowstride);
+        ConvolutionRowPointers.resize(kernel_height);
+        int* buffer = &(ConvolutionRowBuffer[0]);
+        const int** rows = &(ConvolutionRowPointers[0]);
+
+        // next input row to convolve horizontally, input row l is stored
+        // in slot (l % kernel_height) of the ring buffer
+        int next = std::max(row_from - kernel_v_rad, 0);
+        int sum;
+
+        for (int j = row_from; j < row_to; j ++) {
+
+            int l_from = j - kernel_v_rad;
+            int l_to   = l_from + kernel_height;
+            const int* kernelptr = kernel_vert.Pointer();
+            if (l_from < 0) {
+                kernelptr -= l_from;
+                l_from = 0;
+            }
+            if (l_to > height) l_to = height;
+
+            while (next < l_to) {
+                ConvolutionSeparableRow(input + next * rowstride, buffer + (next % kernel_height) * rowstride,
+                                        width, channels, kernel_horiz.Pointer(), kernel_width, shift_h);
+                next ++;
+            }
+            for (l = l_from; l < l_to; l ++) rows[l - l_from] = buffer + (l % kernel_height) * rowstride;
+
+            _ValueType* output2 = output + j * rowstride;
+            const int count = l_to - l_from;
+            const int done = svlImageProcessingSIMD::ConvolutionColumn(rows, kernelptr, count, rowstride,
+                                                                       0, shift_v, absres, output2);
+            for (i = done; i < rowstride; i ++) {
+                sum = 0;
+                for (l = 0; l < count; l ++) sum += kernelptr[l] * rows[l][i];
+                sum >>= shift_v;
+                if (absres) {
+                    if (sum < 0) sum = -sum;
+                }
+                else if (sum < 0) sum = 0;
+                if (sum > maxvalue) sum = maxvalue;
+                output2[i] = static_cast<_ValueType>(sum);
+            }
+        }
+
+        return true;
+    }
+}
+
+bool svlImageProcessingHelper::ConvolutionSeparable(const unsigned char* input, unsigned char* output, const int width, const int height, const int channels,
+                                                    const vctDynamicVector<int> & kernel_horiz, const vctDynamicVector<int> & kernel_vert, bool absres,
+                                                    const int row_from, const int row_to)
+{
+    return ::ConvolutionSeparable(input, output, width, height, channels, kernel_horiz, kernel_vert, 255, absres, row_from, row_to);
+}
+
+bool svlImageProcessingHelper::ConvolutionSeparable(const unsigned short* input, unsigned short* output, const int width, const int height, const int channels,
+                                                    const vctDynamicVector<int> & kernel_horiz, const vctDynamicVector<int> & kernel_vert, bool absres,
+                                                    const int row_from, const int row_to)
+{
+    return ::ConvolutionSeparable(input, output, width, height, channels, kernel_horiz, kernel_vert, 65535, absres, row_from, row_to);
+}
+
 void svlImageProcessingHelper::UnsharpMaskBlurRGB(const unsigned char* img_in, unsigned char* img_out, const int width, const int height, int radius)
 {
     const int rowstride = width * 3;
@@ -1539,6 +1681,240 @@ void svlImageProcessingHelper::ResampleAndInterpolateVRGB24(unsigned char* src,
     }
 }
 
+namespace {
+    // Weights of an output sample add up to 1 << ResampleWeightBits
+    const int ResampleWeightBits = 12;
+
+    // Rows resampled horizontally by the calling thread, see ResamplerInternals::Resample
+    thread_local std::vector<int> ResampleRowBuffer;
+    thread_local std::vector<const int*> ResampleRowPointers;
+
+    // Source indices and weights of each output sample along one axis,
+    // stored as [sample * taps + tap].  Unused taps have zero weight and
+    // repeat the last source index.  Returns the number of taps.
+    int GetResampleTaps(const int srcsize, const int dstsize, const bool interpolation,
+                        std::vector<int> & indices, std::vector<int> & weights)
+    {
+        const int one = 1 << ResampleWeightBits;
+        const double scale = static_cast<double>(srcsize) / dstsize;
+        int taps, i, t;
+
+        if (!interpolation) {
+            // Nearest, same mapping as ResampleMono8 and ResampleRGB24
+            taps = 1;
+            indices.resize(dstsize);
+            weights.assign(dstsize, one);
+            for (i = 0; i < dstsize; i ++) {
+                indices[i] = static_cast<int>((static_cast<long long>(i) * srcsize) / dstsize);
+            }
+        }
+        else if (dstsize >= srcsize) {
+            // Bilinear, pixel centers are aligned and clamped at the borders
+            taps = 2;
+            indices.resize(dstsize * 2);
+            weights.resize(dstsize * 2);
+            for (i = 0; i < dstsize; i ++) {
+                double pos = (i + 0.5) * scale - 0.5;
+                if (pos < 0.0) pos = 0.0;
+                if (pos > srcsize - 1) pos = srcsize - 1;
+                const int index = static_cast<int>(pos);
+                const int weight = static_cast<int>((pos - index) * one + 0.5);
+                indices[i * 2]     = index;
+                indices[i * 2 + 1] = std::min(index + 1, srcsize - 1);
+                weights[i * 2]     = one - weight;
+                weights[i * 2 + 1] = weight;
+            }
+        }
+        else {
+            // Area averaging, each source sample is weighted by the part of
+            // it covered by the output sample
+            std::vector<int> first(dstsize), last(dstsize);
+            taps = 1;
+            for (i = 0; i < dstsize; i ++) {
+                const double start = i * scale;
+                const double end   = std::min(start + scale, static_cast<double>(srcsize));
+                first[i] = static_cast<int>(start);
+                last[i]  = std::max(first[i], std::min(static_cast<int>(ceil(end)), srcsize) - 1);
+                taps = std::max(taps, last[i] - first[i] + 1);
+            }
+            indices.resize(dstsize * taps);
+            weights.resize(dstsize * taps);
+            for (i = 0; i < dstsize; i ++) {
+                const double start = i * scale;
+                const double end   = std::min(start + scale, static_cast<double>(srcsize));
+                double covered = 0.0;
+                int assigned = 0;
+                for (t = 0; t < taps; t ++) {
+                    const int index = std::min(first[i] + t, last[i]);
+                    int weight = 0;
+                    if (first[i] + t <= last[i]) {
+                        covered += std::min(end, index + 1.0) - std::max(start, static_cast<double>(index));
+                        // Rounding the cumulative weight keeps the total exact
+                        const int cumulative = (index == last[i]) ? one : static_cast<int>(covered / scale * one + 0.5);
+                        weight = cumulative - assigned;
+                        assigned = cumulative;
+                    }
+                    indices[i * taps + t] = index;
+                    weights[i * taps + t] = weight;
+                }
+            }
+        }
+        return taps;
+    }
+
+    template <class _ValueType>
+    void ResampleRow(const svlImageProcessingHelper::ResamplerInternals & table, const _ValueType* input, int* output)
+    {
+        const int elements = table.DstWidth * table.Channels;
+        const int taps = table.HorizontalTaps;
+        const int shift = table.HorizontalShift;
+        const int bias = 1 << (shift - 1);
+        const int* indices = table.HorizontalIndices.Pointer();
+        const int* weights = table.HorizontalWeights.Pointer();
+
+        const int done = svlImageProcessingSIMD::ResampleRow(input, output, table.HorizontalGatherCount, elements,
+                                                             indices, weights, taps, bias, shift);
+        int i, t, sum;
+        for (i = done; i < elements; i ++) {
+            sum = bias;
+            for (t = 0; t < taps; t ++) {
+                sum += weights[t * elements + i] * input[indices[t * elements + i]];
+            }
+            output[i] = sum >> shift;
+        }
+    }
+
+    template <class _ValueType>
+    void ResampleRows(const svlImageProcessingHelper::ResamplerInternals & table, const _ValueType* src, _ValueType* dst,
+                      const int maxvalue, const int row_from, const int row_to)
+    {
+        if (row_from >= row_to) return;
+
+        const int src_rowstride = table.SrcWidth * table.Channels;
+        const int dst_rowstride = table.DstWidth * table.Channels;
+        const int taps = table.VerticalTaps;
+        const int shift = table.VerticalShift;
+        const int bias = 1 << (shift - 1);
+
+        ResampleRowBuffer.resize(static_cast<size_t>(taps) * dst_rowstride);
+        ResampleRowPointers.resize(taps);
+        int* buffer = &(ResampleRowBuffer[0]);
+        const int** rows = &(ResampleRowPointers[0]);
+
+        // next source row to resample horizontally, source row l is stored
+        // in slot (l % taps) of the ring buffer
+        int next = table.VerticalIndices[row_from * taps];
+        int i, t, sum;
+
+        for (int j = row_from; j < row_to; j ++) {
+            const int* indices = table.VerticalIndices.Pointer() + j * taps;
+            const int* weights = table.VerticalWeights.Pointer() + j * taps;
+
+            // source rows of an output row are within a window of taps rows
+            if (next < indices[0]) next = indices[0];
+            while (next <= indices[taps - 1]) {
+                ResampleRow(table, src + next * src_rowstride, buffer + (next % taps) * dst_rowstride);
+                next ++;
+            }
+            for (t = 0; t < taps; t ++) rows[t] = buffer + (indices[t] % taps) * dst_rowstride;
+
+            _ValueType* output = dst + j * dst_rowstride;
+            const int done = svlImageProcessingSIMD::ConvolutionColumn(rows, weights, taps, dst_rowstride,
+                                                                       bias, shift, false, output);
+            for (i = done; i < dst_rowstride; i ++) {
+                sum = bias;
+                for (t = 0; t < taps; t ++) sum += weights[t] * rows[t][i];
+                sum >>= shift;
+                if (sum > maxvalue) sum = maxvalue;
+                output[i] = static_cast<_ValueType>(sum);
+            }
+        }
+    }
+}
+
+
+/**********************************************************/
+/*** svlImageProcessingHelper::ResamplerInternals class ***/
+/**********************************************************/
+
+svlImageProcessingHelper::ResamplerInternals::ResamplerInternals() :
+    svlImageProcessingInternals(),
+    SrcWidth(0),
+    SrcHeight(0),
+    DstWidth(0),
+    DstHeight(0),
+    Channels(0),
+    Bytes(0),
+    Interpolation(false),
+    HorizontalTaps(0),
+    HorizontalGatherCount(0),
+    HorizontalShift(0),
+    VerticalTaps(0),
+    VerticalShift(0)
+{
+}
+
+void svlImageProcessingHelper::ResamplerInternals::Setup(const int srcwidth, const int srcheight, const int dstwidth, const int dstheight,
+                                                         const int channels, const int bytes, const bool interpolation)
+{
+    if (SrcWidth == srcwidth && SrcHeight == srcheight &&
+        DstWidth == dstwidth && DstHeight == dstheight &&
+        Channels == channels && Bytes == bytes && Interpolation == interpolation) return;
+
+    SrcWidth      = srcwidth;
+    SrcHeight     = srcheight;
+    DstWidth      = dstwidth;
+    DstHeight     = dstheight;
+    Channels      = channels;
+    Bytes         = bytes;
+    Interpolation = interpolation;
+
+    // Horizontal results keep 16 bits so vertical sums fit in 32 bits
+    HorizontalShift = ResampleWeightBits + 8 * bytes - 16;
+    VerticalShift   = 2 * ResampleWeightBits - HorizontalShift;
+
+    std::vector<int> indices, weights;
+    int i, c, t;
+
+    HorizontalTaps = GetResampleTaps(srcwidth, dstwidth, interpolation, indices, weights);
+    const int elements = dstwidth * channels;
+    HorizontalIndices.SetSize(HorizontalTaps * elements);
+    HorizontalWeights.SetSize(HorizontalTaps * elements);
+    for (t = 0; t < HorizontalTaps; t ++) {
+        for (i = 0; i < dstwidth; i ++) {
+            for (c = 0; c < channels; c ++) {
+                HorizontalIndices[t * elements + i * channels + c] = indices[i * HorizontalTaps + t] * channels + c;
+                HorizontalWeights[t * elements + i * channels + c] = weights[i * HorizontalTaps + t];
+            }
+        }
+    }
+
+    // The last tap has the largest source index of each element, the
+    // gather is used up to the first element reading past the source row
+    const int maxindex = (srcwidth * channels * bytes - 4) / bytes;
+    for (HorizontalGatherCount = 0; HorizontalGatherCount < elements; HorizontalGatherCount ++) {
+        if (HorizontalIndices[(HorizontalTaps - 1) * elements + HorizontalGatherCount] > maxindex) break;
+    }
+
+    VerticalTaps = GetResampleTaps(srcheight, dstheight, interpolation, indices, weights);
+    VerticalIndices.SetSize(VerticalTaps * dstheight);
+    VerticalWeights.SetSize(VerticalTaps * dstheight);
+    for (i = 0; i < VerticalTaps * dstheight; i ++) {
+        VerticalIndices[i] = indices[i];
+        VerticalWeights[i] = weights[i];
+    }
+}
+
+void svlImageProcessingHelper::ResamplerInternals::Resample(const unsigned char* src, unsigned char* dst, const int row_from, const int row_to) const
+{
+    ResampleRows(*this, src, dst, 255, row_from, row_to);
+}
+
+void svlImageProcessingHelper::ResamplerInternals::Resample(const unsigned short* src, unsigned short* dst, const int row_from, const int row_to) const
+{
+    ResampleRows(*this, src, dst, 65535, row_from, row_to);
+}
+
 void svlImageProcessingHelper::DeinterlaceBlending(unsigned char* buffer, const unsigned int width, const unsigned int height)
 {
     unsigned int i, j;
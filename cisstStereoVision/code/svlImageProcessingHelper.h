@@ -133,6 +133,17 @@ namespace svlImageProcessingHelper
     void CISST_EXPORT ConvolutionMono16(unsigned short* input, unsigned short* output, const int width, const int height, vctDynamicMatrix<int> & kernel, bool absres);
     void CISST_EXPORT ConvolutionMono32(unsigned int* input, unsigned int* output, const int width, const int height, vctDynamicMatrix<int> & kernel, bool absres);
 
+    // Separable convolution of the output rows [row_from, row_to), kernels are fixed point
+    // with 10 fractional bits.  Input rows are convolved horizontally into a ring buffer of
+    // kernel_vert.size() rows, then vertically, so bands of rows can be processed by
+    // different threads.  Returns false if intermediate results could overflow.
+    bool CISST_EXPORT ConvolutionSeparable(const unsigned char* input, unsigned char* output, const int width, const int height, const int channels,
+                                           const vctDynamicVector<int> & kernel_horiz, const vctDynamicVector<int> & kernel_vert, bool absres,
+                                           const int row_from, const int row_to);
+    bool CISST_EXPORT ConvolutionSeparable(const unsigned short* input, unsigned short* output, const int width, const int height, const int channels,
+                                           const vctDynamicVector<int> & kernel_horiz, const vctDynamicVector<int> & kernel_vert, bool absres,
+                                           const int row_from, const int row_to);
+
     //////////////////
     // Unsharp Mask //
     //////////////////
@@ -161,6 +172,51 @@ namespace svlImageProcessingHelper
                                       unsigned char* dst, const unsigned int dstheight,
                                       const unsigned int width);
 
+    // Resampling with precomputed weight tables.  Without interpolation the
+    // nearest source pixel is used, with interpolation each axis is either
+    // area averaged (downscaling) or bilinear (upscaling).  Weights of an
+    // output sample are fixed point and add up to exactly 1 << 12.
+    class CISST_EXPORT ResamplerInternals : public svlImageProcessingInternals
+    {
+    public:
+        ResamplerInternals();
+
+        // Will not do anything if parameters have not changed
+        void Setup(const int srcwidth, const int srcheight, const int dstwidth, const int dstheight,
+                   const int channels, const int bytes, const bool interpolation);
+
+        // Resamples the output rows [row_from, row_to).  Source rows are
+        // resampled horizontally into a ring buffer of VerticalTaps rows,
+        // then vertically, so bands of rows can be processed by different
+        // threads sharing the same tables.
+        void Resample(const unsigned char* src, unsigned char* dst, const int row_from, const int row_to) const;
+        void Resample(const unsigned short* src, unsigned short* dst, const int row_from, const int row_to) const;
+
+        int SrcWidth;
+        int SrcHeight;
+        int DstWidth;
+        int DstHeight;
+        int Channels;
+        int Bytes;
+        bool Interpolation;
+
+        // Source element index and weight of each tap of each output
+        // element, stored as [tap * DstWidth * Channels + element]
+        int HorizontalTaps;
+        vctDynamicVector<int> HorizontalIndices;
+        vctDynamicVector<int> HorizontalWeights;
+        // Number of leading output elements that can be gathered 4 bytes at a time
+        int HorizontalGatherCount;
+        int HorizontalShift;
+
+        // Source row and weight of each tap of each output row, stored as
+        // [row * VerticalTaps + tap]
+        int VerticalTaps;
+        vctDynamicVector<int> VerticalIndices;
+        vctDynamicVector<int> VerticalWeights;
+        int VerticalShift;
+    };
+
     ///////////////////
     // Deinterlacing //
     ///////////////////
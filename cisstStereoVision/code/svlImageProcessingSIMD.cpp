@@ -0,0 +1,302 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include "svlImageProcessingSIMD.h"
+#include "svlSIMD.h"
+#include <cisstStereoVision/svlConverters.h>
+
+#include <cstring>
+
+
+#if SVL_SIMD_X86
+
+namespace {
+
+/*************************************/
+/*** Widening loads ******************/
+/*************************************/
+
+    SVL_TARGET_SSE41 inline __m128i Load4(const unsigned char* input)
+    {
+        int value;
+        memcpy(&value, input, sizeof(value));
+        return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(value));
+    }
+
+    SVL_TARGET_SSE41 inline __m128i Load4(const unsigned short* input)
+    {
+        return _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input)));
+    }
+
+    SVL_TARGET_AVX2 inline __m256i Load8(const unsigned char* input)
+    {
+        return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input)));
+    }
+
+    SVL_TARGET_AVX2 inline __m256i Load8(const unsigned short* input)
+    {
+        return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input)));
+    }
+
+
+/*************************************/
+/*** Saturating stores ***************/
+/*************************************/
+
+    // packs_epi32 keeps the sign so packus_epi16 clamps to [0, 255]
+    SVL_TARGET_SSE41 inline void Store8(const __m128i lo, const __m128i hi, unsigned char* output)
+    {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm_packus_epi16(_mm_packs_epi32(lo, hi), _mm_setzero_si128()));
+    }
+
+    SVL_TARGET_SSE41 inline void Store8(const __m128i lo, const __m128i hi, unsigned short* output)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_packus_epi32(lo, hi));
+    }
+
+    // packing works per 128 bit lane, permute4x64 restores the order
+    SVL_TARGET_AVX2 inline void Store16(const __m256i lo, const __m256i hi, unsigned char* output)
+    {
+        const __m256i words = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xD8);
+        const __m128i bytes = _mm_packus_epi16(_mm256_castsi256_si128(words), _mm256_extracti128_si256(words, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), bytes);
+    }
+
+    SVL_TARGET_AVX2 inline void Store16(const __m256i lo, const __m256i hi, unsigned short* output)
+    {
+        const __m256i words = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xD8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), words);
+    }
+
+
+/*************************************/
+/*** Convolution kernels *************/
+/*************************************/
+
+    template <class _ValueType>
+    SVL_TARGET_SSE41 int ConvolutionRowSSE41(const _ValueType* input, int* output, const int count, const int stride,
+                                             const int* kernel, const int kernelsize, const int shift)
+    {
+        const __m128i shiftv = _mm_cvtsi32_si128(shift);
+        const int done = count & ~7;
+        for (int i = 0; i < done; i += 8) {
+            const _ValueType* in = input + i;
+            __m128i coeff = _mm_set1_epi32(kernel[0]);
+            __m128i lo = _mm_mullo_epi32(Load4(in), coeff);
+            __m128i hi = _mm_mullo_epi32(Load4(in + 4), coeff);
+            for (int k = 1; k < kernelsize; k ++) {
+                in += stride;
+                coeff = _mm_set1_epi32(kernel[k]);
+                lo = _mm_add_epi32(lo, _mm_mullo_epi32(Load4(in), coeff));
+                hi = _mm_add_epi32(hi, _mm_mullo_epi32(Load4(in + 4), coeff));
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_sra_epi32(lo, shiftv));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i + 4), _mm_sra_epi32(hi, shiftv));
+        }
+        return done;
+    }
+
+    template <class _ValueType>
+    SVL_TARGET_AVX2 int ConvolutionRowAVX2(const _ValueType* input, int* output, const int count, const int stride,
+                                           const int* kernel, const int kernelsize, const int shift)
+    {
+        const __m128i shiftv = _mm_cvtsi32_si128(shift);
+        const int done = count & ~15;
+        for (int i = 0; i < done; i += 16) {
+            const _ValueType* in = input + i;
+            __m256i coeff = _mm256_set1_epi32(kernel[0]);
+            __m256i lo = _mm256_mullo_epi32(Load8(in), coeff);
+            __m256i hi = _mm256_mullo_epi32(Load8(in + 8), coeff);
+            for (int k = 1; k < kernelsize; k ++) {
+                in += stride;
+                coeff = _mm256_set1_epi32(kernel[k]);
+                lo = _mm256_add_epi32(lo, _mm256_mullo_epi32(Load8(in), coeff));
+                hi = _mm256_add_epi32(hi, _mm256_mullo_epi32(Load8(in + 8), coeff));
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm256_sra_epi32(lo, shiftv));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i + 8), _mm256_sra_epi32(hi, shiftv));
+        }
+        return done;
+    }
+
+    template <class _ValueType>
+    SVL_TARGET_SSE41 int ConvolutionColumnSSE41(const int* const* rows, const int* kernel, const int kernelsize, const int count,
+                                                const int bias, const int shift, const bool absres, _ValueType* output)
+    {
+        const __m128i biasv = _mm_set1_epi32(bias);
+        const __m128i shiftv = _mm_cvtsi32_si128(shift);
+        const int done = count & ~7;
+        for (int i = 0; i < done; i += 8) {
+            __m128i lo = biasv;
+            __m128i hi = biasv;
+            for (int l = 0; l < kernelsize; l ++) {
+                const __m128i coeff = _mm_set1_epi32(kernel[l]);
+                const int* row = rows[l] + i;
+                lo = _mm_add_epi32(lo, _mm_mullo_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row)), coeff));
+                hi = _mm_add_epi32(hi, _mm_mullo_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + 4)), coeff));
+            }
+            lo = _mm_sra_epi32(lo, shiftv);
+            hi = _mm_sra_epi32(hi, shiftv);
+            if (absres) {
+                lo = _mm_abs_epi32(lo);
+                hi = _mm_abs_epi32(hi);
+            }
+            Store8(lo, hi, output + i);
+        }
+        return done;
+    }
+
+    template <class _ValueType>
+    SVL_TARGET_AVX2 int ConvolutionColumnAVX2(const int* const* rows, const int* kernel, const int kernelsize, const int count,
+                                              const int bias, const int shift, const bool absres, _ValueType* output)
+    {
+        const __m256i biasv = _mm256_set1_epi32(bias);
+        const __m128i shiftv = _mm_cvtsi32_si128(shift);
+        const int done = count & ~15;
+        for (int i = 0; i < done; i += 16) {
+            __m256i lo = biasv;
+            __m256i hi = biasv;
+            for (int l = 0; l < kernelsize; l ++) {
+                const __m256i coeff = _mm256_set1_epi32(kernel[l]);
+                const int* row = rows[l] + i;
+                lo = _mm256_add_epi32(lo, _mm256_mullo_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(row)), coeff));
+                hi = _mm256_add_epi32(hi, _mm256_mullo_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + 8)), coeff));
+            }
+            lo = _mm256_sra_epi32(lo, shiftv);
+            hi = _mm256_sra_epi32(hi, shiftv);
+            if (absres) {
+                lo = _mm256_abs_epi32(lo);
+                hi = _mm256_abs_epi32(hi);
+            }
+            Store16(lo, hi, output + i);
+        }
+        return done;
+    }
+
+
+/*************************************/
+/*** Resampling kernels **************/
+/*************************************/
+
+    // The gather reads 32 bits at each index, the mask keeps the element
+    template <class _ValueType>
+    SVL_TARGET_AVX2 int ResampleRowAVX2(const _ValueType* input, int* output, const int count, const int elements,
+                                        const int* indices, const int* weights, const int taps, const int bias, const int shift)
+    {
+        const __m256i mask = _mm256_set1_epi32((sizeof(_ValueType) == 1) ? 0xFF : 0xFFFF);
+        const __m256i biasv = _mm256_set1_epi32(bias);
+        const __m128i shiftv = _mm_cvtsi32_si128(shift);
+        const int* base = reinterpret_cast<const int*>(input);
+        const int done = count & ~7;
+        for (int i = 0; i < done; i += 8) {
+            __m256i sum = biasv;
+            for (int t = 0; t < taps; t ++) {
+                const int offset = t * elements + i;
+                const __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + offset));
+                const __m256i value = _mm256_and_si256(_mm256_i32gather_epi32(base, index, sizeof(_ValueType)), mask);
+                const __m256i weight = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights + offset));
+                sum = _mm256_add_epi32(sum, _mm256_mullo_epi32(value, weight));
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm256_sra_epi32(sum, shiftv));
+        }
+        return done;
+    }
+}
+
+#endif // SVL_SIMD_X86
+
+
+/*************************************/
+/*** Dispatch ************************/
+/*************************************/
+
+int svlImageProcessingSIMD::ConvolutionRow(const unsigned char* input, int* output, const int count, const int stride,
+                                           const int* kernel, const int kernelsize, const int shift)
+{
+#if SVL_SIMD_X86
+    switch (svlConverter::GetInstructionSet()) {
+        case svlConverter::INSTRUCTIONS_AVX2:  return ConvolutionRowAVX2(input, output, count, stride, kernel, kernelsize, shift);
+        case svlConverter::INSTRUCTIONS_SSE41: return ConvolutionRowSSE41(input, output, count, stride, kernel, kernelsize, shift);
+        default: break;
+    }
+#endif
+    return 0;
+}
+
+int svlImageProcessingSIMD::ConvolutionRow(const unsigned short* input, int* output, const int count, const int stride,
+                                           const int* kernel, const int kernelsize, const int shift)
+{
+#if SVL_SIMD_X86
+    switch (svlConverter::GetInstructionSet()) {
+        case svlConverter::INSTRUCTIONS_AVX2:  return ConvolutionRowAVX2(input, output, count, stride, kernel, kernelsize, shift);
+        case svlConverter::INSTRUCTIONS_SSE41: return ConvolutionRowSSE41(input, output, count, stride, kernel, kernelsize, shift);
+        default: break;
+    }
+#endif
+    return 0;
+}
+
+int svlImageProcessingSIMD::ConvolutionColumn(const int* const* rows, const int* kernel, const int kernelsize, const int count,
+                                              const int bias, const int shift, const bool absres, unsigned char* output)
+{
+#if SVL_SIMD_X86
+    switch (svlConverter::GetInstructionSet()) {
+        case svlConverter::INSTRUCTIONS_AVX2:  return ConvolutionColumnAVX2(rows, kernel, kernelsize, count, bias, shift, absres, output);
+        case svlConverter::INSTRUCTIONS_SSE41: return ConvolutionColumnSSE41(rows, kernel, kernelsize, count, bias, shift, absres, output);
+        default: break;
+    }
+#endif
+    return 0;
+}
+
+int svlImageProcessingSIMD::ConvolutionColumn(const int* const* rows, const int* kernel, const int kernelsize, const int count,
+                                              const int bias, const int shift, const bool absres, unsigned short* output)
+{
+#if SVL_SIMD_X86
+    switch (svlConverter::GetInstructionSet()) {
+        case svlConverter::INSTRUCTIONS_AVX2:  return ConvolutionColumnAVX2(rows, kernel, kernelsize, count, bias, shift, absres, output);
+        case svlConverter::INSTRUCTIONS_SSE41: return ConvolutionColumnSSE41(rows, kernel, kernelsize, count, bias, shift, absres, output);
+        default: break;
+    }
+#endif
+    return 0;
+}
+
+int svlImageProcessingSIMD::ResampleRow(const unsigned char* input, int* output, const int count, const int elements,
+                                        const int* indices, const int* weights, const int taps, const int bias, const int shift)
+{
+#if SVL_SIMD_X86
+    if (svlConverter::GetInstructionSet() == svlConverter::INSTRUCTIONS_AVX2) {
+        return ResampleRowAVX2(input, output, count, elements, indices, weights, taps, bias, shift);
+    }
+#endif
+    return 0;
+}
+
+int svlImageProcessingSIMD::ResampleRow(const unsigned short* input, int* output, const int count, const int elements,
+                                        const int* indices, const int* weights, const int taps, const int bias, const int shift)
+{
+#if SVL_SIMD_X86
+    if (svlConverter::GetInstructionSet() == svlConverter::INSTRUCTIONS_AVX2) {
+        return ResampleRowAVX2(input, output, count, elements, indices, weights, taps, bias, shift);
+    }
+#endif
+    return 0;
+}
@@ -0,0 +1,55 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#ifndef _svlImageProcessingSIMD_h
+#define _svlImageProcessingSIMD_h
+
+
+// SIMD kernels used by svlImageProcessingHelper, selected using
+// svlConverter::GetInstructionSet.  Each function processes the first
+// elements of a row and returns the number of elements processed, the
+// caller processes the remaining elements.  Functions return 0 if no
+// SIMD implementation is available.
+namespace svlImageProcessingSIMD
+{
+    // output[i] = (sum of kernel[k] * input[i + k * stride]) >> shift
+    int ConvolutionRow(const unsigned char* input, int* output, const int count, const int stride,
+                       const int* kernel, const int kernelsize, const int shift);
+    int ConvolutionRow(const unsigned short* input, int* output, const int count, const int stride,
+                       const int* kernel, const int kernelsize, const int shift);
+
+    // output[i] = (bias + sum of kernel[l] * rows[l][i]) >> shift, then
+    // either absolute value or clamped to 0, and clamped to maxvalue
+    int ConvolutionColumn(const int* const* rows, const int* kernel, const int kernelsize, const int count,
+                          const int bias, const int shift, const bool absres, unsigned char* output);
+    int ConvolutionColumn(const int* const* rows, const int* kernel, const int kernelsize, const int count,
+                          const int bias, const int shift, const bool absres, unsigned short* output);
+
+    // output[i] = (bias + sum of weights[t * elements + i] * input[indices[t * elements + i]]) >> shift
+    // The gather reads 4 bytes at each index, so for the first count
+    // elements all indices have to be at least 4 bytes from the end of the
+    // input.  Only AVX2 has a gather instruction.
+    int ResampleRow(const unsigned char* input, int* output, const int count, const int elements,
+                    const int* indices, const int* weights, const int taps, const int bias, const int shift);
+    int ResampleRow(const unsigned short* input, int* output, const int count, const int elements,
+                    const int* indices, const int* weights, const int taps, const int bias, const int shift);
+}
+
+#endif // _svlImageProcessingSIMD_h
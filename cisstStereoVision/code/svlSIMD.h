@@ -0,0 +1,42 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#ifndef _svlSIMD_h
+#define _svlSIMD_h
+
+// Compiler support for the SIMD kernels.  Kernels are compiled for
+// their own instruction set using SVL_TARGET_SSE41 or SVL_TARGET_AVX2
+// and called only after checking svlConverter::GetInstructionSet.
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define SVL_SIMD_X86 1
+    #include <immintrin.h>
+    #if defined(__GNUC__) || defined(__clang__)
+        #define SVL_TARGET_SSE41 __attribute__((target("sse4.1")))
+        #define SVL_TARGET_AVX2  __attribute__((target("avx2")))
+    #else
+        #include <intrin.h>
+        #define SVL_TARGET_SSE41
+        #define SVL_TARGET_AVX2
+    #endif
+#else
+    #define SVL_SIMD_X86 0
+#endif
+
+#endif // _svlSIMD_h
@@ -0,0 +1,246 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#include <cisstStereoVision/svlSamplePool.h>
+
+
+/****************************/
+/*** svlSamplePool class ****/
+/****************************/
+
+svlSamplePool::svlSamplePool() :
+    CopyCount(0),
+    CopiedBytes(0),
+    ShareCount(0),
+    RateCopyCount(0),
+    RateTime(-1.0),
+    CopyRate(0.0)
+{
+}
+
+svlSamplePool::~svlSamplePool()
+{
+    for (ReferenceMapType::iterator it = References.begin(); it != References.end(); ++ it) {
+        if (it->second > 0) {
+            CMN_LOG_INIT_WARNING << "svlSamplePool: sample deleted while still referenced ("
+                                 << it->second << " reference(s))" << std::endl;
+        }
+        delete it->first;
+    }
+}
+
+svlSample* svlSamplePool::Acquire(svlStreamType type)
+{
+    svlSample* sample = 0;
+
+    CS.Enter();
+        for (ReferenceMapType::iterator it = References.begin(); it != References.end(); ++ it) {
+            if (it->second == 0 && it->first->GetType() == type) {
+                sample = const_cast<svlSample*>(it->first);
+                it->second = 1;
+                break;
+            }
+        }
+    CS.Leave();
+
+    if (!sample) {
+        sample = svlSample::GetNewFromType(type);
+        if (!sample) return 0;
+
+        CS.Enter();
+            References[sample] = 1;
+        CS.Leave();
+    }
+
+    return sample;
+}
+
+svlSample* svlSamplePool::Acquire(const svlSample* prototype)
+{
+    if (!prototype) return 0;
+
+    const svlStreamType type = prototype->GetType();
+    const unsigned int datasize = prototype->GetDataSize();
+    svlSample* sample = 0;
+    ReferenceMapType::iterator it, candidate = References.end();
+
+    // Samples of the same size don't need to be reallocated
+    CS.Enter();
+        for (it = References.begin(); it != References.end(); ++ it) {
+            if (it->second == 0 && it->first->GetType() == type) {
+                candidate = it;
+                if (it->first->GetDataSize() == datasize) break;
+            }
+        }
+        if (candidate != References.end()) {
+            sample = const_cast<svlSample*>(candidate->first);
+            candidate->second = 1;
+        }
+    CS.Leave();
+
+    if (!sample) {
+        sample = svlSample::GetNewFromType(type);
+        if (!sample) return 0;
+
+        CS.Enter();
+            References[sample] = 1;
+        CS.Leave();
+    }
+    sample->SetSize(prototype);
+
+    return sample;
+}
+
+bool svlSamplePool::AddReference(const svlSample* sample)
+{
+    bool result = false;
+
+    CS.Enter();
+        ReferenceMapType::iterator it = References.find(sample);
+        if (it != References.end() && it->second > 0) {
+            it->second ++;
+            ShareCount ++;
+            result = true;
+        }
+    CS.Leave();
+
+    return result;
+}
+
+bool svlSamplePool::Release(const svlSample* sample)
+{
+    bool result = false;
+
+    CS.Enter();
+        ReferenceMapType::iterator it = References.find(sample);
+        if (it != References.end() && it->second > 0) {
+            it->second --;
+            result = true;
+        }
+    CS.Leave();
+
+    return result;
+}
+
+svlSample* svlSamplePool::GetWritable(svlSample* sample)
+{
+    CS.Enter();
+        ReferenceMapType::iterator it = References.find(sample);
+        if (it == References.end() || it->second <= 1) {
+            CS.Leave();
+            return sample;
+        }
+        // Other references keep the sample out of reach of Acquire
+        it->second --;
+    CS.Leave();
+
+    return Acquire(sample);
+}
+
+bool svlSamplePool::Owns(const svlSample* sample)
+{
+    CS.Enter();
+        const bool result = (References.find(sample) != References.end());
+    CS.Leave();
+
+    return result;
+}
+
+bool svlSamplePool::IsShared(const svlSample* sample)
+{
+    bool result = false;
+
+    CS.Enter();
+        ReferenceMapType::iterator it = References.find(sample);
+        if (it != References.end()) result = (it->second > 1);
+    CS.Leave();
+
+    return result;
+}
+
+void svlSamplePool::AddCopy(const svlSample* sample)
+{
+    if (!sample) return;
+
+    CS.Enter();
+        CopyCount ++;
+        CopiedBytes += sample->GetDataSize();
+    CS.Leave();
+}
+
+void svlSamplePool::UpdateCopyRate(double time)
+{
+    CS.Enter();
+        if (RateTime < 0.0 || time < RateTime) {
+            RateTime = time;
+            RateCopyCount = CopyCount;
+        }
+        else if (time - RateTime >= 1.0) {
+            CopyRate = (CopyCount - RateCopyCount) / (time - RateTime);
+            RateTime = time;
+            RateCopyCount = CopyCount;
+        }
+    CS.Leave();
+}
+
+unsigned int svlSamplePool::GetSampleCount()
+{
+    CS.Enter();
+        const unsigned int count = static_cast<unsigned int>(References.size());
+    CS.Leave();
+
+    return count;
+}
+
+unsigned long long svlSamplePool::GetCopyCount()
+{
+    CS.Enter();
+        const unsigned long long count = CopyCount;
+    CS.Leave();
+
+    return count;
+}
+
+unsigned long long svlSamplePool::GetCopiedBytes()
+{
+    CS.Enter();
+        const unsigned long long bytes = CopiedBytes;
+    CS.Leave();
+
+    return bytes;
+}
+
+unsigned long long svlSamplePool::GetShareCount()
+{
+    CS.Enter();
+        const unsigned long long count = ShareCount;
+    CS.Leave();
+
+    return count;
+}
+
+double svlSamplePool::GetCopyRate()
+{
+    CS.Enter();
+        const double rate = CopyRate;
+    CS.Leave();
+
+    return rate;
+}
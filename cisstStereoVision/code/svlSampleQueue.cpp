@@ -20,6 +20,7 @@ http://www.cisst.org/cisst/license.txt.
 */
 
 #include <cisstStereoVision/svlSampleQueue.h>
+#include <cisstStereoVision/svlSamplePool.h>
 
 
 /****************************/
@@ -30,37 +31,65 @@ svlSampleQueue::svlSampleQueue(svlStreamType type, unsigned int size) :
     Type(type),
     Size(std::max(size, 2u)), // TO DO: check why it doesn't work when min=1
     DroppedSamples(0),
-    UnusedItems(Size, 0)
+    OwnedItems(Size + 1, 0),
+    Pool(0)
 {
-    PullItem = svlSample::GetNewFromType(type);
-    for (std::list<svlSample*>::iterator it = UnusedItems.begin();
-         it != UnusedItems.end();
+    for (std::list<svlSample*>::iterator it = OwnedItems.begin();
+         it != OwnedItems.end();
          ++ it) {
         *it = svlSample::GetNewFromType(type);
     }
+    PullItem = OwnedItems.front();
+    UnusedItems.assign(++ OwnedItems.begin(), OwnedItems.end());
 }
 
 svlSampleQueue::~svlSampleQueue()
 {
-    delete PullItem;
-    for (std::list<svlSample*>::iterator it = UnusedItems.begin();
-         it != UnusedItems.end();
+    // Samples queued by reference belong to the pool
+    for (std::list<svlSample*>::iterator it = OwnedItems.begin();
+         it != OwnedItems.end();
          ++ it) {
         delete *it;
     }
 }
 
+void svlSampleQueue::SetPool(svlSamplePool* pool)
+{
+    CS.Enter();
+        if (Pool && Pool != pool) {
+            std::list<svlSample*>::iterator it = BufferedItems.begin();
+            while (it != BufferedItems.end()) {
+                if (Pool->Release(*it)) it = BufferedItems.erase(it);
+                else ++ it;
+            }
+            if (Pool->Release(PullItem)) {
+                PullItem = UnusedItems.front();
+                UnusedItems.pop_front();
+            }
+        }
+        Pool = pool;
+    CS.Leave();
+}
+
+void svlSampleQueue::DropOldest()
+{
+    svlSample* item = BufferedItems.back();
+    BufferedItems.pop_back();
+    if (!Pool || !Pool->Release(item)) UnusedItems.push_front(item);
+    DroppedSamples ++;
+}
+
 bool svlSampleQueue::Push(const svlSample* sample)
 {
     if (sample->GetType() != Type) return false;
 
     svlSample* push_item;
+    const bool shared = Pool && Pool->AddReference(sample);
 
     CS.Enter();
-        if (UnusedItems.empty()) {
-            push_item = BufferedItems.back();
-            BufferedItems.pop_back();
-            DroppedSamples ++;
+        while (BufferedItems.size() >= Size) DropOldest();
+        if (shared) {
+            push_item = const_cast<svlSample*>(sample);
         }
         else {
             push_item = UnusedItems.front();
@@ -68,7 +97,10 @@ bool svlSampleQueue::Push(const svlSample* sample)
         }
     CS.Leave();
 
-    push_item->CopyOf(sample);
+    if (!shared) {
+        push_item->CopyOf(sample);
+        if (Pool) Pool->AddCopy(sample);
+    }
 
     CS.Enter();
         BufferedItems.push_front(push_item);
@@ -89,7 +121,7 @@ svlSample* svlSampleQueue::Pull(double timeout)
     }
 
     CS.Enter();
-        UnusedItems.push_front(PullItem);
+        if (!Pool || !Pool->Release(PullItem)) UnusedItems.push_front(PullItem);
         PullItem = BufferedItems.back();
         BufferedItems.pop_back();
 
@@ -97,9 +129,26 @@ svlSample* svlSampleQueue::Pull(double timeout)
         if (BufferedItems.empty() && !is_event_reset) NewSampleEvent.Wait(0.0);
     CS.Leave();
 
+    FreeSpaceEvent.Raise();
+
     return PullItem;
 }
 
+bool svlSampleQueue::WaitForSpace(double timeout)
+{
+    bool full;
+
+    while (1) {
+        CS.Enter();
+            full = (BufferedItems.size() >= Size);
+        CS.Leave();
+        if (!full) return true;
+
+        // The event may have been raised before the queue got full again
+        if (FreeSpaceEvent.Wait(timeout) == false) return false;
+    }
+}
+
 svlStreamType svlSampleQueue::GetType()
 {
     return Type;
@@ -112,7 +161,7 @@ unsigned int svlSampleQueue::GetLength()
 
 unsigned int svlSampleQueue::GetUsage()
 {
-    return Size - static_cast<unsigned int>(UnusedItems.size());
+    return static_cast<unsigned int>(BufferedItems.size());
 }
 
 double svlSampleQueue::GetUsageRatio()
@@ -26,6 +26,9 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstStereoVision/svlFilterBase.h>
 #include <cisstStereoVision/svlFilterSourceBase.h>
 #include <cisstStereoVision/svlStreamProc.h>
+#include <cisstStereoVision/svlSamplePool.h>
+#include <cisstStereoVision/svlSampleQueue.h>
+#include <cisstStereoVision/svlStreamBranchSource.h>
 
 #include <cisstOSAbstraction/osaSleep.h>
 #include <cisstOSAbstraction/osaThread.h>
@@ -44,9 +47,15 @@ svlStreamManager::svlStreamManager() :
     ThreadCount(1),
     SyncPoint(0),
     CS(0),
+    SamplePool(new svlSamplePool),
+    ParentStream(0),
+    PipelineStages(1),
+    StageCS(new osaCriticalSection),
     StreamSource(0),
     Initialized(false),
     Running(false),
+    StopThread(false),
+    InternalStopping(false),
     StreamStatus(SVL_STREAM_CREATED)
 {
     CreateInterfaces();
@@ -56,9 +65,15 @@ svlStreamManager::svlStreamManager(unsigned int threadcount) :
     ThreadCount(std::max(1u, threadcount)),
     SyncPoint(0),
     CS(0),
+    SamplePool(new svlSamplePool),
+    ParentStream(0),
+    PipelineStages(1),
+    StageCS(new osaCriticalSection),
     StreamSource(0),
     Initialized(false),
     Running(false),
+    StopThread(false),
+    InternalStopping(false),
     StreamStatus(SVL_STREAM_CREATED)
 {
     CreateInterfaces();
@@ -68,6 +83,8 @@ svlStreamManager::svlStreamManager(unsigned int threadcount) :
 svlStreamManager::~svlStreamManager()
 {
     Release();
+    delete SamplePool;
+    delete StageCS;
 }
 
 int svlStreamManager::SetSourceFilter(svlFilterSourceBase * source)
@@ -121,7 +138,11 @@ int svlStreamManager::Initialize(void)
         return SVL_NO_SOURCE_IN_LIST;
     }
 
+    err = SetupPipelineStages();
+    if (err != SVL_OK) return err;
+
     // Initialize the stream, starting from the stream source
+    SetupFilterPool(source);
     err = source->Initialize(outputsample);
     if (err != SVL_OK) {
         Release();
@@ -179,6 +200,7 @@ int svlStreamManager::Initialize(void)
                                      << output->GetName() << "\"" << std::endl;
             return err;
         }
+        SetupFilterPool(filter);
         err = filter->Initialize(inputsample, outputsample);
         if (err != SVL_OK) {
             Release();
@@ -279,6 +301,7 @@ void svlStreamManager::Release(void)
                 }
             }
         }
+        ReleaseFilterPool(filter);
 
         // Get next filter in the trunk
         output = filter->GetOutput();
@@ -296,6 +319,219 @@ void svlStreamManager::Release(void)
 }
 
 
+void svlStreamManager::SetupFilterPool(svlFilterBase* filter)
+{
+    svlSamplePool* pool = GetSamplePool();
+    filter->SamplePool = pool;
+
+    // Stream branches share the pool, so their queues can hold references.
+    // Buffered inputs of other filters can hold references as well.
+    mtsComponent::InterfacesOutputMapType::iterator iteroutputs;
+    svlFilterOutput * output;
+    for (iteroutputs = filter->InterfacesOutput.begin();
+         iteroutputs != filter->InterfacesOutput.end();
+         iteroutputs ++) {
+        output = dynamic_cast<svlFilterOutput *>(iteroutputs->second);
+        if (output && !output->IsTrunk()) {
+            if (output->Stream) output->Stream->ParentStream = this;
+            if (output->BranchSource) output->BranchSource->SampleQueue.SetPool(pool);
+            else if (output->Connection && output->Connection->Buffer) output->Connection->Buffer->SetPool(pool);
+        }
+    }
+}
+
+void svlStreamManager::ReleaseFilterPool(svlFilterBase* filter)
+{
+    if (filter->InputCopy) {
+        if (filter->SamplePool) filter->SamplePool->Release(filter->InputCopy);
+        filter->InputCopy = 0;
+    }
+    filter->ProcessInput = 0;
+    filter->SamplePool = 0;
+
+    mtsComponent::InterfacesOutputMapType::iterator iteroutputs;
+    svlFilterOutput * output;
+    for (iteroutputs = filter->InterfacesOutput.begin();
+         iteroutputs != filter->InterfacesOutput.end();
+         iteroutputs ++) {
+        output = dynamic_cast<svlFilterOutput *>(iteroutputs->second);
+        if (output && !output->IsTrunk()) {
+            if (output->BranchSource) output->BranchSource->SampleQueue.SetPool(0);
+            else if (output->Connection && output->Connection->Buffer) output->Connection->Buffer->SetPool(0);
+        }
+    }
+}
+
+
+svlStreamManager::PipelineStage::PipelineStage(svlFilterBase* filter, unsigned int threadcount, unsigned int queuesize) :
+    Filter(filter),
+    ThreadCount(threadcount),
+    QueueSize(queuesize),
+    FirstThread(0),
+    SyncPoint(0),
+    CS(0),
+    Queue(0),
+    Input(0),
+    UpstreamFinished(false),
+    FrameCount(0),
+    ProcTime(0.0),
+    WaitTime(0.0)
+{
+}
+
+int svlStreamManager::SetupPipelineStages(void)
+{
+    std::vector<PipelineStage> stages(1, PipelineStage(StreamSource, ThreadCount));
+    svlFilterOutput * output;
+    svlFilterInput * input;
+    size_t i;
+
+    // Sort the stages in the order of the trunk
+    svlFilterBase *filter = StreamSource;
+    while (filter) {
+        for (i = 1; i < PipelineStages.size(); i ++) {
+            if (PipelineStages[i].Filter == filter) stages.push_back(PipelineStages[i]);
+        }
+
+        // Get next filter in the trunk
+        output = filter->GetOutput();
+        filter = 0;
+        // Check if trunk output exists
+        if (output) {
+            input = output->Connection;
+            // Check if trunk output is connected to a trunk input
+            if (input && input->Trunk) filter = input->Filter;
+        }
+    }
+
+    if (stages.size() != PipelineStages.size()) {
+        CMN_LOG_CLASS_INIT_ERROR << "Initialize: stream \"" << this->GetName()
+                                 << "\" has a pipeline stage starting at a filter that is not in the trunk" << std::endl;
+        return SVL_FAIL;
+    }
+    PipelineStages = stages;
+
+    return SVL_OK;
+}
+
+void svlStreamManager::CreatePipelineStages(void)
+{
+    unsigned int threadcount = 0;
+
+    for (size_t i = 0; i < PipelineStages.size(); i ++) {
+        PipelineStage & stage = PipelineStages[i];
+
+        stage.FirstThread = threadcount;
+        threadcount += stage.ThreadCount;
+
+        if (i == 0) {
+            // The first stage runs on the threads of the stream
+            stage.SyncPoint = SyncPoint;
+            stage.CS = CS;
+        }
+        else {
+            if (stage.ThreadCount > 1) {
+                stage.SyncPoint = new svlSyncPoint;
+                stage.SyncPoint->Count(stage.ThreadCount);
+                stage.CS = new osaCriticalSection;
+            }
+            stage.Queue = new svlSampleQueue(stage.Filter->GetInput()->GetType(), stage.QueueSize);
+            stage.Queue->SetPool(GetSamplePool());
+        }
+
+        stage.Input = 0;
+        stage.UpstreamFinished = false;
+        stage.FrameCount = 0;
+        stage.ProcTime = 0.0;
+        stage.WaitTime = 0.0;
+    }
+}
+
+void svlStreamManager::ReleasePipelineStages(void)
+{
+    for (size_t i = 0; i < PipelineStages.size(); i ++) {
+        PipelineStage & stage = PipelineStages[i];
+
+        if (i > 0) {
+            if (stage.SyncPoint) delete stage.SyncPoint;
+            if (stage.CS) delete stage.CS;
+            if (stage.Queue) {
+                // Return the queued frames to the sample pool
+                stage.Queue->SetPool(0);
+                delete stage.Queue;
+            }
+        }
+        stage.SyncPoint = 0;
+        stage.CS = 0;
+        stage.Queue = 0;
+        stage.Input = 0;
+    }
+}
+
+int svlStreamManager::AddPipelineStage(svlFilterBase* filter, unsigned int threadcount, unsigned int queuesize)
+{
+    if (filter == 0 || filter == StreamSource) {
+        CMN_LOG_CLASS_INIT_ERROR << "AddPipelineStage: invalid filter provided for stream \""
+                                 << this->GetName() << "\"" << std::endl;
+        return SVL_FAIL;
+    }
+    if (Initialized) {
+        CMN_LOG_CLASS_INIT_ERROR << "AddPipelineStage: stream \"" << this->GetName()
+                                 << "\" is already initialized, can't change pipeline stages" << std::endl;
+        return SVL_ALREADY_INITIALIZED;
+    }
+
+    threadcount = std::max(1u, threadcount);
+    for (size_t i = 1; i < PipelineStages.size(); i ++) {
+        if (PipelineStages[i].Filter == filter) {
+            PipelineStages[i].ThreadCount = threadcount;
+            PipelineStages[i].QueueSize = queuesize;
+            return SVL_OK;
+        }
+    }
+    PipelineStages.push_back(PipelineStage(filter, threadcount, queuesize));
+
+    return SVL_OK;
+}
+
+void svlStreamManager::RemovePipelineStages(void)
+{
+    if (Initialized) {
+        CMN_LOG_CLASS_INIT_ERROR << "RemovePipelineStages: stream \"" << this->GetName()
+                                 << "\" is already initialized, can't change pipeline stages" << std::endl;
+        return;
+    }
+    PipelineStages.resize(1);
+}
+
+unsigned int svlStreamManager::GetPipelineStageCount(void) const
+{
+    return static_cast<unsigned int>(PipelineStages.size());
+}
+
+int svlStreamManager::GetPipelineStageTiming(unsigned int stage, double & proctime, double & waittime) const
+{
+    if (stage >= PipelineStages.size()) return SVL_FAIL;
+
+    // Snapshot, the stage threads update the timing after each frame
+    StageCS->Enter();
+        const unsigned int count = PipelineStages[stage].FrameCount;
+        proctime = PipelineStages[stage].ProcTime;
+        waittime = PipelineStages[stage].WaitTime;
+    StageCS->Leave();
+
+    if (count > 0) {
+        proctime /= count;
+        waittime /= count;
+    }
+    else {
+        proctime = waittime = 0.0;
+    }
+
+    return SVL_OK;
+}
+
+
 bool svlStreamManager::IsInitialized(void) const
 {
     return Initialized;
@@ -334,9 +570,11 @@ int svlStreamManager::Play(void)
 
     // Call OnStart for all filters in the trunk
     svlFilterBase * filter = StreamSource;
+    unsigned int stage = 0;
     while (filter) {
+        if (stage + 1 < PipelineStages.size() && PipelineStages[stage + 1].Filter == filter) stage ++;
         filter->Running = true;
-        if (filter->OnStart(ThreadCount) != SVL_OK) {
+        if (filter->OnStart(PipelineStages[stage].ThreadCount) != SVL_OK) {
             Stop();
             CMN_LOG_CLASS_RUN_ERROR << "Play: filter \"" << filter->GetName()
                                     << "\" \"OnStart\" method failed while starting stream \""
@@ -373,29 +611,36 @@ int svlStreamManager::Play(void)
         }
     }
 
-    // Allocate new thread control object array
-    StreamProcInstance.SetSize(ThreadCount);
-    StreamProcThread.SetSize(ThreadCount);
-
     // Create thread synchronization object
     if (ThreadCount > 1) {
         SyncPoint = new svlSyncPoint;
         SyncPoint->Count(ThreadCount);
         CS = new osaCriticalSection;
     }
+    CreatePipelineStages();
+
+    // Allocate new thread control object array
+    const unsigned int threadcount = PipelineStages.back().FirstThread + PipelineStages.back().ThreadCount;
+    StreamProcInstance.SetSize(threadcount);
+    StreamProcThread.SetSize(threadcount);
 
     StopThread = false;
+    InternalStopping = false;
     StreamStatus = SVL_STREAM_RUNNING;
 
     // Initialize media control events
     if (StreamSource->PlayCounter != 0) StreamSource->PauseAtFrameID = -1;
     else StreamSource->PauseAtFrameID = 0;
 
-    for (i = 0; i < ThreadCount; i ++) {
-        // Starting multi thread processing
-        StreamProcInstance[i] = new svlStreamProc(ThreadCount, static_cast<unsigned int>(i));
-        StreamProcThread[i] = new osaThread;
-        StreamProcThread[i]->Create<svlStreamProc, svlStreamManager*>(StreamProcInstance[i], &svlStreamProc::Proc, this);
+    for (stage = 0; stage < PipelineStages.size(); stage ++) {
+        const unsigned int stagethreads = PipelineStages[stage].ThreadCount;
+        for (i = 0; i < stagethreads; i ++) {
+            // Starting multi thread processing
+            const size_t id = PipelineStages[stage].FirstThread + i;
+            StreamProcInstance[id] = new svlStreamProc(stagethreads, static_cast<unsigned int>(i), stage);
+            StreamProcThread[id] = new osaThread;
+            StreamProcThread[id]->Create<svlStreamProc, svlStreamManager*>(StreamProcInstance[id], &svlStreamProc::Proc, this);
+        }
     }
 
     // Start all filter outputs recursively, if any
@@ -505,7 +750,7 @@ void svlStreamManager::Stop(void)
                                                       mtsComponentState::READY));
 
     // Stopping multi thread processing and delete thread objects
-    for (size_t i = 0; i < ThreadCount; i ++) {
+    for (size_t i = 0; i < StreamProcThread.size(); i ++) {
         if (StreamProcThread[i]) {
             StreamProcThread[i]->Wait();
             delete StreamProcThread[i];
@@ -528,6 +773,7 @@ void svlStreamManager::Stop(void)
         delete CS;
         CS = 0;
     }
+    ReleasePipelineStages();
 
     // Call OnStop for all filters in the trunk
     filter = StreamSource;
@@ -612,7 +858,7 @@ void svlStreamManager::InternalStop(unsigned int callingthreadID)
                                                       mtsComponentState::READY));
 
     // Stopping multi thread processing and delete thread objects
-    for (size_t i = 0; i < ThreadCount; i ++) {
+    for (size_t i = 0; i < StreamProcThread.size(); i ++) {
         if (i != callingthreadID) {
             if (StreamProcThread[i]) {
                 StreamProcThread[i]->Wait();
@@ -639,6 +885,7 @@ void svlStreamManager::InternalStop(unsigned int callingthreadID)
         delete CS;
         CS = 0;
     }
+    ReleasePipelineStages();
 
     // Call OnStop for all filters in the trunk
     filter = StreamSource;
@@ -678,6 +925,22 @@ int svlStreamManager::GetStreamStatus(void) const
     return StreamStatus;
 }
 
+svlSamplePool* svlStreamManager::GetSamplePool(void) const
+{
+    if (ParentStream) return ParentStream->GetSamplePool();
+    return SamplePool;
+}
+
+unsigned long long svlStreamManager::GetFrameCopyCount(void) const
+{
+    return GetSamplePool()->GetCopyCount();
+}
+
+double svlStreamManager::GetFrameCopyRate(void) const
+{
+    return GetSamplePool()->GetCopyRate();
+}
+
 void svlStreamManager::DisconnectAll(void)
 {
     // First make sure that the stream is released
@@ -727,6 +990,9 @@ void svlStreamManager::CreateInterfaces(void)
         interfaceProvided->AddCommandVoid(&svlStreamManager::PlayCommand, this, "Play");
         interfaceProvided->AddCommandVoid(&svlStreamManager::InitializeCommand, this, "Initialize");
         interfaceProvided->AddCommandVoid(&svlStreamManager::Release, this, "Release");
+        interfaceProvided->AddCommandRead(&svlStreamManager::GetFrameCopyRateCommand, this, "GetFrameCopyRate");
+        interfaceProvided->AddCommandRead(&svlStreamManager::GetPipelineStageProcTimeCommand, this, "GetPipelineStageProcTime");
+        interfaceProvided->AddCommandRead(&svlStreamManager::GetPipelineStageWaitTimeCommand, this, "GetPipelineStageWaitTime");
     }
 }
 
@@ -746,6 +1012,29 @@ void svlStreamManager::InitializeCommand(void)
     }
 }
 
+void svlStreamManager::GetFrameCopyRateCommand(double & rate) const
+{
+    rate = GetFrameCopyRate();
+}
+
+void svlStreamManager::GetPipelineStageProcTimeCommand(vctDoubleVec & proctime) const
+{
+    double waittime;
+    proctime.SetSize(PipelineStages.size());
+    for (unsigned int i = 0; i < proctime.size(); i ++) {
+        GetPipelineStageTiming(i, proctime[i], waittime);
+    }
+}
+
+void svlStreamManager::GetPipelineStageWaitTimeCommand(vctDoubleVec & waittime) const
+{
+    double proctime;
+    waittime.SetSize(PipelineStages.size());
+    for (unsigned int i = 0; i < waittime.size(); i ++) {
+        GetPipelineStageTiming(i, proctime, waittime[i]);
+    }
+}
+
 void svlStreamManager::SetSourceFilterCommand(const mtsStdString & source)
 {
     // look for the source in the component manager
@@ -25,17 +25,21 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstStereoVision/svlStreamBranchSource.h>
 #include <cisstStereoVision/svlFilterInput.h>
 #include <cisstStereoVision/svlFilterOutput.h>
+#include <cisstStereoVision/svlSamplePool.h>
 #include <cisstOSAbstraction/osaTimeServer.h>
+#include <cisstOSAbstraction/osaGetTime.h>
 #include <cisstOSAbstraction/osaSleep.h>
+#include <cisstOSAbstraction/osaTrace.h>
 
 
 /*****************************/
 /*** svlStreamProc class *****/
 /*****************************/
 
-svlStreamProc::svlStreamProc(unsigned int threadcount, unsigned int threadid) :
+svlStreamProc::svlStreamProc(unsigned int threadcount, unsigned int threadid, unsigned int stage) :
     ThreadID(threadid),
-    ThreadCount(threadcount)
+    ThreadCount(threadcount),
+    Stage(stage)
 {
 }
 
@@ -59,19 +63,30 @@ void* svlStreamProc::Proc(svlStreamManager* baseref)
     svlFilterOutput* output;
     svlFilterInput* input;
     svlProcInfo info;
-    svlSyncPoint *sync = baseref->SyncPoint;
+    svlStreamManager::PipelineStage &stage = baseref->PipelineStages[Stage];
+    svlStreamManager::PipelineStage *nextstage = 0;
+    svlFilterBase *stageend = 0;
+    svlSyncPoint *sync = stage.SyncPoint;
+    svlSamplePool* pool = baseref->GetSamplePool();
     unsigned int counter = 0;
     osaTimeServer* timeserver = 0;
-    double timestamp;
+    double timestamp, time, starttime = 0.0, waittime = 0.0;
+    bool handoff, finished;
     int status = SVL_OK;
 
+    // The trunk ends at the first filter of the next pipeline stage
+    if (Stage + 1 < baseref->PipelineStages.size()) {
+        nextstage = &(baseref->PipelineStages[Stage + 1]);
+        stageend = nextstage->Filter;
+    }
+
     // Initializing thread info structure
     info.count = ThreadCount;
     info.ID    = ThreadID;
     info.sync  = sync;
-    info.cs    = baseref->CS;
+    info.cs    = stage.CS;
 
-    if (ThreadID == 0) {
+    if (Stage == 0 && ThreadID == 0) {
     // Execute only on one thread - BEGIN
 
         // Initialize time server for accessing absolute time
@@ -82,22 +97,77 @@ void* svlStreamProc::Proc(svlStreamManager* baseref)
     }
 
     while (baseref->StopThread == false) {
-        source->FrameCounter = counter;
         outputsample = 0;
+        handoff = false;
+        if (ThreadID == 0) {
+            starttime = osaGetTime();
+            waittime = 0.0;
+        }
+
+        if (Stage == 0) {
+            source->FrameCounter = counter;
 
-    ///////////////////////////////////////
-    // Handle stream control (pause/play)
+        ///////////////////////////////////////
+        // Handle stream control (pause/play)
+
+            if (source->PauseAtFrameID == static_cast<int>(counter)) {
+                if (ThreadID == 0) {
+                    // Wait until playback resumed or stream stopped
+                    while (source->PlayCounter == 0 && baseref->StopThread == false) {
+                        osaSleep(0.1); // check 10 times a second
+                    }
+                    if (baseref->StopThread) {
+                        CMN_LOG_INIT_DEBUG << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << source->GetName() << "\"): stream stopped while paused" << std::endl;
+                        break;
+                    }
+                }
+
+                if (ThreadCount > 1) {
+                // Execute only if multi-threaded - BEGIN
+
+                    // Synchronization point, wait for other threads
+                    if (sync->Sync(ThreadID) != SVL_SYNC_OK) {
+                        CMN_LOG_INIT_ERROR << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << source->GetName() << "\"): Sync() returned error (#1)" << std::endl;
+                        break;
+                    }
+
+                // Execute only if multi-threaded - END
+                }
+            }
 
-        if (source->PauseAtFrameID == static_cast<int>(counter)) {
             if (ThreadID == 0) {
-                // Wait until playback resumed or stream stopped
-                while (source->PlayCounter == 0 && baseref->StopThread == false) {
-                    osaSleep(0.1); // check 10 times a second
+                if (source->PlayCounter > 0) source->PlayCounter --;
+                if (source->PlayCounter == 0) {
+                    // Pause when the next frame arrives
+                    source->PauseAtFrameID = static_cast<int>(counter) + 1;
                 }
-                if (baseref->StopThread) {
-                    CMN_LOG_INIT_DEBUG << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << source->GetName() << "\"): stream stopped while paused" << std::endl;
-                    break;
+            }
+
+        ////////////////////////////////////
+        // Starting from the stream source
+
+            {
+                osaTraceScope trace("filter", source->GetName());
+                status = source->Process(&info, outputsample);
+            }
+            if (status == SVL_STOP_REQUEST) {
+                CMN_LOG_INIT_DEBUG << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << source->GetName() << "\"): SVL_STOP_REQUEST received" << std::endl;
+                break;
+            }
+            else if (status < 0) {
+                CMN_LOG_INIT_ERROR << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << source->GetName() << "\"): svlFilterSourceBase::Process() returned error (" << status << ")" << std::endl;
+                break;
+            }
+
+            if (ThreadID == 0) {
+            // Execute only on one thread - BEGIN
+
+                if (outputsample && (source->AutoTimestamp || outputsample->GetTimestamp() < 0.0)) {
+                    // Get fresh timestamp and assign it to the output sample
+                    outputsample->SetTimestamp(GetAbsoluteTime(timeserver));
                 }
+
+            // Execute only on one thread - END
             }
 
             if (ThreadCount > 1) {
@@ -105,92 +175,93 @@ void* svlStreamProc::Proc(svlStreamManager* baseref)
 
                 // Synchronization point, wait for other threads
                 if (sync->Sync(ThreadID) != SVL_SYNC_OK) {
-                    CMN_LOG_INIT_ERROR << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << source->GetName() << "\"): Sync() returned error (#1)" << std::endl;
+                    CMN_LOG_INIT_ERROR << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << source->GetName() << "\"): Sync() returned error (#2)" << std::endl;
                     break;
                 }
 
             // Execute only if multi-threaded - END
             }
-        }
 
-        if (ThreadID == 0) {
-            if (source->PlayCounter > 0) source->PlayCounter --;
-            if (source->PlayCounter == 0) {
-                // Pause when the next frame arrives
-                source->PauseAtFrameID = static_cast<int>(counter) + 1;
-            }
-        }
+            // Enabled/Disabled flag to be ignored in case of
+            // source filters. Use Pause and Play instead.
 
-    ////////////////////////////////////
-    // Starting from the stream source
-
-        status = source->Process(&info, outputsample);
-        if (status == SVL_STOP_REQUEST) {
-            CMN_LOG_INIT_DEBUG << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << source->GetName() << "\"): SVL_STOP_REQUEST received" << std::endl;
-            break;
-        }
-        else if (status < 0) {
-            CMN_LOG_INIT_ERROR << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << source->GetName() << "\"): svlFilterSourceBase::Process() returned error (" << status << ")" << std::endl;
-            break;
-        }
+            // Check for errors and stop request
+            if (baseref->StopThread) {
+                CMN_LOG_INIT_DEBUG << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << source->GetName() << "\"): StopThread flag is true (#1)" << std::endl;
+                break;
+            }
+            else if (baseref->StreamStatus != SVL_OK) {
+                CMN_LOG_INIT_ERROR << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << source->GetName() << "\"): StreamStatus signals error (" << baseref->StreamStatus << ") (#1)" << std::endl;
+                break;
+            }
 
-        if (ThreadID == 0) {
-        // Execute only on one thread - BEGIN
+            prevfilter = source;
 
-            if (outputsample && (source->AutoTimestamp || outputsample->GetTimestamp() < 0.0)) {
-                // Get fresh timestamp and assign it to the output sample
-                outputsample->SetTimestamp(GetAbsoluteTime(timeserver));
+            // Get next filter in the chain
+            output = source->GetOutput();
+            filter = 0;
+            // Check if trunk output exists
+            if (output) {
+                input = output->Connection;
+                // Check if trunk output is connected
+                if (input) {
+                    // If connected input is trunk
+                    if (input->Trunk) filter = input->Filter;
+                    // If connected input is not trunk
+                    else if (ThreadID == 0 && outputsample) input->Buffer->Push(outputsample);
+                    // Store timestamps on both the filter input and the filter output
+                    if (outputsample) {
+                        timestamp = outputsample->GetTimestamp();
+                        output->Timestamp = timestamp;
+                        input->Timestamp = timestamp;
+                    }
+                }
             }
 
-        // Execute only on one thread - END
+            // The next pipeline stage continues on its own threads
+            if (filter && filter == stageend) {
+                filter = 0;
+                handoff = true;
+            }
         }
+        else {
 
-        if (ThreadCount > 1) {
-        // Execute only if multi-threaded - BEGIN
+        ////////////////////////////////////////////
+        // Receiving frames from the previous stage
 
-            // Synchronization point, wait for other threads
-            if (sync->Sync(ThreadID) != SVL_SYNC_OK) {
-                CMN_LOG_INIT_ERROR << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << source->GetName() << "\"): Sync() returned error (#2)" << std::endl;
-                break;
+            if (ThreadID == 0) {
+                stage.Input = 0;
+                while (baseref->StopThread == false) {
+                    baseref->StageCS->Enter();
+                        finished = stage.UpstreamFinished;
+                    baseref->StageCS->Leave();
+                    time = osaGetTime();
+                    stage.Input = stage.Queue->Pull(0.1);
+                    waittime += osaGetTime() - time;
+                    if (stage.Input || finished) break;
+                }
             }
 
-        // Execute only if multi-threaded - END
-        }
+            if (ThreadCount > 1) {
+            // Execute only if multi-threaded - BEGIN
 
-        // Enabled/Disabled flag to be ignored in case of
-        // source filters. Use Pause and Play instead.
+                // Synchronization point, wait for other threads
+                if (sync->Sync(ThreadID) != SVL_SYNC_OK) {
+                    CMN_LOG_INIT_ERROR << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Stage=" << Stage << "): Sync() returned error (#5)" << std::endl;
+                    break;
+                }
 
-        // Check for errors and stop request
-        if (baseref->StopThread) {
-            CMN_LOG_INIT_DEBUG << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << source->GetName() << "\"): StopThread flag is true (#1)" << std::endl;
-            break;
-        }
-        else if (baseref->StreamStatus != SVL_OK) {
-            CMN_LOG_INIT_ERROR << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << source->GetName() << "\"): StreamStatus signals error (" << baseref->StreamStatus << ") (#1)" << std::endl;
-            break;
-        }
+            // Execute only if multi-threaded - END
+            }
 
-        prevfilter = source;
-
-        // Get next filter in the chain
-        output = source->GetOutput();
-        filter = 0;
-        // Check if trunk output exists
-        if (output) {
-            input = output->Connection;
-            // Check if trunk output is connected
-            if (input) {
-                // If connected input is trunk
-                if (input->Trunk) filter = input->Filter;
-                // If connected input is not trunk
-                else if (ThreadID == 0 && outputsample) input->Buffer->Push(outputsample);
-                // Store timestamps on both the filter input and the filter output
-                if (outputsample) {
-                    timestamp = outputsample->GetTimestamp();
-                    output->Timestamp = timestamp;
-                    input->Timestamp = timestamp;
-                }
+            if (stage.Input == 0) {
+                CMN_LOG_INIT_DEBUG << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Stage=" << Stage << "): no more frames from the previous stage" << std::endl;
+                status = SVL_STOP_REQUEST;
+                break;
             }
+
+            filter = stage.Filter;
+            outputsample = stage.Input;
         }
 
     ////////////////////////////////////////////
@@ -209,7 +280,21 @@ void* svlStreamProc::Proc(svlStreamManager* baseref)
                 break;
             }
 
-            status = filter->Process(&info, inputsample, outputsample);
+            // Filters that may modify their input get a private copy of frames
+            // that are shared with stream branches
+            if (!filter->ReadOnlyInput && pool->Owns(inputsample)) {
+                if (ThreadID == 0) filter->ProcessInput = filter->GetPrivateInput(inputsample);
+                if (ThreadCount > 1 && sync->Sync(ThreadID) != SVL_SYNC_OK) {
+                    CMN_LOG_INIT_ERROR << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << filter->GetName() << "\"): Sync() returned error (#4)" << std::endl;
+                    break;
+                }
+                inputsample = filter->ProcessInput;
+            }
+
+            {
+                osaTraceScope trace("filter", filter->GetName());
+                status = filter->Process(&info, inputsample, outputsample);
+            }
             if (status < 0) {
                 CMN_LOG_INIT_ERROR << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Filter=\"" << filter->GetName() << "\"): svlFilterBase::Process() returned error (" << status << ")" << std::endl;
                 break;
@@ -271,9 +356,54 @@ void* svlStreamProc::Proc(svlStreamManager* baseref)
                     }
                 }
             }
+
+            // The next pipeline stage continues on its own threads
+            if (filter && filter == stageend) {
+                filter = 0;
+                handoff = true;
+            }
         }
         if (status < 0) break;
 
+    ////////////////////////////////////////////
+    // Passing the frame to the next stage
+
+        if (handoff) {
+            if (ThreadID == 0 && outputsample) {
+                // Back pressure: wait while the next stage is busy
+                time = osaGetTime();
+                while (nextstage->Queue->WaitForSpace(0.1) == false && baseref->StopThread == false);
+                waittime += osaGetTime() - time;
+                nextstage->Queue->Push(outputsample);
+            }
+
+            if (ThreadCount > 1) {
+            // Execute only if multi-threaded - BEGIN
+
+                // Synchronization point, wait for other threads
+                if (sync->Sync(ThreadID) != SVL_SYNC_OK) {
+                    CMN_LOG_INIT_ERROR << "svlStreamProc::Proc (ThreadID=" << ThreadID << ", Stage=" << Stage << "): Sync() returned error (#6)" << std::endl;
+                    break;
+                }
+
+            // Execute only if multi-threaded - END
+            }
+        }
+
+        if (ThreadID == 0) {
+            time = osaGetTime();
+            baseref->StageCS->Enter();
+                stage.FrameCount ++;
+                stage.WaitTime += waittime;
+                stage.ProcTime += time - starttime - waittime;
+            baseref->StageCS->Leave();
+        }
+
+        // Branch streams report their copies to the parent stream
+        if (ThreadID == 0 && timeserver && !baseref->ParentStream) {
+            pool->UpdateCopyRate(timeserver->GetRelativeTime());
+        }
+
         // incrementing frame counter
         counter ++;
     }
@@ -287,11 +417,27 @@ void* svlStreamProc::Proc(svlStreamManager* baseref)
     // Execute only on one thread - END
     }
 
-    // Signal the error status
-    if (baseref->StopThread == false) {
-        // Internal shutdown
-        baseref->StreamStatus = status;
-    }
+    // Signal the error status; the stages before the last one stop without
+    // an error only after passing all of their frames to the next stage.
+    // Only one stage can stop the stream and an error already signaled by
+    // another stage is never replaced.
+    bool internalstop = false;
+    baseref->StageCS->Enter();
+        if (baseref->StopThread == false && baseref->InternalStopping == false) {
+            if (nextstage == 0 || status < 0) {
+                // Internal shutdown
+                if (baseref->StreamStatus >= 0) baseref->StreamStatus = status;
+                if (ThreadID == 0) {
+                    baseref->InternalStopping = true;
+                    internalstop = true;
+                }
+            }
+            else if (ThreadID == 0) nextstage->UpstreamFinished = true;
+        }
+        else if (baseref->InternalStopping && status < 0 && baseref->StreamStatus >= 0) {
+            baseref->StreamStatus = status;
+        }
+    baseref->StageCS->Leave();
 
     if (ThreadCount > 1) {
     // Execute only if multi-threaded - BEGIN
@@ -302,9 +448,7 @@ void* svlStreamProc::Proc(svlStreamManager* baseref)
     }
 
     // Run InternalStop() method in case of internal shutdown
-    if (baseref->StopThread == false && ThreadID == 0) {
-        baseref->InternalStop(ThreadID);
-    }
+    if (internalstop) baseref->InternalStop(stage.FirstThread + ThreadID);
 
     return this;
 }
@@ -0,0 +1,190 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+/*
+  Throughput of the svlConverter color conversions in megapixels per
+  second, for each instruction set supported by the processor.  The
+  output of the SIMD kernels is compared to the scalar output.
+*/
+
+#include <cisstCommon/cmnCommandLineOptions.h>
+#include <cisstStereoVision/svlConverters.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef void (*ConversionType)(unsigned char* input, unsigned char* output, const unsigned int pixelcount);
+
+void RGB24toGray8(unsigned char* input, unsigned char* output, const unsigned int pixelcount)
+{
+    svlConverter::RGB24toGray8(input, output, pixelcount, false, false);
+}
+
+void RGB24toGray8Accurate(unsigned char* input, unsigned char* output, const unsigned int pixelcount)
+{
+    svlConverter::RGB24toGray8(input, output, pixelcount, true, false);
+}
+
+void BGR24toGray8Accurate(unsigned char* input, unsigned char* output, const unsigned int pixelcount)
+{
+    svlConverter::RGB24toGray8(input, output, pixelcount, true, true);
+}
+
+void RGBA32toGray8Accurate(unsigned char* input, unsigned char* output, const unsigned int pixelcount)
+{
+    svlConverter::RGBA32toGray8(input, output, pixelcount, true, false);
+}
+
+void Gray16toGray8(unsigned char* input, unsigned char* output, const unsigned int pixelcount)
+{
+    svlConverter::Gray16toGray8(reinterpret_cast<unsigned short*>(input), output, pixelcount, 4);
+}
+
+void RGB24toRGBA32(unsigned char* input, unsigned char* output, const unsigned int pixelcount)
+{
+    svlConverter::RGB24toRGBA32(input, output, pixelcount);
+}
+
+void RGBA32toRGB24(unsigned char* input, unsigned char* output, const unsigned int pixelcount)
+{
+    svlConverter::RGBA32toRGB24(input, output, pixelcount);
+}
+
+void RGB24toYUV422(unsigned char* input, unsigned char* output, const unsigned int pixelcount)
+{
+    svlConverter::RGB24toYUV422(input, output, pixelcount);
+}
+
+void BGR24toYUV422(unsigned char* input, unsigned char* output, const unsigned int pixelcount)
+{
+    svlConverter::BGR24toYUV422(input, output, pixelcount);
+}
+
+void RGB24toHSV24(unsigned char* input, unsigned char* output, const unsigned int pixelcount)
+{
+    svlConverter::RGB24toHSV24(input, output, pixelcount);
+}
+
+struct Conversion {
+    std::string Name;
+    ConversionType Function;
+    unsigned int OutputBytesPerPixel;
+};
+
+const char * InstructionSetName(const svlConverter::InstructionSet instructionset)
+{
+    switch (instructionset) {
+        case svlConverter::INSTRUCTIONS_AVX2:  return "AVX2";
+        case svlConverter::INSTRUCTIONS_SSE41: return "SSE4.1";
+        default:                               return "scalar";
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    int width = 1920;
+    int height = 1080;
+    int iterations = 50;
+
+    cmnCommandLineOptions options;
+    options.AddOptionOneValue("x", "width", "image width (default 1920)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &width);
+    options.AddOptionOneValue("y", "height", "image height (default 1080)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &height);
+    options.AddOptionOneValue("n", "iterations", "number of conversions per measurement (default 50)",
+                              cmnCommandLineOptions::OPTIONAL_OPTION, &iterations);
+    if (!options.Parse(argc, argv, std::cerr)) {
+        return -1;
+    }
+    if ((width <= 0) || (height <= 0) || (iterations <= 0)) {
+        std::cerr << "width, height and iterations must be greater than 0" << std::endl;
+        return -1;
+    }
+
+    const unsigned int pixelcount = static_cast<unsigned int>(width * height);
+    std::vector<unsigned char> input(pixelcount * 4);
+    std::srand(1);
+    for (size_t i = 0; i < input.size(); i ++) input[i] = static_cast<unsigned char>(std::rand() & 0xFF);
+    std::vector<unsigned char> reference(pixelcount * 4), output(pixelcount * 4);
+
+    const Conversion conversions[] = {
+        {"RGB24toGray8",            RGB24toGray8,          1},
+        {"RGB24toGray8 (accurate)", RGB24toGray8Accurate,  1},
+        {"BGR24toGray8 (accurate)", BGR24toGray8Accurate,  1},
+        {"RGBA32toGray8 (accurate)", RGBA32toGray8Accurate, 1},
+        {"Gray16toGray8",           Gray16toGray8,         1},
+        {"RGB24toRGBA32",           RGB24toRGBA32,         4},
+        {"RGBA32toRGB24",           RGBA32toRGB24,         3},
+        {"RGB24toYUV422",           RGB24toYUV422,         2},
+        {"BGR24toYUV422",           BGR24toYUV422,         2},
+        {"RGB24toHSV24",            RGB24toHSV24,          3}
+    };
+    const size_t numberOfConversions = sizeof(conversions) / sizeof(conversions[0]);
+
+    const svlConverter::InstructionSet supported = svlConverter::GetSupportedInstructionSet();
+    std::cout << "Image " << width << "x" << height << ", supported instruction set: "
+              << InstructionSetName(supported) << std::endl
+              << "Throughput in megapixels/second" << std::endl;
+
+    int errors = 0;
+    for (size_t c = 0; c < numberOfConversions; c ++) {
+        const Conversion & conversion = conversions[c];
+        const size_t outputBytes = static_cast<size_t>(pixelcount) * conversion.OutputBytesPerPixel;
+        std::cout << std::setw(26) << std::left << conversion.Name << std::right;
+        for (int set = svlConverter::INSTRUCTIONS_SCALAR; set <= supported; set ++) {
+            svlConverter::SetInstructionSet(static_cast<svlConverter::InstructionSet>(set));
+            std::memset(output.data(), 0, output.size());
+            conversion.Function(input.data(), output.data(), pixelcount);
+            bool exact = true;
+            if (set == svlConverter::INSTRUCTIONS_SCALAR) {
+                reference = output;
+            }
+            else {
+                exact = (std::memcmp(reference.data(), output.data(), outputBytes) == 0);
+            }
+
+            const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i ++) {
+                conversion.Function(input.data(), output.data(), pixelcount);
+            }
+            const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            std::cout << "  " << InstructionSetName(static_cast<svlConverter::InstructionSet>(set)) << ": "
+                      << std::fixed << std::setprecision(1) << std::setw(8)
+                      << (static_cast<double>(pixelcount) * iterations) / elapsed * 1.0e-6;
+            if (!exact) {
+                std::cout << " (MISMATCH)";
+                errors ++;
+            }
+        }
+        std::cout << std::endl;
+    }
+    svlConverter::SetInstructionSet(supported);
+
+    if (errors) {
+        std::cout << errors << " SIMD conversion(s) differ from the scalar code" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -33,6 +33,9 @@ http://www.cisst.org/cisst/license.txt.
 // Always include last!
 #include <cisstStereoVision/svlExport.h>
 
+// Forward declarations
+class svlSamplePool;
+
 
 class CISST_EXPORT svlBufferSample
 {
@@ -44,6 +47,10 @@ public:
 
     svlStreamType GetType() const;
 
+    // With a pool, samples that belong to the pool are buffered by reference
+    // instead of being copied.  Setting another pool releases the buffered
+    // references.  Must not be called while samples are pushed.
+    void SetPool(svlSamplePool* pool);
     int Push(const svlSample* sample);
     svlSample* GetPushBuffer();
     void Push();
@@ -60,6 +67,10 @@ private:
 #endif
     osaThreadSignal NewSampleEvent;
     svlSample* Buffer[3];
+    svlSample* OwnedItems[3];
+    svlSamplePool* Pool;
+
+    svlSample* ReleaseShared(unsigned int index);
 
 #if (CISST_OS == CISST_LINUX_RTAI) || (CISST_OS == CISST_LINUX) || (CISST_OS == CISST_DARWIN) || (CISST_OS == CISST_SOLARIS)
     osaCriticalSection CS;
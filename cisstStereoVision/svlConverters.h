@@ -30,6 +30,22 @@ http://www.cisst.org/cisst/license.txt.
 
 namespace svlConverter
 {
+    // Instruction sets used by the color conversions, SIMD kernels
+    // produce the same results as the scalar code
+    enum InstructionSet {
+        INSTRUCTIONS_SCALAR = 0,
+        INSTRUCTIONS_SSE41,
+        INSTRUCTIONS_AVX2
+    };
+
+    // Best instruction set supported by the processor, detected at runtime
+    CISST_EXPORT InstructionSet GetSupportedInstructionSet(void);
+    // Instruction set currently used, the supported one by default
+    CISST_EXPORT InstructionSet GetInstructionSet(void);
+    // Select the instruction set, limited to the supported one; returns the one selected.
+    // Not thread safe, meant to be called before streams are started.
+    CISST_EXPORT InstructionSet SetInstructionSet(const InstructionSet instructionset);
+
     CISST_EXPORT int ConvertSample(const svlSample* inimage, svlSample* outimage,
                                    unsigned int threads = 1, unsigned int threadid = 0);
     CISST_EXPORT int ConvertImage(const svlSampleImage* inimage, svlSampleImage* outimage,
@@ -85,6 +85,19 @@ protected:
     int  IsDataValid(svlStreamType type, svlSample* data);
     bool IsNewSample(svlSample* sample);
 
+    // Samples from the sample pool of the stream can be passed to stream
+    // branches without copying.  Before writing into an acquired sample,
+    // GetWritableSample has to be called on a single thread; it replaces
+    // the sample if a stream branch still holds a reference to it.
+    svlSamplePool* GetSamplePool(void) const;
+    svlSample* AcquireSample(svlStreamType type);
+    svlSample* GetWritableSample(svlSample* sample);
+    void ReleaseSample(svlSample* sample);
+
+    // Filters that never modify their input sample receive the frames
+    // shared with stream branches, other filters receive a private copy
+    void SetReadOnlyInput(bool readonly);
+
 private:
     bool   Enabled;
     bool   EnabledInternal;
@@ -92,6 +105,13 @@ private:
     bool   Running;
     bool   AutoType;
     double PrevInputTimestamp;
+
+    svlSamplePool* SamplePool;
+    bool ReadOnlyInput;
+    svlSample* InputCopy;
+    svlSample* ProcessInput;
+
+    svlSample* GetPrivateInput(svlSample* sample);
 };
 
 CMN_DECLARE_SERVICES_INSTANTIATION(svlFilterBase)
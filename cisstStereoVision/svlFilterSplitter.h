@@ -45,9 +45,11 @@ protected:
     virtual int OnConnectInput(svlFilterInput &input, svlStreamType type);
     virtual int Initialize(svlSample* syncInput, svlSample* &syncOutput);
     virtual int Process(svlProcInfo* procInfo, svlSample* syncInput, svlSample* &syncOutput);
+    virtual int Release();
 
 private:
     vctDynamicVector<svlFilterOutput*> AsyncOutputs;
+    svlSample* SharedCopy;
 
 protected:
     virtual void CreateInterfaces();
@@ -32,6 +32,7 @@ class svlFilterOutput;
 class svlStreamManager;
 class svlStreamProc;
 class svlStreamBranchSource;
+class svlSamplePool;
 
 class svlFilterImageOverlay;
 
@@ -31,6 +31,7 @@ http://www.cisst.org/cisst/license.txt.
 
 // Forward declarations
 class svlImageProcessingInternals;
+struct svlProcInfo;
 
 
 namespace svlImageProcessing
@@ -58,20 +59,32 @@ namespace svlImageProcessing
     };
 
 
+    // When procInfo is specified, all the threads of the stream have to
+    // call Convolution with the same parameters and each thread processes
+    // a band of rows.  Kernels that can't be split are processed by one
+    // thread per video channel, as with _ParallelInterleavedLoop.
+    // Separable kernels, including rank-1 matrices, are applied in two
+    // passes; without absres, the separable vectors are combined without
+    // rounding the intermediate results to pixels.  For rank-1 matrices,
+    // the fixed point kernels are rounded per vector instead of per
+    // matrix element so the result can differ from the 2D convolution
+    // by up to one gray level.
     int CISST_EXPORT Convolution(svlSampleImage* src_img,
                                  unsigned int src_videoch,
                                  svlSampleImage* dst_img,
                                  unsigned int dst_videoch,
                                  vctDynamicVector<double> kernel_horiz,
                                  vctDynamicVector<double> kernel_vert,
-                                 bool absres = false);
+                                 bool absres = false,
+                                 svlProcInfo* procInfo = 0);
 
     int CISST_EXPORT Convolution(svlSampleImage* src_img,
                                  unsigned int src_videoch,
                                  svlSampleImage* dst_img,
                                  unsigned int dst_videoch,
                                  vctDynamicMatrix<double> kernel,
-                                 bool absres = false);
+                                 bool absres = false,
+                                 svlProcInfo* procInfo = 0);
 
     int CISST_EXPORT UnsharpMask(const svlSampleImage* src_img,
                                  unsigned int src_videoch,
@@ -101,6 +114,20 @@ namespace svlImageProcessing
                             bool interpolation,
                             vctDynamicVector<unsigned char>& internals);
 
+    // Resampling engine for RGB, RGBA, Mono8 and Mono16 images, the weight
+    // tables are kept in internals.  With interpolation, downscaling
+    // averages the source pixels covered by each output pixel and upscaling
+    // is bilinear.  When procInfo is specified, all the threads of the
+    // stream have to call Resize with the same parameters and each thread
+    // processes a band of rows.
+    int CISST_EXPORT Resize(svlSampleImage* src_img,
+                            unsigned int src_videoch,
+                            svlSampleImage* dst_img,
+                            unsigned int dst_videoch,
+                            bool interpolation,
+                            Internals& internals,
+                            svlProcInfo* procInfo = 0);
+
     int CISST_EXPORT Deinterlace(svlSampleImage* image,
                                  unsigned int videoch,
                                  DI_Algorithm algorithm);
@@ -0,0 +1,86 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-    */
+/* ex: set filetype=cpp softtabstop=4 shiftwidth=4 tabstop=4 cindent expandtab: */
+
+/*
+
+  Author(s):  cisst developers
+  Created on: 2026-10-17
+
+  (C) Copyright 2026 Johns Hopkins University (JHU), All Rights Reserved.
+
+--- begin cisst license - do not edit ---
+
+This software is provided "as is" under an open source license, with
+no warranty.  The complete license can be found in license.txt and
+http://www.cisst.org/cisst/license.txt.
+
+--- end cisst license ---
+
+*/
+
+#ifndef _svlSamplePool_h
+#define _svlSamplePool_h
+
+#include <cisstOSAbstraction/osaCriticalSection.h>
+#include <cisstStereoVision/svlTypes.h>
+
+#include <map>
+
+// Always include last!
+#include <cisstStereoVision/svlExport.h>
+
+
+// Reference counted samples owned by a stream and shared by its filters
+// and stream branches.  A sample returns to the pool when its last
+// reference is released and is reused by the next Acquire call, so frames
+// can be passed to stream branches without copying them.  The pool also
+// counts the frames copied by the stream.
+class CISST_EXPORT svlSamplePool
+{
+public:
+    svlSamplePool();
+    ~svlSamplePool();
+
+    // Returns an unreferenced sample, the caller holds the only reference.
+    // With a prototype, the sample has the same type and size.
+    svlSample* Acquire(svlStreamType type);
+    svlSample* Acquire(const svlSample* prototype);
+    // Return false if the sample doesn't belong to the pool
+    bool AddReference(const svlSample* sample);
+    bool Release(const svlSample* sample);
+    // Returns the sample if the caller holds the only reference, otherwise
+    // releases the caller's reference and returns an unreferenced sample of
+    // the same type and size
+    svlSample* GetWritable(svlSample* sample);
+
+    bool Owns(const svlSample* sample);
+    bool IsShared(const svlSample* sample);
+
+    void AddCopy(const svlSample* sample);
+    // Called once per frame, the copy rate is updated every second
+    void UpdateCopyRate(double time);
+
+    unsigned int GetSampleCount();
+    unsigned long long GetCopyCount();
+    unsigned long long GetCopiedBytes();
+    unsigned long long GetShareCount();
+    double GetCopyRate();
+
+private:
+    svlSamplePool(const svlSamplePool & other);
+    svlSamplePool & operator= (const svlSamplePool & other);
+
+    typedef std::map<const svlSample*, unsigned int> ReferenceMapType;
+    ReferenceMapType References;
+
+    unsigned long long CopyCount;
+    unsigned long long CopiedBytes;
+    unsigned long long ShareCount;
+    unsigned long long RateCopyCount;
+    double RateTime;
+    double CopyRate;
+
+    osaCriticalSection CS;
+};
+
+#endif // _svlSamplePool_h
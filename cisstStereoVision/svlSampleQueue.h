@@ -29,6 +29,9 @@ http://www.cisst.org/cisst/license.txt.
 // Always include last!
 #include <cisstStereoVision/svlExport.h>
 
+// Forward declarations
+class svlSamplePool;
+
 
 class CISST_EXPORT svlSampleQueue
 {
@@ -36,8 +39,14 @@ public:
     svlSampleQueue(svlStreamType type, unsigned int size);
     ~svlSampleQueue();
 
+    // With a pool, samples that belong to the pool are queued by reference
+    // instead of being copied.  Setting another pool releases the queued
+    // references.
+    void SetPool(svlSamplePool* pool);
     bool Push(const svlSample* sample);
     svlSample* Pull(double timeout = 5.0);
+    // Returns false if the queue is still full after the timeout
+    bool WaitForSpace(double timeout = 5.0);
 
     svlStreamType GetType();
     unsigned int GetLength();
@@ -50,12 +59,17 @@ private:
     svlStreamType Type;
     unsigned int Size;
     unsigned int DroppedSamples;
+    std::list<svlSample*> OwnedItems;
     std::list<svlSample*> UnusedItems;
     std::list<svlSample*> BufferedItems;
     svlSample* PullItem;
+    svlSamplePool* Pool;
+
+    void DropOldest();
 
     osaCriticalSection CS;
     osaThreadSignal NewSampleEvent;
+    osaThreadSignal FreeSpaceEvent;
 };
 
 /*
@@ -26,6 +26,8 @@ http://www.cisst.org/cisst/license.txt.
 #include <cisstVector/vctDynamicVector.h>
 #include <cisstMultiTask/mtsComponent.h>
 
+#include <vector>
+
 // Always include last!
 #include <cisstStereoVision/svlExport.h>
 
@@ -37,6 +39,9 @@ class svlFilterSourceBase;
 class svlStreamProc;
 class osaThread;
 class osaCriticalSection;
+class svlSamplePool;
+class svlSampleQueue;
+class svlSample;
 
 
 class CISST_EXPORT svlStreamManager: public mtsComponent
@@ -61,6 +66,24 @@ public:
     int GetStreamStatus(void) const;
     void DisconnectAll(void);
 
+    // Stream branches use the sample pool of the stream they branch from
+    svlSamplePool* GetSamplePool(void) const;
+    unsigned long long GetFrameCopyCount(void) const;
+    double GetFrameCopyRate(void) const;
+
+    // Pipelined execution: the trunk is split into stages, each starting at
+    // the specified filter.  The stages run on their own threads on different
+    // frames and are connected by bounded sample queues; a stage waits while
+    // the queue of the next stage is full.  The stream source and the filters
+    // before the first stage run on the threads of the stream.
+    int AddPipelineStage(svlFilterBase* filter, unsigned int threadcount = 1, unsigned int queuesize = 2);
+    void RemovePipelineStages(void);
+    unsigned int GetPipelineStageCount(void) const;
+    // Average time spent processing a frame and waiting for the neighbouring
+    // stages, in seconds; also available through the "GetPipelineStageProcTime"
+    // and "GetPipelineStageWaitTime" commands (one element per stage)
+    int GetPipelineStageTiming(unsigned int stage, double & proctime, double & waittime) const;
+
     // Virtual methods from mtsComponent (these are temporary measures until 
     // ticket #67 is resolved)
     void Start(void) { Play(); }
@@ -72,20 +95,51 @@ private:
     vctDynamicVector<osaThread*> StreamProcThread;
     svlSyncPoint* SyncPoint;
     osaCriticalSection* CS;
+    svlSamplePool* SamplePool;
+    svlStreamManager* ParentStream;
+
+    struct PipelineStage {
+        PipelineStage(svlFilterBase* filter = 0, unsigned int threadcount = 1, unsigned int queuesize = 2);
+
+        svlFilterBase* Filter;
+        unsigned int ThreadCount;
+        unsigned int QueueSize;
+        unsigned int FirstThread;
+        svlSyncPoint* SyncPoint;
+        osaCriticalSection* CS;
+        svlSampleQueue* Queue;
+        svlSample* Input;
+        // Guarded by StageCS, written and read by different stages
+        bool UpstreamFinished;
+        unsigned int FrameCount;
+        double ProcTime;
+        double WaitTime;
+    };
+    std::vector<PipelineStage> PipelineStages;
+    osaCriticalSection* StageCS;
 
     svlFilterSourceBase* StreamSource;
     bool Initialized;
     bool Running;
     bool StopThread;
+    bool InternalStopping;
     int StreamStatus;
 
     void InternalStop(unsigned int callingthreadID);
+    void SetupFilterPool(svlFilterBase* filter);
+    void ReleaseFilterPool(svlFilterBase* filter);
+    int SetupPipelineStages(void);
+    void CreatePipelineStages(void);
+    void ReleasePipelineStages(void);
 
 protected:
     virtual void CreateInterfaces(void);
     virtual void PlayCommand(void);
     virtual void InitializeCommand(void);
     virtual void SetSourceFilterCommand(const mtsStdString & source);
+    virtual void GetFrameCopyRateCommand(double & rate) const;
+    virtual void GetPipelineStageProcTimeCommand(vctDoubleVec & proctime) const;
+    virtual void GetPipelineStageWaitTimeCommand(vctDoubleVec & waittime) const;
 };
 
 CMN_DECLARE_SERVICES_INSTANTIATION(svlStreamManager);
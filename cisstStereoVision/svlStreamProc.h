@@ -31,7 +31,7 @@ http://www.cisst.org/cisst/license.txt.
 class svlStreamProc
 {
 public:
-    svlStreamProc(unsigned int threadcount, unsigned int threadid);
+    svlStreamProc(unsigned int threadcount, unsigned int threadid, unsigned int stage = 0);
 
     void* Proc(svlStreamManager* baseref);
 
@@ -42,6 +42,7 @@ private:
 
     unsigned int ThreadID;
     unsigned int ThreadCount;
+    unsigned int Stage;
 };
 
 #endif // _svlStreamProc_h
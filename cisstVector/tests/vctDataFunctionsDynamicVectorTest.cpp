@@ -55,6 +55,28 @@ void vctDataFunctionsDynamicVectorTest::TestBinarySerializationStream(void)
 }
 
 
+void vctDataFunctionsDynamicVectorTest::TestBinarySerializationBuffer(void)
+{
+    cmnDataFormat local, remote;
+    typedef vctDynamicVector<double> DataType;
+    DataType v1, v2, vReference;
+    v1.SetSize(12);
+    v2.SetSize(3); // intentionally different, deserialize should resize
+    vReference.SetSize(12);
+    vctRandom(vReference, -10.0, 10.0);
+    v1 = vReference;
+    const size_t byteSize = cmnData<DataType>::SerializeBinaryByteSize(v1);
+    CPPUNIT_ASSERT_EQUAL(sizeof(size_t) + 12 * sizeof(double), byteSize);
+    std::vector<char> buffer(byteSize);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), cmnData<DataType>::SerializeBinary(v1, &(buffer[0]), byteSize - 1));
+    CPPUNIT_ASSERT_EQUAL(byteSize, cmnData<DataType>::SerializeBinary(v1, &(buffer[0]), byteSize));
+    v1.SetAll(0);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), cmnData<DataType>::DeSerializeBinary(v2, &(buffer[0]), byteSize - 1, local, remote));
+    CPPUNIT_ASSERT_EQUAL(byteSize, cmnData<DataType>::DeSerializeBinary(v2, &(buffer[0]), byteSize, local, remote));
+    CPPUNIT_ASSERT_EQUAL(vReference, v2);
+}
+
+
 void vctDataFunctionsDynamicVectorTest::TestTextSerializationStream(void)
 {
     std::stringstream stream;
@@ -28,6 +28,7 @@ class vctDataFunctionsDynamicVectorTest: public CppUnit::TestFixture
     {
         CPPUNIT_TEST(TestDataCopy);
         CPPUNIT_TEST(TestBinarySerializationStream);
+        CPPUNIT_TEST(TestBinarySerializationBuffer);
         CPPUNIT_TEST(TestTextSerializationStream);
         CPPUNIT_TEST(TestScalar);
     }
@@ -42,6 +43,7 @@ class vctDataFunctionsDynamicVectorTest: public CppUnit::TestFixture
 
     void TestDataCopy(void);
     void TestBinarySerializationStream(void);
+    void TestBinarySerializationBuffer(void);
     void TestTextSerializationStream(void);
     void TestScalar(void);
 };
@@ -65,6 +65,37 @@ public:
         cmnDataMatrixDeSerializeBinaryResize(data, inputStream, localFormat, remoteFormat);
     }
 
+    static size_t SerializeBinaryByteSize(const DataType & data)
+    {
+        return 2 * cmnData<size_t>::SerializeBinaryByteSize(data.rows())
+            + cmnDataMatrixSerializeBinaryByteSize(data);
+    }
+
+    static size_t SerializeBinary(const DataType & data, char * buffer, size_t bufferSize)
+    {
+        size_t sizeBytes = cmnData<size_t>::SerializeBinary(data.rows(), buffer, bufferSize);
+        if (sizeBytes == 0) {
+            return 0;
+        }
+        const size_t colsBytes = cmnData<size_t>::SerializeBinary(data.cols(), buffer + sizeBytes, bufferSize - sizeBytes);
+        if (colsBytes == 0) {
+            return 0;
+        }
+        sizeBytes += colsBytes;
+        const size_t dataBytes = cmnDataMatrixSerializeBinary(data, buffer + sizeBytes, bufferSize - sizeBytes);
+        if ((dataBytes == 0) && (data.size() != 0)) {
+            return 0;
+        }
+        return sizeBytes + dataBytes;
+    }
+
+    static size_t DeSerializeBinary(DataType & data, const char * buffer, size_t bufferSize,
+                                    const cmnDataFormat & localFormat,
+                                    const cmnDataFormat & remoteFormat)
+    {
+        return cmnDataMatrixDeSerializeBinaryResize(data, buffer, bufferSize, localFormat, remoteFormat);
+    }
+
     static void SerializeText(const DataType & data, std::ostream & outputStream, const char delimiter = ',')
         CISST_THROW(std::runtime_error)
     {
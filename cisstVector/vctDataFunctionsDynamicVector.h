@@ -66,6 +66,32 @@ public:
         cmnDataVectorDeSerializeBinaryResize(data, inputStream, localFormat, remoteFormat);
     }
 
+    static size_t SerializeBinaryByteSize(const DataType & data)
+    {
+        return cmnData<size_t>::SerializeBinaryByteSize(data.size())
+            + cmnDataVectorSerializeBinaryByteSize(data);
+    }
+
+    static size_t SerializeBinary(const DataType & data, char * buffer, size_t bufferSize)
+    {
+        const size_t sizeBytes = cmnData<size_t>::SerializeBinary(data.size(), buffer, bufferSize);
+        if (sizeBytes == 0) {
+            return 0;
+        }
+        const size_t dataBytes = cmnDataVectorSerializeBinary(data, buffer + sizeBytes, bufferSize - sizeBytes);
+        if ((dataBytes == 0) && (data.size() != 0)) {
+            return 0;
+        }
+        return sizeBytes + dataBytes;
+    }
+
+    static size_t DeSerializeBinary(DataType & data, const char * buffer, size_t bufferSize,
+                                    const cmnDataFormat & localFormat,
+                                    const cmnDataFormat & remoteFormat)
+    {
+        return cmnDataVectorDeSerializeBinaryResize(data, buffer, bufferSize, localFormat, remoteFormat);
+    }
+
     static void SerializeText(const DataType & data,
                               std::ostream & outputStream,
                               const char delimiter = ',')
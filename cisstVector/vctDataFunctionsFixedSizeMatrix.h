@@ -62,6 +62,23 @@ public:
         cmnDataMatrixDeSerializeBinary(data, inputStream, localFormat, remoteFormat);
     }
 
+    static size_t SerializeBinaryByteSize(const DataType & data)
+    {
+        return cmnDataMatrixSerializeBinaryByteSize(data);
+    }
+
+    static size_t SerializeBinary(const DataType & data, char * buffer, size_t bufferSize)
+    {
+        return cmnDataMatrixSerializeBinary(data, buffer, bufferSize);
+    }
+
+    static size_t DeSerializeBinary(DataType & data, const char * buffer, size_t bufferSize,
+                                    const cmnDataFormat & localFormat,
+                                    const cmnDataFormat & remoteFormat)
+    {
+        return cmnDataMatrixDeSerializeBinary(data, buffer, bufferSize, localFormat, remoteFormat);
+    }
+
     static void SerializeText(const DataType & data,
                               std::ostream & outputStream,
                               const char delimiter = ',')
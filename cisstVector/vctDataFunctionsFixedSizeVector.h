@@ -61,6 +61,23 @@ public:
         cmnDataVectorDeSerializeBinary(data, inputStream, localFormat, remoteFormat);
     }
 
+    static size_t SerializeBinaryByteSize(const DataType & data)
+    {
+        return cmnDataVectorSerializeBinaryByteSize(data);
+    }
+
+    static size_t SerializeBinary(const DataType & data, char * buffer, size_t bufferSize)
+    {
+        return cmnDataVectorSerializeBinary(data, buffer, bufferSize);
+    }
+
+    static size_t DeSerializeBinary(DataType & data, const char * buffer, size_t bufferSize,
+                                    const cmnDataFormat & localFormat,
+                                    const cmnDataFormat & remoteFormat)
+    {
+        return cmnDataVectorDeSerializeBinary(data, buffer, bufferSize, localFormat, remoteFormat);
+    }
+
     static void SerializeText(const DataType & data, std::ostream & outputStream,
                               const char delimiter = ',')
         CISST_THROW(std::runtime_error)
@@ -59,6 +59,43 @@ public:
         cmnData<RotationType>::DeSerializeBinary(data.Rotation(), inputStream, localFormat, remoteFormat);
     }
 
+    static size_t SerializeBinaryByteSize(const DataType & data)
+    {
+        return cmnData<TranslationType>::SerializeBinaryByteSize(data.Translation())
+            + cmnData<RotationType>::SerializeBinaryByteSize(data.Rotation());
+    }
+
+    static size_t SerializeBinary(const DataType & data, char * buffer, size_t bufferSize)
+    {
+        const size_t translationBytes = cmnData<TranslationType>::SerializeBinary(data.Translation(), buffer, bufferSize);
+        if (translationBytes == 0) {
+            return 0;
+        }
+        const size_t rotationBytes = cmnData<RotationType>::SerializeBinary(data.Rotation(), buffer + translationBytes,
+                                                                            bufferSize - translationBytes);
+        if (rotationBytes == 0) {
+            return 0;
+        }
+        return translationBytes + rotationBytes;
+    }
+
+    static size_t DeSerializeBinary(DataType & data, const char * buffer, size_t bufferSize,
+                                    const cmnDataFormat & localFormat, const cmnDataFormat & remoteFormat)
+    {
+        const size_t translationBytes = cmnData<TranslationType>::DeSerializeBinary(data.Translation(), buffer, bufferSize,
+                                                                                    localFormat, remoteFormat);
+        if (translationBytes == 0) {
+            return 0;
+        }
+        const size_t rotationBytes = cmnData<RotationType>::DeSerializeBinary(data.Rotation(), buffer + translationBytes,
+                                                                              bufferSize - translationBytes,
+                                                                              localFormat, remoteFormat);
+        if (rotationBytes == 0) {
+            return 0;
+        }
+        return translationBytes + rotationBytes;
+    }
+
     static void SerializeText(const DataType & data, std::ostream & outputStream,
                               const char delimiter = ',')
         CISST_THROW(std::runtime_error)
@@ -155,6 +192,22 @@ public:
         cmnData<ContainerType>::DeSerializeBinary(data, inputStream, localFormat, remoteFormat);
     }
 
+    static size_t SerializeBinaryByteSize(const DataType & data)
+    {
+        return cmnData<ContainerType>::SerializeBinaryByteSize(data);
+    }
+
+    static size_t SerializeBinary(const DataType & data, char * buffer, size_t bufferSize)
+    {
+        return cmnData<ContainerType>::SerializeBinary(data, buffer, bufferSize);
+    }
+
+    static size_t DeSerializeBinary(DataType & data, const char * buffer, size_t bufferSize,
+                                    const cmnDataFormat & localFormat, const cmnDataFormat & remoteFormat)
+    {
+        return cmnData<ContainerType>::DeSerializeBinary(data, buffer, bufferSize, localFormat, remoteFormat);
+    }
+
     static void SerializeText(const DataType & data, std::ostream & outputStream,
                               const char delimiter = ',')
         CISST_THROW(std::runtime_error)
@@ -232,6 +285,22 @@ public:
         cmnData<ContainerType>::DeSerializeBinary(data, inputStream, localFormat, remoteFormat);
     }
 
+    static size_t SerializeBinaryByteSize(const DataType & data)
+    {
+        return cmnData<ContainerType>::SerializeBinaryByteSize(data);
+    }
+
+    static size_t SerializeBinary(const DataType & data, char * buffer, size_t bufferSize)
+    {
+        return cmnData<ContainerType>::SerializeBinary(data, buffer, bufferSize);
+    }
+
+    static size_t DeSerializeBinary(DataType & data, const char * buffer, size_t bufferSize,
+                                    const cmnDataFormat & localFormat, const cmnDataFormat & remoteFormat)
+    {
+        return cmnData<ContainerType>::DeSerializeBinary(data, buffer, bufferSize, localFormat, remoteFormat);
+    }
+
     static void SerializeText(const DataType & data, std::ostream & outputStream,
                               const char delimiter = ',')
         CISST_THROW(std::runtime_error)